@@ -0,0 +1,726 @@
+#ifndef MYSTL_ALGORITHMS__DETAILS_FIND_KERNELS_HPP
+#define MYSTL_ALGORITHMS__DETAILS_FIND_KERNELS_HPP
+
+// 非修改算法（find / count / mismatch / adjacent_find / min_element 等）的比较内核：
+// SSE2 / AVX2 向量版本与标量版本（hidden in __details）
+//
+// - find_eq(p, n, v)：第一个等于 v 的下标，没有则返回 n
+// - find_eq_pair(p, n, off, v0, v1)：第一个 p[i] == v0 且 p[i + off] == v1 的下标 i < n，没有则返回 n；
+//   search 用模式的首尾元素同时过滤候选位置，要求 p + n + off 之前可读
+// - count_eq(p, n, v)：等于 v 的元素个数；相等掩码按元素宽度的通道累加，通道计数将溢出前汇总
+// - find_cmp<Equal>(a, b, n)：第一个 (a[i] == b[i]) == Equal 的下标，没有则返回 n；
+//   Equal 为假即 mismatch，为真且 b = a + 1 即 adjacent_find
+// - reduce_extreme<Max>(p, n, out)：非空区间的最小（Max 时最大）值；浮点区间含 NaN 时返回 false，
+//   NaN 下 < 不是严格弱序，由调用方按标量算法的语义处理
+// 支持 1 / 2 / 4 / 8 字节整数（reduce_extreme 不含 bool）与 float、double；浮点数按 == 比较
+// （NaN 不等于任何值，+0 等于 -0），与标量版本一致。SSE2 没有 8 字节整数的大小比较，reduce_extreme 对其走标量
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "mystl/config/cpu_features.hpp"
+#include "mystl/config/platform.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mystl {
+namespace __details {
+
+template <class T>
+concept find_simd_type = std::same_as<T, float> || std::same_as<T, double> ||
+                         (std::integral<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
+
+template <class T>
+concept extreme_simd_type = find_simd_type<T> && !std::same_as<T, bool>;
+
+// 与元素等宽的无符号整数，用作按通道计数的类型
+template <class T>
+using find_lane_t =
+    std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                          std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+// 一个计数通道在汇总前最多累加的次数
+template <class T>
+inline constexpr std::size_t count_flush_rounds = sizeof(T) >= 8 ? static_cast<std::size_t>(-1)
+                                                                 : static_cast<std::size_t>(find_lane_t<T>(-1));
+
+// ---------------------------------------------------------------------------
+// 标量版本
+// ---------------------------------------------------------------------------
+
+template <class T>
+std::size_t find_eq_scalar(const T* p, std::size_t n, T v) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (p[i] == v) {
+      return i;
+    }
+  }
+  return n;
+}
+
+template <class T>
+std::size_t find_eq_pair_scalar(const T* p, std::size_t n, std::size_t off, T v0, T v1) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (p[i] == v0 && p[i + off] == v1) {
+      return i;
+    }
+  }
+  return n;
+}
+
+template <class T>
+std::size_t count_eq_scalar(const T* p, std::size_t n, T v) noexcept {
+  std::size_t c = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    c += p[i] == v ? 1 : 0;
+  }
+  return c;
+}
+
+template <bool Equal, class T>
+std::size_t find_cmp_scalar(const T* a, const T* b, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if ((a[i] == b[i]) == Equal) {
+      return i;
+    }
+  }
+  return n;
+}
+
+template <bool Max, class T>
+bool reduce_extreme_scalar(const T* p, std::size_t n, T& out) noexcept {
+  T best = p[0];
+  for (std::size_t i = 0; i < n; ++i) {
+    const T x = p[i];
+    if constexpr (std::is_floating_point_v<T>) {
+      if (x != x) {
+        return false;
+      }
+    }
+    if (Max ? best < x : x < best) {
+      best = x;
+    }
+  }
+  out = best;
+  return true;
+}
+
+// 把 tail 中的元素并入已知的极值 best
+template <bool Max, class T>
+bool reduce_extreme_tail(const T* tail, std::size_t n, T& best) noexcept {
+  if (n == 0) {
+    return true;
+  }
+  T t;
+  if (!reduce_extreme_scalar<Max>(tail, n, t)) {
+    return false;
+  }
+  if (Max ? best < t : t < best) {
+    best = t;
+  }
+  return true;
+}
+
+// 有原生大小比较的表示：有符号 1 字节翻转符号位后按无符号（pminub）比较，
+// 无符号 2 / 4 字节翻转符号位后按有符号比较
+template <class T>
+inline constexpr bool extreme_needs_bias_sse2_v =
+    std::is_integral_v<T> && ((sizeof(T) == 1 && std::is_signed_v<T>) ||
+                              ((sizeof(T) == 2 || sizeof(T) == 4) && std::is_unsigned_v<T>));
+
+// ---------------------------------------------------------------------------
+// SSE2 版本（x86-64 基线）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_SSE2
+
+template <class T>
+inline __m128i find_broadcast_sse2(T v) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_set1_ps(v));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_set1_pd(v));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm_set1_epi8(static_cast<char>(v));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_set1_epi16(static_cast<short>(v));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(v));
+  }
+}
+
+template <class T>
+inline __m128i find_load_sse2(const T* p) noexcept {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// 相等的通道为全 1；8 字节整数没有 pcmpeqq，两个 4 字节半边都相等才算相等
+template <class T>
+inline __m128i eq_mask_sse2(__m128i a, __m128i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_cmpeq_epi32(a, b);
+  } else {
+    const __m128i e = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(e, _mm_shuffle_epi32(e, 0xB1));
+  }
+}
+
+template <class T>
+std::size_t find_eq_sse2(const T* p, std::size_t n, T v) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  const __m128i key = find_broadcast_sse2(v);
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m128i any = _mm_or_si128(
+        _mm_or_si128(eq_mask_sse2<T>(find_load_sse2(p + i), key), eq_mask_sse2<T>(find_load_sse2(p + i + per), key)),
+        _mm_or_si128(eq_mask_sse2<T>(find_load_sse2(p + i + 2 * per), key),
+                     eq_mask_sse2<T>(find_load_sse2(p + i + 3 * per), key)));
+    if (_mm_movemask_epi8(any) != 0) {
+      break;
+    }
+  }
+  for (; i + per <= n; i += per) {
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq_mask_sse2<T>(find_load_sse2(p + i), key)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_eq_scalar(p + i, n - i, v);
+}
+
+template <class T>
+std::size_t find_eq_pair_sse2(const T* p, std::size_t n, std::size_t off, T v0, T v1) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  const __m128i k0 = find_broadcast_sse2(v0);
+  const __m128i k1 = find_broadcast_sse2(v1);
+  std::size_t i = 0;
+  for (; i + per <= n; i += per) {
+    const __m128i both =
+        _mm_and_si128(eq_mask_sse2<T>(find_load_sse2(p + i), k0), eq_mask_sse2<T>(find_load_sse2(p + i + off), k1));
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(both));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_eq_pair_scalar(p + i, n - i, off, v0, v1);
+}
+
+// 相等的通道为 -1，从计数中减去即加 1
+template <class T>
+inline __m128i count_sub_sse2(__m128i acc, __m128i mask) noexcept {
+  if constexpr (sizeof(T) == 1) {
+    return _mm_sub_epi8(acc, mask);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_sub_epi16(acc, mask);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_sub_epi32(acc, mask);
+  } else {
+    return _mm_sub_epi64(acc, mask);
+  }
+}
+
+template <class T>
+std::size_t count_eq_sse2(const T* p, std::size_t n, T v) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  const __m128i key = find_broadcast_sse2(v);
+  std::size_t total = 0;
+  std::size_t i = 0;
+  while (i + per <= n) {
+    const std::size_t rounds = std::min(count_flush_rounds<T>, (n - i) / per);
+    __m128i acc = _mm_setzero_si128();
+    for (std::size_t r = 0; r < rounds; ++r, i += per) {
+      acc = count_sub_sse2<T>(acc, eq_mask_sse2<T>(find_load_sse2(p + i), key));
+    }
+    alignas(16) find_lane_t<T> lanes[per];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    for (std::size_t j = 0; j < per; ++j) {
+      total += lanes[j];
+    }
+  }
+  return total + count_eq_scalar(p + i, n - i, v);
+}
+
+template <bool Equal, class T>
+std::size_t find_cmp_sse2(const T* a, const T* b, std::size_t n) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m128i m0 = eq_mask_sse2<T>(find_load_sse2(a + i), find_load_sse2(b + i));
+    const __m128i m1 = eq_mask_sse2<T>(find_load_sse2(a + i + per), find_load_sse2(b + i + per));
+    const __m128i m2 = eq_mask_sse2<T>(find_load_sse2(a + i + 2 * per), find_load_sse2(b + i + 2 * per));
+    const __m128i m3 = eq_mask_sse2<T>(find_load_sse2(a + i + 3 * per), find_load_sse2(b + i + 3 * per));
+    if constexpr (Equal) {
+      if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(m0, m1), _mm_or_si128(m2, m3))) != 0) {
+        break;
+      }
+    } else {
+      if (_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(m0, m1), _mm_and_si128(m2, m3))) != 0xFFFF) {
+        break;
+      }
+    }
+  }
+  for (; i + per <= n; i += per) {
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq_mask_sse2<T>(find_load_sse2(a + i), find_load_sse2(b + i))));
+    if constexpr (!Equal) {
+      mask ^= 0xFFFFu;
+    }
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_cmp_scalar<Equal>(a + i, b + i, n - i);
+}
+
+template <class T>
+inline __m128i extreme_bias_sse2() noexcept {
+  if constexpr (sizeof(T) == 1) {
+    return _mm_set1_epi8(static_cast<char>(0x80));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_set1_epi16(static_cast<short>(0x8000));
+  } else {
+    return _mm_set1_epi32(static_cast<int>(0x80000000u));
+  }
+}
+
+template <class T>
+inline __m128i extreme_load_sse2(const T* p) noexcept {
+  const __m128i x = find_load_sse2(p);
+  if constexpr (extreme_needs_bias_sse2_v<T>) {
+    return _mm_xor_si128(x, extreme_bias_sse2<T>());
+  } else {
+    return x;
+  }
+}
+
+// 在 extreme_load_sse2 的表示下取两者中的较小（Max 时较大）者
+template <bool Max, class T>
+inline __m128i extreme_sse2(__m128i a, __m128i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    const __m128 x = _mm_castsi128_ps(a);
+    const __m128 y = _mm_castsi128_ps(b);
+    return _mm_castps_si128(Max ? _mm_max_ps(x, y) : _mm_min_ps(x, y));
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m128d x = _mm_castsi128_pd(a);
+    const __m128d y = _mm_castsi128_pd(b);
+    return _mm_castpd_si128(Max ? _mm_max_pd(x, y) : _mm_min_pd(x, y));
+  } else if constexpr (sizeof(T) == 1) {
+    return Max ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return Max ? _mm_max_epi16(a, b) : _mm_min_epi16(a, b);
+  } else {
+    const __m128i gt = _mm_cmpgt_epi32(a, b);
+    return Max ? _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b))
+               : _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+}
+
+// 浮点数中 NaN 的通道为全 1
+template <class T>
+inline __m128i unordered_mask_sse2(__m128i x) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_cmpunord_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(x)));
+  } else {
+    return _mm_castpd_si128(_mm_cmpunord_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(x)));
+  }
+}
+
+template <bool Max, class T>
+bool reduce_extreme_sse2(const T* p, std::size_t n, T& out) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  if (n < 2 * per) {
+    return reduce_extreme_scalar<Max>(p, n, out);
+  }
+  __m128i a0 = extreme_load_sse2(p);
+  __m128i a1 = extreme_load_sse2(p + per);
+  __m128i nan = _mm_setzero_si128();
+  if constexpr (std::is_floating_point_v<T>) {
+    nan = _mm_or_si128(unordered_mask_sse2<T>(a0), unordered_mask_sse2<T>(a1));
+  }
+  std::size_t i = 2 * per;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const __m128i x0 = extreme_load_sse2(p + i);
+    const __m128i x1 = extreme_load_sse2(p + i + per);
+    if constexpr (std::is_floating_point_v<T>) {
+      nan = _mm_or_si128(nan, _mm_or_si128(unordered_mask_sse2<T>(x0), unordered_mask_sse2<T>(x1)));
+    }
+    a0 = extreme_sse2<Max, T>(x0, a0);
+    a1 = extreme_sse2<Max, T>(x1, a1);
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (_mm_movemask_epi8(nan) != 0) {
+      return false;
+    }
+  }
+  __m128i a = extreme_sse2<Max, T>(a0, a1);
+  if constexpr (extreme_needs_bias_sse2_v<T>) {
+    a = _mm_xor_si128(a, extreme_bias_sse2<T>());
+  }
+  alignas(16) T lanes[per];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a);
+  T best = lanes[0];
+  for (std::size_t j = 1; j < per; ++j) {
+    if (Max ? best < lanes[j] : lanes[j] < best) {
+      best = lanes[j];
+    }
+  }
+  if (!reduce_extreme_tail<Max>(p + i, n - i, best)) {
+    return false;
+  }
+  out = best;
+  return true;
+}
+
+#endif  // MYSTL_HAS_SSE2
+
+// ---------------------------------------------------------------------------
+// AVX2 版本（编译期开启或运行期分派）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i find_broadcast_avx2(T v) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_set1_ps(v));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_set1_pd(v));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_set1_epi8(static_cast<char>(v));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_set1_epi16(static_cast<short>(v));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(v));
+  }
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i find_load_avx2(const T* p) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i eq_mask_avx2(__m256i a, __m256i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_cmpeq_epi32(a, b);
+  } else {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+}
+
+// 每次检查 128 字节，四个块的比较结果先按位或再测试，命中后再逐块定位
+template <class T>
+MYSTL_TARGET_AVX2 std::size_t find_eq_avx2(const T* p, std::size_t n, T v) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  const __m256i key = find_broadcast_avx2(v);
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m256i any = _mm256_or_si256(
+        _mm256_or_si256(eq_mask_avx2<T>(find_load_avx2(p + i), key), eq_mask_avx2<T>(find_load_avx2(p + i + per), key)),
+        _mm256_or_si256(eq_mask_avx2<T>(find_load_avx2(p + i + 2 * per), key),
+                        eq_mask_avx2<T>(find_load_avx2(p + i + 3 * per), key)));
+    if (!_mm256_testz_si256(any, any)) {
+      break;
+    }
+  }
+  for (; i + per <= n; i += per) {
+    const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(eq_mask_avx2<T>(find_load_avx2(p + i), key)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_eq_scalar(p + i, n - i, v);
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 std::size_t find_eq_pair_avx2(const T* p, std::size_t n, std::size_t off, T v0, T v1) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  const __m256i k0 = find_broadcast_avx2(v0);
+  const __m256i k1 = find_broadcast_avx2(v1);
+  std::size_t i = 0;
+  for (; i + per <= n; i += per) {
+    const __m256i both = _mm256_and_si256(eq_mask_avx2<T>(find_load_avx2(p + i), k0),
+                                          eq_mask_avx2<T>(find_load_avx2(p + i + off), k1));
+    const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(both));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_eq_pair_scalar(p + i, n - i, off, v0, v1);
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i count_sub_avx2(__m256i acc, __m256i mask) noexcept {
+  if constexpr (sizeof(T) == 1) {
+    return _mm256_sub_epi8(acc, mask);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_sub_epi16(acc, mask);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_sub_epi32(acc, mask);
+  } else {
+    return _mm256_sub_epi64(acc, mask);
+  }
+}
+
+// 两个计数向量交替累加，比较与累加的依赖链减半
+template <class T>
+MYSTL_TARGET_AVX2 std::size_t count_eq_avx2(const T* p, std::size_t n, T v) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  const __m256i key = find_broadcast_avx2(v);
+  std::size_t total = 0;
+  std::size_t i = 0;
+  while (i + 2 * per <= n) {
+    const std::size_t rounds = std::min(count_flush_rounds<T>, (n - i) / (2 * per));
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    for (std::size_t r = 0; r < rounds; ++r, i += 2 * per) {
+      acc0 = count_sub_avx2<T>(acc0, eq_mask_avx2<T>(find_load_avx2(p + i), key));
+      acc1 = count_sub_avx2<T>(acc1, eq_mask_avx2<T>(find_load_avx2(p + i + per), key));
+    }
+    alignas(32) find_lane_t<T> lanes[2 * per];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes + per), acc1);
+    for (std::size_t j = 0; j < 2 * per; ++j) {
+      total += lanes[j];
+    }
+  }
+  return total + count_eq_scalar(p + i, n - i, v);
+}
+
+template <bool Equal, class T>
+MYSTL_TARGET_AVX2 std::size_t find_cmp_avx2(const T* a, const T* b, std::size_t n) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m256i m0 = eq_mask_avx2<T>(find_load_avx2(a + i), find_load_avx2(b + i));
+    const __m256i m1 = eq_mask_avx2<T>(find_load_avx2(a + i + per), find_load_avx2(b + i + per));
+    const __m256i m2 = eq_mask_avx2<T>(find_load_avx2(a + i + 2 * per), find_load_avx2(b + i + 2 * per));
+    const __m256i m3 = eq_mask_avx2<T>(find_load_avx2(a + i + 3 * per), find_load_avx2(b + i + 3 * per));
+    if constexpr (Equal) {
+      const __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3));
+      if (!_mm256_testz_si256(any, any)) {
+        break;
+      }
+    } else {
+      const __m256i all = _mm256_and_si256(_mm256_and_si256(m0, m1), _mm256_and_si256(m2, m3));
+      if (!_mm256_testc_si256(all, _mm256_set1_epi8(-1))) {
+        break;
+      }
+    }
+  }
+  for (; i + per <= n; i += per) {
+    auto mask =
+        static_cast<unsigned>(_mm256_movemask_epi8(eq_mask_avx2<T>(find_load_avx2(a + i), find_load_avx2(b + i))));
+    if constexpr (!Equal) {
+      mask = ~mask;
+    }
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_cmp_scalar<Equal>(a + i, b + i, n - i);
+}
+
+template <bool Max, class T>
+MYSTL_TARGET_AVX2 inline __m256i extreme_avx2(__m256i a, __m256i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    const __m256 x = _mm256_castsi256_ps(a);
+    const __m256 y = _mm256_castsi256_ps(b);
+    return _mm256_castps_si256(Max ? _mm256_max_ps(x, y) : _mm256_min_ps(x, y));
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m256d x = _mm256_castsi256_pd(a);
+    const __m256d y = _mm256_castsi256_pd(b);
+    return _mm256_castpd_si256(Max ? _mm256_max_pd(x, y) : _mm256_min_pd(x, y));
+  } else if constexpr (sizeof(T) == 1) {
+    if constexpr (std::is_signed_v<T>) {
+      return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+    } else {
+      return Max ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+    }
+  } else if constexpr (sizeof(T) == 2) {
+    if constexpr (std::is_signed_v<T>) {
+      return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+    } else {
+      return Max ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b);
+    }
+  } else if constexpr (sizeof(T) == 4) {
+    if constexpr (std::is_signed_v<T>) {
+      return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+    } else {
+      return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+    }
+  } else {
+    // 没有 8 字节整数的 min / max：无符号数翻转符号位后比较，再按比较结果选择原值
+    __m256i x = a;
+    __m256i y = b;
+    if constexpr (std::is_unsigned_v<T>) {
+      const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+      x = _mm256_xor_si256(x, bias);
+      y = _mm256_xor_si256(y, bias);
+    }
+    const __m256i gt = _mm256_cmpgt_epi64(x, y);
+    return Max ? _mm256_blendv_epi8(b, a, gt) : _mm256_blendv_epi8(a, b, gt);
+  }
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i unordered_mask_avx2(__m256i x) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(x), _mm256_castsi256_ps(x), _CMP_UNORD_Q));
+  } else {
+    return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(x), _mm256_castsi256_pd(x), _CMP_UNORD_Q));
+  }
+}
+
+template <bool Max, class T>
+MYSTL_TARGET_AVX2 bool reduce_extreme_avx2(const T* p, std::size_t n, T& out) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  if (n < 2 * per) {
+    return reduce_extreme_scalar<Max>(p, n, out);
+  }
+  __m256i a0 = find_load_avx2(p);
+  __m256i a1 = find_load_avx2(p + per);
+  __m256i nan = _mm256_setzero_si256();
+  if constexpr (std::is_floating_point_v<T>) {
+    nan = _mm256_or_si256(unordered_mask_avx2<T>(a0), unordered_mask_avx2<T>(a1));
+  }
+  std::size_t i = 2 * per;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const __m256i x0 = find_load_avx2(p + i);
+    const __m256i x1 = find_load_avx2(p + i + per);
+    if constexpr (std::is_floating_point_v<T>) {
+      nan = _mm256_or_si256(nan, _mm256_or_si256(unordered_mask_avx2<T>(x0), unordered_mask_avx2<T>(x1)));
+    }
+    a0 = extreme_avx2<Max, T>(x0, a0);
+    a1 = extreme_avx2<Max, T>(x1, a1);
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (!_mm256_testz_si256(nan, nan)) {
+      return false;
+    }
+  }
+  alignas(32) T lanes[per];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), extreme_avx2<Max, T>(a0, a1));
+  T best = lanes[0];
+  for (std::size_t j = 1; j < per; ++j) {
+    if (Max ? best < lanes[j] : lanes[j] < best) {
+      best = lanes[j];
+    }
+  }
+  if (!reduce_extreme_tail<Max>(p + i, n - i, best)) {
+    return false;
+  }
+  out = best;
+  return true;
+}
+
+#endif  // MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// ---------------------------------------------------------------------------
+// 分派入口（运行期）
+// ---------------------------------------------------------------------------
+
+template <find_simd_type T>
+std::size_t find_eq(const T* p, std::size_t n, T v) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return find_eq_avx2(p, n, v);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return find_eq_sse2(p, n, v);
+#else
+  return find_eq_scalar(p, n, v);
+#endif
+}
+
+template <find_simd_type T>
+std::size_t find_eq_pair(const T* p, std::size_t n, std::size_t off, T v0, T v1) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return find_eq_pair_avx2(p, n, off, v0, v1);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return find_eq_pair_sse2(p, n, off, v0, v1);
+#else
+  return find_eq_pair_scalar(p, n, off, v0, v1);
+#endif
+}
+
+template <find_simd_type T>
+std::size_t count_eq(const T* p, std::size_t n, T v) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return count_eq_avx2(p, n, v);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return count_eq_sse2(p, n, v);
+#else
+  return count_eq_scalar(p, n, v);
+#endif
+}
+
+template <bool Equal, find_simd_type T>
+std::size_t find_cmp(const T* a, const T* b, std::size_t n) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return find_cmp_avx2<Equal>(a, b, n);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return find_cmp_sse2<Equal>(a, b, n);
+#else
+  return find_cmp_scalar<Equal>(a, b, n);
+#endif
+}
+
+template <bool Max, extreme_simd_type T>
+bool reduce_extreme(const T* p, std::size_t n, T& out) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return reduce_extreme_avx2<Max>(p, n, out);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  if constexpr (sizeof(T) != 8 || std::is_floating_point_v<T>) {
+    return reduce_extreme_sse2<Max>(p, n, out);
+  }
+#endif
+  return reduce_extreme_scalar<Max>(p, n, out);
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_ALGORITHMS__DETAILS_FIND_KERNELS_HPP
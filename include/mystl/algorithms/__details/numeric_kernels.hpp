@@ -0,0 +1,603 @@
+#ifndef MYSTL_ALGORITHMS__DETAILS_NUMERIC_KERNELS_HPP
+#define MYSTL_ALGORITHMS__DETAILS_NUMERIC_KERNELS_HPP
+
+// 数值算法的向量内核：SSE2 / AVX2 版本与标量版本（hidden in __details）
+//
+// 前缀和（inclusive_scan / exclusive_scan / partial_sum）的加法内核
+// scan_add<Exclusive>(in, out, n, carry)：out[i] = carry + in[0] + ... + in[i]（Exclusive 时不含 in[i]），
+// 返回 carry 加上全部元素之和。in 与 out 可以是同一块内存（原地）。
+// 向量内前缀和：移位相加 log2(宽度) 次，AVX2 再把低 128 位的总和加到高 128 位；
+// 上一块的总和广播到每个通道后整体相加，块之间只有一次加法的依赖。
+// 支持 float、double 与 4 / 8 字节整数；整数结果与顺序相加完全相同，浮点数的结合顺序不同，
+// 舍入误差与顺序相加同阶
+//
+// 补偿求和与统计的内核（kahan_reduce / stats），只处理 float、double：
+// - compensated_sum(p, n, sum, comp)：每个通道各自做 TwoSum 累加，最后逐通道精确合并；结果为 sum + comp
+// - stats_sum_min_max(p, n, ...)：和、最小值、最大值（忽略 NaN）
+// - stats_deviations(p, n, mean, ...)：Σ(x - mean) 与 Σ(x - mean)²
+// 各版本的通道数不同，浮点结果可能在最后几位不同；同一台机器上结果是确定的
+
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "mystl/config/cpu_features.hpp"
+#include "mystl/config/platform.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mystl {
+namespace __details {
+
+template <class T>
+concept scan_simd_type = std::same_as<T, float> || std::same_as<T, double> ||
+                         (std::integral<T> && !std::same_as<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+// ---------------------------------------------------------------------------
+// 标量版本
+// ---------------------------------------------------------------------------
+
+template <bool Exclusive, class T>
+T scan_add_scalar(const T* in, T* out, std::size_t n, T carry) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    const T x = in[i];
+    if constexpr (Exclusive) {
+      out[i] = carry;
+      carry = static_cast<T>(carry + x);
+    } else {
+      carry = static_cast<T>(carry + x);
+      out[i] = carry;
+    }
+  }
+  return carry;
+}
+
+template <class T>
+concept fp_simd_type = std::same_as<T, float> || std::same_as<T, double>;
+
+// TwoSum：sum + x 的精确舍入误差累加到 comp（6 次浮点加减、无分支）
+template <class T>
+constexpr void two_sum_add(T& sum, T& comp, T x) noexcept {
+  const T t = sum + x;
+  const T bp = t - sum;
+  comp += (sum - (t - bp)) + (x - bp);
+  sum = t;
+}
+
+template <class T>
+void compensated_sum_scalar(const T* p, std::size_t n, T& sum, T& comp) noexcept {
+  T s = T(0);
+  T c = T(0);
+  for (std::size_t i = 0; i < n; ++i) {
+    two_sum_add(s, c, p[i]);
+  }
+  sum = s;
+  comp = c;
+}
+
+template <class T>
+void stats_sum_min_max_scalar(const T* p, std::size_t n, T& sum, T& mn, T& mx) noexcept {
+  T s = T(0);
+  T lo = std::numeric_limits<T>::infinity();
+  T hi = -std::numeric_limits<T>::infinity();
+  for (std::size_t i = 0; i < n; ++i) {
+    const T x = p[i];
+    s += x;
+    lo = x < lo ? x : lo;
+    hi = hi < x ? x : hi;
+  }
+  sum = s;
+  mn = lo;
+  mx = hi;
+}
+
+template <class T>
+void stats_deviations_scalar(const T* p, std::size_t n, T mean, T& dsum, T& dsq) noexcept {
+  T ds = T(0);
+  T dq = T(0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const T d = p[i] - mean;
+    ds += d;
+    dq += d * d;
+  }
+  dsum = ds;
+  dsq = dq;
+}
+
+// 把各通道的部分结果按通道顺序合并到标量结果，剩余元素用标量版本接上
+template <class T, std::size_t Lanes>
+void compensated_sum_finish(const T (&s)[Lanes], const T (&c)[Lanes], const T* tail, std::size_t tail_n, T& sum,
+                            T& comp) noexcept {
+  T total = T(0);
+  T err = T(0);
+  for (std::size_t j = 0; j < Lanes; ++j) {
+    two_sum_add(total, err, s[j]);
+    err += c[j];
+  }
+  for (std::size_t i = 0; i < tail_n; ++i) {
+    two_sum_add(total, err, tail[i]);
+  }
+  sum = total;
+  comp = err;
+}
+
+template <class T, std::size_t Lanes>
+void stats_sum_min_max_finish(const T (&s)[Lanes], const T (&lo)[Lanes], const T (&hi)[Lanes], const T* tail,
+                              std::size_t tail_n, T& sum, T& mn, T& mx) noexcept {
+  T ts;
+  T tlo;
+  T thi;
+  stats_sum_min_max_scalar(tail, tail_n, ts, tlo, thi);
+  for (std::size_t j = 0; j < Lanes; ++j) {
+    ts += s[j];
+    tlo = lo[j] < tlo ? lo[j] : tlo;
+    thi = thi < hi[j] ? hi[j] : thi;
+  }
+  sum = ts;
+  mn = tlo;
+  mx = thi;
+}
+
+// ---------------------------------------------------------------------------
+// SSE2 版本（x86-64 基线）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_SSE2
+
+template <class T>
+inline __m128i scan_add_sse2(__m128i a, __m128i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_add_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_add_epi32(a, b);
+  } else {
+    return _mm_add_epi64(a, b);
+  }
+}
+
+template <class T>
+inline __m128i scan_broadcast_sse2(T x) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_set1_ps(x));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_set1_pd(x));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_set1_epi32(static_cast<int>(x));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(x));
+  }
+}
+
+// 最后一个元素广播到所有通道
+template <class T>
+inline __m128i scan_last_sse2(__m128i v) noexcept {
+  if constexpr (sizeof(T) == 4) {
+    return _mm_shuffle_epi32(v, 0xFF);
+  } else {
+    return _mm_shuffle_epi32(v, 0xEE);
+  }
+}
+
+template <bool Exclusive, class T>
+T scan_add_sse2(const T* in, T* out, std::size_t n, T carry) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  __m128i c = scan_broadcast_sse2(carry);
+  std::size_t i = 0;
+  for (; i + per <= n; i += per) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    x = scan_add_sse2<T>(x, _mm_slli_si128(x, sizeof(T)));
+    if constexpr (sizeof(T) == 4) {
+      x = scan_add_sse2<T>(x, _mm_slli_si128(x, 8));
+    }
+    const __m128i v = scan_add_sse2<T>(x, c);
+    if constexpr (Exclusive) {
+      // 整体右移一个元素，空出的通道 0 填入上一块的总和
+      const __m128i e = _mm_or_si128(_mm_slli_si128(v, sizeof(T)), _mm_srli_si128(c, 16 - sizeof(T)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), e);
+    } else {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+    }
+    c = scan_last_sse2<T>(v);
+  }
+  if (i != 0) {
+    alignas(16) T lanes[per];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), c);
+    carry = lanes[0];
+  }
+  return scan_add_scalar<Exclusive>(in + i, out + i, n - i, carry);
+}
+
+// 浮点向量运算按向量类型重载，float / double 的内核共用同一份代码
+inline __m128 fp_set1_sse2(float x) noexcept { return _mm_set1_ps(x); }
+inline __m128d fp_set1_sse2(double x) noexcept { return _mm_set1_pd(x); }
+inline __m128 fp_load_sse2(const float* p) noexcept { return _mm_loadu_ps(p); }
+inline __m128d fp_load_sse2(const double* p) noexcept { return _mm_loadu_pd(p); }
+inline void fp_store_sse2(float* p, __m128 v) noexcept { _mm_storeu_ps(p, v); }
+inline void fp_store_sse2(double* p, __m128d v) noexcept { _mm_storeu_pd(p, v); }
+inline __m128 fp_add_sse2(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+inline __m128d fp_add_sse2(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+inline __m128 fp_sub_sse2(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+inline __m128d fp_sub_sse2(__m128d a, __m128d b) noexcept { return _mm_sub_pd(a, b); }
+inline __m128 fp_mul_sse2(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+inline __m128d fp_mul_sse2(__m128d a, __m128d b) noexcept { return _mm_mul_pd(a, b); }
+// minps / maxps 在任一操作数为 NaN 时返回第二个操作数：新元素放在第一个，NaN 被忽略
+inline __m128 fp_min_sse2(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+inline __m128d fp_min_sse2(__m128d a, __m128d b) noexcept { return _mm_min_pd(a, b); }
+inline __m128 fp_max_sse2(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+inline __m128d fp_max_sse2(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+
+// 两组向量累加器交替使用，TwoSum 的依赖链减半
+template <class T>
+void compensated_sum_sse2(const T* p, std::size_t n, T& sum, T& comp) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  auto s0 = fp_set1_sse2(T(0));
+  auto s1 = s0;
+  auto c0 = s0;
+  auto c1 = s0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto x0 = fp_load_sse2(p + i);
+    const auto x1 = fp_load_sse2(p + i + per);
+    const auto t0 = fp_add_sse2(s0, x0);
+    const auto t1 = fp_add_sse2(s1, x1);
+    const auto b0 = fp_sub_sse2(t0, s0);
+    const auto b1 = fp_sub_sse2(t1, s1);
+    c0 = fp_add_sse2(c0, fp_add_sse2(fp_sub_sse2(s0, fp_sub_sse2(t0, b0)), fp_sub_sse2(x0, b0)));
+    c1 = fp_add_sse2(c1, fp_add_sse2(fp_sub_sse2(s1, fp_sub_sse2(t1, b1)), fp_sub_sse2(x1, b1)));
+    s0 = t0;
+    s1 = t1;
+  }
+  T s[2 * per];
+  T c[2 * per];
+  fp_store_sse2(s, s0);
+  fp_store_sse2(s + per, s1);
+  fp_store_sse2(c, c0);
+  fp_store_sse2(c + per, c1);
+  compensated_sum_finish(s, c, p + i, n - i, sum, comp);
+}
+
+template <class T>
+void stats_sum_min_max_sse2(const T* p, std::size_t n, T& sum, T& mn, T& mx) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  auto s0 = fp_set1_sse2(T(0));
+  auto s1 = s0;
+  auto lo0 = fp_set1_sse2(std::numeric_limits<T>::infinity());
+  auto lo1 = lo0;
+  auto hi0 = fp_set1_sse2(-std::numeric_limits<T>::infinity());
+  auto hi1 = hi0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto x0 = fp_load_sse2(p + i);
+    const auto x1 = fp_load_sse2(p + i + per);
+    s0 = fp_add_sse2(s0, x0);
+    s1 = fp_add_sse2(s1, x1);
+    lo0 = fp_min_sse2(x0, lo0);
+    lo1 = fp_min_sse2(x1, lo1);
+    hi0 = fp_max_sse2(x0, hi0);
+    hi1 = fp_max_sse2(x1, hi1);
+  }
+  T s[per];
+  T lo[per];
+  T hi[per];
+  fp_store_sse2(s, fp_add_sse2(s0, s1));
+  fp_store_sse2(lo, fp_min_sse2(lo0, lo1));
+  fp_store_sse2(hi, fp_max_sse2(hi0, hi1));
+  stats_sum_min_max_finish(s, lo, hi, p + i, n - i, sum, mn, mx);
+}
+
+template <class T>
+void stats_deviations_sse2(const T* p, std::size_t n, T mean, T& dsum, T& dsq) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  const auto m = fp_set1_sse2(mean);
+  auto ds0 = fp_set1_sse2(T(0));
+  auto ds1 = ds0;
+  auto dq0 = ds0;
+  auto dq1 = ds0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto d0 = fp_sub_sse2(fp_load_sse2(p + i), m);
+    const auto d1 = fp_sub_sse2(fp_load_sse2(p + i + per), m);
+    ds0 = fp_add_sse2(ds0, d0);
+    ds1 = fp_add_sse2(ds1, d1);
+    dq0 = fp_add_sse2(dq0, fp_mul_sse2(d0, d0));
+    dq1 = fp_add_sse2(dq1, fp_mul_sse2(d1, d1));
+  }
+  T ds[per];
+  T dq[per];
+  fp_store_sse2(ds, fp_add_sse2(ds0, ds1));
+  fp_store_sse2(dq, fp_add_sse2(dq0, dq1));
+  T tds;
+  T tdq;
+  stats_deviations_scalar(p + i, n - i, mean, tds, tdq);
+  for (std::size_t j = 0; j < per; ++j) {
+    tds += ds[j];
+    tdq += dq[j];
+  }
+  dsum = tds;
+  dsq = tdq;
+}
+
+#endif  // MYSTL_HAS_SSE2
+
+// ---------------------------------------------------------------------------
+// AVX2 版本（编译期开启或运行期分派）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i scan_add_avx2(__m256i a, __m256i b) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_add_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_add_epi32(a, b);
+  } else {
+    return _mm256_add_epi64(a, b);
+  }
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i scan_broadcast_avx2(T x) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_set1_ps(x));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_set1_pd(x));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(static_cast<int>(x));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+  }
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i scan_last_avx2(__m256i v) noexcept {
+  if constexpr (sizeof(T) == 4) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_set1_epi32(7));
+  } else {
+    return _mm256_permute4x64_epi64(v, 0xFF);
+  }
+}
+
+// 8 个（或 4 个）元素的向量内前缀和
+template <class T>
+MYSTL_TARGET_AVX2 inline __m256i scan_in_register_avx2(__m256i x) noexcept {
+  // 两个 128 位通道各自做前缀和
+  x = scan_add_avx2<T>(x, _mm256_slli_si256(x, sizeof(T)));
+  if constexpr (sizeof(T) == 4) {
+    x = scan_add_avx2<T>(x, _mm256_slli_si256(x, 8));
+  }
+  // 低通道的总和加到高通道：[0, lo] 再在每个通道内广播最后一个元素
+  const __m256i lo = _mm256_permute2x128_si256(x, x, 0x08);
+  return scan_add_avx2<T>(x, _mm256_shuffle_epi32(lo, sizeof(T) == 4 ? 0xFF : 0xEE));
+}
+
+// Exclusive 时整体右移一个元素，空出的通道 0 填入上一块的总和 prev
+template <bool Exclusive, class T>
+MYSTL_TARGET_AVX2 inline void scan_store_avx2(T* dst, __m256i v, __m256i prev) noexcept {
+  if constexpr (Exclusive) {
+    if constexpr (sizeof(T) == 4) {
+      v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6));
+      v = _mm256_blend_epi32(v, prev, 0x01);
+    } else {
+      v = _mm256_permute4x64_epi64(v, 0x93);
+      v = _mm256_blend_epi32(v, prev, 0x03);
+    }
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+}
+
+// 每次两个向量：两块的总和先相加再加到进位上，进位的依赖链每 2 个向量只有一次加法
+template <bool Exclusive, class T>
+MYSTL_TARGET_AVX2 T scan_add_avx2(const T* in, T* out, std::size_t n, T carry) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  __m256i c = scan_broadcast_avx2(carry);
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const __m256i s1 = scan_in_register_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+    const __m256i s2 = scan_in_register_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + per)));
+    const __m256i t1 = scan_last_avx2<T>(s1);
+    const __m256i c1 = scan_add_avx2<T>(c, t1);
+    scan_store_avx2<Exclusive>(out + i, scan_add_avx2<T>(s1, c), c);
+    scan_store_avx2<Exclusive>(out + i + per, scan_add_avx2<T>(s2, c1), c1);
+    c = scan_add_avx2<T>(c, scan_add_avx2<T>(t1, scan_last_avx2<T>(s2)));
+  }
+  for (; i + per <= n; i += per) {
+    const __m256i s = scan_in_register_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+    const __m256i v = scan_add_avx2<T>(s, c);
+    scan_store_avx2<Exclusive>(out + i, v, c);
+    c = scan_last_avx2<T>(v);
+  }
+  if (i != 0) {
+    alignas(32) T lanes[per];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), c);
+    carry = lanes[0];
+  }
+  return scan_add_scalar<Exclusive>(in + i, out + i, n - i, carry);
+}
+
+MYSTL_TARGET_AVX2 inline __m256 fp_set1_avx2(float x) noexcept { return _mm256_set1_ps(x); }
+MYSTL_TARGET_AVX2 inline __m256d fp_set1_avx2(double x) noexcept { return _mm256_set1_pd(x); }
+MYSTL_TARGET_AVX2 inline __m256 fp_load_avx2(const float* p) noexcept { return _mm256_loadu_ps(p); }
+MYSTL_TARGET_AVX2 inline __m256d fp_load_avx2(const double* p) noexcept { return _mm256_loadu_pd(p); }
+MYSTL_TARGET_AVX2 inline void fp_store_avx2(float* p, __m256 v) noexcept { _mm256_storeu_ps(p, v); }
+MYSTL_TARGET_AVX2 inline void fp_store_avx2(double* p, __m256d v) noexcept { _mm256_storeu_pd(p, v); }
+MYSTL_TARGET_AVX2 inline __m256 fp_add_avx2(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+MYSTL_TARGET_AVX2 inline __m256d fp_add_avx2(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+MYSTL_TARGET_AVX2 inline __m256 fp_sub_avx2(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+MYSTL_TARGET_AVX2 inline __m256d fp_sub_avx2(__m256d a, __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+MYSTL_TARGET_AVX2 inline __m256 fp_mul_avx2(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+MYSTL_TARGET_AVX2 inline __m256d fp_mul_avx2(__m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+MYSTL_TARGET_AVX2 inline __m256 fp_min_avx2(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+MYSTL_TARGET_AVX2 inline __m256d fp_min_avx2(__m256d a, __m256d b) noexcept { return _mm256_min_pd(a, b); }
+MYSTL_TARGET_AVX2 inline __m256 fp_max_avx2(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+MYSTL_TARGET_AVX2 inline __m256d fp_max_avx2(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+
+template <class T>
+MYSTL_TARGET_AVX2 void compensated_sum_avx2(const T* p, std::size_t n, T& sum, T& comp) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  auto s0 = fp_set1_avx2(T(0));
+  auto s1 = s0;
+  auto c0 = s0;
+  auto c1 = s0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto x0 = fp_load_avx2(p + i);
+    const auto x1 = fp_load_avx2(p + i + per);
+    const auto t0 = fp_add_avx2(s0, x0);
+    const auto t1 = fp_add_avx2(s1, x1);
+    const auto b0 = fp_sub_avx2(t0, s0);
+    const auto b1 = fp_sub_avx2(t1, s1);
+    c0 = fp_add_avx2(c0, fp_add_avx2(fp_sub_avx2(s0, fp_sub_avx2(t0, b0)), fp_sub_avx2(x0, b0)));
+    c1 = fp_add_avx2(c1, fp_add_avx2(fp_sub_avx2(s1, fp_sub_avx2(t1, b1)), fp_sub_avx2(x1, b1)));
+    s0 = t0;
+    s1 = t1;
+  }
+  T s[2 * per];
+  T c[2 * per];
+  fp_store_avx2(s, s0);
+  fp_store_avx2(s + per, s1);
+  fp_store_avx2(c, c0);
+  fp_store_avx2(c + per, c1);
+  compensated_sum_finish(s, c, p + i, n - i, sum, comp);
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 void stats_sum_min_max_avx2(const T* p, std::size_t n, T& sum, T& mn, T& mx) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  auto s0 = fp_set1_avx2(T(0));
+  auto s1 = s0;
+  auto lo0 = fp_set1_avx2(std::numeric_limits<T>::infinity());
+  auto lo1 = lo0;
+  auto hi0 = fp_set1_avx2(-std::numeric_limits<T>::infinity());
+  auto hi1 = hi0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto x0 = fp_load_avx2(p + i);
+    const auto x1 = fp_load_avx2(p + i + per);
+    s0 = fp_add_avx2(s0, x0);
+    s1 = fp_add_avx2(s1, x1);
+    lo0 = fp_min_avx2(x0, lo0);
+    lo1 = fp_min_avx2(x1, lo1);
+    hi0 = fp_max_avx2(x0, hi0);
+    hi1 = fp_max_avx2(x1, hi1);
+  }
+  T s[per];
+  T lo[per];
+  T hi[per];
+  fp_store_avx2(s, fp_add_avx2(s0, s1));
+  fp_store_avx2(lo, fp_min_avx2(lo0, lo1));
+  fp_store_avx2(hi, fp_max_avx2(hi0, hi1));
+  stats_sum_min_max_finish(s, lo, hi, p + i, n - i, sum, mn, mx);
+}
+
+template <class T>
+MYSTL_TARGET_AVX2 void stats_deviations_avx2(const T* p, std::size_t n, T mean, T& dsum, T& dsq) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  const auto m = fp_set1_avx2(mean);
+  auto ds0 = fp_set1_avx2(T(0));
+  auto ds1 = ds0;
+  auto dq0 = ds0;
+  auto dq1 = ds0;
+  std::size_t i = 0;
+  for (; i + 2 * per <= n; i += 2 * per) {
+    const auto d0 = fp_sub_avx2(fp_load_avx2(p + i), m);
+    const auto d1 = fp_sub_avx2(fp_load_avx2(p + i + per), m);
+    ds0 = fp_add_avx2(ds0, d0);
+    ds1 = fp_add_avx2(ds1, d1);
+    dq0 = fp_add_avx2(dq0, fp_mul_avx2(d0, d0));
+    dq1 = fp_add_avx2(dq1, fp_mul_avx2(d1, d1));
+  }
+  T ds[per];
+  T dq[per];
+  fp_store_avx2(ds, fp_add_avx2(ds0, ds1));
+  fp_store_avx2(dq, fp_add_avx2(dq0, dq1));
+  T tds;
+  T tdq;
+  stats_deviations_scalar(p + i, n - i, mean, tds, tdq);
+  for (std::size_t j = 0; j < per; ++j) {
+    tds += ds[j];
+    tdq += dq[j];
+  }
+  dsum = tds;
+  dsq = tdq;
+}
+
+#endif  // MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// ---------------------------------------------------------------------------
+// 分派入口（运行期）
+// ---------------------------------------------------------------------------
+
+template <bool Exclusive, scan_simd_type T>
+T scan_add(const T* in, T* out, std::size_t n, T carry) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return scan_add_avx2<Exclusive>(in, out, n, carry);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return scan_add_sse2<Exclusive>(in, out, n, carry);
+#else
+  return scan_add_scalar<Exclusive>(in, out, n, carry);
+#endif
+}
+
+template <fp_simd_type T>
+void compensated_sum(const T* p, std::size_t n, T& sum, T& comp) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    compensated_sum_avx2(p, n, sum, comp);
+    return;
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  compensated_sum_sse2(p, n, sum, comp);
+#else
+  compensated_sum_scalar(p, n, sum, comp);
+#endif
+}
+
+template <fp_simd_type T>
+void stats_sum_min_max(const T* p, std::size_t n, T& sum, T& mn, T& mx) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    stats_sum_min_max_avx2(p, n, sum, mn, mx);
+    return;
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  stats_sum_min_max_sse2(p, n, sum, mn, mx);
+#else
+  stats_sum_min_max_scalar(p, n, sum, mn, mx);
+#endif
+}
+
+template <fp_simd_type T>
+void stats_deviations(const T* p, std::size_t n, T mean, T& dsum, T& dsq) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    stats_deviations_avx2(p, n, mean, dsum, dsq);
+    return;
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  stats_deviations_sse2(p, n, mean, dsum, dsq);
+#else
+  stats_deviations_scalar(p, n, mean, dsum, dsq);
+#endif
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_ALGORITHMS__DETAILS_NUMERIC_KERNELS_HPP
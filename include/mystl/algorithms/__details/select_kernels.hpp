@@ -0,0 +1,200 @@
+#ifndef MYSTL_ALGORITHMS__DETAILS_SELECT_KERNELS_HPP
+#define MYSTL_ALGORITHMS__DETAILS_SELECT_KERNELS_HPP
+
+// 选择算法（partial_sort / top_k）的阈值过滤内核：SSE2 / AVX2 向量版本与标量版本（hidden in __details）
+//
+// find_beyond<Greater>(p, n, t)：第一个越过阈值的下标（Greater 为真时 p[i] > t，否则 p[i] < t），
+// 没有则返回 n。选择到后期阈值很紧，绝大多数元素在向量比较中被整块跳过。
+// 支持 float、double 与 4 / 8 字节整数；NaN 与任何阈值比较都不越过，与标量的 < / > 一致
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "mystl/config/cpu_features.hpp"
+#include "mystl/config/platform.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mystl {
+namespace __details {
+
+template <class T>
+concept select_simd_type = std::same_as<T, float> || std::same_as<T, double> ||
+                           (std::integral<T> && !std::same_as<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+// ---------------------------------------------------------------------------
+// 标量版本
+// ---------------------------------------------------------------------------
+
+template <bool Greater, class T>
+std::size_t find_beyond_scalar(const T* p, std::size_t n, T t) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (Greater ? t < p[i] : p[i] < t) {
+      return i;
+    }
+  }
+  return n;
+}
+
+// 无符号整数翻转符号位后按有符号比较
+template <class T>
+constexpr auto select_signed_bits(T t) noexcept {
+  using S = std::make_signed_t<T>;
+  if constexpr (std::is_unsigned_v<T>) {
+    return static_cast<S>(t ^ (T{1} << (sizeof(T) * 8 - 1)));
+  } else {
+    return t;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// SSE2 版本（x86-64 基线；8 字节整数没有比较指令，走标量）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_SSE2
+
+template <bool Greater, class T>
+inline __m128i beyond_mask_sse2(const T* p, __m128i t) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    const __m128 x = _mm_loadu_ps(p);
+    return _mm_castps_si128(Greater ? _mm_cmpgt_ps(x, _mm_castsi128_ps(t)) : _mm_cmplt_ps(x, _mm_castsi128_ps(t)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m128d x = _mm_loadu_pd(p);
+    return _mm_castpd_si128(Greater ? _mm_cmpgt_pd(x, _mm_castsi128_pd(t)) : _mm_cmplt_pd(x, _mm_castsi128_pd(t)));
+  } else {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if constexpr (std::is_unsigned_v<T>) {
+      x = _mm_xor_si128(x, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    }
+    return Greater ? _mm_cmpgt_epi32(x, t) : _mm_cmpgt_epi32(t, x);
+  }
+}
+
+template <bool Greater, class T>
+std::size_t find_beyond_sse2(const T* p, std::size_t n, T t) noexcept {
+  constexpr std::size_t per = 16 / sizeof(T);
+  __m128i thr;
+  if constexpr (std::is_same_v<T, float>) {
+    thr = _mm_castps_si128(_mm_set1_ps(t));
+  } else if constexpr (std::is_same_v<T, double>) {
+    thr = _mm_castpd_si128(_mm_set1_pd(t));
+  } else {
+    thr = _mm_set1_epi32(select_signed_bits(t));
+  }
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m128i any = _mm_or_si128(
+        _mm_or_si128(beyond_mask_sse2<Greater>(p + i, thr), beyond_mask_sse2<Greater>(p + i + per, thr)),
+        _mm_or_si128(beyond_mask_sse2<Greater>(p + i + 2 * per, thr), beyond_mask_sse2<Greater>(p + i + 3 * per, thr)));
+    if (_mm_movemask_epi8(any) != 0) {
+      break;
+    }
+  }
+  for (; i + per <= n; i += per) {
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(beyond_mask_sse2<Greater>(p + i, thr)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_beyond_scalar<Greater>(p + i, n - i, t);
+}
+
+#endif  // MYSTL_HAS_SSE2
+
+// ---------------------------------------------------------------------------
+// AVX2 版本（编译期开启或运行期分派）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+template <bool Greater, class T>
+MYSTL_TARGET_AVX2 inline __m256i beyond_mask_avx2(const T* p, __m256i t) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    const __m256 x = _mm256_loadu_ps(p);
+    const __m256 tf = _mm256_castsi256_ps(t);
+    return _mm256_castps_si256(Greater ? _mm256_cmp_ps(x, tf, _CMP_GT_OQ) : _mm256_cmp_ps(x, tf, _CMP_LT_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m256d x = _mm256_loadu_pd(p);
+    const __m256d td = _mm256_castsi256_pd(t);
+    return _mm256_castpd_si256(Greater ? _mm256_cmp_pd(x, td, _CMP_GT_OQ) : _mm256_cmp_pd(x, td, _CMP_LT_OQ));
+  } else if constexpr (sizeof(T) == 4) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    if constexpr (std::is_unsigned_v<T>) {
+      x = _mm256_xor_si256(x, _mm256_set1_epi32(static_cast<int>(0x80000000u)));
+    }
+    return Greater ? _mm256_cmpgt_epi32(x, t) : _mm256_cmpgt_epi32(t, x);
+  } else {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    if constexpr (std::is_unsigned_v<T>) {
+      x = _mm256_xor_si256(x, _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull)));
+    }
+    return Greater ? _mm256_cmpgt_epi64(x, t) : _mm256_cmpgt_epi64(t, x);
+  }
+}
+
+// 每次检查 128 字节，四个块的比较结果先按位或再测试，命中后再逐块定位
+template <bool Greater, class T>
+MYSTL_TARGET_AVX2 std::size_t find_beyond_avx2(const T* p, std::size_t n, T t) noexcept {
+  constexpr std::size_t per = 32 / sizeof(T);
+  __m256i thr;
+  if constexpr (std::is_same_v<T, float>) {
+    thr = _mm256_castps_si256(_mm256_set1_ps(t));
+  } else if constexpr (std::is_same_v<T, double>) {
+    thr = _mm256_castpd_si256(_mm256_set1_pd(t));
+  } else if constexpr (sizeof(T) == 4) {
+    thr = _mm256_set1_epi32(select_signed_bits(t));
+  } else {
+    thr = _mm256_set1_epi64x(select_signed_bits(t));
+  }
+  std::size_t i = 0;
+  for (; i + 4 * per <= n; i += 4 * per) {
+    const __m256i any = _mm256_or_si256(
+        _mm256_or_si256(beyond_mask_avx2<Greater>(p + i, thr), beyond_mask_avx2<Greater>(p + i + per, thr)),
+        _mm256_or_si256(beyond_mask_avx2<Greater>(p + i + 2 * per, thr),
+                        beyond_mask_avx2<Greater>(p + i + 3 * per, thr)));
+    if (!_mm256_testz_si256(any, any)) {
+      break;
+    }
+  }
+  for (; i + per <= n; i += per) {
+    const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(beyond_mask_avx2<Greater>(p + i, thr)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(T);
+    }
+  }
+  return i + find_beyond_scalar<Greater>(p + i, n - i, t);
+}
+
+#endif  // MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// ---------------------------------------------------------------------------
+// 分派入口（运行期）
+// ---------------------------------------------------------------------------
+
+template <bool Greater, select_simd_type T>
+std::size_t find_beyond(const T* p, std::size_t n, T t) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return find_beyond_avx2<Greater>(p, n, t);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  if constexpr (sizeof(T) == 4 || std::is_same_v<T, double>) {
+    return find_beyond_sse2<Greater>(p, n, t);
+  }
+#endif
+  return find_beyond_scalar<Greater>(p, n, t);
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_ALGORITHMS__DETAILS_SELECT_KERNELS_HPP
@@ -1,10 +1,233 @@
 #ifndef MYSTL_ALGORITHMS_HEAP_HPP
 #define MYSTL_ALGORITHMS_HEAP_HPP
 
-// placeholder for make_heap/push_heap/pop_heap/sort_heap
+/**
+ * @file algorithms/heap.hpp
+ * @brief d 叉堆算法：make_heap / push_heap / pop_heap / sort_heap / is_heap / is_heap_until
+ *
+ * ## 设计
+ * - 接口与语义与 <algorithm> 一致：[first, last) 为以 comp 定义的最大堆，first 为最大元素
+ * - 叉数 Arity 是可选的第一个模板参数，默认 2（与 std 的布局相同，std::is_heap 可直接检查）；
+ *   mystl::pop_heap<4>(first, last) 按 4 叉堆操作。同一区间的所有操作必须使用相同的叉数
+ * - 节点 i 的孩子为 Arity * i + 1 .. Arity * i + Arity，在内存中连续（通常只跨一到两条缓存行），
+ *   树高降为 log_Arity(n)。大堆（超出缓存）的 pop 由每层一次缓存缺失主导，
+ *   4 / 8 叉把缺失次数减为 1/2 / 1/3，代价是每层的比较从 1 次增加到 Arity - 1 次
+ *   （锦标赛式两两比较，彼此没有依赖）
+ * - 下沉用"先到底再上浮"（Floyd）：空位沿最大的孩子一路下移到叶子，再把元素从叶子上浮。
+ *   被下沉的元素通常来自堆尾、本来就很小，上浮几乎立即停止，
+ *   每层省去元素与最大孩子的那次比较
+ * - push 的上浮路径也变短：每层一次比较，层数为 log_Arity(n)
+ * - make_heap 自底向上建堆，O(n)
+ * - 元素只移动不拷贝；比较器按引用在内部传递，不会被复制
+ */
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "mystl/config/config.hpp"
 
 namespace mystl {
-// algorithms to be added
+
+namespace __details {
+
+template <std::size_t Arity>
+concept valid_heap_arity = Arity >= 2;
+
+// [child, child + N) 中最大元素的位置：两两比较的锦标赛，比较之间没有依赖，可以并行执行。
+// 多叉时随机数据上的比较结果不可预测，用算术选择代替分支；二叉保留分支，
+// 预测执行可以提前发出下一层的访存
+template <std::size_t N, bool Branchless, class RandomIt, class Compare>
+std::iter_difference_t<RandomIt> heap_max_child(RandomIt first, std::iter_difference_t<RandomIt> child,
+                                                Compare& comp) {
+  using diff_t = std::iter_difference_t<RandomIt>;
+  if constexpr (N == 1) {
+    return child;
+  } else {
+    const auto left = heap_max_child<N / 2, Branchless>(first, child, comp);
+    const auto right = heap_max_child<N - N / 2, Branchless>(first, child + static_cast<diff_t>(N / 2), comp);
+    if constexpr (Branchless) {
+      return left + (right - left) * static_cast<diff_t>(comp(*(first + left), *(first + right)));
+    } else {
+      return comp(*(first + left), *(first + right)) ? right : left;
+    }
+  }
+}
+
+// 把 value 放入空位 hole，向上比较直到 top
+template <std::size_t Arity = 2, class RandomIt, class Compare, class T>
+void heap_sift_up(RandomIt first, std::iter_difference_t<RandomIt> hole, std::iter_difference_t<RandomIt> top,
+                  T&& value, Compare& comp) {
+  constexpr auto d = static_cast<std::iter_difference_t<RandomIt>>(Arity);
+  auto parent = (hole - 1) / d;
+  while (hole > top && comp(*(first + parent), value)) {
+    *(first + hole) = std::move(*(first + parent));
+    hole = parent;
+    parent = (hole - 1) / d;
+  }
+  *(first + hole) = std::forward<T>(value);
+}
+
+// 空位 hole 沿最大的孩子下移到叶子，再把 value 从那里上浮
+template <std::size_t Arity = 2, class RandomIt, class Compare, class T>
+void heap_adjust(RandomIt first, std::iter_difference_t<RandomIt> hole, std::iter_difference_t<RandomIt> len,
+                 T&& value, Compare& comp) {
+  using diff_t = std::iter_difference_t<RandomIt>;
+  constexpr auto d = static_cast<diff_t>(Arity);
+  const auto top = hole;
+  // 孩子齐全的节点：d * hole + d <= len - 1
+  while (hole < (len - 1) / d) {
+    const auto child = heap_max_child<Arity, (Arity > 2)>(first, d * hole + 1, comp);
+    *(first + hole) = std::move(*(first + child));
+    hole = child;
+  }
+  // 最后一个内部节点可能只有部分孩子
+  if (const auto child = d * hole + 1; child < len) {
+    auto best = child;
+    for (diff_t c = child + 1; c < len; ++c) {
+      if (comp(*(first + best), *(first + c))) {
+        best = c;
+      }
+    }
+    *(first + hole) = std::move(*(first + best));
+    hole = best;
+  }
+  heap_sift_up<Arity>(first, hole, top, std::forward<T>(value), comp);
 }
 
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+void make_heap_impl(RandomIt first, RandomIt last, Compare& comp) {
+  constexpr auto d = static_cast<std::iter_difference_t<RandomIt>>(Arity);
+  const auto len = last - first;
+  if (len < 2) {
+    return;
+  }
+  for (auto parent = (len - 2) / d;; --parent) {
+    auto value = std::move(*(first + parent));
+    heap_adjust<Arity>(first, parent, len, std::move(value), comp);
+    if (parent == 0) {
+      return;
+    }
+  }
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+void push_heap_impl(RandomIt first, RandomIt last, Compare& comp) {
+  const auto len = last - first;
+  if (len < 2) {
+    return;
+  }
+  auto value = std::move(*(last - 1));
+  heap_sift_up<Arity>(first, len - 1, std::iter_difference_t<RandomIt>(0), std::move(value), comp);
+}
+
+// 把堆顶移到 last - 1，[first, last - 1) 重新成为堆
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+void pop_heap_impl(RandomIt first, RandomIt last, Compare& comp) {
+  const auto len = last - first;
+  if (len < 2) {
+    return;
+  }
+  auto value = std::move(*(last - 1));
+  *(last - 1) = std::move(*first);
+  heap_adjust<Arity>(first, std::iter_difference_t<RandomIt>(0), len - 1, std::move(value), comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+void sort_heap_impl(RandomIt first, RandomIt last, Compare& comp) {
+  for (; last - first > 1; --last) {
+    pop_heap_impl<Arity>(first, last, comp);
+  }
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+RandomIt is_heap_until_impl(RandomIt first, RandomIt last, Compare& comp) {
+  constexpr auto d = static_cast<std::iter_difference_t<RandomIt>>(Arity);
+  const auto len = last - first;
+  for (std::iter_difference_t<RandomIt> child = 1; child < len; ++child) {
+    if (comp(*(first + (child - 1) / d), *(first + child))) {
+      return first + child;
+    }
+  }
+  return last;
+}
+
+}  // namespace __details
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+void make_heap(RandomIt first, RandomIt last, Compare comp) {
+  __details::make_heap_impl<Arity>(first, last, comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+void make_heap(RandomIt first, RandomIt last) {
+  mystl::make_heap<Arity>(first, last, std::less<>());
+}
+
+// [first, last - 1) 为堆，把 last - 1 处的元素加入堆
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+void push_heap(RandomIt first, RandomIt last, Compare comp) {
+  __details::push_heap_impl<Arity>(first, last, comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+void push_heap(RandomIt first, RandomIt last) {
+  mystl::push_heap<Arity>(first, last, std::less<>());
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+void pop_heap(RandomIt first, RandomIt last, Compare comp) {
+  __details::pop_heap_impl<Arity>(first, last, comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+void pop_heap(RandomIt first, RandomIt last) {
+  mystl::pop_heap<Arity>(first, last, std::less<>());
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+void sort_heap(RandomIt first, RandomIt last, Compare comp) {
+  __details::sort_heap_impl<Arity>(first, last, comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+void sort_heap(RandomIt first, RandomIt last) {
+  mystl::sort_heap<Arity>(first, last, std::less<>());
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+RandomIt is_heap_until(RandomIt first, RandomIt last, Compare comp) {
+  return __details::is_heap_until_impl<Arity>(first, last, comp);
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+RandomIt is_heap_until(RandomIt first, RandomIt last) {
+  return mystl::is_heap_until<Arity>(first, last, std::less<>());
+}
+
+template <std::size_t Arity = 2, class RandomIt, class Compare>
+  requires __details::valid_heap_arity<Arity>
+bool is_heap(RandomIt first, RandomIt last, Compare comp) {
+  return __details::is_heap_until_impl<Arity>(first, last, comp) == last;
+}
+
+template <std::size_t Arity = 2, class RandomIt>
+  requires __details::valid_heap_arity<Arity>
+bool is_heap(RandomIt first, RandomIt last) {
+  return mystl::is_heap<Arity>(first, last, std::less<>());
+}
+
+}  // namespace mystl
+
 #endif  // MYSTL_ALGORITHMS_HEAP_HPP
@@ -1,10 +1,582 @@
 #ifndef MYSTL_ALGORITHMS_NON_MODIFYING_HPP
 #define MYSTL_ALGORITHMS_NON_MODIFYING_HPP
 
-// placeholder for for_each, find, count, mismatch, equal, etc.
+/**
+ * @file algorithms/non_modifying.hpp
+ * @brief 非修改序列算法：for_each、all_of / any_of / none_of、find / find_if / find_if_not、count / count_if、
+ *        mismatch、equal、search、adjacent_find、min_element、max_element、minmax_element
+ *
+ * 返回值与 <algorithm> 一致，包括有多个相等元素时返回哪一个。
+ *
+ * ## 向量化的快速路径
+ * 连续存储、元素为 1 / 2 / 4 / 8 字节整数或 float / double、谓词为默认的 == / < 时，
+ * 走 __details/find_kernels.hpp 的 SSE2 / AVX2 内核（运行期选择，没有则为标量）：
+ * - find / count：与广播的 value 逐块比较；value 与元素类型不同时，只有按数值比较的整数组合才走内核，
+ *   value 不在元素类型范围内时直接得出“没有”
+ * - mismatch / adjacent_find / search 的逐元素比较：两组向量比较出第一个不相等（相等）的位置；
+ *   search 同时比较模式的首尾元素筛选候选位置，再比较中间部分
+ * - equal：整数与指针逐位相等即相等，直接 memcmp；浮点数（+0 == -0，NaN != NaN）用向量比较
+ * - min_element / max_element / minmax_element：按 4 KiB 分块求每块的极值，记下极值所在的块，
+ *   最后只在该块内定位；块内第二遍命中 L1，整个区间只从内存读一遍。
+ *   浮点区间含 NaN 时 < 不是严格弱序，回到逐个比较的标量版本，以保持与 std 相同的结果
+ * 其他情况（自定义谓词、非连续迭代器、类类型元素）为逐个比较的标量循环。
+ */
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/algorithms/__details/find_kernels.hpp"
 
 namespace mystl {
-// algorithms to be added
+
+namespace __details {
+
+template <class Pred, class T>
+inline constexpr bool find_pred_is_equal_v = std::is_same_v<Pred, std::equal_to<>> ||
+                                             std::is_same_v<Pred, std::ranges::equal_to> ||
+                                             std::is_same_v<Pred, std::equal_to<T>>;
+
+template <class Compare, class T>
+inline constexpr bool find_compare_is_less_v =
+    std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::ranges::less> ||
+    std::is_same_v<Compare, std::less<T>>;
+
+// std::in_range 只接受有符号 / 无符号的标准整数类型（不含 bool 与字符类型）
+template <class T>
+concept find_std_integer = std::integral<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+                           !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+                           !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+// 元素类型 V 与 T 类型的 value 的 == 按数值比较（公共类型为有符号，或两者都无符号）时，
+// 等价于与 V(value) 比较，value 不在 V 的范围内则没有元素相等；unsigned 与负数比较会回绕，不在此列
+template <class V, class T>
+inline constexpr bool find_integer_compatible_v = false;
+
+template <find_std_integer V, find_std_integer T>
+inline constexpr bool find_integer_compatible_v<V, T> =
+    std::is_signed_v<std::common_type_t<V, T>> || (std::is_unsigned_v<V> && std::is_unsigned_v<T>);
+
+template <class V, class T>
+inline constexpr bool find_value_compatible_v = std::is_same_v<V, T> || find_integer_compatible_v<V, T>;
+
+template <class It, class T>
+inline constexpr bool find_use_simd_v = std::contiguous_iterator<It> && find_simd_type<std::iter_value_t<It>> &&
+                                        find_value_compatible_v<std::iter_value_t<It>, T>;
+
+// 两个连续区间元素类型相同、用默认的 == 逐个比较
+template <class It1, class It2, class Pred>
+inline constexpr bool compare_use_simd_v =
+    std::contiguous_iterator<It1> && std::contiguous_iterator<It2> &&
+    std::is_same_v<std::iter_value_t<It1>, std::iter_value_t<It2>> && find_simd_type<std::iter_value_t<It1>> &&
+    find_pred_is_equal_v<Pred, std::iter_value_t<It1>>;
+
+// 整数与指针 == 即对象表示逐位相等，可以直接 memcmp
+template <class It1, class It2, class Pred>
+inline constexpr bool equal_use_memcmp_v =
+    std::contiguous_iterator<It1> && std::contiguous_iterator<It2> &&
+    std::is_same_v<std::iter_value_t<It1>, std::iter_value_t<It2>> &&
+    (std::is_integral_v<std::iter_value_t<It1>> || std::is_pointer_v<std::iter_value_t<It1>>) &&
+    find_pred_is_equal_v<Pred, std::iter_value_t<It1>>;
+
+template <class It, class Compare>
+inline constexpr bool extreme_use_simd_v = std::contiguous_iterator<It> && extreme_simd_type<std::iter_value_t<It>> &&
+                                           find_compare_is_less_v<Compare, std::iter_value_t<It>>;
+
+// 极值分块的字节数：一块在第二遍定位时仍在 L1 中
+inline constexpr std::size_t extreme_block_bytes = 4096;
+
+// 非空区间中最小（Max 时最大）元素的下标；First 为假时取最后一个（minmax_element 的最大值）。
+// 含 NaN 时返回 n，由调用方走标量版本
+template <bool Max, bool First, class T>
+std::size_t extreme_index(const T* p, std::size_t n) noexcept {
+  constexpr std::size_t block = extreme_block_bytes / sizeof(T);
+  T best{};
+  std::size_t best_block = 0;
+  for (std::size_t b = 0; b < n; b += block) {
+    T m;
+    if (!reduce_extreme<Max>(p + b, std::min(block, n - b), m)) {
+      return n;
+    }
+    const bool better = b == 0 || (Max ? (First ? best < m : !(m < best)) : (First ? m < best : !(best < m)));
+    if (better) {
+      best = m;
+      best_block = b;
+    }
+  }
+  const std::size_t len = std::min(block, n - best_block);
+  if constexpr (First) {
+    return best_block + find_eq(p + best_block, len, best);
+  } else {
+    std::size_t i = len - 1;
+    while (!(p[best_block + i] == best)) {
+      --i;
+    }
+    return best_block + i;
+  }
+}
+
+// minmax_element：同一块的两次归约中第二次命中 L1
+template <class T>
+std::pair<std::size_t, std::size_t> minmax_index(const T* p, std::size_t n) noexcept {
+  constexpr std::size_t block = extreme_block_bytes / sizeof(T);
+  T lo{};
+  T hi{};
+  std::size_t lo_block = 0;
+  std::size_t hi_block = 0;
+  for (std::size_t b = 0; b < n; b += block) {
+    const std::size_t len = std::min(block, n - b);
+    T mn;
+    T mx;
+    if (!reduce_extreme<false>(p + b, len, mn) || !reduce_extreme<true>(p + b, len, mx)) {
+      return {n, n};
+    }
+    if (b == 0 || mn < lo) {
+      lo = mn;
+      lo_block = b;
+    }
+    if (b == 0 || !(mx < hi)) {
+      hi = mx;
+      hi_block = b;
+    }
+  }
+  const std::size_t lo_index = lo_block + find_eq(p + lo_block, std::min(block, n - lo_block), lo);
+  std::size_t i = std::min(block, n - hi_block) - 1;
+  while (!(p[hi_block + i] == hi)) {
+    --i;
+  }
+  return {lo_index, hi_block + i};
+}
+
+template <class ForwardIt, class Compare>
+ForwardIt min_element_scalar(ForwardIt first, ForwardIt last, Compare& comp) {
+  if (first == last) {
+    return last;
+  }
+  ForwardIt best = first;
+  while (++first != last) {
+    if (comp(*first, *best)) {
+      best = first;
+    }
+  }
+  return best;
+}
+
+template <class ForwardIt, class Compare>
+ForwardIt max_element_scalar(ForwardIt first, ForwardIt last, Compare& comp) {
+  if (first == last) {
+    return last;
+  }
+  ForwardIt best = first;
+  while (++first != last) {
+    if (comp(*best, *first)) {
+      best = first;
+    }
+  }
+  return best;
+}
+
+// 成对处理：两元素先互相比较，较小者与当前最小比较、较大者与当前最大比较，共约 3n/2 次比较
+template <class ForwardIt, class Compare>
+std::pair<ForwardIt, ForwardIt> minmax_element_scalar(ForwardIt first, ForwardIt last, Compare& comp) {
+  ForwardIt lo = first;
+  ForwardIt hi = first;
+  if (first == last || ++first == last) {
+    return {lo, hi};
+  }
+  if (comp(*first, *lo)) {
+    lo = first;
+  } else {
+    hi = first;
+  }
+  while (++first != last) {
+    ForwardIt i = first;
+    if (++first == last) {
+      if (comp(*i, *lo)) {
+        lo = i;
+      } else if (!comp(*i, *hi)) {
+        hi = i;
+      }
+      break;
+    }
+    if (comp(*first, *i)) {
+      if (comp(*first, *lo)) {
+        lo = first;
+      }
+      if (!comp(*i, *hi)) {
+        hi = i;
+      }
+    } else {
+      if (comp(*i, *lo)) {
+        lo = i;
+      }
+      if (!comp(*first, *hi)) {
+        hi = first;
+      }
+    }
+  }
+  return {lo, hi};
+}
+
+}  // namespace __details
+
+// ---------------------------------------------------------------------------
+// for_each
+// ---------------------------------------------------------------------------
+
+template <class InputIt, class UnaryFunc>
+UnaryFunc for_each(InputIt first, InputIt last, UnaryFunc f) {
+  for (; first != last; ++first) {
+    f(*first);
+  }
+  return f;
+}
+
+// ---------------------------------------------------------------------------
+// find / find_if / find_if_not / all_of / any_of / none_of
+// ---------------------------------------------------------------------------
+
+template <class InputIt, class T = std::iter_value_t<InputIt>>
+InputIt find(InputIt first, InputIt last, const T& value) {
+  if constexpr (__details::find_use_simd_v<InputIt, T>) {
+    using V = std::iter_value_t<InputIt>;
+    if constexpr (!std::is_same_v<V, T>) {
+      if (!std::in_range<V>(value)) {
+        return last;
+      }
+    }
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t i = __details::find_eq(std::to_address(first), n, static_cast<V>(value));
+    return first + static_cast<std::iter_difference_t<InputIt>>(i);
+  } else {
+    for (; first != last; ++first) {
+      if (*first == value) {
+        return first;
+      }
+    }
+    return last;
+  }
+}
+
+template <class InputIt, class UnaryPred>
+InputIt find_if(InputIt first, InputIt last, UnaryPred pred) {
+  for (; first != last; ++first) {
+    if (pred(*first)) {
+      return first;
+    }
+  }
+  return last;
+}
+
+template <class InputIt, class UnaryPred>
+InputIt find_if_not(InputIt first, InputIt last, UnaryPred pred) {
+  for (; first != last; ++first) {
+    if (!pred(*first)) {
+      return first;
+    }
+  }
+  return last;
+}
+
+template <class InputIt, class UnaryPred>
+bool all_of(InputIt first, InputIt last, UnaryPred pred) {
+  return mystl::find_if_not(first, last, pred) == last;
+}
+
+template <class InputIt, class UnaryPred>
+bool any_of(InputIt first, InputIt last, UnaryPred pred) {
+  return mystl::find_if(first, last, pred) != last;
+}
+
+template <class InputIt, class UnaryPred>
+bool none_of(InputIt first, InputIt last, UnaryPred pred) {
+  return mystl::find_if(first, last, pred) == last;
+}
+
+// ---------------------------------------------------------------------------
+// count / count_if
+// ---------------------------------------------------------------------------
+
+template <class InputIt, class T = std::iter_value_t<InputIt>>
+std::iter_difference_t<InputIt> count(InputIt first, InputIt last, const T& value) {
+  using D = std::iter_difference_t<InputIt>;
+  if constexpr (__details::find_use_simd_v<InputIt, T>) {
+    using V = std::iter_value_t<InputIt>;
+    if constexpr (!std::is_same_v<V, T>) {
+      if (!std::in_range<V>(value)) {
+        return 0;
+      }
+    }
+    const auto n = static_cast<std::size_t>(last - first);
+    return static_cast<D>(__details::count_eq(std::to_address(first), n, static_cast<V>(value)));
+  } else {
+    D c = 0;
+    for (; first != last; ++first) {
+      if (*first == value) {
+        ++c;
+      }
+    }
+    return c;
+  }
 }
 
+template <class InputIt, class UnaryPred>
+std::iter_difference_t<InputIt> count_if(InputIt first, InputIt last, UnaryPred pred) {
+  std::iter_difference_t<InputIt> c = 0;
+  for (; first != last; ++first) {
+    if (pred(*first)) {
+      ++c;
+    }
+  }
+  return c;
+}
+
+// ---------------------------------------------------------------------------
+// mismatch / equal
+// ---------------------------------------------------------------------------
+
+template <class InputIt1, class InputIt2, class BinaryPred>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPred pred) {
+  if constexpr (__details::compare_use_simd_v<InputIt1, InputIt2, BinaryPred>) {
+    const auto n = static_cast<std::size_t>(last1 - first1);
+    const std::size_t i = __details::find_cmp<false>(std::to_address(first1), std::to_address(first2), n);
+    return {first1 + static_cast<std::iter_difference_t<InputIt1>>(i),
+            first2 + static_cast<std::iter_difference_t<InputIt2>>(i)};
+  } else {
+    while (first1 != last1 && pred(*first1, *first2)) {
+      ++first1;
+      ++first2;
+    }
+    return {first1, first2};
+  }
+}
+
+template <class InputIt1, class InputIt2>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  return mystl::mismatch(first1, last1, first2, std::equal_to<>());
+}
+
+template <class InputIt1, class InputIt2, class BinaryPred>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+                                       BinaryPred pred) {
+  if constexpr (std::random_access_iterator<InputIt1> && std::random_access_iterator<InputIt2>) {
+    const auto n = std::min(static_cast<std::size_t>(last1 - first1), static_cast<std::size_t>(last2 - first2));
+    return mystl::mismatch(first1, first1 + static_cast<std::iter_difference_t<InputIt1>>(n), first2, pred);
+  } else {
+    while (first1 != last1 && first2 != last2 && pred(*first1, *first2)) {
+      ++first1;
+      ++first2;
+    }
+    return {first1, first2};
+  }
+}
+
+template <class InputIt1, class InputIt2>
+std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+  return mystl::mismatch(first1, last1, first2, last2, std::equal_to<>());
+}
+
+template <class InputIt1, class InputIt2, class BinaryPred>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPred pred) {
+  if constexpr (__details::equal_use_memcmp_v<InputIt1, InputIt2, BinaryPred>) {
+    const auto n = static_cast<std::size_t>(last1 - first1);
+    return n == 0 ||
+           std::memcmp(std::to_address(first1), std::to_address(first2), n * sizeof(std::iter_value_t<InputIt1>)) == 0;
+  } else {
+    return mystl::mismatch(first1, last1, first2, pred).first == last1;
+  }
+}
+
+template <class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  return mystl::equal(first1, last1, first2, std::equal_to<>());
+}
+
+template <class InputIt1, class InputIt2, class BinaryPred>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, BinaryPred pred) {
+  if constexpr (std::random_access_iterator<InputIt1> && std::random_access_iterator<InputIt2>) {
+    if (last1 - first1 != static_cast<std::iter_difference_t<InputIt1>>(last2 - first2)) {
+      return false;
+    }
+    return mystl::equal(first1, last1, first2, pred);
+  } else {
+    const auto [it1, it2] = mystl::mismatch(first1, last1, first2, last2, pred);
+    return it1 == last1 && it2 == last2;
+  }
+}
+
+template <class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2) {
+  return mystl::equal(first1, last1, first2, last2, std::equal_to<>());
+}
+
+// ---------------------------------------------------------------------------
+// search / adjacent_find
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief [s_first, s_last) 在 [first, last) 中第一次出现的位置；模式为空时返回 first
+ *
+ * 逐个候选起点比较，最坏 O(n·m)，与 std::search 的默认搜索器相同
+ */
+template <class ForwardIt1, class ForwardIt2, class BinaryPred>
+ForwardIt1 search(ForwardIt1 first, ForwardIt1 last, ForwardIt2 s_first, ForwardIt2 s_last, BinaryPred pred) {
+  if constexpr (__details::compare_use_simd_v<ForwardIt1, ForwardIt2, BinaryPred>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto m = static_cast<std::size_t>(s_last - s_first);
+    if (m == 0) {
+      return first;
+    }
+    if (m > n) {
+      return last;
+    }
+    const auto* hay = std::to_address(first);
+    const auto* needle = std::to_address(s_first);
+    const std::size_t starts = n - m + 1;
+    for (std::size_t i = 0; i < starts; ++i) {
+      i += __details::find_eq_pair(hay + i, starts - i, m - 1, needle[0], needle[m - 1]);
+      if (i == starts) {
+        break;
+      }
+      if (m < 3 || mystl::equal(hay + i + 1, hay + i + m - 1, needle + 1)) {
+        return first + static_cast<std::iter_difference_t<ForwardIt1>>(i);
+      }
+    }
+    return last;
+  } else {
+    for (;; ++first) {
+      ForwardIt1 it = first;
+      for (ForwardIt2 s_it = s_first;; ++it, ++s_it) {
+        if (s_it == s_last) {
+          return first;
+        }
+        if (it == last) {
+          return last;
+        }
+        if (!pred(*it, *s_it)) {
+          break;
+        }
+      }
+    }
+  }
+}
+
+template <class ForwardIt1, class ForwardIt2>
+ForwardIt1 search(ForwardIt1 first, ForwardIt1 last, ForwardIt2 s_first, ForwardIt2 s_last) {
+  return mystl::search(first, last, s_first, s_last, std::equal_to<>());
+}
+
+/**
+ * @brief 第一对满足 pred(*it, *(it + 1)) 的相邻元素中前者的位置；没有则返回 last
+ */
+template <class ForwardIt, class BinaryPred>
+ForwardIt adjacent_find(ForwardIt first, ForwardIt last, BinaryPred pred) {
+  if constexpr (__details::compare_use_simd_v<ForwardIt, ForwardIt, BinaryPred>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < 2) {
+      return last;
+    }
+    const auto* p = std::to_address(first);
+    const std::size_t i = __details::find_cmp<true>(p, p + 1, n - 1);
+    return i == n - 1 ? last : first + static_cast<std::iter_difference_t<ForwardIt>>(i);
+  } else {
+    if (first == last) {
+      return last;
+    }
+    for (ForwardIt next = std::next(first); next != last; ++next, ++first) {
+      if (pred(*first, *next)) {
+        return first;
+      }
+    }
+    return last;
+  }
+}
+
+template <class ForwardIt>
+ForwardIt adjacent_find(ForwardIt first, ForwardIt last) {
+  return mystl::adjacent_find(first, last, std::equal_to<>());
+}
+
+// ---------------------------------------------------------------------------
+// min_element / max_element / minmax_element
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief 第一个最小元素
+ */
+template <class ForwardIt, class Compare>
+ForwardIt min_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if constexpr (__details::extreme_use_simd_v<ForwardIt, Compare>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n == 0) {
+      return last;
+    }
+    const std::size_t i = __details::extreme_index<false, true>(std::to_address(first), n);
+    if (i != n) {
+      return first + static_cast<std::iter_difference_t<ForwardIt>>(i);
+    }
+  }
+  return __details::min_element_scalar(first, last, comp);
+}
+
+template <class ForwardIt>
+ForwardIt min_element(ForwardIt first, ForwardIt last) {
+  return mystl::min_element(first, last, std::less<>());
+}
+
+/**
+ * @brief 第一个最大元素
+ */
+template <class ForwardIt, class Compare>
+ForwardIt max_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if constexpr (__details::extreme_use_simd_v<ForwardIt, Compare>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n == 0) {
+      return last;
+    }
+    const std::size_t i = __details::extreme_index<true, true>(std::to_address(first), n);
+    if (i != n) {
+      return first + static_cast<std::iter_difference_t<ForwardIt>>(i);
+    }
+  }
+  return __details::max_element_scalar(first, last, comp);
+}
+
+template <class ForwardIt>
+ForwardIt max_element(ForwardIt first, ForwardIt last) {
+  return mystl::max_element(first, last, std::less<>());
+}
+
+/**
+ * @brief {第一个最小元素, 最后一个最大元素}；空区间返回 {last, last}
+ */
+template <class ForwardIt, class Compare>
+std::pair<ForwardIt, ForwardIt> minmax_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if constexpr (__details::extreme_use_simd_v<ForwardIt, Compare>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n == 0) {
+      return {last, last};
+    }
+    const auto [lo, hi] = __details::minmax_index(std::to_address(first), n);
+    if (lo != n) {
+      using D = std::iter_difference_t<ForwardIt>;
+      return {first + static_cast<D>(lo), first + static_cast<D>(hi)};
+    }
+  }
+  return __details::minmax_element_scalar(first, last, comp);
+}
+
+template <class ForwardIt>
+std::pair<ForwardIt, ForwardIt> minmax_element(ForwardIt first, ForwardIt last) {
+  return mystl::minmax_element(first, last, std::less<>());
+}
+
+}  // namespace mystl
+
 #endif  // MYSTL_ALGORITHMS_NON_MODIFYING_HPP
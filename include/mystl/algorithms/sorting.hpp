@@ -1,10 +1,1703 @@
 #ifndef MYSTL_ALGORITHMS_SORTING_HPP
 #define MYSTL_ALGORITHMS_SORTING_HPP
 
-// placeholder for sort, stable_sort, partial_sort, nth_element
+/**
+ * @file algorithms/sorting.hpp
+ * @brief 排序：sort（pattern-defeating quicksort）、stable_sort、radix_sort / radix_sort_by_key、
+ *        选择：nth_element、partial_sort、top_k，is_sorted、is_sorted_until，
+ *        以及 sort / stable_sort / radix_sort 的执行策略重载
+ *
+ * ## sort 的设计（pdqsort）
+ * - 主体为内省式快速排序：
+ *   - 少于 24 个元素时用插入排序；不是最左侧的区间以左邻元素为哨兵，内层循环不检查边界
+ *   - 枢轴取三数中值，超过 128 个元素时取九数中值（ninther）
+ *   - 划分后两侧有一侧不足 1/8 视为不平衡，打乱两侧若干元素以破坏构造出的坏模式；
+ *     不平衡次数超过 log2(n) 时改用堆排序（heap.hpp），最坏 O(n log n)
+ * - 模式识别：
+ *   - 整个区间单调不减或单调不增时一次扫描后直接返回或原地反转，O(n)
+ *   - 划分时若一次交换都不需要，两侧各尝试一次插入排序，移动次数超过 8 即放弃，
+ *     因此基本有序的输入接近 O(n)
+ *   - 枢轴与左邻元素相等时把等于枢轴的元素整体划到左侧，大量重复键的输入接近 O(n)
+ * - 算术类型且比较器为 less / greater 时使用无分支的分块划分（BlockQuicksort）：
+ *   每侧先把 64 个元素的比较结果写成偏移量数组，再成对交换，比较结果不参与分支，
+ *   随机输入不再有一半的分支预测失败
+ *
+ * ## radix_sort 的设计
+ * - 整数、float、double 键：LSD，每趟按一个字节分配，共 sizeof(key) 趟
+ *   - 键先映射为顺序相同的无符号整数（有符号数翻转符号位，浮点数按符号翻转符号位或全部位）
+ *   - 一次遍历统计所有字节的直方图；某字节在全部元素上相同（如时间戳、ID 的高位）时跳过该趟
+ *   - 元素在原区间与临时缓冲区之间来回移动，趟数为奇数时最后移回原区间
+ *   - 数据超出缓存（256 KiB）时先按最高的非平凡字节分桶一趟，再对每个桶在缓存内做 LSD：
+ *     跨越内存的分散写很贵，这样只有一趟分散写落在内存上
+ *   - 稳定：等价键保持原有相对顺序
+ * - 字符串键：MSD（American flag），原地按字节分桶，公共前缀只扫描不交换，小桶改用插入排序
+ *   - 每个元素的桶号缓存在一个 uint16_t 数组里并随元素一起交换，交换循环不再重新取键
+ *   - 不稳定
+ * - 少于 64 个元素时直接插入排序
+ *
+ * ## stable_sort 的设计（powersort）
+ * - 自然归并排序：从左到右切出最长的单调段（严格递减段原地反转），短于 32 的段用插入排序补足
+ * - 合并顺序采用 powersort 策略：相邻两段边界的 power 由两段中点在 [0, n) 中的二进制位置决定，
+ *   新段入栈前先归并栈顶 power 更大的段。得到的归并树接近按段长的最优树，
+ *   代价为 O(n + n·H)，H 为各段长度分布的熵；已有序的输入只有一段，O(n)，不分配内存
+ * - 归并（同 timsort）：
+ *   - 先飞奔剪掉两端已经就位的元素，只把较短的一侧移入缓冲区，缓冲区最多 n / 2 个元素
+ *   - 逐个比较时一侧连续胜出 7 次后改为飞奔：指数探测加二分，整段搬运；
+ *     飞奔的门槛随效果自适应（有效时降低，无效时提高）
+ *   - 缓冲区分配失败时改为原地归并：二分切分 + rotate 递归，O(n log n) 每次归并
+ *
+ * ## 选择（nth_element / partial_sort / top_k）
+ * - nth_element 为 introselect：枢轴选取与划分同 pdqsort，只进入 nth 所在的一侧；
+ *   不平衡划分超过常数次（8 次）后改用中位数的中位数作枢轴，最坏 O(n)
+ * - partial_sort：k 较小时堆选择，k 较大（超过 n / 256）时 nth_element 后排序前 k 个
+ * - top_k 只读一遍输入：候选缓冲区填满 2k 个后用 nth_element 留下前 k 个，第 k 个成为阈值，
+ *   之后只收越过阈值的元素
+ * - 阈值过滤：float、double、4 / 8 字节整数在连续存储中且比较器为 less / greater 时，
+ *   用 SSE2 / AVX2 一次比较一整块（AVX2 为 4 个向量共 128 字节），整块都不越过阈值就跳过；
+ *   阈值收紧后绝大多数元素在这一步被拒绝，不进入堆或缓冲区
+ *
+ * ## 并行版本（execution::par）
+ * - 在 execution::thread_pool 上做并行归并排序：区间对半拆分、两半并行排序到暂存区，
+ *   再并行归并回来，原区间与暂存区逐层交替，不做额外的复制
+ * - 归并也并行：较长一侧取中点，在另一侧二分出切分位置，两对子区间互不相干
+ * - 叶子约为 n / (4 * 线程数) 个元素，分别用顺序的 pdqsort、归并排序或基数排序；
+ *   基数排序的叶子之间按变换后的键归并，定长键整体仍然稳定
+ * - 少于 32768 个元素或线程池只有一个线程时直接走顺序版本
+ * - 并行的 sort 也需要 n 个元素的临时缓冲区
+ *
+ * ## 与 std::sort 的差异
+ * - 与 std::sort 一样不稳定，等价元素的相对顺序未指定，且与 std::sort 的结果顺序不一定相同
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mystl/algorithms/__details/select_kernels.hpp"
+#include "mystl/algorithms/heap.hpp"
+#include "mystl/config/config.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/execution/policy.hpp"
+#include "mystl/memory/allocator.hpp"
 
 namespace mystl {
-// algorithms to be added
+
+namespace __details {
+
+inline constexpr std::ptrdiff_t sort_insertion_threshold = 24;
+inline constexpr std::ptrdiff_t sort_ninther_threshold = 128;
+inline constexpr std::ptrdiff_t sort_partial_insertion_limit = 8;
+// introselect 允许的不平衡划分次数；取常数而非 log2(n)，退化前的总代价才是 O(n)
+inline constexpr int select_bad_partition_limit = 8;
+inline constexpr std::size_t sort_block_size = 64;
+inline constexpr std::size_t sort_cacheline_size = 64;
+
+template <class C>
+inline constexpr bool is_sort_less_or_greater_v =
+    std::is_same_v<C, std::less<>> || std::is_same_v<C, std::greater<>> || std::is_same_v<C, std::ranges::less> ||
+    std::is_same_v<C, std::ranges::greater>;
+
+// 比较结果可以无分支地参与运算：算术键配合内置的 < / >
+template <class RandomIt, class Compare>
+inline constexpr bool sort_use_branchless_v =
+    std::is_arithmetic_v<std::iter_value_t<RandomIt>> &&
+    (is_sort_less_or_greater_v<Compare> || std::is_same_v<Compare, std::less<std::iter_value_t<RandomIt>>> ||
+     std::is_same_v<Compare, std::greater<std::iter_value_t<RandomIt>>>);
+
+template <class RandomIt, class Compare>
+void insertion_sort(RandomIt begin, RandomIt end, Compare& comp) {
+  if (begin == end) {
+    return;
+  }
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// *(begin - 1) 不大于区间内任何元素，充当哨兵
+template <class RandomIt, class Compare>
+void unguarded_insertion_sort(RandomIt begin, RandomIt end, Compare& comp) {
+  if (begin == end) {
+    return;
+  }
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// 插入排序，但移动次数超过上限时放弃并返回 false
+template <class RandomIt, class Compare>
+bool partial_insertion_sort(RandomIt begin, RandomIt end, Compare& comp) {
+  if (begin == end) {
+    return true;
+  }
+  std::ptrdiff_t moved = 0;
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      auto tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      moved += cur - sift;
+    }
+    if (moved > sort_partial_insertion_limit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class RandomIt, class Compare>
+void sort2(RandomIt a, RandomIt b, Compare& comp) {
+  if (comp(*b, *a)) {
+    std::iter_swap(a, b);
+  }
+}
+
+// 把 *a、*b、*c 排好序，中值落在 b
+template <class RandomIt, class Compare>
+void sort3(RandomIt a, RandomIt b, RandomIt c, Compare& comp) {
+  sort2(a, b, comp);
+  sort2(b, c, comp);
+  sort2(a, b, comp);
+}
+
+template <class T>
+T* align_cacheline(T* p) noexcept {
+  const auto ip = reinterpret_cast<std::uintptr_t>(p);
+  return reinterpret_cast<T*>((ip + sort_cacheline_size - 1) & ~std::uintptr_t{sort_cacheline_size - 1});
+}
+
+// 按偏移量交换左右两侧错位的元素；两侧个数相同时逐对交换，否则用一次轮换减少移动
+template <class RandomIt>
+void swap_offsets(RandomIt first, RandomIt last, const unsigned char* offsets_l, const unsigned char* offsets_r,
+                  std::size_t num, bool use_swaps) {
+  if (use_swaps) {
+    for (std::size_t i = 0; i < num; ++i) {
+      std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+    }
+  } else if (num > 0) {
+    RandomIt l = first + offsets_l[0];
+    RandomIt r = last - offsets_r[0];
+    auto tmp = std::move(*l);
+    *l = std::move(*r);
+    for (std::size_t i = 1; i < num; ++i) {
+      l = first + offsets_l[i];
+      *r = std::move(*l);
+      r = last - offsets_r[i];
+      *l = std::move(*r);
+    }
+    *r = std::move(tmp);
+  }
+}
+
+// 以 *begin 为枢轴划分：小于枢轴的在左，不小于的在右。返回枢轴的最终位置，
+// 以及划分前区间是否已经有序划分（一次交换都不需要）
+template <class RandomIt, class Compare>
+std::pair<RandomIt, bool> partition_right(RandomIt begin, RandomIt end, Compare& comp) {
+  auto pivot = std::move(*begin);
+  RandomIt first = begin;
+  RandomIt last = end;
+
+  // 中值选取保证右侧存在不小于枢轴的元素，左侧扫描不会越界
+  while (comp(*++first, pivot)) {
+  }
+  // 左侧扫描一步都没走时，右侧没有哨兵
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  RandomIt pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// 与 partition_right 结果相同，但比较结果先按块写成偏移量，不参与分支
+template <class RandomIt, class Compare>
+std::pair<RandomIt, bool> partition_right_branchless(RandomIt begin, RandomIt end, Compare& comp) {
+  auto pivot = std::move(*begin);
+  RandomIt first = begin;
+  RandomIt last = end;
+
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  if (!already_partitioned) {
+    std::iter_swap(first, last);
+    ++first;
+
+    // 偏移量数组按缓存行对齐
+    unsigned char offsets_l_storage[sort_block_size + sort_cacheline_size];
+    unsigned char offsets_r_storage[sort_block_size + sort_cacheline_size];
+    unsigned char* offsets_l = align_cacheline(offsets_l_storage);
+    unsigned char* offsets_r = align_cacheline(offsets_r_storage);
+
+    RandomIt offsets_l_base = first;
+    RandomIt offsets_r_base = last;
+    std::size_t num_l = 0;
+    std::size_t num_r = 0;
+    std::size_t start_l = 0;
+    std::size_t start_r = 0;
+
+    while (first < last) {
+      // 只为空了的一侧补充偏移量；两侧都空时平分剩余的未知区间
+      const auto num_unknown = static_cast<std::size_t>(last - first);
+      const std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      const std::size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+      // 左侧记录不小于枢轴（放错侧）的元素偏移
+      if (left_split >= sort_block_size) {
+        for (std::size_t i = 0; i < sort_block_size;) {
+          for (int k = 0; k < 8; ++k) {
+            offsets_l[num_l] = static_cast<unsigned char>(i++);
+            num_l += !comp(*first, pivot);
+            ++first;
+          }
+        }
+      } else {
+        for (std::size_t i = 0; i < left_split;) {
+          offsets_l[num_l] = static_cast<unsigned char>(i++);
+          num_l += !comp(*first, pivot);
+          ++first;
+        }
+      }
+
+      // 右侧记录小于枢轴的元素偏移（相对 offsets_r_base 向左）
+      if (right_split >= sort_block_size) {
+        for (std::size_t i = 0; i < sort_block_size;) {
+          for (int k = 0; k < 8; ++k) {
+            offsets_r[num_r] = static_cast<unsigned char>(++i);
+            num_r += comp(*--last, pivot);
+          }
+        }
+      } else {
+        for (std::size_t i = 0; i < right_split;) {
+          offsets_r[num_r] = static_cast<unsigned char>(++i);
+          num_r += comp(*--last, pivot);
+        }
+      }
+
+      const std::size_t num = std::min(num_l, num_r);
+      swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+      num_l -= num;
+      num_r -= num;
+      start_l += num;
+      start_r += num;
+
+      if (num_l == 0) {
+        start_l = 0;
+        offsets_l_base = first;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        offsets_r_base = last;
+      }
+    }
+
+    // 一侧还剩放错的元素：全部交换到中间
+    if (num_l != 0) {
+      offsets_l += start_l;
+      while (num_l-- != 0) {
+        std::iter_swap(offsets_l_base + offsets_l[num_l], --last);
+      }
+      first = last;
+    }
+    if (num_r != 0) {
+      offsets_r += start_r;
+      while (num_r-- != 0) {
+        std::iter_swap(offsets_r_base - offsets_r[num_r], first);
+        ++first;
+      }
+      last = first;
+    }
+  }
+
+  RandomIt pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// 等于枢轴的元素划到左侧，返回枢轴位置；用于枢轴与左邻元素相等（重复键很多）时
+template <class RandomIt, class Compare>
+RandomIt partition_left(RandomIt begin, RandomIt end, Compare& comp) {
+  auto pivot = std::move(*begin);
+  RandomIt first = begin;
+  RandomIt last = end;
+
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+
+  RandomIt pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+template <bool Branchless, class RandomIt, class Compare>
+void pdqsort_loop(RandomIt begin, RandomIt end, Compare& comp, int bad_allowed, bool leftmost) {
+  using diff_t = std::iter_difference_t<RandomIt>;
+
+  // 对右侧区间用循环代替递归，只对左侧递归
+  while (true) {
+    const diff_t size = end - begin;
+
+    if (size < sort_insertion_threshold) {
+      if (leftmost) {
+        insertion_sort(begin, end, comp);
+      } else {
+        unguarded_insertion_sort(begin, end, comp);
+      }
+      return;
+    }
+
+    // 中值放到 begin 作为枢轴
+    const diff_t s2 = size / 2;
+    if (size > sort_ninther_threshold) {
+      sort3(begin, begin + s2, end - 1, comp);
+      sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+      sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+      sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+      std::iter_swap(begin, begin + s2);
+    } else {
+      sort3(begin + s2, begin, end - 1, comp);
+    }
+
+    // 左邻元素（上一轮的枢轴）不小于当前枢轴，说明当前枢轴等于它：
+    // 把等于枢轴的元素全部划到左侧，左侧无需再排序
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = partition_left(begin, end, comp) + 1;
+      continue;
+    }
+
+    std::pair<RandomIt, bool> part;
+    if constexpr (Branchless) {
+      part = partition_right_branchless(begin, end, comp);
+    } else {
+      part = partition_right(begin, end, comp);
+    }
+    const RandomIt pivot_pos = part.first;
+    const bool already_partitioned = part.second;
+
+    const diff_t l_size = pivot_pos - begin;
+    const diff_t r_size = end - (pivot_pos + 1);
+    const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+    if (highly_unbalanced) {
+      if (--bad_allowed == 0) {
+        make_heap_impl(begin, end, comp);
+        sort_heap_impl(begin, end, comp);
+        return;
+      }
+
+      // 打乱两侧若干位置，破坏使中值选取失效的模式
+      if (l_size >= sort_insertion_threshold) {
+        std::iter_swap(begin, begin + l_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > sort_ninther_threshold) {
+          std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+          std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+          std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+          std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+      }
+      if (r_size >= sort_insertion_threshold) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        std::iter_swap(end - 1, end - r_size / 4);
+        if (r_size > sort_ninther_threshold) {
+          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+          std::iter_swap(end - 2, end - (1 + r_size / 4));
+          std::iter_swap(end - 3, end - (2 + r_size / 4));
+        }
+      }
+    } else if (already_partitioned && partial_insertion_sort(begin, pivot_pos, comp) &&
+               partial_insertion_sort(pivot_pos + 1, end, comp)) {
+      // 划分平衡且无需交换：两侧很可能已经有序，插入排序在少量移动内完成即结束
+      return;
+    }
+
+    pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+// 整个区间单调不减时返回 true；单调不增时原地反转后返回 true。
+// 遇到第一个方向不符的相邻对即停止，随机输入只多看几个元素
+template <class RandomIt, class Compare>
+bool sort_monotonic_run(RandomIt begin, RandomIt end, Compare& comp) {
+  RandomIt cur = begin + 1;
+  if (comp(*cur, *begin)) {
+    while (++cur != end && !comp(*(cur - 1), *cur)) {
+    }
+    if (cur != end) {
+      return false;
+    }
+    std::reverse(begin, end);
+    return true;
+  }
+  while (++cur != end && !comp(*cur, *(cur - 1))) {
+  }
+  return cur == end;
+}
+
+template <class RandomIt, class Compare>
+void sort_impl(RandomIt begin, RandomIt end, Compare& comp) {
+  if (end - begin < 2 || sort_monotonic_run(begin, end, comp)) {
+    return;
+  }
+  const int bad_allowed = static_cast<int>(std::bit_width(static_cast<std::size_t>(end - begin))) - 1;
+  pdqsort_loop<sort_use_branchless_v<RandomIt, Compare>>(begin, end, comp, bad_allowed, true);
+}
+
+}  // namespace __details
+
+/**
+ * @brief 把 [first, last) 按 comp 升序排列（不稳定），最坏 O(n log n)
+ */
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  __details::sort_impl(first, last, comp);
+}
+
+template <class RandomIt>
+void sort(RandomIt first, RandomIt last) {
+  mystl::sort(first, last, std::less<>());
+}
+
+template <class ForwardIt, class Compare>
+ForwardIt is_sorted_until(ForwardIt first, ForwardIt last, Compare comp) {
+  if (first == last) {
+    return last;
+  }
+  for (ForwardIt next = std::next(first); next != last; first = next, ++next) {
+    if (comp(*next, *first)) {
+      return next;
+    }
+  }
+  return last;
+}
+
+template <class ForwardIt>
+ForwardIt is_sorted_until(ForwardIt first, ForwardIt last) {
+  return mystl::is_sorted_until(first, last, std::less<>());
+}
+
+template <class ForwardIt, class Compare>
+bool is_sorted(ForwardIt first, ForwardIt last, Compare comp) {
+  return mystl::is_sorted_until(first, last, comp) == last;
+}
+
+template <class ForwardIt>
+bool is_sorted(ForwardIt first, ForwardIt last) {
+  return mystl::is_sorted(first, last, std::less<>());
+}
+
+namespace __details {
+
+// 排序用的临时缓冲区：n 个元素的存储。
+// 平凡可复制类型不构造元素；其他类型构造时把源区间的元素移入缓冲区（holds_source 为真），
+// 之后两边只做移动赋值，析构时销毁
+template <class T>
+class sort_buffer {
+public:
+  static constexpr bool holds_source = !std::is_trivially_copyable_v<T>;
+
+  template <class It>
+  sort_buffer(It source, std::size_t n) : data_(allocator<T>().allocate(n)), size_(n) {
+    if constexpr (holds_source) {
+      try {
+        std::uninitialized_move_n(source, n, data_);
+      } catch (...) {
+        allocator<T>().deallocate(data_, size_);
+        throw;
+      }
+    }
+  }
+
+  sort_buffer(const sort_buffer&) = delete;
+  sort_buffer& operator=(const sort_buffer&) = delete;
+
+  ~sort_buffer() {
+    if constexpr (holds_source) {
+      std::destroy_n(data_, size_);
+    }
+    allocator<T>().deallocate(data_, size_);
+  }
+
+  T* data() const noexcept { return data_; }
+
+private:
+  T* data_;
+  std::size_t size_;
+};
+
+inline constexpr std::ptrdiff_t radix_insertion_threshold = 64;
+inline constexpr std::ptrdiff_t radix_string_insertion_threshold = 32;
+inline constexpr std::size_t radix_cache_bytes = std::size_t{1} << 18;
+
+template <class K>
+concept radix_fixed_key = std::is_integral_v<K> || std::is_enum_v<K> || std::is_same_v<K, float> ||
+                          std::is_same_v<K, double>;
+
+template <class K>
+concept radix_string_key = !radix_fixed_key<K> && (std::is_convertible_v<const K&, std::string_view> ||
+                                                   std::is_convertible_v<const K&, string_view>);
+
+// 把键映射为无符号整数，无符号比较的顺序与键的顺序相同：
+// 有符号整数翻转符号位；浮点数为正时翻转符号位、为负时翻转全部位
+template <class K>
+MYSTL_FORCE_INLINE auto radix_unsigned(K k) noexcept {
+  if constexpr (std::is_enum_v<K>) {
+    return radix_unsigned(static_cast<std::underlying_type_t<K>>(k));
+  } else if constexpr (std::is_same_v<K, bool>) {
+    return static_cast<std::uint8_t>(k);
+  } else if constexpr (std::is_integral_v<K>) {
+    using U = std::make_unsigned_t<K>;
+    U u = static_cast<U>(k);
+    if constexpr (std::is_signed_v<K>) {
+      u ^= static_cast<U>(U{1} << (sizeof(U) * 8 - 1));
+    }
+    return u;
+  } else {
+    using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+    const U u = std::bit_cast<U>(k);
+    constexpr U sign = U{1} << (sizeof(U) * 8 - 1);
+    const U mask = static_cast<U>(U{0} - (u >> (sizeof(U) * 8 - 1))) | sign;
+    return static_cast<U>(u ^ mask);
+  }
+}
+
+template <class K>
+MYSTL_FORCE_INLINE std::string_view radix_string_view(const K& k) noexcept {
+  if constexpr (std::is_convertible_v<const K&, std::string_view>) {
+    return std::string_view(k);
+  } else {
+    const string_view v(k);
+    return std::string_view(v.data(), v.size());
+  }
+}
+
+// 小区间：按变换后的键做插入排序（稳定）
+template <class RandomIt, class KeyFn>
+void radix_insertion_sort(RandomIt first, RandomIt last, KeyFn& key) {
+  auto less = [&](const auto& a, const auto& b) { return radix_unsigned(key(a)) < radix_unsigned(key(b)); };
+  insertion_sort(first, last, less);
+}
+
+// 一趟 LSD 分配：按第 shift 位起的字节把 src 稳定地移动到 dst
+template <class SrcIt, class DstIt, class KeyFn>
+void radix_scatter(SrcIt src, SrcIt src_end, DstIt dst, std::size_t* offsets, unsigned shift, KeyFn& key) {
+  for (; src != src_end; ++src) {
+    const auto byte = static_cast<std::size_t>((radix_unsigned(key(*src)) >> shift) & 0xFF);
+    dst[static_cast<std::iter_difference_t<DstIt>>(offsets[byte]++)] = std::move(*src);
+  }
+}
+
+// 对 data 中 n 个元素按键的低 limit 个字节排序，scratch 为同样大小的暂存区，结果留在 data 中。
+// 一次遍历统计各字节的直方图，某字节在所有元素上都相同（直方图只有一个非零桶）时跳过该趟。
+// 数据超出缓存时先按最高的非平凡字节做一趟 MSD 分配，每个桶再在缓存内做 LSD：
+// 对整个区间的随机分配每趟都要写 256 个相距很远的位置，TLB 与缓存缺失远多于桶内的分配
+template <class DataIt, class ScratchIt, class KeyFn>
+void radix_sort_bytes(DataIt data, ScratchIt scratch, std::size_t n, std::size_t limit, KeyFn& key) {
+  using T = std::iter_value_t<DataIt>;
+  using U = decltype(radix_unsigned(key(*data)));
+  constexpr std::size_t bytes = sizeof(U);
+  using data_diff = std::iter_difference_t<DataIt>;
+  using scratch_diff = std::iter_difference_t<ScratchIt>;
+
+  if (static_cast<std::ptrdiff_t>(n) < radix_insertion_threshold) {
+    radix_insertion_sort(data, data + static_cast<data_diff>(n), key);
+    return;
+  }
+
+  std::size_t counts[bytes][256] = {};
+  for (DataIt it = data, end = data + static_cast<data_diff>(n); it != end; ++it) {
+    const U u = radix_unsigned(key(*it));
+    for (std::size_t b = 0; b < limit; ++b) {
+      ++counts[b][(u >> (8 * b)) & 0xFF];
+    }
+  }
+
+  unsigned shifts[bytes];
+  std::size_t passes = 0;
+  const U first_key = radix_unsigned(key(*data));
+  for (std::size_t b = 0; b < limit; ++b) {
+    if (counts[b][(first_key >> (8 * b)) & 0xFF] != n) {
+      shifts[passes++] = static_cast<unsigned>(8 * b);
+    }
+  }
+  if (passes == 0) {
+    return;
+  }
+
+  if (passes > 1 && n * sizeof(T) > radix_cache_bytes) {
+    const unsigned top = shifts[passes - 1];
+    std::size_t* count = counts[top / 8];
+    std::size_t starts[257];
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < 256; ++i) {
+      starts[i] = sum;
+      sum += count[i];
+      count[i] = starts[i];
+    }
+    starts[256] = n;
+    radix_scatter(data, data + static_cast<data_diff>(n), scratch, count, top, key);
+    for (std::size_t i = 0; i < 256; ++i) {
+      const std::size_t len = starts[i + 1] - starts[i];
+      if (len > 1) {
+        radix_sort_bytes(scratch + static_cast<scratch_diff>(starts[i]), data + static_cast<data_diff>(starts[i]), len,
+                         top / 8, key);
+      }
+    }
+    std::move(scratch, scratch + static_cast<scratch_diff>(n), data);
+    return;
+  }
+
+  bool in_scratch = false;
+  for (std::size_t p = 0; p < passes; ++p) {
+    std::size_t* count = counts[shifts[p] / 8];
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < 256; ++i) {
+      const std::size_t c = count[i];
+      count[i] = sum;
+      sum += c;
+    }
+    if (in_scratch) {
+      radix_scatter(scratch, scratch + static_cast<scratch_diff>(n), data, count, shifts[p], key);
+    } else {
+      radix_scatter(data, data + static_cast<data_diff>(n), scratch, count, shifts[p], key);
+    }
+    in_scratch = !in_scratch;
+  }
+  if (in_scratch) {
+    std::move(scratch, scratch + static_cast<scratch_diff>(n), data);
+  }
+}
+
+// 定长键的基数排序（稳定）
+template <class RandomIt, class KeyFn>
+void lsd_radix_sort(RandomIt first, RandomIt last, KeyFn& key) {
+  using T = std::iter_value_t<RandomIt>;
+  using U = decltype(radix_unsigned(key(*first)));
+
+  const auto n = static_cast<std::size_t>(last - first);
+  if (last - first < radix_insertion_threshold) {
+    radix_insertion_sort(first, last, key);
+    return;
+  }
+  sort_buffer<T> buffer(first, n);
+  if constexpr (sort_buffer<T>::holds_source) {
+    radix_sort_bytes(buffer.data(), first, n, sizeof(U), key);
+    std::move(buffer.data(), buffer.data() + n, first);
+  } else {
+    radix_sort_bytes(first, buffer.data(), n, sizeof(U), key);
+  }
+}
+
+// 字符串键的 MSD 基数排序（American flag）：每层按第 depth 个字节分成 257 个桶
+// （桶 0 为长度恰为 depth 的字符串），原地按环交换到各自的桶，再逐桶处理下一层。
+// 计数时把每个元素的桶号记在旁边的数组里，交换时随元素一起移动，每层只读一次字符串内容。
+// 所有元素落在同一个桶时直接进入下一层，不做交换；待处理的区间放在显式栈中，不递归
+template <class RandomIt, class KeyFn>
+void msd_radix_sort(RandomIt first, RandomIt last, KeyFn& key) {
+  using diff_t = std::iter_difference_t<RandomIt>;
+  struct task {
+    std::size_t offset;
+    std::size_t size;
+    std::size_t depth;
+  };
+
+  std::vector<std::uint16_t> ids(static_cast<std::size_t>(last - first));
+  std::vector<task> stack;
+  stack.push_back({0, ids.size(), 0});
+  while (!stack.empty()) {
+    const task t = stack.back();
+    stack.pop_back();
+    const RandomIt base = first + static_cast<diff_t>(t.offset);
+    const std::size_t n = t.size;
+    const std::size_t depth = t.depth;
+
+    if (static_cast<std::ptrdiff_t>(n) < radix_string_insertion_threshold) {
+      auto less = [&](const auto& a, const auto& b) {
+        return radix_string_view(key(a)).substr(depth) < radix_string_view(key(b)).substr(depth);
+      };
+      insertion_sort(base, base + static_cast<diff_t>(n), less);
+      continue;
+    }
+
+    std::uint16_t* id = ids.data() + t.offset;
+    std::size_t counts[257] = {};
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::string_view s = radix_string_view(key(base[static_cast<diff_t>(i)]));
+      id[i] = static_cast<std::uint16_t>(s.size() > depth ? 1 + static_cast<unsigned char>(s[depth]) : 0);
+      ++counts[id[i]];
+    }
+    if (counts[0] == n) {
+      continue;
+    }
+    if (counts[id[0]] == n) {
+      stack.push_back({t.offset, n, depth + 1});
+      continue;
+    }
+
+    std::size_t heads[257];
+    std::size_t ends[257];
+    std::size_t sum = 0;
+    for (std::size_t b = 0; b < 257; ++b) {
+      heads[b] = sum;
+      sum += counts[b];
+      ends[b] = sum;
+    }
+    for (std::size_t b = 0; b < 257; ++b) {
+      while (heads[b] < ends[b]) {
+        const std::size_t i = heads[b];
+        while (id[i] != b) {
+          const std::size_t j = heads[id[i]]++;
+          std::iter_swap(base + static_cast<diff_t>(i), base + static_cast<diff_t>(j));
+          std::swap(id[i], id[j]);
+        }
+        ++heads[b];
+      }
+    }
+
+    // 桶 0 中的字符串彼此相等，无需继续
+    for (std::size_t b = 1; b < 257; ++b) {
+      if (counts[b] > 1) {
+        stack.push_back({t.offset + ends[b] - counts[b], counts[b], depth + 1});
+      }
+    }
+  }
 }
 
+template <class RandomIt, class KeyFn>
+void radix_sort_impl(RandomIt first, RandomIt last, KeyFn& key) {
+  using R = std::invoke_result_t<KeyFn&, std::iter_reference_t<RandomIt>>;
+  using K = std::remove_cvref_t<R>;
+  if (last - first < 2) {
+    return;
+  }
+  if constexpr (radix_fixed_key<K>) {
+    lsd_radix_sort(first, last, key);
+  } else {
+    static_assert(radix_string_key<K>, "mystl::radix_sort: key must be an integer, float, double or string-like");
+    static_assert(std::is_reference_v<R> || std::is_trivially_copyable_v<K>,
+                  "mystl::radix_sort_by_key: a string key must be returned by reference or as a view");
+    msd_radix_sort(first, last, key);
+  }
+}
+
+struct radix_identity {
+  template <class T>
+  constexpr T&& operator()(T&& v) const noexcept {
+    return std::forward<T>(v);
+  }
+};
+
+}  // namespace __details
+
+/**
+ * @brief 基数排序 [first, last)：整数、float、double 按数值升序，字符串按字节序升序
+ *
+ * 定长键为 LSD（稳定，需要 n 个元素的临时缓冲区），字符串为原地 MSD（不稳定）。
+ * 浮点数中 -0.0 排在 +0.0 之前，NaN 按符号位排在两端
+ */
+template <class RandomIt>
+void radix_sort(RandomIt first, RandomIt last) {
+  __details::radix_identity key;
+  __details::radix_sort_impl(first, last, key);
+}
+
+/**
+ * @brief 按 key(元素) 基数排序 [first, last)
+ *
+ * key 返回整数、float、double 时为稳定的 LSD 排序，每趟都会重新调用 key；
+ * 返回字符串时必须返回引用或视图（如 string_view），排序不稳定
+ */
+template <class RandomIt, class KeyFn>
+void radix_sort_by_key(RandomIt first, RandomIt last, KeyFn key) {
+  __details::radix_sort_impl(first, last, key);
+}
+
+namespace __details {
+
+inline constexpr std::ptrdiff_t stable_sort_min_run = 32;
+inline constexpr std::size_t stable_sort_min_gallop = 7;
+
+template <class It>
+MYSTL_FORCE_INLINE It sort_advance(It it, std::size_t n) {
+  return it + static_cast<std::iter_difference_t<It>>(n);
+}
+
+// 归并用的临时存储：首次需要时才分配 capacity 个元素（已有序的输入从不分配），
+// 分配失败后不再尝试，之后的归并都原地进行。元素只在一次归并期间构造在其中
+template <class T>
+class merge_buffer {
+public:
+  explicit merge_buffer(std::size_t capacity) noexcept : capacity_(capacity) {}
+
+  merge_buffer(const merge_buffer&) = delete;
+  merge_buffer& operator=(const merge_buffer&) = delete;
+
+  ~merge_buffer() {
+    if (data_ != nullptr) {
+      allocator<T>().deallocate(data_, capacity_);
+    }
+  }
+
+  // 至少 n 个元素的未初始化存储；容量不足或分配失败时返回 nullptr
+  T* get(std::size_t n) noexcept {
+    if (n > capacity_) {
+      return nullptr;
+    }
+    if (data_ == nullptr && !failed_) {
+      try {
+        data_ = allocator<T>().allocate(capacity_);
+      } catch (const std::bad_alloc&) {
+        failed_ = true;
+      }
+    }
+    return data_;
+  }
+
+private:
+  T* data_ = nullptr;
+  std::size_t capacity_;
+  bool failed_ = false;
+};
+
+// 在有序区间 [first, last) 中从前端指数探测 key 的位置（1、3、7、15……），再在最后一段二分。
+// Upper 为真时返回第一个大于 key 的位置（upper_bound），否则返回第一个不小于 key 的位置（lower_bound）。
+// 目标靠近前端时只需 O(log k) 次比较
+template <bool Upper, class RandomIt, class T, class Compare>
+RandomIt gallop_forward(RandomIt first, RandomIt last, const T& key, Compare& comp) {
+  auto before = [&](const auto& x) { return Upper ? !comp(key, x) : comp(x, key); };
+  const auto n = last - first;
+  std::iter_difference_t<RandomIt> lo = 0;
+  std::iter_difference_t<RandomIt> hi = 1;
+  while (hi <= n && before(*(first + (hi - 1)))) {
+    lo = hi;
+    hi = 2 * hi + 1;
+  }
+  hi = std::min(hi - 1, n);
+  if constexpr (Upper) {
+    return std::upper_bound(first + lo, first + hi, key, comp);
+  } else {
+    return std::lower_bound(first + lo, first + hi, key, comp);
+  }
+}
+
+// 同 gallop_forward，但从后端向前探测，目标靠近后端时只需 O(log k) 次比较
+template <bool Upper, class RandomIt, class T, class Compare>
+RandomIt gallop_backward(RandomIt first, RandomIt last, const T& key, Compare& comp) {
+  auto before = [&](const auto& x) { return Upper ? !comp(key, x) : comp(x, key); };
+  const auto n = last - first;
+  std::iter_difference_t<RandomIt> lo = 0;
+  std::iter_difference_t<RandomIt> hi = 1;
+  while (hi <= n && !before(*(last - hi))) {
+    lo = hi;
+    hi = 2 * hi + 1;
+  }
+  hi = std::min(hi, n);
+  // 答案位于 [last - hi, last - lo]
+  if constexpr (Upper) {
+    return std::upper_bound(last - hi, last - lo, key, comp);
+  } else {
+    return std::lower_bound(last - hi, last - lo, key, comp);
+  }
+}
+
+// 左段较短：左段移入 buf，从前向后归并。逐个比较时某一侧连续胜出 min_gallop 次后改为飞奔，
+// 用 gallop_forward 整段搬运；飞奔收益不足时退回逐个比较并提高 min_gallop。
+// 任何时刻 buf 中剩余元素的个数恰好等于 out 与 r 之间的空位，退出（包括异常）时把剩余元素移回
+template <class RandomIt, class T, class Compare>
+void merge_lo(RandomIt first, RandomIt mid, RandomIt last, T* buf, Compare& comp, std::size_t& min_gallop) {
+  const auto len1 = static_cast<std::size_t>(mid - first);
+  std::uninitialized_move(first, mid, buf);
+  T* b = buf;
+  T* b_end = buf + len1;
+  RandomIt out = first;
+  RandomIt r = mid;
+  struct guard {
+    T*& b;
+    T*& b_end;
+    RandomIt& out;
+    T* buf;
+    std::size_t len;
+    ~guard() {
+      std::move(b, b_end, out);
+      std::destroy_n(buf, len);
+    }
+  } g{b, b_end, out, buf, len1};
+
+  for (;;) {
+    std::size_t count1 = 0;
+    std::size_t count2 = 0;
+    while (count1 < min_gallop && count2 < min_gallop) {
+      if (comp(*r, *b)) {
+        *out++ = std::move(*r++);
+        ++count2;
+        count1 = 0;
+        if (r == last) {
+          return;
+        }
+      } else {
+        *out++ = std::move(*b++);
+        ++count1;
+        count2 = 0;
+        if (b == b_end) {
+          return;
+        }
+      }
+    }
+    do {
+      T* bg = gallop_forward<true>(b, b_end, *r, comp);
+      count1 = static_cast<std::size_t>(bg - b);
+      out = std::move(b, bg, out);
+      b = bg;
+      if (b == b_end) {
+        return;
+      }
+      *out++ = std::move(*r++);
+      if (r == last) {
+        return;
+      }
+      RandomIt rg = gallop_forward<false>(r, last, *b, comp);
+      count2 = static_cast<std::size_t>(rg - r);
+      out = std::move(r, rg, out);
+      r = rg;
+      if (r == last) {
+        return;
+      }
+      *out++ = std::move(*b++);
+      if (b == b_end) {
+        return;
+      }
+      min_gallop -= min_gallop > 1;
+    } while (count1 >= stable_sort_min_gallop || count2 >= stable_sort_min_gallop);
+    min_gallop += 2;
+  }
+}
+
+// 右段较短：右段移入 buf，从后向前归并，与 merge_lo 对称。
+// 相等时先放右段的元素（它们排在后面），保持稳定
+template <class RandomIt, class T, class Compare>
+void merge_hi(RandomIt first, RandomIt mid, RandomIt last, T* buf, Compare& comp, std::size_t& min_gallop) {
+  const auto len2 = static_cast<std::size_t>(last - mid);
+  std::uninitialized_move(mid, last, buf);
+  T* b = buf;
+  T* b_end = buf + len2;
+  RandomIt out = last;
+  RandomIt l = mid;
+  struct guard {
+    T*& b;
+    T*& b_end;
+    RandomIt& l;
+    T* buf;
+    std::size_t len;
+    ~guard() {
+      std::move(b, b_end, l);
+      std::destroy_n(buf, len);
+    }
+  } g{b, b_end, l, buf, len2};
+
+  for (;;) {
+    std::size_t count1 = 0;
+    std::size_t count2 = 0;
+    while (count1 < min_gallop && count2 < min_gallop) {
+      if (comp(*(b_end - 1), *(l - 1))) {
+        *--out = std::move(*--l);
+        ++count1;
+        count2 = 0;
+        if (l == first) {
+          return;
+        }
+      } else {
+        *--out = std::move(*--b_end);
+        ++count2;
+        count1 = 0;
+        if (b == b_end) {
+          return;
+        }
+      }
+    }
+    do {
+      RandomIt lg = gallop_backward<true>(first, l, *(b_end - 1), comp);
+      count1 = static_cast<std::size_t>(l - lg);
+      out = std::move_backward(lg, l, out);
+      l = lg;
+      if (l == first) {
+        return;
+      }
+      *--out = std::move(*--b_end);
+      if (b == b_end) {
+        return;
+      }
+      T* bg = gallop_backward<false>(b, b_end, *(l - 1), comp);
+      count2 = static_cast<std::size_t>(b_end - bg);
+      out = std::move_backward(bg, b_end, out);
+      b_end = bg;
+      if (b == b_end) {
+        return;
+      }
+      *--out = std::move(*--l);
+      if (l == first) {
+        return;
+      }
+      min_gallop -= min_gallop > 1;
+    } while (count1 >= stable_sort_min_gallop || count2 >= stable_sort_min_gallop);
+    min_gallop += 2;
+  }
+}
+
+// 无缓冲的稳定归并：较长一侧取中点，在另一侧二分出切分位置，旋转后两侧递归，O(n log n)
+template <class RandomIt, class Compare>
+void merge_in_place(RandomIt first, RandomIt mid, RandomIt last, Compare& comp) {
+  const auto len1 = mid - first;
+  const auto len2 = last - mid;
+  if (len1 == 0 || len2 == 0) {
+    return;
+  }
+  if (len1 + len2 == 2) {
+    if (comp(*mid, *first)) {
+      std::iter_swap(first, mid);
+    }
+    return;
+  }
+  RandomIt cut1;
+  RandomIt cut2;
+  if (len1 > len2) {
+    cut1 = first + len1 / 2;
+    cut2 = std::lower_bound(mid, last, *cut1, comp);
+  } else {
+    cut2 = mid + len2 / 2;
+    cut1 = std::upper_bound(first, mid, *cut2, comp);
+  }
+  const RandomIt new_mid = std::rotate(cut1, mid, cut2);
+  merge_in_place(first, cut1, new_mid, comp);
+  merge_in_place(new_mid, cut2, last, comp);
+}
+
+// 归并相邻的有序段 [first, mid) 与 [mid, last)：先用飞奔剪掉两端已经就位的元素，
+// 再把较短的一侧放入缓冲区；没有缓冲区时原地归并
+template <class RandomIt, class T, class Compare>
+void merge_runs(RandomIt first, RandomIt mid, RandomIt last, merge_buffer<T>& buffer, Compare& comp,
+                std::size_t& min_gallop) {
+  first = gallop_forward<true>(first, mid, *mid, comp);
+  if (first == mid) {
+    return;
+  }
+  last = gallop_backward<false>(mid, last, *(mid - 1), comp);
+  const auto len1 = static_cast<std::size_t>(mid - first);
+  const auto len2 = static_cast<std::size_t>(last - mid);
+  T* buf = buffer.get(std::min(len1, len2));
+  if (buf == nullptr) {
+    merge_in_place(first, mid, last, comp);
+  } else if (len1 <= len2) {
+    merge_lo(first, mid, last, buf, comp, min_gallop);
+  } else {
+    merge_hi(first, mid, last, buf, comp, min_gallop);
+  }
+}
+
+// 从 first 开始的最长单调段：不减段原样保留，严格递减段原地反转（严格保证稳定），返回段尾
+template <class RandomIt, class Compare>
+RandomIt natural_run(RandomIt first, RandomIt last, Compare& comp) {
+  RandomIt it = first + 1;
+  if (it == last) {
+    return last;
+  }
+  if (comp(*it, *first)) {
+    while (++it != last && comp(*it, *(it - 1))) {
+    }
+    std::reverse(first, it);
+  } else {
+    while (++it != last && !comp(*it, *(it - 1))) {
+    }
+  }
+  return it;
+}
+
+// powersort 的合并策略：段 [s1, s1 + n1) 与 [s1 + n1, s1 + n1 + n2) 之间边界的"power"，
+// 即两段中点 / n 的二进制小数从第几位开始不同。各边界按 power 构成一棵近似最优的归并树
+inline int powersort_power(std::size_t s1, std::size_t n1, std::size_t n2, std::size_t n) noexcept {
+  std::size_t a = 2 * s1 + n1;
+  std::size_t b = a + n1 + n2;
+  int power = 0;
+  for (;;) {
+    ++power;
+    if (a >= n) {
+      a -= n;
+      b -= n;
+    } else if (b >= n) {
+      return power;
+    }
+    a <<= 1;
+    b <<= 1;
+  }
+}
+
+template <class RandomIt, class Compare>
+void powersort(RandomIt first, RandomIt last, Compare& comp, merge_buffer<std::iter_value_t<RandomIt>>& buffer) {
+  struct run {
+    std::size_t start;
+    std::size_t len;
+    int power;
+  };
+  const auto n = static_cast<std::size_t>(last - first);
+  const auto min_run = static_cast<std::size_t>(stable_sort_min_run);
+  // 栈中 power 自底向上严格递增，power 不超过 64
+  run stack[sizeof(std::size_t) * 8 + 2];
+  std::size_t top = 0;
+  std::size_t min_gallop = stable_sort_min_gallop;
+  auto merge_top = [&] {
+    run& a = stack[top - 2];
+    const run& b = stack[top - 1];
+    merge_runs(sort_advance(first, a.start), sort_advance(first, b.start), sort_advance(first, b.start + b.len),
+               buffer, comp, min_gallop);
+    a.len += b.len;
+    --top;
+  };
+
+  for (std::size_t start = 0; start < n;) {
+    const RandomIt run_first = sort_advance(first, start);
+    auto len = static_cast<std::size_t>(natural_run(run_first, last, comp) - run_first);
+    if (len < min_run) {
+      // 短段用插入排序补足到 min_run，已有序的前缀只需一次比较
+      len = std::min(min_run, n - start);
+      insertion_sort(run_first, sort_advance(run_first, len), comp);
+    }
+    int power = 0;
+    if (top > 0) {
+      power = powersort_power(stack[top - 1].start, stack[top - 1].len, len, n);
+      while (top > 1 && stack[top - 1].power > power) {
+        merge_top();
+      }
+    }
+    stack[top++] = {start, len, power};
+    start += len;
+  }
+  while (top > 1) {
+    merge_top();
+  }
+}
+
+template <class RandomIt, class Compare>
+void stable_sort_impl(RandomIt first, RandomIt last, Compare& comp) {
+  using T = std::iter_value_t<RandomIt>;
+  if (last - first <= stable_sort_min_run) {
+    insertion_sort(first, last, comp);
+    return;
+  }
+  // 每次归并只把较短的一侧放入缓冲区，n / 2 个元素足够
+  merge_buffer<T> buffer(static_cast<std::size_t>(last - first) / 2);
+  powersort(first, last, comp, buffer);
+}
+
+}  // namespace __details
+
+/**
+ * @brief 把 [first, last) 按 comp 升序排列，等价元素保持原有相对顺序
+ *
+ * 已有序或逆序的输入 O(n) 且不分配内存；一般情况 O(n log n)，需要 n / 2 个元素的临时缓冲区，
+ * 分配失败时退化为原地归并，O(n log² n)
+ */
+template <class RandomIt, class Compare>
+void stable_sort(RandomIt first, RandomIt last, Compare comp) {
+  __details::stable_sort_impl(first, last, comp);
+}
+
+template <class RandomIt>
+void stable_sort(RandomIt first, RandomIt last) {
+  mystl::stable_sort(first, last, std::less<>());
+}
+
+namespace __details {
+
+template <class C, class T>
+inline constexpr bool select_compare_is_less_v =
+    std::is_same_v<C, std::less<>> || std::is_same_v<C, std::ranges::less> || std::is_same_v<C, std::less<T>>;
+
+template <class C, class T>
+inline constexpr bool select_compare_is_greater_v =
+    std::is_same_v<C, std::greater<>> || std::is_same_v<C, std::ranges::greater> || std::is_same_v<C, std::greater<T>>;
+
+// 连续存储的算术元素配合内置的 < / > 时，用向量内核跳过不越过阈值的元素
+template <class T, class Compare>
+inline constexpr bool select_use_simd_v =
+    select_simd_type<T> && (select_compare_is_less_v<Compare, T> || select_compare_is_greater_v<Compare, T>);
+
+// k 不超过 n / 256 时 partial_sort 用堆选择，否则先 nth_element 再排序前 k 个：
+// 堆选择每次替换要 O(log k) 次随机访问，k 较大时替换次数 k·ln(n/k) 使其慢于线性的 nth_element
+inline constexpr std::ptrdiff_t partial_sort_heap_ratio = 256;
+
+template <class RandomIt, class Compare>
+void nth_element_impl(RandomIt begin, RandomIt nth, RandomIt end, Compare& comp);
+
+// 中位数的中位数：每 5 个元素一组排序，组中位数依次换到区间开头，递归选出它们的中位数放到 begin。
+// 至少 3/10 的元素不大于、3/10 的元素不小于它，划分必然平衡
+template <class RandomIt, class Compare>
+void median_of_medians_to_front(RandomIt begin, RandomIt end, Compare& comp) {
+  const auto groups = (end - begin) / 5;
+  for (std::iter_difference_t<RandomIt> g = 0; g < groups; ++g) {
+    const RandomIt group = begin + 5 * g;
+    insertion_sort(group, group + 5, comp);
+    std::iter_swap(begin + g, group + 2);
+  }
+  nth_element_impl(begin, begin + groups / 2, begin + groups, comp);
+  std::iter_swap(begin, begin + groups / 2);
+}
+
+// introselect：与 pdqsort 相同的枢轴选取与划分，只进入 nth 所在的一侧。
+// 不平衡的划分超过常数次后，之后每一轮都改用中位数的中位数作枢轴。平衡的划分至少去掉 1/8，
+// 不平衡的划分至多常数次、每次 O(n)，因此最坏 O(n)。
+// 枢轴等于左邻的上一个枢轴时把相等元素整体划到左侧，nth 落在其中即可结束，大量重复键时不退化
+template <class RandomIt, class Compare>
+void nth_element_impl(RandomIt begin, RandomIt nth, RandomIt end, Compare& comp) {
+  using diff_t = std::iter_difference_t<RandomIt>;
+  if (nth == end) {
+    return;
+  }
+  int bad_allowed = select_bad_partition_limit;
+  bool leftmost = true;
+  while (end - begin > sort_insertion_threshold) {
+    const diff_t size = end - begin;
+    if (bad_allowed > 0) {
+      const diff_t s2 = size / 2;
+      if (size > sort_ninther_threshold) {
+        sort3(begin, begin + s2, end - 1, comp);
+        sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+        sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+        sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+        std::iter_swap(begin, begin + s2);
+      } else {
+        sort3(begin + s2, begin, end - 1, comp);
+      }
+    } else {
+      median_of_medians_to_front(begin, end, comp);
+    }
+
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      const RandomIt equal_end = partition_left(begin, end, comp);
+      if (nth <= equal_end) {
+        return;
+      }
+      begin = equal_end + 1;
+      continue;
+    }
+
+    RandomIt pivot_pos;
+    if constexpr (sort_use_branchless_v<RandomIt, Compare>) {
+      pivot_pos = partition_right_branchless(begin, end, comp).first;
+    } else {
+      pivot_pos = partition_right(begin, end, comp).first;
+    }
+    if (pivot_pos - begin < size / 8 || end - (pivot_pos + 1) < size / 8) {
+      --bad_allowed;
+    }
+    if (nth == pivot_pos) {
+      return;
+    }
+    if (nth < pivot_pos) {
+      end = pivot_pos;
+    } else {
+      begin = pivot_pos + 1;
+      leftmost = false;
+    }
+  }
+  insertion_sort(begin, end, comp);
+}
+
+// 堆选择：[first, middle) 已是堆，堆顶为当前保留的 k 个元素中排在最后的一个（阈值）。
+// 扫描其余元素，排在阈值之前的替换堆顶；可向量化时由 find_beyond 成块跳过不越过阈值的元素
+template <class RandomIt, class Compare>
+void heap_select(RandomIt first, RandomIt middle, RandomIt last, Compare& comp) {
+  using T = std::iter_value_t<RandomIt>;
+  const auto k = middle - first;
+  if constexpr (std::contiguous_iterator<RandomIt> && select_use_simd_v<T, Compare>) {
+    constexpr bool greater = select_compare_is_greater_v<Compare, T>;
+    T* p = std::to_address(first);
+    const auto n = static_cast<std::size_t>(last - first);
+    for (auto i = static_cast<std::size_t>(k);;) {
+      i += find_beyond<greater>(p + i, n - i, p[0]);
+      if (i >= n) {
+        return;
+      }
+      const T value = p[i];
+      p[i] = p[0];
+      heap_adjust(p, std::ptrdiff_t{0}, static_cast<std::ptrdiff_t>(k), value, comp);
+      ++i;
+    }
+  } else {
+    for (RandomIt it = middle; it != last; ++it) {
+      if (comp(*it, *first)) {
+        auto value = std::move(*it);
+        *it = std::move(*first);
+        heap_adjust(first, std::iter_difference_t<RandomIt>(0), k, std::move(value), comp);
+      }
+    }
+  }
+}
+
+template <class RandomIt, class Compare>
+void partial_sort_impl(RandomIt first, RandomIt middle, RandomIt last, Compare& comp) {
+  const auto k = middle - first;
+  if (k == 0) {
+    return;
+  }
+  if (k > (last - first) / partial_sort_heap_ratio) {
+    nth_element_impl(first, middle - 1, last, comp);
+    sort_impl(first, middle - 1, comp);
+    return;
+  }
+  make_heap_impl(first, middle, comp);
+  heap_select(first, middle, last, comp);
+  sort_heap_impl(first, middle, comp);
+}
+
+// top_k 的候选缓冲区：先收满 cap 个元素，再用 nth_element 留下前 k 个，第 k 个即为阈值；
+// 之后只收越过阈值的元素，缓冲区再次填满时重复。每次收缩 O(cap)，至少换来 cap - k 个新元素
+template <class R, class Compare>
+auto top_k_candidates(R&& range, std::size_t k, Compare& comp) {
+  using T = std::ranges::range_value_t<R>;
+  constexpr std::size_t max_size = static_cast<std::size_t>(-1);
+  const std::size_t cap = k <= max_size / 2 - 64 ? k + std::max<std::size_t>(k, 64) : max_size;
+  std::vector<T> buf;
+  if constexpr (std::ranges::sized_range<R>) {
+    buf.reserve(std::min(cap, static_cast<std::size_t>(std::ranges::size(range))));
+  }
+  auto shrink = [&] {
+    nth_element_impl(buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(k - 1), buf.end(), comp);
+    buf.erase(buf.begin() + static_cast<std::ptrdiff_t>(k), buf.end());
+  };
+
+  if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> && select_use_simd_v<T, Compare>) {
+    constexpr bool greater = select_compare_is_greater_v<Compare, T>;
+    const T* p = std::ranges::data(range);
+    const auto n = static_cast<std::size_t>(std::ranges::size(range));
+    std::size_t i = std::min(n, cap);
+    buf.assign(p, p + i);
+    while (i < n) {
+      shrink();
+      const T threshold = buf.back();
+      while (buf.size() < cap) {
+        i += find_beyond<greater>(p + i, n - i, threshold);
+        if (i >= n) {
+          break;
+        }
+        buf.push_back(p[i++]);
+      }
+    }
+  } else {
+    bool filtering = false;
+    for (auto&& x : range) {
+      if (filtering && !comp(x, buf[k - 1])) {
+        continue;
+      }
+      buf.push_back(x);
+      if (buf.size() == cap) {
+        shrink();
+        filtering = true;
+      }
+    }
+  }
+  if (buf.size() > k) {
+    shrink();
+  }
+  return buf;
+}
+
+}  // namespace __details
+
+/**
+ * @brief 重排 [first, last)，使 nth 处为完整排序后应在该处的元素，
+ *        其前的元素都不排在它之后、其后的元素都不排在它之前；平均 O(n)，最坏 O(n)
+ */
+template <class RandomIt, class Compare>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp) {
+  __details::nth_element_impl(first, nth, last, comp);
+}
+
+template <class RandomIt>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+  mystl::nth_element(first, nth, last, std::less<>());
+}
+
+/**
+ * @brief 把 [first, last) 中排在最前的 middle - first 个元素按顺序放到 [first, middle)，其余元素顺序未指定
+ *
+ * k 较小时为堆选择，O(n + k log k log(n/k))，算术元素配合 less / greater 时用向量比较跳过不进堆的元素；
+ * k 较大时为 nth_element 加排序，O(n + k log k)
+ */
+template <class RandomIt, class Compare>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last, Compare comp) {
+  __details::partial_sort_impl(first, middle, last, comp);
+}
+
+template <class RandomIt>
+void partial_sort(RandomIt first, RandomIt middle, RandomIt last) {
+  mystl::partial_sort(first, middle, last, std::less<>());
+}
+
+/**
+ * @brief 把 range 中按 comp 排在最前的 k 个元素（默认为最大的 k 个）按 comp 的顺序写到 out，返回输出的末尾
+ *
+ * 只读一遍 range，额外空间 O(k)；元素不足 k 个时输出全部。等价元素中保留哪些未指定。
+ * 连续存储的算术元素配合 less / greater 时，绝大多数元素在向量比较中被跳过
+ */
+template <std::ranges::input_range R, class OutIt, class Compare = std::greater<>>
+OutIt top_k(R&& range, std::size_t k, OutIt out, Compare comp = {}) {
+  if (k == 0) {
+    return out;
+  }
+  auto buf = __details::top_k_candidates(range, k, comp);
+  __details::sort_impl(buf.begin(), buf.end(), comp);
+  return std::move(buf.begin(), buf.end(), out);
+}
+
+namespace __details {
+
+inline constexpr std::size_t parallel_sort_threshold = std::size_t{1} << 15;
+inline constexpr std::size_t parallel_merge_grain = std::size_t{1} << 14;
+
+// 把 a 中 na 个与 b 中 nb 个已排序元素稳定归并到 dst：较长一侧取中点，在另一侧二分出切分位置，
+// 两半互不重叠，并行归并。等价元素中 a 的排在 b 的之前
+template <class SrcIt, class DstIt, class Compare>
+void parallel_merge(execution::thread_pool& pool, SrcIt a, std::size_t na, SrcIt b, std::size_t nb, DstIt dst,
+                    Compare& comp) {
+  if (na + nb <= parallel_merge_grain) {
+    std::merge(std::make_move_iterator(a), std::make_move_iterator(sort_advance(a, na)), std::make_move_iterator(b),
+               std::make_move_iterator(sort_advance(b, nb)), dst, comp);
+    return;
+  }
+  std::size_t ia;
+  std::size_t ib;
+  if (na >= nb) {
+    ia = na / 2;
+    ib = static_cast<std::size_t>(std::lower_bound(b, sort_advance(b, nb), *sort_advance(a, ia), comp) - b);
+  } else {
+    ib = nb / 2;
+    ia = static_cast<std::size_t>(std::upper_bound(a, sort_advance(a, na), *sort_advance(b, ib), comp) - a);
+  }
+  pool.invoke([&] { parallel_merge(pool, a, ia, b, ib, dst, comp); },
+              [&] {
+                parallel_merge(pool, sort_advance(a, ia), na - ia, sort_advance(b, ib), nb - ib,
+                               sort_advance(dst, ia + ib), comp);
+              });
+}
+
+// 并行归并排序 src 中的 n 个元素，结果放在 src（to_dst 为假）或 dst（to_dst 为真）中，另一侧作暂存区。
+// 两半并行排序到另一侧，再并行归并回来；不超过 leaf 个元素时由 base(data, scratch, n) 顺序排序
+template <class SrcIt, class DstIt, class Compare, class BaseSort>
+void parallel_merge_sort(execution::thread_pool& pool, SrcIt src, DstIt dst, std::size_t n, bool to_dst,
+                         std::size_t leaf, Compare& comp, BaseSort& base) {
+  if (n <= leaf) {
+    base(src, dst, n);
+    if (to_dst) {
+      std::move(src, sort_advance(src, n), dst);
+    }
+    return;
+  }
+  const std::size_t half = n / 2;
+  pool.invoke([&] { parallel_merge_sort(pool, src, dst, half, !to_dst, leaf, comp, base); },
+              [&] {
+                parallel_merge_sort(pool, sort_advance(src, half), sort_advance(dst, half), n - half, !to_dst, leaf,
+                                    comp, base);
+              });
+  if (to_dst) {
+    parallel_merge(pool, src, half, sort_advance(src, half), n - half, dst, comp);
+  } else {
+    parallel_merge(pool, dst, half, sort_advance(dst, half), n - half, src, comp);
+  }
+}
+
+// 并行排序的公共入口：规模不足或池只有一个线程时返回 false，由调用方顺序排序。
+// 叶子约为 n / (4 * 线程数)，留出余量让窃取抹平各叶子耗时的差异
+template <class RandomIt, class Compare, class BaseSort>
+bool parallel_sort_driver(execution::thread_pool& pool, RandomIt first, RandomIt last, Compare& comp,
+                          BaseSort base) {
+  using T = std::iter_value_t<RandomIt>;
+  const auto n = static_cast<std::size_t>(last - first);
+  if (n < parallel_sort_threshold || pool.size() < 2) {
+    return false;
+  }
+  const std::size_t parts = 4 * pool.size();
+  const std::size_t leaf = std::max(parallel_sort_threshold / 2, (n + parts - 1) / parts);
+  sort_buffer<T> buffer(first, n);
+  pool.run([&] {
+    if constexpr (sort_buffer<T>::holds_source) {
+      parallel_merge_sort(pool, buffer.data(), first, n, true, leaf, comp, base);
+    } else {
+      parallel_merge_sort(pool, first, buffer.data(), n, false, leaf, comp, base);
+    }
+  });
+  return true;
+}
+
+template <class RandomIt, class Compare>
+void parallel_sort_impl(execution::thread_pool& pool, RandomIt first, RandomIt last, Compare& comp) {
+  auto base = [&](auto data, auto, std::size_t n) { sort_impl(data, sort_advance(data, n), comp); };
+  if (!parallel_sort_driver(pool, first, last, comp, base)) {
+    sort_impl(first, last, comp);
+  }
+}
+
+template <class RandomIt, class Compare>
+void parallel_stable_sort_impl(execution::thread_pool& pool, RandomIt first, RandomIt last, Compare& comp) {
+  auto base = [&](auto data, auto, std::size_t n) { stable_sort_impl(data, sort_advance(data, n), comp); };
+  if (!parallel_sort_driver(pool, first, last, comp, base)) {
+    stable_sort_impl(first, last, comp);
+  }
+}
+
+// 各叶子做顺序基数排序，叶子之间按变换后的键归并：定长键整体仍然稳定
+template <class RandomIt, class KeyFn>
+void parallel_radix_sort_impl(execution::thread_pool& pool, RandomIt first, RandomIt last, KeyFn& key) {
+  using R = std::invoke_result_t<KeyFn&, std::iter_reference_t<RandomIt>>;
+  using K = std::remove_cvref_t<R>;
+  bool done = false;
+  if constexpr (radix_fixed_key<K>) {
+    using U = decltype(radix_unsigned(key(*first)));
+    auto less = [&](const auto& a, const auto& b) { return radix_unsigned(key(a)) < radix_unsigned(key(b)); };
+    auto base = [&](auto data, auto scratch, std::size_t n) { radix_sort_bytes(data, scratch, n, sizeof(U), key); };
+    done = parallel_sort_driver(pool, first, last, less, base);
+  } else if constexpr (radix_string_key<K>) {
+    auto less = [&](const auto& a, const auto& b) { return radix_string_view(key(a)) < radix_string_view(key(b)); };
+    auto base = [&](auto data, auto, std::size_t n) { msd_radix_sort(data, sort_advance(data, n), key); };
+    done = parallel_sort_driver(pool, first, last, less, base);
+  }
+  if (!done) {
+    radix_sort_impl(first, last, key);
+  }
+}
+
+}  // namespace __details
+
+/**
+ * @brief 按执行策略排序：seq 同 sort；par 为并行归并排序，每个线程的叶子用 pdqsort，需要 n 个元素的临时缓冲区
+ */
+template <class ExecutionPolicy, class RandomIt, class Compare>
+  requires execution::execution_policy<ExecutionPolicy>
+void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp) {
+  if constexpr (__details::is_parallel_policy_v<ExecutionPolicy>) {
+    __details::parallel_sort_impl(policy.pool(), first, last, comp);
+  } else {
+    __details::sort_impl(first, last, comp);
+  }
+}
+
+template <class ExecutionPolicy, class RandomIt>
+  requires execution::execution_policy<ExecutionPolicy>
+void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last) {
+  mystl::sort(std::forward<ExecutionPolicy>(policy), first, last, std::less<>());
+}
+
+/**
+ * @brief 按执行策略稳定排序：par 为并行归并排序
+ */
+template <class ExecutionPolicy, class RandomIt, class Compare>
+  requires execution::execution_policy<ExecutionPolicy>
+void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp) {
+  if constexpr (__details::is_parallel_policy_v<ExecutionPolicy>) {
+    __details::parallel_stable_sort_impl(policy.pool(), first, last, comp);
+  } else {
+    __details::stable_sort_impl(first, last, comp);
+  }
+}
+
+template <class ExecutionPolicy, class RandomIt>
+  requires execution::execution_policy<ExecutionPolicy>
+void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last) {
+  mystl::stable_sort(std::forward<ExecutionPolicy>(policy), first, last, std::less<>());
+}
+
+
+/**
+ * @brief 按执行策略基数排序：par 时每个叶子做顺序基数排序，叶子之间并行归并；定长键仍然稳定
+ */
+template <class ExecutionPolicy, class RandomIt, class KeyFn>
+  requires execution::execution_policy<ExecutionPolicy>
+void radix_sort_by_key(ExecutionPolicy&& policy, RandomIt first, RandomIt last, KeyFn key) {
+  if constexpr (__details::is_parallel_policy_v<ExecutionPolicy>) {
+    __details::parallel_radix_sort_impl(policy.pool(), first, last, key);
+  } else {
+    __details::radix_sort_impl(first, last, key);
+  }
+}
+
+template <class ExecutionPolicy, class RandomIt>
+  requires execution::execution_policy<ExecutionPolicy>
+void radix_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last) {
+  mystl::radix_sort_by_key(std::forward<ExecutionPolicy>(policy), first, last, __details::radix_identity{});
+}
+
+}  // namespace mystl
+
 #endif  // MYSTL_ALGORITHMS_SORTING_HPP
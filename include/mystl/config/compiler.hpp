@@ -36,4 +36,13 @@
 #define MYSTL_MAYBE_UNUSED
 #endif
 
+// 指针别名限定（C 的 restrict）
+#if MYSTL_COMPILER_MSVC
+#define MYSTL_RESTRICT __restrict
+#elif MYSTL_COMPILER_GCC || MYSTL_COMPILER_CLANG
+#define MYSTL_RESTRICT __restrict__
+#else
+#define MYSTL_RESTRICT
+#endif
+
 #endif  // MYSTL_CONFIG_COMPILER_HPP
@@ -0,0 +1,36 @@
+#ifndef MYSTL_CONFIG_CPU_FEATURES_HPP
+#define MYSTL_CONFIG_CPU_FEATURES_HPP
+
+// Runtime CPU feature detection for SIMD dispatch
+
+#include "mystl/config/compiler.hpp"
+#include "mystl/config/platform.hpp"
+
+// GCC/Clang 可以在未开启 -mavx2 的翻译单元中用 target 属性编译 AVX2 函数，运行期再按 CPU 选择
+#if MYSTL_ARCH_X86_64 && (MYSTL_COMPILER_GCC || MYSTL_COMPILER_CLANG)
+#define MYSTL_HAS_AVX2_DISPATCH 1
+#define MYSTL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MYSTL_HAS_AVX2_DISPATCH 0
+#define MYSTL_TARGET_AVX2
+#endif
+
+namespace mystl {
+namespace __details {
+
+// 结果在首次调用时缓存
+inline bool cpu_has_avx2() noexcept {
+#if MYSTL_HAS_AVX2
+  return true;
+#elif MYSTL_HAS_AVX2_DISPATCH
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_CONFIG_CPU_FEATURES_HPP
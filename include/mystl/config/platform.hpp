@@ -21,4 +21,44 @@
 #define MYSTL_PLATFORM_LINUX 0
 #endif
 
+// Architecture detection
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MYSTL_ARCH_X86_64 1
+#else
+#define MYSTL_ARCH_X86_64 0
+#endif
+
+#if MYSTL_ARCH_X86_64 || defined(__i386__) || defined(_M_IX86)
+#define MYSTL_ARCH_X86 1
+#else
+#define MYSTL_ARCH_X86 0
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MYSTL_ARCH_ARM64 1
+#else
+#define MYSTL_ARCH_ARM64 0
+#endif
+
+// 缓存行大小，用于按缓存行对齐以避免伪共享（Apple ARM64 为 128 字节）
+#if MYSTL_PLATFORM_APPLE && MYSTL_ARCH_ARM64
+#define MYSTL_CACHE_LINE_SIZE 128
+#else
+#define MYSTL_CACHE_LINE_SIZE 64
+#endif
+
+// 编译期可用的指令集（x86-64 基线即包含 SSE2）
+#if MYSTL_ARCH_X86_64 || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MYSTL_HAS_SSE2 1
+#else
+#define MYSTL_HAS_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+#define MYSTL_HAS_AVX2 1
+#else
+#define MYSTL_HAS_AVX2 0
+#endif
+
 #endif  // MYSTL_CONFIG_PLATFORM_HPP
@@ -0,0 +1,513 @@
+#ifndef MYSTL_CONTAINERS__DETAILS_STRING_SEARCH_HPP
+#define MYSTL_CONTAINERS__DETAILS_STRING_SEARCH_HPP
+
+// string_view 查找内核：SSE2 / AVX2 向量版本与标量版本（hidden in __details）
+//
+// - 单字符：逐块比较得到掩码，取最低（rfind 取最高）置位
+// - 子串：首字节 + 尾字节过滤，只对两者同时命中的位置做 memcmp
+// - 字符集：AVX2 下用 nibble 查找表（两次 pshufb）判断成员关系；其余情况用 256 位位图
+// 所有函数返回下标，未找到返回 npos；标量版本可在常量求值中使用
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "mystl/config/cpu_features.hpp"
+#include "mystl/config/platform.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mystl {
+namespace __details {
+
+inline constexpr std::size_t search_npos = static_cast<std::size_t>(-1);
+
+// ---------------------------------------------------------------------------
+// 标量版本
+// ---------------------------------------------------------------------------
+
+constexpr std::size_t find_char_scalar(const char* p, std::size_t n, char c) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (p[i] == c) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+constexpr std::size_t rfind_char_scalar(const char* p, std::size_t n, char c) noexcept {
+  while (n > 0) {
+    --n;
+    if (p[n] == c) {
+      return n;
+    }
+  }
+  return search_npos;
+}
+
+constexpr bool equal_bytes(const char* a, const char* b, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (a[i] != b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 首尾字节过滤后再比较中间部分
+constexpr std::size_t find_substr_scalar(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  if (m == 0) {
+    return 0;
+  }
+  if (m > n) {
+    return search_npos;
+  }
+  const char first = s[0];
+  const char last = s[m - 1];
+  for (std::size_t i = 0; i + m <= n; ++i) {
+    if (h[i] == first && h[i + m - 1] == last && equal_bytes(h + i + 1, s + 1, m > 2 ? m - 2 : 0)) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+constexpr std::size_t rfind_substr_scalar(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  if (m > n) {
+    return search_npos;
+  }
+  if (m == 0) {
+    return n;
+  }
+  const char first = s[0];
+  const char last = s[m - 1];
+  for (std::size_t i = n - m + 1; i > 0;) {
+    --i;
+    if (h[i] == first && h[i + m - 1] == last && equal_bytes(h + i + 1, s + 1, m > 2 ? m - 2 : 0)) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+// 256 位字符集合
+struct char_bitmap {
+  std::uint64_t words[4] = {0, 0, 0, 0};
+
+  constexpr char_bitmap(const char* set, std::size_t k) noexcept {
+    for (std::size_t i = 0; i < k; ++i) {
+      const auto b = static_cast<unsigned char>(set[i]);
+      words[b >> 6] |= std::uint64_t{1} << (b & 63);
+    }
+  }
+
+  constexpr bool contains(char c) const noexcept {
+    const auto b = static_cast<unsigned char>(c);
+    return (words[b >> 6] >> (b & 63)) & 1;
+  }
+};
+
+// in_set 为 true 时查找第一个属于集合的字符，否则查找第一个不属于集合的字符
+constexpr std::size_t find_of_scalar(const char* p, std::size_t n, const char_bitmap& set, bool in_set) noexcept {
+  for (std::size_t i = 0; i < n; ++i) {
+    if (set.contains(p[i]) == in_set) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+constexpr std::size_t rfind_of_scalar(const char* p, std::size_t n, const char_bitmap& set, bool in_set) noexcept {
+  while (n > 0) {
+    --n;
+    if (set.contains(p[n]) == in_set) {
+      return n;
+    }
+  }
+  return search_npos;
+}
+
+// ---------------------------------------------------------------------------
+// SSE2 版本（x86-64 基线）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_SSE2
+
+inline std::size_t find_char_sse2(const char* p, std::size_t n, char c) noexcept {
+  const __m128i needle = _mm_set1_epi8(c);
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  const std::size_t rest = find_char_scalar(p + i, n - i, c);
+  return rest == search_npos ? search_npos : i + rest;
+}
+
+inline std::size_t rfind_char_sse2(const char* p, std::size_t n, char c) noexcept {
+  const __m128i needle = _mm_set1_epi8(c);
+  std::size_t end = n;
+  for (; end >= 16; end -= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + end - 16));
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+    if (mask != 0) {
+      return end - 16 + 31 - static_cast<std::size_t>(std::countl_zero(mask));
+    }
+  }
+  return rfind_char_scalar(p, end, c);
+}
+
+inline std::size_t find_substr_sse2(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  const __m128i first = _mm_set1_epi8(s[0]);
+  const __m128i last = _mm_set1_epi8(s[m - 1]);
+  std::size_t i = 0;
+  for (; i + m + 15 <= n; i += 16) {
+    const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+    const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i + m - 1));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+    while (mask != 0) {
+      const auto k = static_cast<std::size_t>(std::countr_zero(mask));
+      if (m == 2 || std::memcmp(h + i + k + 1, s + 1, m - 2) == 0) {
+        return i + k;
+      }
+      mask &= mask - 1;
+    }
+  }
+  const std::size_t rest = find_substr_scalar(h + i, n - i, s, m);
+  return rest == search_npos ? search_npos : i + rest;
+}
+
+// find_substr_sse2 的镜像：候选起点按 16 个一组从高往低检查，组内从最高位的候选开始
+inline std::size_t rfind_substr_sse2(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  const __m128i first = _mm_set1_epi8(s[0]);
+  const __m128i last = _mm_set1_epi8(s[m - 1]);
+  std::size_t end = n - m + 1;  // 尚未检查的候选起点为 [0, end)
+  for (; end >= 16; end -= 16) {
+    const std::size_t i = end - 16;
+    const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+    const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i + m - 1));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+    while (mask != 0) {
+      const auto k = static_cast<std::size_t>(31 - std::countl_zero(mask));
+      if (m == 2 || std::memcmp(h + i + k + 1, s + 1, m - 2) == 0) {
+        return i + k;
+      }
+      mask &= ~(1u << k);
+    }
+  }
+  return rfind_substr_scalar(h, end + m - 1, s, m);
+}
+
+// 集合较小时逐字符比较后按位或，返回块内属于集合的字节掩码
+inline unsigned small_set_mask_sse2(__m128i block, const char* set, std::size_t k) noexcept {
+  __m128i any = _mm_setzero_si128();
+  for (std::size_t j = 0; j < k; ++j) {
+    any = _mm_or_si128(any, _mm_cmpeq_epi8(block, _mm_set1_epi8(set[j])));
+  }
+  return static_cast<unsigned>(_mm_movemask_epi8(any));
+}
+
+inline std::size_t find_of_small_set_sse2(const char* p, std::size_t n, const char* set, std::size_t k,
+                                          bool in_set) noexcept {
+  const unsigned flip = in_set ? 0u : 0xFFFFu;
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const unsigned mask = small_set_mask_sse2(block, set, k) ^ flip;
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  const std::size_t rest = find_of_scalar(p + i, n - i, char_bitmap(set, k), in_set);
+  return rest == search_npos ? search_npos : i + rest;
+}
+
+inline std::size_t rfind_of_small_set_sse2(const char* p, std::size_t n, const char* set, std::size_t k,
+                                           bool in_set) noexcept {
+  const unsigned flip = in_set ? 0u : 0xFFFFu;
+  std::size_t end = n;
+  for (; end >= 16; end -= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + end - 16));
+    const unsigned mask = small_set_mask_sse2(block, set, k) ^ flip;
+    if (mask != 0) {
+      return end - 16 + 31 - static_cast<std::size_t>(std::countl_zero(mask));
+    }
+  }
+  return rfind_of_scalar(p, end, char_bitmap(set, k), in_set);
+}
+
+#endif  // MYSTL_HAS_SSE2
+
+// ---------------------------------------------------------------------------
+// AVX2 版本（编译期开启或运行期分派）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// 每次处理 128 字节，四个块的比较结果先按位或再测试，命中后再逐块定位
+MYSTL_TARGET_AVX2 inline std::size_t find_char_avx2(const char* p, std::size_t n, char c) noexcept {
+  const __m256i needle = _mm256_set1_epi8(c);
+  const auto mask_at = [&](std::size_t at) MYSTL_TARGET_AVX2 {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + at));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+  };
+  std::size_t i = 0;
+  for (; i + 128 <= n; i += 128) {
+    const __m256i b0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle);
+    const __m256i b1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32)), needle);
+    const __m256i b2 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 64)), needle);
+    const __m256i b3 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 96)), needle);
+    const __m256i any = _mm256_or_si256(_mm256_or_si256(b0, b1), _mm256_or_si256(b2, b3));
+    if (!_mm256_testz_si256(any, any)) {
+      for (std::size_t at = i;; at += 32) {
+        const unsigned mask = mask_at(at);
+        if (mask != 0) {
+          return at + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+      }
+    }
+  }
+  for (; i + 32 <= n; i += 32) {
+    const unsigned mask = mask_at(i);
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  if (n < 32) {
+    // 整段不足 32 字节时无法向前重叠读取，交给窄内核处理
+#if MYSTL_HAS_SSE2
+    return find_char_sse2(p, n, c);
+#else
+    return find_char_scalar(p, n, c);
+#endif
+  }
+  if (i < n) {
+    // 尾部：与前一块重叠地读取最后 32 字节（n >= 32 保证不越过 p），丢掉已经检查过的低位
+    const std::size_t rest = n - i;
+    const unsigned mask = mask_at(n - 32) >> (32 - rest);
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  return search_npos;
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t find_substr_avx2(const char* h, std::size_t n, const char* s,
+                                                      std::size_t m) noexcept {
+  const __m256i first = _mm256_set1_epi8(s[0]);
+  const __m256i last = _mm256_set1_epi8(s[m - 1]);
+  std::size_t i = 0;
+  for (; i + m + 31 <= n; i += 32) {
+    const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i));
+    const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i + m - 1));
+    const __m256i eq =
+        _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last));
+    auto mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+    while (mask != 0) {
+      const auto k = static_cast<std::size_t>(std::countr_zero(mask));
+      if (m == 2 || std::memcmp(h + i + k + 1, s + 1, m - 2) == 0) {
+        return i + k;
+      }
+      mask &= mask - 1;
+    }
+  }
+  const std::size_t rest = find_substr_scalar(h + i, n - i, s, m);
+  return rest == search_npos ? search_npos : i + rest;
+}
+
+/**
+ * nibble 查找表：字节 b = (hi << 4) | lo
+ * - lut_low[lo] 的第 (hi & 7) 位表示 hi < 8 的字符是否在集合中，lut_high[lo] 对应 hi >= 8
+ * - 用 b 的最高位（即 hi >= 8）在两张表的查表结果之间选择，再与 1 << (hi & 7) 相与
+ */
+struct nibble_lut {
+  alignas(32) std::uint8_t low[32] = {};
+  alignas(32) std::uint8_t high[32] = {};
+
+  nibble_lut(const char* set, std::size_t k) noexcept {
+    for (std::size_t i = 0; i < k; ++i) {
+      const auto b = static_cast<unsigned char>(set[i]);
+      const unsigned lo = b & 0x0F;
+      const unsigned hi = b >> 4;
+      const auto bit = static_cast<std::uint8_t>(1u << (hi & 7));
+      std::uint8_t* table = hi < 8 ? low : high;
+      // pshufb 在每个 128 位通道内独立查表，两个通道放同一张表
+      table[lo] |= bit;
+      table[lo + 16] |= bit;
+    }
+  }
+};
+
+// 按 nibble_lut 给出 32 字节块内属于集合的字节掩码
+MYSTL_TARGET_AVX2 inline unsigned nibble_set_mask_avx2(__m256i block, __m256i lut_low, __m256i lut_high) noexcept {
+  const __m256i bit_of_hi = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,  //
+                                             1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+  const __m256i lo = _mm256_and_si256(block, nibble_mask);
+  const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+  const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lut_low, lo), _mm256_shuffle_epi8(lut_high, lo), block);
+  const __m256i hit = _mm256_and_si256(row, _mm256_shuffle_epi8(bit_of_hi, hi));
+  const __m256i miss = _mm256_cmpeq_epi8(hit, _mm256_setzero_si256());
+  return ~static_cast<unsigned>(_mm256_movemask_epi8(miss));
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t find_of_avx2(const char* p, std::size_t n, const char* set, std::size_t k,
+                                                  bool in_set) noexcept {
+  const nibble_lut lut(set, k);
+  const __m256i lut_low = _mm256_load_si256(reinterpret_cast<const __m256i*>(lut.low));
+  const __m256i lut_high = _mm256_load_si256(reinterpret_cast<const __m256i*>(lut.high));
+  const unsigned flip = in_set ? 0u : 0xFFFFFFFFu;
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    const unsigned mask = nibble_set_mask_avx2(block, lut_low, lut_high) ^ flip;
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  const std::size_t rest = find_of_scalar(p + i, n - i, char_bitmap(set, k), in_set);
+  return rest == search_npos ? search_npos : i + rest;
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t rfind_of_avx2(const char* p, std::size_t n, const char* set, std::size_t k,
+                                                   bool in_set) noexcept {
+  const nibble_lut lut(set, k);
+  const __m256i lut_low = _mm256_load_si256(reinterpret_cast<const __m256i*>(lut.low));
+  const __m256i lut_high = _mm256_load_si256(reinterpret_cast<const __m256i*>(lut.high));
+  const unsigned flip = in_set ? 0u : 0xFFFFFFFFu;
+  std::size_t end = n;
+  for (; end >= 32; end -= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + end - 32));
+    const unsigned mask = nibble_set_mask_avx2(block, lut_low, lut_high) ^ flip;
+    if (mask != 0) {
+      return end - 32 + 31 - static_cast<std::size_t>(std::countl_zero(mask));
+    }
+  }
+  return rfind_of_scalar(p, end, char_bitmap(set, k), in_set);
+}
+
+#endif  // MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// ---------------------------------------------------------------------------
+// 分派入口（运行期）
+// ---------------------------------------------------------------------------
+
+// 命中往往很近（如逐行查找换行符），先用 SSE2 检查开头 64 字节，
+// 剩余部分较长时再切换到 AVX2
+inline std::size_t find_char(const char* p, std::size_t n, char c) noexcept {
+#if MYSTL_HAS_SSE2
+  constexpr std::size_t head = 64;
+  if (n <= head) {
+    return find_char_sse2(p, n, c);
+  }
+  const std::size_t r = find_char_sse2(p, head, c);
+  if (r != search_npos) {
+    return r;
+  }
+  std::size_t rest = search_npos;
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    rest = find_char_avx2(p + head, n - head, c);
+  } else {
+    rest = find_char_sse2(p + head, n - head, c);
+  }
+#else
+  rest = find_char_sse2(p + head, n - head, c);
+#endif
+  return rest == search_npos ? search_npos : head + rest;
+#else
+  return find_char_scalar(p, n, c);
+#endif
+}
+
+inline std::size_t rfind_char(const char* p, std::size_t n, char c) noexcept {
+#if MYSTL_HAS_SSE2
+  return rfind_char_sse2(p, n, c);
+#else
+  return rfind_char_scalar(p, n, c);
+#endif
+}
+
+inline std::size_t find_substr(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  if (m == 0) {
+    return 0;
+  }
+  if (m > n) {
+    return search_npos;
+  }
+  if (m == 1) {
+    return find_char(h, n, s[0]);
+  }
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (n >= m + 31 && cpu_has_avx2()) {
+    return find_substr_avx2(h, n, s, m);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return find_substr_sse2(h, n, s, m);
+#else
+  return find_substr_scalar(h, n, s, m);
+#endif
+}
+
+inline std::size_t rfind_substr(const char* h, std::size_t n, const char* s, std::size_t m) noexcept {
+  if (m == 1) {
+    return rfind_char(h, n, s[0]);
+  }
+#if MYSTL_HAS_SSE2
+  if (m >= 2 && m <= n) {
+    return rfind_substr_sse2(h, n, s, m);
+  }
+#endif
+  return rfind_substr_scalar(h, n, s, m);
+}
+
+inline std::size_t find_of(const char* p, std::size_t n, const char* set, std::size_t k, bool in_set) noexcept {
+  if (k == 1 && in_set) {
+    return find_char(p, n, set[0]);
+  }
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (n >= 32 && cpu_has_avx2()) {
+    return find_of_avx2(p, n, set, k, in_set);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  if (k <= 8) {
+    return find_of_small_set_sse2(p, n, set, k, in_set);
+  }
+#endif
+  return find_of_scalar(p, n, char_bitmap(set, k), in_set);
+}
+
+inline std::size_t rfind_of(const char* p, std::size_t n, const char* set, std::size_t k, bool in_set) noexcept {
+  if (k == 1 && in_set) {
+    return rfind_char(p, n, set[0]);
+  }
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (n >= 32 && cpu_has_avx2()) {
+    return rfind_of_avx2(p, n, set, k, in_set);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  if (k <= 8) {
+    return rfind_of_small_set_sse2(p, n, set, k, in_set);
+  }
+#endif
+  return rfind_of_scalar(p, n, char_bitmap(set, k), in_set);
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS__DETAILS_STRING_SEARCH_HPP
@@ -0,0 +1,479 @@
+#ifndef MYSTL_CONTAINERS__DETAILS_UTF8_KERNELS_HPP
+#define MYSTL_CONTAINERS__DETAILS_UTF8_KERNELS_HPP
+
+// UTF-8 校验、计数与转码内核：标量 / SSE2 / AVX2 版本（hidden in __details）
+//
+// - 校验（AVX2）：查表法，每 32 字节用三次 nibble 查找（pshufb）判定相邻两字节的所有非法组合，
+//   再用饱和减法检查三、四字节序列的后续字节是否为续字节；
+//   不为 ASCII 块单独分支：ASCII 与非 ASCII 交错时分支预测失败的代价高于查表本身
+// - 校验（标量）：按 RFC 3629 逐序列判断，每次先以 8 字节为单位跳过 ASCII
+// - 计数：非续字节（不在 0x80..0xBF）的个数即码点数，向量比较后 popcount
+// - 转码：16 字节全为 ASCII 时整块零扩展 / 收窄，否则逐码点标量处理
+// 所有位置均为下标，未找到返回 utf8_npos
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "mystl/config/cpu_features.hpp"
+#include "mystl/config/platform.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mystl {
+namespace __details {
+
+inline constexpr std::size_t utf8_npos = static_cast<std::size_t>(-1);
+
+// ---------------------------------------------------------------------------
+// 标量版本
+// ---------------------------------------------------------------------------
+
+constexpr bool utf8_is_continuation(unsigned char b) noexcept { return (b & 0xC0u) == 0x80u; }
+
+// 解码 p[i..n) 开头的一个码点，返回序列长度；非法或截断返回 0
+constexpr int utf8_decode(const char* p, std::size_t n, std::size_t i, char32_t& cp) noexcept {
+  const auto b0 = static_cast<unsigned char>(p[i]);
+  if (b0 < 0x80u) {
+    cp = b0;
+    return 1;
+  }
+  if (b0 < 0xC2u) {  // 续字节或过长的两字节序列
+    return 0;
+  }
+  if (b0 < 0xE0u) {
+    if (i + 1 >= n || !utf8_is_continuation(static_cast<unsigned char>(p[i + 1]))) {
+      return 0;
+    }
+    cp = static_cast<char32_t>(((b0 & 0x1Fu) << 6) | (static_cast<unsigned char>(p[i + 1]) & 0x3Fu));
+    return 2;
+  }
+  if (b0 < 0xF0u) {
+    if (i + 2 >= n) {
+      return 0;
+    }
+    const auto b1 = static_cast<unsigned char>(p[i + 1]);
+    const auto b2 = static_cast<unsigned char>(p[i + 2]);
+    // E0 后不能小于 A0（过长），ED 后不能大于 9F（代理区）
+    if (!utf8_is_continuation(b1) || !utf8_is_continuation(b2) || (b0 == 0xE0u && b1 < 0xA0u) ||
+        (b0 == 0xEDu && b1 > 0x9Fu)) {
+      return 0;
+    }
+    cp = static_cast<char32_t>(((b0 & 0x0Fu) << 12) | ((b1 & 0x3Fu) << 6) | (b2 & 0x3Fu));
+    return 3;
+  }
+  if (b0 < 0xF5u) {
+    if (i + 3 >= n) {
+      return 0;
+    }
+    const auto b1 = static_cast<unsigned char>(p[i + 1]);
+    const auto b2 = static_cast<unsigned char>(p[i + 2]);
+    const auto b3 = static_cast<unsigned char>(p[i + 3]);
+    // F0 后不能小于 90（过长），F4 后不能大于 8F（超过 U+10FFFF）
+    if (!utf8_is_continuation(b1) || !utf8_is_continuation(b2) || !utf8_is_continuation(b3) ||
+        (b0 == 0xF0u && b1 < 0x90u) || (b0 == 0xF4u && b1 > 0x8Fu)) {
+      return 0;
+    }
+    cp = static_cast<char32_t>(((b0 & 0x07u) << 18) | ((b1 & 0x3Fu) << 12) | ((b2 & 0x3Fu) << 6) | (b3 & 0x3Fu));
+    return 4;
+  }
+  return 0;
+}
+
+// 把合法码点编码到 out，返回字节数
+constexpr int utf8_encode(char32_t cp, char* out) noexcept {
+  if (cp < 0x80u) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800u) {
+    out[0] = static_cast<char>(0xC0u | (cp >> 6));
+    out[1] = static_cast<char>(0x80u | (cp & 0x3Fu));
+    return 2;
+  }
+  if (cp < 0x10000u) {
+    out[0] = static_cast<char>(0xE0u | (cp >> 12));
+    out[1] = static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<char>(0x80u | (cp & 0x3Fu));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0u | (cp >> 18));
+  out[1] = static_cast<char>(0x80u | ((cp >> 12) & 0x3Fu));
+  out[2] = static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu));
+  out[3] = static_cast<char>(0x80u | (cp & 0x3Fu));
+  return 4;
+}
+
+constexpr int utf8_encoded_length(char32_t cp) noexcept {
+  return cp < 0x80u ? 1 : cp < 0x800u ? 2 : cp < 0x10000u ? 3 : 4;
+}
+
+// 解码已校验输入中的一个码点：只按首字节分长度，不再检查续字节
+inline int utf8_decode_valid(const char* p, char32_t& cp) noexcept {
+  const auto b0 = static_cast<unsigned char>(p[0]);
+  if (b0 < 0x80u) {
+    cp = b0;
+    return 1;
+  }
+  const auto b1 = static_cast<unsigned char>(p[1]) & 0x3Fu;
+  if (b0 < 0xE0u) {
+    cp = static_cast<char32_t>(((b0 & 0x1Fu) << 6) | b1);
+    return 2;
+  }
+  const auto b2 = static_cast<unsigned char>(p[2]) & 0x3Fu;
+  if (b0 < 0xF0u) {
+    cp = static_cast<char32_t>(((b0 & 0x0Fu) << 12) | (b1 << 6) | b2);
+    return 3;
+  }
+  const auto b3 = static_cast<unsigned char>(p[3]) & 0x3Fu;
+  cp = static_cast<char32_t>(((b0 & 0x07u) << 18) | (b1 << 12) | (b2 << 6) | b3);
+  return 4;
+}
+
+// 8 字节全为 ASCII
+inline bool utf8_ascii_word(const char* p) noexcept {
+  std::uint64_t w;
+  std::memcpy(&w, p, sizeof(w));
+  return (w & 0x8080808080808080ull) == 0;
+}
+
+// 从 i 开始查找第一个非法序列的起点
+inline std::size_t utf8_first_invalid_scalar(const char* p, std::size_t n, std::size_t i = 0) noexcept {
+  while (i < n) {
+    if (i + 8 <= n && utf8_ascii_word(p + i)) {
+      i += 8;
+      continue;
+    }
+    char32_t cp = 0;
+    const int len = utf8_decode(p, n, i, cp);
+    if (len == 0) {
+      return i;
+    }
+    i += static_cast<std::size_t>(len);
+  }
+  return utf8_npos;
+}
+
+constexpr std::size_t utf8_count_scalar(const char* p, std::size_t n) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    count += utf8_is_continuation(static_cast<unsigned char>(p[i])) ? 0u : 1u;
+  }
+  return count;
+}
+
+// 每个码点一个 UTF-16 单元，四字节序列（首字节 >= F0）再加一个
+constexpr std::size_t utf8_utf16_length_scalar(const char* p, std::size_t n) noexcept {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto b = static_cast<unsigned char>(p[i]);
+    count += (utf8_is_continuation(b) ? 0u : 1u) + (b >= 0xF0u ? 1u : 0u);
+  }
+  return count;
+}
+
+// ---------------------------------------------------------------------------
+// SSE2 版本（x86-64 基线）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_SSE2
+
+inline bool utf8_ascii_block_sse2(const char* p) noexcept {
+  return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) == 0;
+}
+
+// 先整块跳过 ASCII，遇到非 ASCII 块后逐序列校验到块尾之后
+inline std::size_t utf8_first_invalid_sse2(const char* p, std::size_t n) noexcept {
+  std::size_t i = 0;
+  while (i + 16 <= n) {
+    if (utf8_ascii_block_sse2(p + i)) {
+      i += 16;
+      continue;
+    }
+    const std::size_t block_end = i + 16;
+    while (i < block_end) {
+      char32_t cp = 0;
+      const int len = utf8_decode(p, n, i, cp);
+      if (len == 0) {
+        return i;
+      }
+      i += static_cast<std::size_t>(len);
+    }
+  }
+  return utf8_first_invalid_scalar(p, n, i);
+}
+
+// 有符号比较：续字节 0x80..0xBF 为 -128..-65，其余字节都大于 -65
+inline std::size_t utf8_count_sse2(const char* p, std::size_t n) noexcept {
+  const __m128i limit = _mm_set1_epi8(-65);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(block, limit)));
+    count += static_cast<std::size_t>(std::popcount(mask));
+  }
+  return count + utf8_count_scalar(p + i, n - i);
+}
+
+inline std::size_t utf8_utf16_length_sse2(const char* p, std::size_t n) noexcept {
+  const __m128i lead_limit = _mm_set1_epi8(-65);
+  const __m128i four_limit = _mm_set1_epi8(-17);  // 有符号下 0xF0..0xFF 为 -16..-1
+  const __m128i zero = _mm_setzero_si128();
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const auto leads = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(block, lead_limit)));
+    const __m128i four = _mm_and_si128(_mm_cmpgt_epi8(block, four_limit), _mm_cmplt_epi8(block, zero));
+    const auto fours = static_cast<unsigned>(_mm_movemask_epi8(four));
+    count += static_cast<std::size_t>(std::popcount(leads)) + static_cast<std::size_t>(std::popcount(fours));
+  }
+  return count + utf8_utf16_length_scalar(p + i, n - i);
+}
+
+// 16 个 ASCII 字节零扩展为 16 个 UTF-16 单元
+inline void utf8_widen16_sse2(const char* p, char16_t* out) noexcept {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(block, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(block, zero));
+}
+
+inline void utf8_widen32_sse2(const char* p, char32_t* out) noexcept {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lo = _mm_unpacklo_epi8(block, zero);
+  const __m128i hi = _mm_unpackhi_epi8(block, zero);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+}
+
+// 8 个 UTF-16 单元全部小于 0x80 时收窄为 8 字节
+inline bool utf16_narrow8_sse2(const char16_t* p, char* out) noexcept {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i high = _mm_and_si128(block, _mm_set1_epi16(static_cast<short>(0xFF80)));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF) {
+    return false;
+  }
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(block, block));
+  return true;
+}
+
+// 8 个 UTF-32 单元全部小于 0x80 时收窄为 8 字节
+inline bool utf32_narrow8_sse2(const char32_t* p, char* out) noexcept {
+  const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+  const __m128i high = _mm_or_si128(_mm_andnot_si128(_mm_set1_epi32(0x7F), a), _mm_andnot_si128(_mm_set1_epi32(0x7F), b));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xFFFF) {
+    return false;
+  }
+  const __m128i words = _mm_packs_epi32(a, b);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(words, words));
+  return true;
+}
+
+#endif  // MYSTL_HAS_SSE2
+
+// ---------------------------------------------------------------------------
+// AVX2 版本（编译期开启或运行期分派）
+// ---------------------------------------------------------------------------
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// 查表法校验中的错误类别：每种非法的 (前一字节, 当前字节) 组合对应一位，
+// 三张表分别以前一字节高 4 位、前一字节低 4 位、当前字节高 4 位为下标，三者按位与非零即为错误
+inline constexpr unsigned char utf8_too_short = 1 << 0;   // 首字节后缺少续字节
+inline constexpr unsigned char utf8_too_long = 1 << 1;    // ASCII 后出现续字节
+inline constexpr unsigned char utf8_overlong_3 = 1 << 2;  // E0 80..9F
+inline constexpr unsigned char utf8_too_large = 1 << 3;   // F4 90..BF 或 F5..FF
+inline constexpr unsigned char utf8_surrogate = 1 << 4;   // ED A0..BF
+inline constexpr unsigned char utf8_overlong_2 = 1 << 5;  // C0 / C1
+inline constexpr unsigned char utf8_too_large_1000 = 1 << 6;
+inline constexpr unsigned char utf8_overlong_4 = 1 << 6;  // F0 80..8F
+inline constexpr unsigned char utf8_two_conts = 1 << 7;   // 连续两个续字节（由长度检查确认是否合法）
+inline constexpr unsigned char utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+alignas(16) inline constexpr unsigned char utf8_byte1_high[16] = {
+    // 0_______：ASCII
+    utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+    utf8_too_long,
+    // 10______：续字节
+    utf8_two_conts, utf8_two_conts, utf8_two_conts, utf8_two_conts,
+    // 1100____ / 1101____：两字节首字节
+    utf8_too_short | utf8_overlong_2, utf8_too_short,
+    // 1110____：三字节首字节
+    utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+    // 1111____：四字节首字节
+    utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4};
+
+alignas(16) inline constexpr unsigned char utf8_byte1_low[16] = {
+    utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,  // ____0000
+    utf8_carry | utf8_overlong_2,                                      // ____0001
+    utf8_carry,
+    utf8_carry,
+    utf8_carry | utf8_too_large,  // ____0100
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,  // ____1101
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000};
+
+alignas(16) inline constexpr unsigned char utf8_byte2_high[16] = {
+    // 0_______：ASCII
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+    utf8_too_short,
+    // 1000____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+    // 1001____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+    // 101_____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    // 11______：首字节
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short};
+
+// 块末尾 3 字节中仍在等待续字节的首字节：最后 1 字节 >= C0，倒数第 2 字节 >= E0，倒数第 3 字节 >= F0
+alignas(32) inline constexpr unsigned char utf8_incomplete_limit[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF};
+
+MYSTL_TARGET_AVX2 inline __m256i utf8_load_table_avx2(const unsigned char* table) noexcept {
+  return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+// 把 input 整体后移 N 字节，空出的开头由上一块的末尾填充
+template <int N>
+MYSTL_TARGET_AVX2 inline __m256i utf8_prev_avx2(__m256i input, __m256i prev_input) noexcept {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+}
+
+struct utf8_validator_avx2 {
+  __m256i error;
+  __m256i prev_input;
+  __m256i prev_incomplete;
+  __m256i byte1_high;
+  __m256i byte1_low;
+  __m256i byte2_high;
+};
+
+MYSTL_TARGET_AVX2 inline void utf8_check_block_avx2(utf8_validator_avx2& v, __m256i input) noexcept {
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  const __m256i prev1 = utf8_prev_avx2<1>(input, v.prev_input);
+  const __m256i b1h = _mm256_shuffle_epi8(v.byte1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+  const __m256i b1l = _mm256_shuffle_epi8(v.byte1_low, _mm256_and_si256(prev1, nibble));
+  const __m256i b2h = _mm256_shuffle_epi8(v.byte2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+  const __m256i special = _mm256_and_si256(_mm256_and_si256(b1h, b1l), b2h);
+
+  // 前 2 / 前 3 字节是三 / 四字节首字节时，当前字节必须是续字节，且只有这种情况允许 two_conts
+  const __m256i prev2 = utf8_prev_avx2<2>(input, v.prev_input);
+  const __m256i prev3 = utf8_prev_avx2<3>(input, v.prev_input);
+  const __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  const __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+  v.error = _mm256_or_si256(v.error, _mm256_xor_si256(must23, special));
+
+  v.prev_incomplete =
+      _mm256_subs_epu8(input, _mm256_load_si256(reinterpret_cast<const __m256i*>(utf8_incomplete_limit)));
+  v.prev_input = input;
+}
+
+MYSTL_TARGET_AVX2 inline bool utf8_validate_avx2(const char* p, std::size_t n) noexcept {
+  utf8_validator_avx2 v{_mm256_setzero_si256(),
+                        _mm256_setzero_si256(),
+                        _mm256_setzero_si256(),
+                        utf8_load_table_avx2(utf8_byte1_high),
+                        utf8_load_table_avx2(utf8_byte1_low),
+                        utf8_load_table_avx2(utf8_byte2_high)};
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    utf8_check_block_avx2(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+  }
+  if (i < n) {
+    // 尾部补 0（ASCII）：截断的序列会在补齐的字节上报 too_short
+    alignas(32) char tail[32] = {};
+    std::memcpy(tail, p + i, n - i);
+    utf8_check_block_avx2(v, _mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+  }
+  const __m256i error = _mm256_or_si256(v.error, v.prev_incomplete);
+  return _mm256_testz_si256(error, error) != 0;
+}
+
+MYSTL_TARGET_AVX2 inline std::size_t utf8_count_avx2(const char* p, std::size_t n) noexcept {
+  const __m256i limit = _mm256_set1_epi8(-65);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, limit)));
+    count += static_cast<std::size_t>(std::popcount(mask));
+  }
+  return count + utf8_count_scalar(p + i, n - i);
+}
+
+#endif  // MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+
+// ---------------------------------------------------------------------------
+// 分派入口（运行期）
+// ---------------------------------------------------------------------------
+
+inline bool utf8_validate(const char* p, std::size_t n) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (cpu_has_avx2()) {
+    return utf8_validate_avx2(p, n);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return utf8_first_invalid_sse2(p, n) == utf8_npos;
+#else
+  return utf8_first_invalid_scalar(p, n) == utf8_npos;
+#endif
+}
+
+inline std::size_t utf8_first_invalid(const char* p, std::size_t n) noexcept {
+#if MYSTL_HAS_SSE2
+  return utf8_first_invalid_sse2(p, n);
+#else
+  return utf8_first_invalid_scalar(p, n);
+#endif
+}
+
+inline std::size_t utf8_count(const char* p, std::size_t n) noexcept {
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+  if (n >= 64 && cpu_has_avx2()) {
+    return utf8_count_avx2(p, n);
+  }
+#endif
+#if MYSTL_HAS_SSE2
+  return utf8_count_sse2(p, n);
+#else
+  return utf8_count_scalar(p, n);
+#endif
+}
+
+inline std::size_t utf8_utf16_length(const char* p, std::size_t n) noexcept {
+#if MYSTL_HAS_SSE2
+  return utf8_utf16_length_sse2(p, n);
+#else
+  return utf8_utf16_length_scalar(p, n);
+#endif
+}
+
+}  // namespace __details
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS__DETAILS_UTF8_KERNELS_HPP
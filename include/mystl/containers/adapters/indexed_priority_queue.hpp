@@ -0,0 +1,278 @@
+#ifndef MYSTL_CONTAINERS_ADAPTERS_INDEXED_PRIORITY_QUEUE_HPP
+#define MYSTL_CONTAINERS_ADAPTERS_INDEXED_PRIORITY_QUEUE_HPP
+
+/**
+ * @file containers/adapters/indexed_priority_queue.hpp
+ * @brief 可寻址优先队列 (indexed_priority_queue)：以稠密整数 ID 定位元素的 d 叉堆
+ *
+ * 每个 ID（[0, id_bound) 内的整数，如图的顶点编号、定时器槽位）在队列中至多出现一次，
+ * 可以按 ID 修改键或删除，不必重复入队再惰性跳过过期项，堆的大小始终等于有效元素个数。
+ *
+ * ## 布局
+ * - 堆数组存放 {key, id}，比较时不需要间接访问
+ * - pos 表按 ID 记录其在堆中的下标（不在队列中为 npos），堆中每次移动元素都同步更新
+ * - pos 表在 push 时按需扩展到 id + 1；ID 应当稠密，稀疏的大 ID 会浪费 pos 表空间
+ * - 叉数 Arity 默认 4：层数减半，pos 表的随机写入随之减半；选孩子的方式与 algorithms/heap.hpp 相同
+ *
+ * ## 复杂度
+ * - push / pop / update / decrease_key / erase：O(log n)
+ * - contains / key / top：O(1)
+ *
+ * ## 优先级
+ * - 与 priority_queue 一致：以 Compare 定义的最大者在堆顶；最小堆使用 std::greater
+ * - decrease_key(id, key) 沿用最短路算法中的名称，表示提高优先级：新键不能排在旧键之后
+ *   （最小堆中即新键不大于旧键），只做上浮；方向不确定时使用 update
+ */
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mystl/algorithms/heap.hpp"
+#include "mystl/core/assert.hpp"
+
+namespace mystl {
+
+template <class Key, class Compare = std::less<Key>, std::size_t Arity = 4>
+class indexed_priority_queue {
+  static_assert(Arity >= 2, "indexed_priority_queue: Arity must be at least 2");
+
+public:
+  using key_type = Key;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+
+  static constexpr std::size_t arity = Arity;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  indexed_priority_queue() : indexed_priority_queue(0) {}
+
+  /**
+   * @brief 预先为 [0, id_bound) 的 ID 分配 pos 表
+   */
+  explicit indexed_priority_queue(size_type id_bound, const Compare& compare = Compare())
+      : pos_(id_bound, npos), comp_(compare) {}
+
+  [[nodiscard]] bool empty() const noexcept { return heap_.empty(); }
+  size_type size() const noexcept { return heap_.size(); }
+
+  /**
+   * @brief pos 表覆盖的 ID 上界（不含）
+   */
+  size_type id_bound() const noexcept { return pos_.size(); }
+
+  /**
+   * @brief 为至多 n 个元素、[0, id_bound) 的 ID 预留空间
+   */
+  void reserve(size_type n, size_type id_bound) {
+    heap_.reserve(n);
+    if (id_bound > pos_.size()) {
+      pos_.resize(id_bound, npos);
+    }
+  }
+
+  bool contains(size_type id) const noexcept { return id < pos_.size() && pos_[id] != npos; }
+
+  const Key& key(size_type id) const {
+    MYSTL_ASSERT(contains(id));
+    return heap_[pos_[id]].key;
+  }
+
+  size_type top_id() const {
+    MYSTL_ASSERT(!empty());
+    return heap_.front().id;
+  }
+
+  const Key& top_key() const {
+    MYSTL_ASSERT(!empty());
+    return heap_.front().key;
+  }
+
+  /**
+   * @brief 加入 id，前置条件：id 不在队列中
+   */
+  void push(size_type id, Key key) {
+    MYSTL_ASSERT(!contains(id));
+    if (id >= pos_.size()) {
+      pos_.resize(id + 1, npos);
+    }
+    heap_.push_back(entry{std::move(key), id});
+    sift_up(heap_.size() - 1, std::move(heap_.back()));
+  }
+
+  /**
+   * @brief id 不在队列中时加入，否则把键改为 key
+   * @return 是否新加入
+   */
+  bool push_or_update(size_type id, Key key) {
+    if (contains(id)) {
+      update(id, std::move(key));
+      return false;
+    }
+    push(id, std::move(key));
+    return true;
+  }
+
+  /**
+   * @brief 把 id 的键改为 key，按新旧键的先后上浮或下沉
+   */
+  void update(size_type id, Key key) {
+    MYSTL_ASSERT(contains(id));
+    const size_type i = pos_[id];
+    const bool up = comp_(heap_[i].key, key);
+    entry e{std::move(key), id};
+    if (up) {
+      sift_up(i, std::move(e));
+    } else {
+      sift_down(i, std::move(e));
+    }
+  }
+
+  /**
+   * @brief 提高 id 的优先级，前置条件：key 不排在当前键之后
+   */
+  void decrease_key(size_type id, Key key) {
+    MYSTL_ASSERT(contains(id));
+    MYSTL_ASSERT(!comp_(key, heap_[pos_[id]].key));
+    const size_type i = pos_[id];
+    sift_up(i, entry{std::move(key), id});
+  }
+
+  /**
+   * @brief 删除堆顶；堆尾元素用 Floyd 下沉（空位先到叶子再上浮）补位
+   */
+  void pop() {
+    MYSTL_ASSERT(!empty());
+    pos_[heap_.front().id] = npos;
+    entry last = std::move(heap_.back());
+    heap_.pop_back();
+    if (heap_.empty()) {
+      return;
+    }
+    size_type hole = 0;
+    const size_type n = heap_.size();
+    for (size_type child = first_child(hole); child < n; child = first_child(hole)) {
+      const size_type best = max_child(child, n);
+      place(hole, std::move(heap_[best]));
+      hole = best;
+    }
+    sift_up(hole, std::move(last));
+  }
+
+  /**
+   * @brief 删除 id；不在队列中时什么也不做
+   * @return 是否删除了元素
+   */
+  bool erase(size_type id) {
+    if (!contains(id)) {
+      return false;
+    }
+    const size_type i = pos_[id];
+    pos_[id] = npos;
+    entry last = std::move(heap_.back());
+    heap_.pop_back();
+    if (i == heap_.size()) {
+      return true;
+    }
+    if (i > 0 && comp_(heap_[parent(i)].key, last.key)) {
+      sift_up(i, std::move(last));
+    } else {
+      sift_down(i, std::move(last));
+    }
+    return true;
+  }
+
+  /**
+   * @brief 清空队列，保留 pos 表与堆数组的容量
+   */
+  void clear() noexcept {
+    for (const entry& e : heap_) {
+      pos_[e.id] = npos;
+    }
+    heap_.clear();
+  }
+
+  void swap(indexed_priority_queue& other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(heap_, other.heap_);
+    swap(pos_, other.pos_);
+    swap(comp_, other.comp_);
+  }
+
+  friend void swap(indexed_priority_queue& a, indexed_priority_queue& b) noexcept(noexcept(a.swap(b))) {
+    a.swap(b);
+  }
+
+private:
+  struct entry {
+    Key key;
+    size_type id;
+  };
+
+  struct entry_compare {
+    bool operator()(const entry& a, const entry& b) const { return comp(a.key, b.key); }
+    Compare& comp;
+  };
+
+  static constexpr size_type parent(size_type i) noexcept { return (i - 1) / Arity; }
+  static constexpr size_type first_child(size_type i) noexcept { return Arity * i + 1; }
+
+  void place(size_type i, entry&& e) {
+    pos_[e.id] = i;
+    heap_[i] = std::move(e);
+  }
+
+  // [child, min(child + Arity, n)) 中优先级最高的孩子
+  size_type max_child(size_type child, size_type n) {
+    if (child + Arity <= n) {
+      entry_compare cmp{comp_};
+      const auto best = __details::heap_max_child<Arity, (Arity > 2)>(
+          heap_.begin(), static_cast<std::ptrdiff_t>(child), cmp);
+      return static_cast<size_type>(best);
+    }
+    size_type best = child;
+    for (size_type c = child + 1; c < n; ++c) {
+      if (comp_(heap_[best].key, heap_[c].key)) {
+        best = c;
+      }
+    }
+    return best;
+  }
+
+  // 把 e 放入空位 hole 并上浮
+  void sift_up(size_type hole, entry e) {
+    while (hole > 0) {
+      const size_type p = parent(hole);
+      if (!comp_(heap_[p].key, e.key)) {
+        break;
+      }
+      place(hole, std::move(heap_[p]));
+      hole = p;
+    }
+    place(hole, std::move(e));
+  }
+
+  // 把 e 放入空位 hole 并下沉；用于 update / erase，元素通常停在附近，逐层比较后提前结束
+  void sift_down(size_type hole, entry e) {
+    const size_type n = heap_.size();
+    for (size_type child = first_child(hole); child < n; child = first_child(hole)) {
+      const size_type best = max_child(child, n);
+      if (!comp_(e.key, heap_[best].key)) {
+        break;
+      }
+      place(hole, std::move(heap_[best]));
+      hole = best;
+    }
+    place(hole, std::move(e));
+  }
+
+  std::vector<entry> heap_;
+  std::vector<size_type> pos_;
+  Compare comp_;
+};
+
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS_ADAPTERS_INDEXED_PRIORITY_QUEUE_HPP
@@ -1,11 +1,142 @@
 #ifndef MYSTL_CONTAINERS_ADAPTERS_PRIORITY_QUEUE_HPP
 #define MYSTL_CONTAINERS_ADAPTERS_PRIORITY_QUEUE_HPP
 
-// placeholder for mystl::priority_queue adapter (default underlying: vector)
+/**
+ * @file containers/adapters/priority_queue.hpp
+ * @brief 优先队列适配器 (priority_queue)，底层为 d 叉堆
+ *
+ * ## 与 std::priority_queue 的差异
+ * - 第四个模板参数 Arity 为堆的叉数（默认 2，与 std 相同），对外以 priority_queue::arity 暴露。
+ *   元素多到超出缓存时（如上百万个定时器），pop 由每层一次缓存缺失主导，
+ *   Arity = 4 / 8 的层数更少、同一节点的孩子连续存放，通常更快；小队列用默认的 2 即可
+ * - 底层容器默认 std::vector（mystl::vector 尚未实现），需要随机访问迭代器与
+ *   front / push_back / emplace_back / pop_back
+ * - replace_top(value)：等价于 pop() 后 push(value)，但只做一次下沉。
+ *   定时器到期后重新排期、流式 top-k 中替换最小元素都是这种模式
+ * - 与 std 一样，受保护成员 c / comp 可由派生类访问
+ */
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mystl/algorithms/heap.hpp"
+#include "mystl/core/assert.hpp"
 
 namespace mystl {
-template <class T, class Container = void, class Compare = void>
-class priority_queue;  // to be implemented
-}
+
+template <class T, class Container = std::vector<T>, class Compare = std::less<typename Container::value_type>,
+          std::size_t Arity = 2>
+class priority_queue {
+  static_assert(Arity >= 2, "priority_queue: Arity must be at least 2");
+  static_assert(std::is_same_v<T, typename Container::value_type>,
+                "priority_queue: T must be the same as Container::value_type");
+
+public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = typename Container::value_type;
+  using size_type = typename Container::size_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+
+  static constexpr std::size_t arity = Arity;
+
+  priority_queue() : priority_queue(Compare()) {}
+
+  explicit priority_queue(const Compare& compare) : c(), comp(compare) {}
+
+  priority_queue(const Compare& compare, const Container& cont) : c(cont), comp(compare) { make_heap(); }
+
+  priority_queue(const Compare& compare, Container&& cont) : c(std::move(cont)), comp(compare) { make_heap(); }
+
+  template <std::input_iterator InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& compare = Compare()) : c(first, last), comp(compare) {
+    make_heap();
+  }
+
+  template <std::input_iterator InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& compare, const Container& cont)
+      : c(cont), comp(compare) {
+    c.insert(c.end(), first, last);
+    make_heap();
+  }
+
+  template <std::input_iterator InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& compare, Container&& cont)
+      : c(std::move(cont)), comp(compare) {
+    c.insert(c.end(), first, last);
+    make_heap();
+  }
+
+  [[nodiscard]] bool empty() const { return c.empty(); }
+  size_type size() const { return c.size(); }
+
+  const_reference top() const {
+    MYSTL_ASSERT(!c.empty());
+    return c.front();
+  }
+
+  void push(const value_type& value) {
+    c.push_back(value);
+    __details::push_heap_impl<Arity>(c.begin(), c.end(), comp);
+  }
+
+  void push(value_type&& value) {
+    c.push_back(std::move(value));
+    __details::push_heap_impl<Arity>(c.begin(), c.end(), comp);
+  }
+
+  template <class... Args>
+  void emplace(Args&&... args) {
+    c.emplace_back(std::forward<Args>(args)...);
+    __details::push_heap_impl<Arity>(c.begin(), c.end(), comp);
+  }
+
+  void pop() {
+    MYSTL_ASSERT(!c.empty());
+    __details::pop_heap_impl<Arity>(c.begin(), c.end(), comp);
+    c.pop_back();
+  }
+
+  /**
+   * @brief 用 value 替换堆顶：与 pop() + push(value) 结果相同，但只下沉一次、不改变容器大小
+   */
+  void replace_top(value_type value) {
+    MYSTL_ASSERT(!c.empty());
+    __details::heap_adjust<Arity>(c.begin(), std::iter_difference_t<typename Container::iterator>(0),
+                                  static_cast<std::iter_difference_t<typename Container::iterator>>(c.size()),
+                                  std::move(value), comp);
+  }
+
+  void swap(priority_queue& other) noexcept(std::is_nothrow_swappable_v<Container> &&
+                                            std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(c, other.c);
+    swap(comp, other.comp);
+  }
+
+  friend void swap(priority_queue& a, priority_queue& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+protected:
+  Container c;
+  Compare comp;
+
+private:
+  void make_heap() { __details::make_heap_impl<Arity>(c.begin(), c.end(), comp); }
+};
+
+template <class Compare, class Container>
+priority_queue(Compare, Container) -> priority_queue<typename Container::value_type, Container, Compare>;
+
+template <std::input_iterator InputIt, class Compare = std::less<std::iter_value_t<InputIt>>>
+priority_queue(InputIt, InputIt, Compare = Compare()) -> priority_queue<std::iter_value_t<InputIt>,
+                                                                        std::vector<std::iter_value_t<InputIt>>,
+                                                                        Compare>;
+
+}  // namespace mystl
 
 #endif  // MYSTL_CONTAINERS_ADAPTERS_PRIORITY_QUEUE_HPP
@@ -0,0 +1,346 @@
+#ifndef MYSTL_CONTAINERS_FORMAT_HPP
+#define MYSTL_CONTAINERS_FORMAT_HPP
+
+/**
+ * @file containers/format.hpp
+ * @brief 编译期检查的轻量格式化，直接追加到 mystl::string（format_to / format）
+ *
+ * ## 设计
+ * - format_string<Args...> 的构造函数是 consteval 的：格式串在编译期解析一次，
+ *   记录每个占位符的位置与进制，并按参数类型算出除字符串参数外的输出长度上界
+ *   - 占位符个数与参数个数不符、括号不匹配、不支持的说明符都会在编译期报错
+ * - format_to 先把字符串参数转成 string_view，上界 = 编译期常量 + 各字符串长度，
+ *   然后通过 string::resize_and_overwrite 一次性保证容量，直接写进尾部空闲空间，
+ *   不经过中间缓冲区；结束时按实际长度截断
+ *   - 例外：字符串参数指向 out 自身的缓冲区时，先格式化到临时字符串再追加
+ * - 数值走 mystl::to_chars，浮点为最短往返表示
+ *
+ * ## 支持的语法
+ * - {}：按参数类型的默认格式输出
+ * - {:x} {:X} {:o} {:b}：整数按十六 / 八 / 二进制输出（不带前缀）
+ * - {{ 与 }}：字面的 '{' 与 '}'
+ * - 参数类型：整数、bool、char、float、double，以及可转换为 mystl::string_view / std::string_view 的类型
+ *
+ * ## 与 std::format 的差异
+ * - 不支持位置参数、宽度、填充、精度与自定义 formatter
+ *
+ * ## 异常安全
+ * - 只有扩容可能抛出 std::bad_alloc / std::length_error，此时目标字符串保持不变
+ */
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/config/config.hpp"
+#include "mystl/containers/string.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/core/charconv.hpp"
+
+namespace mystl {
+
+namespace __details {
+
+enum class format_kind : unsigned char { integer, boolean, character, floating, string };
+
+template <class T>
+consteval format_kind format_kind_of() {
+  using U = std::remove_cvref_t<T>;
+  if constexpr (std::same_as<U, bool>) {
+    return format_kind::boolean;
+  } else if constexpr (std::same_as<U, char>) {
+    return format_kind::character;
+  } else if constexpr (charconv_integer<U>) {
+    return format_kind::integer;
+  } else if constexpr (std::same_as<U, double> || std::same_as<U, float>) {
+    return format_kind::floating;
+  } else {
+    static_assert(std::is_convertible_v<const U&, string_view> || std::is_convertible_v<const U&, std::string_view>,
+                  "mystl::format_to: unsupported argument type");
+    return format_kind::string;
+  }
+}
+
+// 非 constexpr 函数：在 consteval 求值中被调用即产生编译错误，错误信息中带有原因
+inline void invalid_format_string(const char*) {}
+
+// 整数按给定进制输出时的最大长度（含负号）
+template <class T>
+consteval std::size_t integer_format_bound(unsigned base) {
+  constexpr std::size_t bits = static_cast<std::size_t>(std::numeric_limits<std::make_unsigned_t<T>>::digits);
+  constexpr std::size_t sign = std::is_signed_v<T> ? 1 : 0;
+  switch (base) {
+    case 2:
+      return bits + sign;
+    case 8:
+      return (bits + 2) / 3 + sign;
+    case 16:
+      return (bits + 3) / 4 + sign;
+    default:
+      return max_chars_length<T>;
+  }
+}
+
+// 除字符串外，单个参数的输出长度上界
+template <class T>
+consteval std::size_t format_fixed_bound(unsigned base) {
+  using U = std::remove_cvref_t<T>;
+  constexpr format_kind kind = format_kind_of<U>();
+  if constexpr (kind == format_kind::integer) {
+    return integer_format_bound<U>(base);
+  } else if constexpr (kind == format_kind::boolean) {
+    return 5;  // "false"
+  } else if constexpr (kind == format_kind::character) {
+    return 1;
+  } else if constexpr (kind == format_kind::floating) {
+    return max_chars_length<U>;
+  } else {
+    return 0;
+  }
+}
+
+// 字符串参数先转成 string_view，只求一次长度；其他参数原样传递
+template <class T>
+constexpr decltype(auto) format_prepare(const T& value) noexcept {
+  if constexpr (format_kind_of<T>() != format_kind::string) {
+    return (value);
+  } else if constexpr (std::is_convertible_v<const T&, string_view>) {
+    return string_view(value);
+  } else {
+    const std::string_view v(value);
+    return string_view(v.data(), v.size());
+  }
+}
+
+template <class T>
+constexpr std::size_t format_runtime_size(const T& value) noexcept {
+  if constexpr (std::same_as<T, string_view>) {
+    return value.size();
+  } else {
+    return 0;
+  }
+}
+
+// 复制 [first, last) 中的字面文本；含转义时把 "{{" / "}}" 还原为单个括号
+inline char* format_copy_literal(char* out, const char* first, const char* last, bool has_escapes) noexcept {
+  if (!has_escapes) {
+    const auto n = static_cast<std::size_t>(last - first);
+    std::memcpy(out, first, n);
+    return out + n;
+  }
+  while (first != last) {
+    const char c = *first;
+    *out++ = c;
+    first += (c == '{' || c == '}') ? 2 : 1;
+  }
+  return out;
+}
+
+// 字符串参数是否指向 out 自身的缓冲区；扩容会先释放旧缓冲区，这类参数不能直接读取
+template <class T>
+bool format_aliases(const T& value, const string& out) noexcept {
+  if constexpr (std::same_as<T, string_view>) {
+    const std::less<const char*> less;
+    const char* first = out.data();
+    return !less(value.data(), first) && less(value.data(), first + out.capacity());
+  } else {
+    return false;
+  }
+}
+
+template <class T>
+char* format_write_arg(char* out, const T& value, unsigned base) noexcept {
+  if constexpr (std::same_as<T, string_view>) {
+    std::memcpy(out, value.data(), value.size());
+    return out + value.size();
+  } else if constexpr (std::same_as<T, bool>) {
+    const string_view s = value ? string_view("true", 4) : string_view("false", 5);
+    std::memcpy(out, s.data(), s.size());
+    return out + s.size();
+  } else if constexpr (std::same_as<T, char>) {
+    *out = value;
+    return out + 1;
+  } else if constexpr (std::same_as<T, double> || std::same_as<T, float>) {
+    return mystl::to_chars(out, out + max_chars_length<T>, value).ptr;
+  } else {
+    const unsigned abs_base = base == 17 ? 16 : base;
+    // 容量已按占位符的进制预留，这里只需给出一个足够大的尾端
+    char* end = mystl::to_chars(out, out + integer_format_bound<T>(2), value, static_cast<int>(abs_base)).ptr;
+    if (base == 17) {
+      for (char* p = out; p != end; ++p) {
+        if (*p >= 'a' && *p <= 'f') {
+          *p = static_cast<char>(*p - 'a' + 'A');
+        }
+      }
+    }
+    return end;
+  }
+}
+
+}  // namespace __details
+
+/**
+ * @brief 编译期解析的格式串，只能由常量表达式构造
+ *
+ * 记录每个占位符在格式串中的 [open, close] 位置与整数进制（{:X} 记为 17），
+ * 以及字面文本与非字符串参数的输出长度之和 fixed_bound()。
+ */
+template <class... Args>
+class format_string {
+public:
+  template <class S>
+    requires std::is_convertible_v<const S&, string_view>
+  consteval format_string(const S& s) : str_(s) {
+    parse();
+  }
+
+  constexpr string_view get() const noexcept { return str_; }
+  constexpr std::size_t fixed_bound() const noexcept { return fixed_bound_; }
+
+private:
+  template <class... A>
+  friend string& format_to(string& out, format_string<std::type_identity_t<A>...> fmt, const A&... args);
+
+  struct placeholder {
+    std::uint32_t open;
+    std::uint32_t close;
+    unsigned base;
+  };
+
+  static constexpr std::size_t arg_count = sizeof...(Args);
+
+  consteval void parse() {
+    const char* s = str_.data();
+    const std::size_t n = str_.size();
+    std::size_t literal = 0;
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (s[i] == '}') {
+        if (i + 1 == n || s[i + 1] != '}') {
+          __details::invalid_format_string("unmatched '}' in format string");
+        }
+        has_escapes_ = true;
+        ++literal;
+        ++i;
+        continue;
+      }
+      if (s[i] != '{') {
+        ++literal;
+        continue;
+      }
+      if (i + 1 < n && s[i + 1] == '{') {
+        has_escapes_ = true;
+        ++literal;
+        ++i;
+        continue;
+      }
+      if (index == arg_count) {
+        __details::invalid_format_string("more placeholders than arguments");
+      }
+      std::size_t j = i + 1;
+      unsigned base = 10;
+      if (j < n && s[j] == ':') {
+        ++j;
+        if (j < n && s[j] != '}') {
+          switch (s[j]) {
+            case 'x':
+              base = 16;
+              break;
+            case 'X':
+              base = 17;
+              break;
+            case 'o':
+              base = 8;
+              break;
+            case 'b':
+              base = 2;
+              break;
+            default:
+              __details::invalid_format_string("unsupported format specifier");
+          }
+          ++j;
+        }
+      }
+      if (j >= n || s[j] != '}') {
+        __details::invalid_format_string("unterminated or malformed placeholder");
+      }
+      if (base != 10 && kinds_[index] != __details::format_kind::integer) {
+        __details::invalid_format_string("base specifiers apply to integer arguments only");
+      }
+      specs_[index] = {static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j), base};
+      ++index;
+      i = j;
+    }
+    if (index != arg_count) {
+      __details::invalid_format_string("fewer placeholders than arguments");
+    }
+    fixed_bound_ = literal + args_bound(specs_, std::index_sequence_for<Args...>{});
+  }
+
+  template <std::size_t... I>
+  static consteval std::size_t args_bound([[maybe_unused]] const placeholder* specs, std::index_sequence<I...>) {
+    return (std::size_t{0} + ... + __details::format_fixed_bound<Args>(specs[I].base));
+  }
+
+  static constexpr __details::format_kind kinds_[arg_count + 1] = {__details::format_kind_of<Args>()...,
+                                                                    __details::format_kind::string};
+
+  string_view str_;
+  std::size_t fixed_bound_ = 0;
+  bool has_escapes_ = false;
+  placeholder specs_[arg_count + 1] = {};  // 多留一个元素，避免零长度数组
+};
+
+/**
+ * @brief 按 fmt 格式化 args 并追加到 out 末尾
+ *
+ * 容量不足时只按上界扩容一次；空闲容量足够时不分配。
+ */
+template <class... Args>
+string& format_to(string& out, format_string<std::type_identity_t<Args>...> fmt, const Args&... args) {
+  [&](const auto&... a) {
+    const std::size_t bound = fmt.fixed_bound() + (std::size_t{0} + ... + __details::format_runtime_size(a));
+    const auto write = [&](string& dst) {
+      const std::size_t old = dst.size();
+      dst.resize_and_overwrite(old + bound, [&](char* p, std::size_t) {
+        const char* s = fmt.str_.data();
+        char* it = p + old;
+        std::size_t prev = 0;
+        [[maybe_unused]] std::size_t index = 0;
+        ((it = __details::format_copy_literal(it, s + prev, s + fmt.specs_[index].open, fmt.has_escapes_),
+          it = __details::format_write_arg(it, a, fmt.specs_[index].base), prev = fmt.specs_[index].close + 1,
+          ++index),
+         ...);
+        it = __details::format_copy_literal(it, s + prev, s + fmt.str_.size(), fmt.has_escapes_);
+        return static_cast<std::size_t>(it - p);
+      });
+    };
+    if ((false || ... || __details::format_aliases(a, out))) {
+      // 参数引用了 out 自身：先格式化到独立的缓冲区再追加
+      string tmp;
+      write(tmp);
+      out.append(tmp.data(), tmp.size());
+    } else {
+      write(out);
+    }
+  }(__details::format_prepare(args)...);
+  return out;
+}
+
+// 格式化为新的字符串
+template <class... Args>
+string format(format_string<std::type_identity_t<Args>...> fmt, const Args&... args) {
+  string out;
+  format_to(out, fmt, args...);
+  return out;
+}
+
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS_FORMAT_HPP
@@ -1,16 +1,853 @@
 #ifndef MYSTL_CONTAINERS_HIVE_HPP
 #define MYSTL_CONTAINERS_HIVE_HPP
 
-// placeholder for mystl::hive (C++26)
-// Unordered container with stable references and O(1) erase
-// Similar to std::hive
+/**
+ * @file containers/hive.hpp
+ * @brief 稳定引用的块式容器 (Hive, C++26)
+ *
+ * 本文件实现 mystl::hive，接口与 std::hive (P0447) 对齐的子集。
+ *
+ * ## 存储结构
+ * - 元素存放在若干块（block）中，块按插入顺序组成双向链表
+ * - 每块带一个 skipfield（低复杂度跳跃计数模式）：被删除的连续槽位组成 skipblock，
+ *   仅其首/尾节点记录长度，迭代时 ++/-- 可以 O(1) 跳过整段空洞
+ * - 每个 skipblock 的首槽位复用元素内存保存空闲链表（prev/next），插入优先复用空洞
+ * - 存在空洞的块串成另一条链表，插入时 O(1) 找到可复用的槽位
+ *
+ * ## 容量回收
+ * - 块变空时立即从活动链表摘除：放入保留区（reserve），或在保留区已满时直接归还分配器
+ * - 保留区上限由 set_reserved_block_limit() 控制，默认不限（与 std::hive 行为一致）
+ * - trim_capacity() 释放保留区；shrink_to_fit() 进一步把元素压缩到尽量少的块中
+ * - reshape() 修改块容量上下限，超出范围的块会被重新分配
+ *
+ * ## 迭代器失效
+ * - insert/erase 不使其他元素的迭代器/引用失效
+ * - shrink_to_fit()/reshape() 需要搬移元素时使全部迭代器失效
+ *
+ * ## 异常安全
+ * - insert/emplace：强保证
+ * - shrink_to_fit/reshape：元素移动构造 noexcept 时为强保证，否则为基本保证
+ * - 拷贝赋值：先归还原有的块再按 other 的分配器策略复制，基本保证
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/core/move_if_noexcept.hpp"
+#include "mystl/memory/allocator.hpp"
+#include "mystl/memory/allocator_traits.hpp"
 
 namespace mystl {
-template <class T, class Allocator = void>
-class hive;  // to be implemented
-// Design: Block-based storage, stable iterators/references
-// O(1) erase, no rehashing, maintains insertion order within blocks
-// Exception safety: Strong guarantee where possible
+
+// 块容量的上下限（元素个数）
+struct hive_limits {
+  std::size_t min;
+  std::size_t max;
+  constexpr hive_limits(std::size_t minimum, std::size_t maximum) noexcept : min(minimum), max(maximum) {}
+};
+
+template <class T, class Allocator = allocator<T>>
+class hive {
+  // skipfield 元素类型决定了单块容量的硬上限
+  using skip_type = std::uint16_t;
+  static constexpr skip_type no_free = std::numeric_limits<skip_type>::max();
+
+  // 被删除 skipblock 的首槽位中保存的空闲链表节点
+  struct free_links {
+    skip_type prev;
+    skip_type next;
+  };
+
+  struct alignas(alignof(T) > alignof(free_links) ? alignof(T) : alignof(free_links)) slot {
+    unsigned char bytes[sizeof(T) > sizeof(free_links) ? sizeof(T) : sizeof(free_links)];
+  };
+
+  struct block {
+    slot* elements;
+    skip_type* skipfield;  // capacity + 1 项，末项恒为 0 作为哨兵
+    block* next;
+    block* prev;
+    block* next_erased;  // 含空洞的块链表
+    block* prev_erased;
+    std::size_t capacity;
+    std::size_t size;        // 存活元素数
+    std::size_t high_water;  // 已使用过的槽位上界（仅尾块可能小于 capacity）
+    std::size_t slot_count;  // 实际分配的 slot 数（含 skipfield 占用）
+    skip_type free_head;     // 首个空闲 skipblock 的起始下标
+    bool in_erased_list;
+  };
+
+  using alloc_traits = allocator_traits<Allocator>;
+  using slot_allocator = typename alloc_traits::template rebind_alloc<slot>;
+  using slot_traits = allocator_traits<slot_allocator>;
+  using block_allocator = typename alloc_traits::template rebind_alloc<block>;
+  using block_traits = allocator_traits<block_allocator>;
+
+  template <bool Const>
+  class hive_iterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    hive_iterator() noexcept = default;
+
+    template <bool OtherConst>
+      requires(Const && !OtherConst)
+    hive_iterator(const hive_iterator<OtherConst>& other) noexcept : block_(other.block_), index_(other.index_) {}
+
+    reference operator*() const noexcept { return *hive::element_at(block_, index_); }
+    pointer operator->() const noexcept { return hive::element_at(block_, index_); }
+
+    hive_iterator& operator++() noexcept {
+      ++index_;
+      index_ += block_->skipfield[index_];
+      if (index_ == block_->capacity && block_->next != nullptr) {
+        block_ = block_->next;
+        index_ = block_->skipfield[0];
+      }
+      return *this;
+    }
+
+    hive_iterator operator++(int) noexcept {
+      hive_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    hive_iterator& operator--() noexcept {
+      for (;;) {
+        if (index_ == 0) {
+          block_ = block_->prev;
+          index_ = block_->capacity;
+        }
+        --index_;
+        const std::size_t skip = block_->skipfield[index_];
+        if (skip <= index_) {
+          index_ -= skip;
+          return *this;
+        }
+        // 块首部全部为空洞，继续退到上一块
+        index_ = 0;
+      }
+    }
+
+    hive_iterator operator--(int) noexcept {
+      hive_iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    friend bool operator==(const hive_iterator& a, const hive_iterator& b) noexcept {
+      return a.block_ == b.block_ && a.index_ == b.index_;
+    }
+
+  private:
+    friend class hive;
+    template <bool>
+    friend class hive_iterator;
+
+    hive_iterator(block* b, std::size_t index) noexcept : block_(b), index_(index) {}
+
+    block* block_ = nullptr;
+    std::size_t index_ = 0;
+  };
+
+public:
+  // 类型定义
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+  using iterator = hive_iterator<false>;
+  using const_iterator = hive_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr hive_limits block_capacity_hard_limits() noexcept {
+    return hive_limits(2, std::numeric_limits<skip_type>::max());
+  }
+
+  static constexpr hive_limits block_capacity_default_limits() noexcept {
+    constexpr size_type max_bytes = 64 * 1024;
+    constexpr size_type by_size = max_bytes / sizeof(slot);
+    constexpr size_type max_cap = by_size < 8 ? 8 : (by_size > 8192 ? 8192 : by_size);
+    return hive_limits(8, max_cap);
+  }
+
+  // 构造函数
+  hive() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : hive(Allocator()) {}
+
+  explicit hive(const Allocator& alloc) noexcept : alloc_(alloc), limits_(block_capacity_default_limits()) {}
+
+  explicit hive(hive_limits block_limits, const Allocator& alloc = Allocator())
+      : alloc_(alloc), limits_(checked_limits(block_limits)) {}
+
+  hive(size_type n, const T& value, hive_limits block_limits = block_capacity_default_limits(),
+       const Allocator& alloc = Allocator())
+      : hive(block_limits, alloc) {
+    insert(n, value);
+  }
+
+  template <std::input_iterator InputIt>
+  hive(InputIt first, InputIt last, hive_limits block_limits = block_capacity_default_limits(),
+       const Allocator& alloc = Allocator())
+      : hive(block_limits, alloc) {
+    insert(first, last);
+  }
+
+  hive(std::initializer_list<T> il, hive_limits block_limits = block_capacity_default_limits(),
+       const Allocator& alloc = Allocator())
+      : hive(block_limits, alloc) {
+    insert(il.begin(), il.end());
+  }
+
+  hive(const hive& other)
+      : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)),
+        reserve_limit_(other.reserve_limit_),
+        limits_(other.limits_) {
+    reserve(other.size_);
+    insert(other.begin(), other.end());
+  }
+
+  hive(hive&& other) noexcept : alloc_(std::move(other.alloc_)) { steal(other); }
+
+  ~hive() { release_all(); }
+
+  hive& operator=(const hive& other) {
+    if (this == &other) {
+      return *this;
+    }
+    // 旧块可能属于即将被替换的分配器，也可能不符合新的上下限，先全部归还
+    release_all();
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      alloc_ = other.alloc_;
+    }
+    reserve_limit_ = other.reserve_limit_;
+    limits_ = other.limits_;
+    reserve(other.size_);
+    insert(other.begin(), other.end());
+    return *this;
+  }
+
+  hive& operator=(hive&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                         alloc_traits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value ||
+                  alloc_traits::is_always_equal::value) {
+      release_all();
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        alloc_ = std::move(other.alloc_);
+      }
+      steal(other);
+    } else if (alloc_ == other.alloc_) {
+      release_all();
+      steal(other);
+    } else {
+      // 旧块按旧 limits_ 分配，换上新上下限前必须全部归还，否则保留区里会残留越界的块
+      release_all();
+      reserve_limit_ = other.reserve_limit_;
+      limits_ = other.limits_;
+      reserve(other.size_);
+      for (auto& value : other) {
+        emplace(std::move(value));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  hive& operator=(std::initializer_list<T> il) {
+    hive tmp(il, limits_, alloc_);
+    swap(tmp);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // 迭代器
+  iterator begin() noexcept { return head_ ? iterator(head_, head_->skipfield[0]) : iterator(); }
+  const_iterator begin() const noexcept {
+    return head_ ? const_iterator(head_, head_->skipfield[0]) : const_iterator();
+  }
+  iterator end() noexcept { return tail_ ? iterator(tail_, tail_->high_water) : iterator(); }
+  const_iterator end() const noexcept { return tail_ ? const_iterator(tail_, tail_->high_water) : const_iterator(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+  // 容量
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept { return slot_traits::max_size(slot_allocator(alloc_)); }
+  size_type capacity() const noexcept { return capacity_; }
+  hive_limits block_capacity_limits() const noexcept { return limits_; }
+
+  // 保留区：变空的块最多保留多少个，超出部分直接归还分配器
+  size_type reserved_block_limit() const noexcept { return reserve_limit_; }
+
+  void set_reserved_block_limit(size_type n) noexcept {
+    reserve_limit_ = n;
+    while (reserved_count_ > reserve_limit_) {
+      block* b = reserve_;
+      reserve_ = b->next;
+      --reserved_count_;
+      capacity_ -= b->capacity;
+      deallocate_block(b);
+    }
+  }
+
+  void reserve(size_type n) {
+    if (n > max_size()) {
+      throw std::length_error("mystl::hive::reserve");
+    }
+    while (capacity_ < n) {
+      const size_type cap = clamp_capacity(n - capacity_);
+      block* b = allocate_block(cap);
+      b->next = reserve_;
+      reserve_ = b;
+      ++reserved_count_;
+      capacity_ += cap;
+    }
+  }
+
+  // 释放保留区中的块（不使迭代器失效）
+  void trim_capacity() noexcept { trim_capacity(0); }
+
+  void trim_capacity(size_type n) noexcept {
+    block** link = &reserve_;
+    while (*link != nullptr && capacity_ > n) {
+      block* b = *link;
+      if (capacity_ - b->capacity < n) {
+        link = &b->next;
+        continue;
+      }
+      *link = b->next;
+      --reserved_count_;
+      capacity_ -= b->capacity;
+      deallocate_block(b);
+    }
+  }
+
+  // 释放保留区，并在存在空洞时把元素压缩到新块中（使迭代器失效）
+  void shrink_to_fit() {
+    trim_capacity();
+    if (size_ == 0) {
+      release_all();
+      return;
+    }
+    if (erased_head_ != nullptr) {
+      rebuild(limits_);
+    }
+  }
+
+  // 修改块容量上下限；有活动块超出新范围时重新分配（使迭代器失效）
+  void reshape(hive_limits block_limits) {
+    const hive_limits limits = checked_limits(block_limits);
+    block** link = &reserve_;
+    while (*link != nullptr) {
+      block* b = *link;
+      if (b->capacity < limits.min || b->capacity > limits.max) {
+        *link = b->next;
+        --reserved_count_;
+        capacity_ -= b->capacity;
+        deallocate_block(b);
+      } else {
+        link = &b->next;
+      }
+    }
+    bool needs_rebuild = false;
+    for (block* b = head_; b != nullptr; b = b->next) {
+      if (b->capacity < limits.min || b->capacity > limits.max) {
+        needs_rebuild = true;
+        break;
+      }
+    }
+    if (needs_rebuild) {
+      rebuild(limits);
+    } else {
+      limits_ = limits;
+    }
+  }
+
+  // 修改器
+  template <class... Args>
+  iterator emplace(Args&&... args) {
+    if (erased_head_ != nullptr) {
+      return emplace_into_hole(std::forward<Args>(args)...);
+    }
+    if (tail_ != nullptr && tail_->high_water < tail_->capacity) {
+      block* b = tail_;
+      const size_type index = b->high_water;
+      construct_element(b, index, std::forward<Args>(args)...);
+      ++b->high_water;
+      ++b->size;
+      ++size_;
+      return iterator(b, index);
+    }
+    block* b = acquire_block();
+    try {
+      construct_element(b, 0, std::forward<Args>(args)...);
+    } catch (...) {
+      recycle_block(b);
+      throw;
+    }
+    b->high_water = 1;
+    b->size = 1;
+    link_tail(b);
+    ++size_;
+    return iterator(b, 0);
+  }
+
+  template <class... Args>
+  iterator emplace_hint(const_iterator, Args&&... args) {
+    return emplace(std::forward<Args>(args)...);
+  }
+
+  iterator insert(const T& value) { return emplace(value); }
+  iterator insert(T&& value) { return emplace(std::move(value)); }
+  iterator insert(const_iterator, const T& value) { return emplace(value); }
+  iterator insert(const_iterator, T&& value) { return emplace(std::move(value)); }
+
+  void insert(size_type n, const T& value) {
+    reserve(size_ + n);
+    for (size_type i = 0; i < n; ++i) {
+      emplace(value);
+    }
+  }
+
+  template <std::input_iterator InputIt>
+  void insert(InputIt first, InputIt last) {
+    if constexpr (std::forward_iterator<InputIt>) {
+      reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      emplace(*first);
+    }
+  }
+
+  void insert(std::initializer_list<T> il) { insert(il.begin(), il.end()); }
+
+  iterator erase(const_iterator pos) {
+    block* b = pos.block_;
+    const size_type index = pos.index_;
+    // 下一个位置需要在修改 skipfield 之前求出
+    iterator next(b, index);
+    ++next;
+
+    alloc_traits::destroy(alloc_, element_at(b, index));
+    --size_;
+    if (--b->size == 0) {
+      const bool was_tail = (b == tail_);
+      unlink_active(b);
+      recycle_block(b);
+      return was_tail ? end() : next;
+    }
+    mark_erased(b, index);
+    return next;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    // last 为 end() 时尾块可能在删除过程中被摘除，需要每轮重新取 end()
+    if (last == cend()) {
+      while (first != cend()) {
+        first = erase(first);
+      }
+      return end();
+    }
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(last.block_, last.index_);
+  }
+
+  // 销毁全部元素，块放入保留区（受保留区上限约束）
+  void clear() noexcept {
+    while (head_ != nullptr) {
+      block* b = head_;
+      destroy_block_elements(b);
+      head_ = b->next;
+      size_ -= b->size;
+      recycle_block(b);
+    }
+    tail_ = nullptr;
+    erased_head_ = nullptr;
+  }
+
+  void swap(hive& other) noexcept {
+    using std::swap;
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      swap(alloc_, other.alloc_);
+    }
+    swap(head_, other.head_);
+    swap(tail_, other.tail_);
+    swap(erased_head_, other.erased_head_);
+    swap(reserve_, other.reserve_);
+    swap(size_, other.size_);
+    swap(capacity_, other.capacity_);
+    swap(reserved_count_, other.reserved_count_);
+    swap(reserve_limit_, other.reserve_limit_);
+    swap(limits_, other.limits_);
+  }
+
+  friend void swap(hive& a, hive& b) noexcept { a.swap(b); }
+
+  // 由元素地址求迭代器，O(块数)
+  iterator get_iterator(const_pointer p) noexcept {
+    for (block* b = head_; b != nullptr; b = b->next) {
+      const auto* first = reinterpret_cast<const unsigned char*>(b->elements);
+      const auto* last = reinterpret_cast<const unsigned char*>(b->elements + b->high_water);
+      const auto* addr = reinterpret_cast<const unsigned char*>(p);
+      if (std::less_equal<>()(first, addr) && std::less<>()(addr, last)) {
+        return iterator(b, static_cast<size_type>(addr - first) / sizeof(slot));
+      }
+    }
+    return end();
+  }
+
+  const_iterator get_iterator(const_pointer p) const noexcept { return const_cast<hive*>(this)->get_iterator(p); }
+
+private:
+  static T* element_at(block* b, size_type index) noexcept {
+    return std::launder(reinterpret_cast<T*>(b->elements[index].bytes));
+  }
+
+  static free_links load_links(block* b, size_type index) noexcept {
+    free_links links;
+    std::memcpy(&links, b->elements[index].bytes, sizeof(links));
+    return links;
+  }
+
+  static void store_links(block* b, size_type index, free_links links) noexcept {
+    std::memcpy(b->elements[index].bytes, &links, sizeof(links));
+  }
+
+  static void set_prev(block* b, skip_type index, skip_type prev) noexcept {
+    free_links links = load_links(b, index);
+    links.prev = prev;
+    store_links(b, index, links);
+  }
+
+  static void set_next(block* b, skip_type index, skip_type next) noexcept {
+    free_links links = load_links(b, index);
+    links.next = next;
+    store_links(b, index, links);
+  }
+
+  static hive_limits checked_limits(hive_limits limits) {
+    constexpr hive_limits hard = block_capacity_hard_limits();
+    if (limits.min > limits.max || limits.min < hard.min || limits.max > hard.max) {
+      throw std::length_error("mystl::hive: block capacity limits out of range");
+    }
+    return limits;
+  }
+
+  size_type clamp_capacity(size_type wanted) const noexcept {
+    return wanted < limits_.min ? limits_.min : (wanted > limits_.max ? limits_.max : wanted);
+  }
+
+  template <class... Args>
+  void construct_element(block* b, size_type index, Args&&... args) {
+    alloc_traits::construct(alloc_, reinterpret_cast<T*>(b->elements[index].bytes), std::forward<Args>(args)...);
+  }
+
+  block* allocate_block(size_type cap) {
+    slot_allocator sa(alloc_);
+    const size_type skip_bytes = (cap + 1) * sizeof(skip_type);
+    const size_type slot_count = cap + (skip_bytes + sizeof(slot) - 1) / sizeof(slot);
+    slot* elements = slot_traits::allocate(sa, slot_count);
+    block_allocator ba(alloc_);
+    block* b;
+    try {
+      b = block_traits::allocate(ba, 1);
+    } catch (...) {
+      slot_traits::deallocate(sa, elements, slot_count);
+      throw;
+    }
+    auto* skipfield = reinterpret_cast<skip_type*>(elements + cap);
+    std::uninitialized_fill_n(skipfield, cap + 1, skip_type{0});
+    ::new (static_cast<void*>(b)) block{elements, skipfield, nullptr, nullptr, nullptr, nullptr, cap, 0, 0,
+                                        slot_count,  no_free,   false};
+    return b;
+  }
+
+  void deallocate_block(block* b) noexcept {
+    slot_allocator sa(alloc_);
+    slot_traits::deallocate(sa, b->elements, b->slot_count);
+    block_allocator ba(alloc_);
+    block_traits::deallocate(ba, b, 1);
+  }
+
+  // 从保留区取块（保留区中的块在取出时才重置 skipfield），否则新分配
+  block* acquire_block() {
+    if (reserve_ != nullptr) {
+      block* b = reserve_;
+      reserve_ = b->next;
+      --reserved_count_;
+      if (b->high_water != 0) {
+        std::fill_n(b->skipfield, b->high_water + 1, skip_type{0});
+      }
+      b->next = b->prev = b->next_erased = b->prev_erased = nullptr;
+      b->size = b->high_water = 0;
+      b->free_head = no_free;
+      b->in_erased_list = false;
+      return b;
+    }
+    const size_type cap = clamp_capacity(size_);
+    block* b = allocate_block(cap);
+    capacity_ += cap;
+    return b;
+  }
+
+  // 空块放回保留区或归还分配器
+  void recycle_block(block* b) noexcept {
+    if (reserved_count_ < reserve_limit_) {
+      b->next = reserve_;
+      reserve_ = b;
+      ++reserved_count_;
+    } else {
+      capacity_ -= b->capacity;
+      deallocate_block(b);
+    }
+  }
+
+  void link_tail(block* b) noexcept {
+    b->prev = tail_;
+    b->next = nullptr;
+    if (tail_ != nullptr) {
+      tail_->next = b;
+    } else {
+      head_ = b;
+    }
+    tail_ = b;
+  }
+
+  void unlink_active(block* b) noexcept {
+    if (b->prev != nullptr) {
+      b->prev->next = b->next;
+    } else {
+      head_ = b->next;
+    }
+    if (b->next != nullptr) {
+      b->next->prev = b->prev;
+    } else {
+      tail_ = b->prev;
+    }
+    if (b->in_erased_list) {
+      unlink_erased(b);
+    }
+  }
+
+  void link_erased(block* b) noexcept {
+    b->prev_erased = nullptr;
+    b->next_erased = erased_head_;
+    if (erased_head_ != nullptr) {
+      erased_head_->prev_erased = b;
+    }
+    erased_head_ = b;
+    b->in_erased_list = true;
+  }
+
+  void unlink_erased(block* b) noexcept {
+    if (b->prev_erased != nullptr) {
+      b->prev_erased->next_erased = b->next_erased;
+    } else {
+      erased_head_ = b->next_erased;
+    }
+    if (b->next_erased != nullptr) {
+      b->next_erased->prev_erased = b->prev_erased;
+    }
+    b->in_erased_list = false;
+  }
+
+  // 把 skipblock 的空闲节点从 from 挪到 to（skipblock 起点前移）
+  static void move_free_node(block* b, skip_type from, skip_type to) noexcept {
+    const free_links links = load_links(b, from);
+    store_links(b, to, links);
+    if (links.prev != no_free) {
+      set_next(b, links.prev, to);
+    } else {
+      b->free_head = to;
+    }
+    if (links.next != no_free) {
+      set_prev(b, links.next, to);
+    }
+  }
+
+  static void remove_free_node(block* b, skip_type index) noexcept {
+    const free_links links = load_links(b, index);
+    if (links.prev != no_free) {
+      set_next(b, links.prev, links.next);
+    } else {
+      b->free_head = links.next;
+    }
+    if (links.next != no_free) {
+      set_prev(b, links.next, links.prev);
+    }
+  }
+
+  void push_free_node(block* b, skip_type index) noexcept {
+    store_links(b, index, free_links{no_free, b->free_head});
+    if (b->free_head != no_free) {
+      set_prev(b, b->free_head, index);
+    }
+    b->free_head = index;
+  }
+
+  // 更新 skipfield：与左右相邻的 skipblock 合并
+  void mark_erased(block* b, size_type index) noexcept {
+    skip_type* skip = b->skipfield;
+    const auto i = static_cast<skip_type>(index);
+    const size_type left = index > 0 ? skip[index - 1] : 0;
+    const size_type right = skip[index + 1];
+    if (left == 0 && right == 0) {
+      skip[i] = 1;
+      push_free_node(b, i);
+    } else if (right == 0) {
+      const auto len = static_cast<skip_type>(left + 1);
+      skip[index - left] = len;
+      skip[i] = len;
+    } else if (left == 0) {
+      const auto len = static_cast<skip_type>(right + 1);
+      skip[i] = len;
+      skip[index + right] = len;
+      move_free_node(b, static_cast<skip_type>(i + 1), i);
+    } else {
+      const auto len = static_cast<skip_type>(left + right + 1);
+      remove_free_node(b, static_cast<skip_type>(i + 1));
+      skip[index - left] = len;
+      skip[index + right] = len;
+      skip[i] = 1;
+    }
+    if (!b->in_erased_list) {
+      link_erased(b);
+    }
+  }
+
+  // 复用空洞：总是占用首个空闲 skipblock 的起始槽位
+  template <class... Args>
+  iterator emplace_into_hole(Args&&... args) {
+    block* b = erased_head_;
+    const skip_type index = b->free_head;
+    const free_links links = load_links(b, index);
+    try {
+      construct_element(b, index, std::forward<Args>(args)...);
+    } catch (...) {
+      store_links(b, index, links);
+      throw;
+    }
+    skip_type* skip = b->skipfield;
+    const skip_type len = skip[index];
+    skip[index] = 0;
+    if (len == 1) {
+      b->free_head = links.next;
+      if (links.next != no_free) {
+        set_prev(b, links.next, no_free);
+      }
+    } else {
+      const auto start = static_cast<skip_type>(index + 1);
+      const auto new_len = static_cast<skip_type>(len - 1);
+      skip[start] = new_len;
+      skip[index + len - 1] = new_len;
+      store_links(b, start, links);
+      b->free_head = start;
+      if (links.next != no_free) {
+        set_prev(b, links.next, start);
+      }
+    }
+    if (b->free_head == no_free) {
+      unlink_erased(b);
+    }
+    ++b->size;
+    ++size_;
+    return iterator(b, index);
+  }
+
+  void destroy_block_elements(block* b) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      size_type index = b->skipfield[0];
+      while (index < b->high_water) {
+        alloc_traits::destroy(alloc_, element_at(b, index));
+        ++index;
+        index += b->skipfield[index];
+      }
+    }
+  }
+
+  void release_all() noexcept {
+    while (head_ != nullptr) {
+      block* b = head_;
+      head_ = b->next;
+      destroy_block_elements(b);
+      deallocate_block(b);
+    }
+    while (reserve_ != nullptr) {
+      block* b = reserve_;
+      reserve_ = b->next;
+      deallocate_block(b);
+    }
+    tail_ = nullptr;
+    erased_head_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+    reserved_count_ = 0;
+  }
+
+  void steal(hive& other) noexcept {
+    head_ = std::exchange(other.head_, nullptr);
+    tail_ = std::exchange(other.tail_, nullptr);
+    erased_head_ = std::exchange(other.erased_head_, nullptr);
+    reserve_ = std::exchange(other.reserve_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    reserved_count_ = std::exchange(other.reserved_count_, 0);
+    reserve_limit_ = other.reserve_limit_;
+    limits_ = other.limits_;
+  }
+
+  // 按给定上下限把全部元素搬到紧凑的新块中
+  void rebuild(hive_limits limits) {
+    hive tmp(limits, alloc_);
+    tmp.reserve_limit_ = reserve_limit_;
+    tmp.reserve(size_);
+    for (auto& value : *this) {
+      tmp.emplace(mystl::move_if_noexcept(value));
+    }
+    swap(tmp);
+  }
+
+  [[no_unique_address]] Allocator alloc_;
+  block* head_ = nullptr;
+  block* tail_ = nullptr;
+  block* erased_head_ = nullptr;
+  block* reserve_ = nullptr;  // 单向链表（复用 next）
+  size_type size_ = 0;
+  size_type capacity_ = 0;  // 活动块与保留块容量之和
+  size_type reserved_count_ = 0;
+  size_type reserve_limit_ = std::numeric_limits<size_type>::max();
+  hive_limits limits_ = block_capacity_default_limits();
+};
+
 }  // namespace mystl
 
 #endif  // MYSTL_CONTAINERS_HIVE_HPP
@@ -1,15 +1,583 @@
 #ifndef MYSTL_CONTAINERS_INPLACE_VECTOR_HPP
 #define MYSTL_CONTAINERS_INPLACE_VECTOR_HPP
 
-// placeholder for mystl::inplace_vector (C++26)
-// Fixed-capacity vector with stack-allocated storage
-// Similar to std::inplace_vector
+/**
+ * @file containers/inplace_vector.hpp
+ * @brief 固定容量、无动态分配的向量 (inplace_vector, C++26)
+ *
+ * 本文件实现 mystl::inplace_vector，接口与 std::inplace_vector (P0843) 对齐。
+ *
+ * ## 布局
+ * - 元素直接存放在对象内部，size 字段使用能容纳 Capacity 的最小无符号整数
+ *   （Capacity <= 255 时只占 1 字节）
+ * - Capacity == 0 时不含元素存储
+ *
+ * ## 平凡性
+ * - T 可平凡复制时 inplace_vector 也可平凡复制（可直接 memcpy，放进消息结构体）；
+ *   此时复制/移动由编译器生成，是一次固定长度的整对象拷贝
+ * - T 可平凡析构时 inplace_vector 可平凡析构
+ * - 其他路径（范围构造/assign/insert/erase 以及非平凡类型的复制）
+ *   对可平凡复制的 T 只 memcpy/memmove 已使用的前缀
+ *
+ * ## constexpr
+ * - T 可平凡默认构造且可平凡析构时，存储为普通数组，全部操作可在常量求值中使用
+ * - 其他 T 使用 union 存储，仅运行期可用
+ *
+ * ## 异常安全
+ * - 超出容量的 push_back/emplace_back/insert/构造抛出 std::bad_alloc（与 std 一致）
+ * - try_push_back/try_emplace_back 容量不足时返回 nullptr，不抛出
+ * - unchecked_* 以容量充足为前置条件
+ * - 单元素插入：强保证；范围插入：基本保证
+ */
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/core/assert.hpp"
 
 namespace mystl {
-template <class T, unsigned long long Capacity>
-class inplace_vector;  // to be implemented
-// Design: Fixed capacity, no dynamic allocation, stack-based storage
-// Exception safety: Strong guarantee where possible
+
+namespace __details {
+
+// 能表示 [0, N] 的最小无符号整数类型
+template <std::size_t N>
+using inplace_vector_size_t =
+    std::conditional_t<(N <= UINT8_MAX), std::uint8_t,
+                       std::conditional_t<(N <= UINT16_MAX), std::uint16_t,
+                                          std::conditional_t<(N <= UINT32_MAX), std::uint32_t, std::uint64_t>>>;
+
+template <class T>
+inline constexpr bool inplace_vector_trivial_storage =
+    std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+enum class inplace_vector_storage_kind { empty, trivial, non_trivial };
+
+template <class T, std::size_t N>
+inline constexpr inplace_vector_storage_kind inplace_vector_storage_kind_for =
+    N == 0 ? inplace_vector_storage_kind::empty
+           : (inplace_vector_trivial_storage<T> ? inplace_vector_storage_kind::trivial
+                                                : inplace_vector_storage_kind::non_trivial);
+
+template <class T, std::size_t N, inplace_vector_storage_kind = inplace_vector_storage_kind_for<T, N>>
+struct inplace_vector_storage;
+
+template <class T, std::size_t N>
+struct inplace_vector_storage<T, N, inplace_vector_storage_kind::empty> {
+  constexpr T* storage_data() noexcept { return nullptr; }
+  constexpr const T* storage_data() const noexcept { return nullptr; }
+};
+
+// 平凡类型：普通数组，可在常量求值中使用
+template <class T, std::size_t N>
+struct inplace_vector_storage<T, N, inplace_vector_storage_kind::trivial> {
+  T data_[N];
+
+  constexpr T* storage_data() noexcept { return data_; }
+  constexpr const T* storage_data() const noexcept { return data_; }
+};
+
+// 非平凡类型：union 避免默认构造元素
+template <class T, std::size_t N>
+struct inplace_vector_storage<T, N, inplace_vector_storage_kind::non_trivial> {
+  union {
+    T data_[N];
+  };
+
+  constexpr inplace_vector_storage() noexcept {}
+  inplace_vector_storage(const inplace_vector_storage&) = default;
+  inplace_vector_storage(inplace_vector_storage&&) = default;
+  inplace_vector_storage& operator=(const inplace_vector_storage&) = default;
+  inplace_vector_storage& operator=(inplace_vector_storage&&) = default;
+  constexpr ~inplace_vector_storage()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  // 元素由 inplace_vector 负责销毁
+  constexpr ~inplace_vector_storage() {}
+
+  constexpr T* storage_data() noexcept { return data_; }
+  constexpr const T* storage_data() const noexcept { return data_; }
+};
+
+// 复制 n 个元素到未初始化内存：可平凡复制时只 memcpy 已使用的前缀
+template <class T>
+constexpr void inplace_copy_n(const T* src, std::size_t n, T* dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if !consteval {
+      if (n != 0) {
+        std::memcpy(dst, src, n * sizeof(T));
+      }
+      return;
+    }
+  }
+  std::size_t i = 0;
+  try {
+    for (; i < n; ++i) {
+      std::construct_at(dst + i, src[i]);
+    }
+  } catch (...) {
+    std::destroy(dst, dst + i);
+    throw;
+  }
+}
+
+template <class T>
+constexpr void inplace_move_n(T* src, std::size_t n, T* dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if !consteval {
+      if (n != 0) {
+        std::memcpy(dst, src, n * sizeof(T));
+      }
+      return;
+    }
+  }
+  std::size_t i = 0;
+  try {
+    for (; i < n; ++i) {
+      std::construct_at(dst + i, std::move(src[i]));
+    }
+  } catch (...) {
+    std::destroy(dst, dst + i);
+    throw;
+  }
+}
+
+}  // namespace __details
+
+template <class T, std::size_t Capacity>
+class inplace_vector : private __details::inplace_vector_storage<T, Capacity> {
+  using storage = __details::inplace_vector_storage<T, Capacity>;
+  using size_field = __details::inplace_vector_size_t<Capacity>;
+
+  static constexpr bool trivial_copy_ctor = std::is_trivially_copy_constructible_v<T>;
+  static constexpr bool trivial_move_ctor = std::is_trivially_move_constructible_v<T>;
+  static constexpr bool trivial_copy_assign = std::is_trivially_copy_constructible_v<T> &&
+                                              std::is_trivially_copy_assignable_v<T> &&
+                                              std::is_trivially_destructible_v<T>;
+  static constexpr bool trivial_move_assign = std::is_trivially_move_constructible_v<T> &&
+                                              std::is_trivially_move_assignable_v<T> &&
+                                              std::is_trivially_destructible_v<T>;
+
+public:
+  // 类型定义
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // 构造函数（用户提供的默认构造：值初始化时不会清零整块存储）
+  constexpr inplace_vector() noexcept {}
+
+  // 构造函数抛出时析构函数不会运行，经 resize 走带回滚的路径以销毁已构造的元素
+  constexpr explicit inplace_vector(size_type n) { resize(n); }
+
+  constexpr inplace_vector(size_type n, const T& value) { resize(n, value); }
+
+  template <std::input_iterator InputIt>
+  constexpr inplace_vector(InputIt first, InputIt last) {
+    append_range(first, last);
+  }
+
+  constexpr inplace_vector(std::initializer_list<T> il) { append_range(il.begin(), il.end()); }
+
+  constexpr inplace_vector(const inplace_vector&)
+    requires trivial_copy_ctor
+  = default;
+  constexpr inplace_vector(const inplace_vector& other) {
+    __details::inplace_copy_n(other.data(), other.size(), data());
+    size_ = other.size_;
+  }
+
+  constexpr inplace_vector(inplace_vector&&)
+    requires trivial_move_ctor
+  = default;
+  constexpr inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    __details::inplace_move_n(other.data(), other.size(), data());
+    size_ = other.size_;
+  }
+
+  constexpr ~inplace_vector()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  constexpr ~inplace_vector() { std::destroy(begin(), end()); }
+
+  constexpr inplace_vector& operator=(const inplace_vector&)
+    requires trivial_copy_assign
+  = default;
+  constexpr inplace_vector& operator=(const inplace_vector& other) {
+    if (this != &other) {
+      assign_from(other.data(), other.size());
+    }
+    return *this;
+  }
+
+  constexpr inplace_vector& operator=(inplace_vector&&)
+    requires trivial_move_assign
+  = default;
+  constexpr inplace_vector& operator=(inplace_vector&& other) noexcept(std::is_nothrow_move_assignable_v<T> &&
+                                                                      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      const size_type common = std::min(size(), other.size());
+      std::move(other.begin(), other.begin() + common, begin());
+      if (other.size() > size()) {
+        __details::inplace_move_n(other.data() + common, other.size() - common, data() + common);
+      } else {
+        std::destroy(begin() + common, end());
+      }
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  constexpr inplace_vector& operator=(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+    return *this;
+  }
+
+  constexpr void assign(size_type n, const T& value) {
+    check_capacity(n);
+    clear();
+    for (; size_ < n; ++size_) {
+      std::construct_at(data() + size_, value);
+    }
+  }
+
+  template <std::input_iterator InputIt>
+  constexpr void assign(InputIt first, InputIt last) {
+    if constexpr (contiguous_source<InputIt>) {
+      const auto n = static_cast<size_type>(last - first);
+      check_capacity(n);
+      assign_from(std::to_address(first), n);
+    } else {
+      clear();
+      append_range(first, last);
+    }
+  }
+
+  constexpr void assign(std::initializer_list<T> il) { assign(il.begin(), il.end()); }
+
+  // 迭代器
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size(); }
+  constexpr const_iterator end() const noexcept { return data() + size(); }
+  constexpr const_iterator cbegin() const noexcept { return begin(); }
+  constexpr const_iterator cend() const noexcept { return end(); }
+  constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+  constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+  // 容量
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr size_type size() const noexcept { return size_; }
+  static constexpr size_type max_size() noexcept { return Capacity; }
+  static constexpr size_type capacity() noexcept { return Capacity; }
+
+  constexpr void resize(size_type n) {
+    check_capacity(n);
+    if (n < size()) {
+      std::destroy(begin() + n, end());
+      size_ = static_cast<size_field>(n);
+      return;
+    }
+    const size_type old = size();
+    try {
+      for (; size_ < n; ++size_) {
+        std::construct_at(data() + size_);
+      }
+    } catch (...) {
+      std::destroy(begin() + old, end());
+      size_ = static_cast<size_field>(old);
+      throw;
+    }
+  }
+
+  constexpr void resize(size_type n, const T& value) {
+    check_capacity(n);
+    if (n < size()) {
+      std::destroy(begin() + n, end());
+      size_ = static_cast<size_field>(n);
+      return;
+    }
+    const size_type old = size();
+    try {
+      for (; size_ < n; ++size_) {
+        std::construct_at(data() + size_, value);
+      }
+    } catch (...) {
+      std::destroy(begin() + old, end());
+      size_ = static_cast<size_field>(old);
+      throw;
+    }
+  }
+
+  static constexpr void reserve(size_type n) { check_capacity(n); }
+  static constexpr void shrink_to_fit() noexcept {}
+
+  // 元素访问
+  constexpr reference operator[](size_type n) {
+    MYSTL_ASSERT(n < size());
+    return data()[n];
+  }
+  constexpr const_reference operator[](size_type n) const {
+    MYSTL_ASSERT(n < size());
+    return data()[n];
+  }
+
+  constexpr reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("mystl::inplace_vector::at");
+    }
+    return data()[n];
+  }
+  constexpr const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("mystl::inplace_vector::at");
+    }
+    return data()[n];
+  }
+
+  constexpr reference front() { return (*this)[0]; }
+  constexpr const_reference front() const { return (*this)[0]; }
+  constexpr reference back() { return (*this)[size() - 1]; }
+  constexpr const_reference back() const { return (*this)[size() - 1]; }
+
+  constexpr T* data() noexcept { return this->storage_data(); }
+  constexpr const T* data() const noexcept { return this->storage_data(); }
+
+  // 修改器
+  template <class... Args>
+  constexpr reference emplace_back(Args&&... args) {
+    if (size() == Capacity) {
+      throw std::bad_alloc();
+    }
+    return unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  constexpr reference push_back(const T& value) { return emplace_back(value); }
+  constexpr reference push_back(T&& value) { return emplace_back(std::move(value)); }
+
+  template <class... Args>
+  constexpr pointer try_emplace_back(Args&&... args) {
+    if (size() == Capacity) {
+      return nullptr;
+    }
+    return std::addressof(unchecked_emplace_back(std::forward<Args>(args)...));
+  }
+
+  constexpr pointer try_push_back(const T& value) { return try_emplace_back(value); }
+  constexpr pointer try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+
+  template <class... Args>
+  constexpr reference unchecked_emplace_back(Args&&... args) {
+    MYSTL_ASSERT(size() < Capacity);
+    T* p = std::construct_at(data() + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *p;
+  }
+
+  constexpr reference unchecked_push_back(const T& value) { return unchecked_emplace_back(value); }
+  constexpr reference unchecked_push_back(T&& value) { return unchecked_emplace_back(std::move(value)); }
+
+  constexpr void pop_back() {
+    MYSTL_ASSERT(!empty());
+    --size_;
+    std::destroy_at(data() + size_);
+  }
+
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args&&... args) {
+    const auto offset = pos - cbegin();
+    emplace_back(std::forward<Args>(args)...);
+    std::rotate(begin() + offset, end() - 1, end());
+    return begin() + offset;
+  }
+
+  constexpr iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+  constexpr iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+  constexpr iterator insert(const_iterator pos, size_type n, const T& value) {
+    const auto offset = pos - cbegin();
+    check_capacity(size() + n);
+    const size_type old = size();
+    for (size_type i = 0; i < n; ++i) {
+      unchecked_emplace_back(value);
+    }
+    std::rotate(begin() + offset, begin() + old, end());
+    return begin() + offset;
+  }
+
+  template <std::input_iterator InputIt>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    const auto offset = pos - cbegin();
+    if constexpr (contiguous_source<InputIt> && std::is_trivially_copyable_v<T>) {
+      if !consteval {
+        // 只搬动插入点之后的部分，再拷入新元素
+        const auto n = static_cast<size_type>(last - first);
+        check_capacity(size() + n);
+        T* p = data() + offset;
+        std::memmove(p + n, p, (size() - static_cast<size_type>(offset)) * sizeof(T));
+        if (n != 0) {
+          std::memcpy(p, std::to_address(first), n * sizeof(T));
+        }
+        size_ = static_cast<size_field>(size_ + n);
+        return p;
+      }
+    }
+    const size_type old = size();
+    append_range(first, last);
+    std::rotate(begin() + offset, begin() + old, end());
+    return begin() + offset;
+  }
+
+  constexpr iterator insert(const_iterator pos, std::initializer_list<T> il) {
+    return insert(pos, il.begin(), il.end());
+  }
+
+  constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    iterator f = begin() + (first - cbegin());
+    iterator l = begin() + (last - cbegin());
+    if (f == l) {
+      return f;
+    }
+    const auto n = static_cast<size_type>(l - f);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if !consteval {
+        std::memmove(f, l, static_cast<size_type>(end() - l) * sizeof(T));
+        size_ = static_cast<size_field>(size_ - n);
+        return f;
+      }
+    }
+    iterator new_end = std::move(l, end(), f);
+    std::destroy(new_end, end());
+    size_ = static_cast<size_field>(size_ - n);
+    return f;
+  }
+
+  constexpr void clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+  constexpr void swap(inplace_vector& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                      std::is_nothrow_move_constructible_v<T>) {
+    inplace_vector& small = size() <= other.size() ? *this : other;
+    inplace_vector& large = size() <= other.size() ? other : *this;
+    const size_type common = small.size();
+    std::swap_ranges(small.begin(), small.end(), large.begin());
+    __details::inplace_move_n(large.data() + common, large.size() - common, small.data() + common);
+    std::destroy(large.begin() + common, large.end());
+    std::swap(small.size_, large.size_);
+  }
+
+  friend constexpr void swap(inplace_vector& a, inplace_vector& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+  friend constexpr bool operator==(const inplace_vector& a, const inplace_vector& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+  friend constexpr auto operator<=>(const inplace_vector& a, const inplace_vector& b)
+    requires std::three_way_comparable<T>
+  {
+    return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+private:
+  template <class It>
+  static constexpr bool contiguous_source =
+      std::contiguous_iterator<It> && std::is_same_v<std::remove_cv_t<std::iter_value_t<It>>, T>;
+
+  static constexpr void check_capacity(size_type n) {
+    if (n > Capacity) {
+      throw std::bad_alloc();
+    }
+  }
+
+  template <class InputIt>
+  constexpr void append_range(InputIt first, InputIt last) {
+    if constexpr (contiguous_source<InputIt>) {
+      const auto n = static_cast<size_type>(last - first);
+      check_capacity(size() + n);
+      __details::inplace_copy_n(std::to_address(first), n, data() + size());
+      size_ = static_cast<size_field>(size_ + n);
+    } else {
+      if constexpr (std::forward_iterator<InputIt>) {
+        check_capacity(size() + static_cast<size_type>(std::distance(first, last)));
+      }
+      const size_type old = size();
+      try {
+        for (; first != last; ++first) {
+          emplace_back(*first);
+        }
+      } catch (...) {
+        std::destroy(begin() + old, end());
+        size_ = static_cast<size_field>(old);
+        throw;
+      }
+    }
+  }
+
+  // 用 [src, src + n) 覆盖当前内容：前 min(size, n) 个赋值，其余构造或销毁
+  constexpr void assign_from(const T* src, size_type n) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if !consteval {
+        if (n != 0) {
+          std::memmove(data(), src, n * sizeof(T));
+        }
+        size_ = static_cast<size_field>(n);
+        return;
+      }
+    }
+    const size_type common = std::min(size(), n);
+    std::copy(src, src + common, begin());
+    if (n > size()) {
+      __details::inplace_copy_n(src + common, n - common, data() + common);
+    } else {
+      std::destroy(begin() + n, end());
+    }
+    size_ = static_cast<size_field>(n);
+  }
+
+  size_field size_ = 0;
+};
+
+template <class T, std::size_t Capacity, class U>
+constexpr std::size_t erase(inplace_vector<T, Capacity>& c, const U& value) {
+  auto it = std::remove(c.begin(), c.end(), value);
+  const auto n = static_cast<std::size_t>(c.end() - it);
+  c.erase(it, c.end());
+  return n;
+}
+
+template <class T, std::size_t Capacity, class Pred>
+constexpr std::size_t erase_if(inplace_vector<T, Capacity>& c, Pred pred) {
+  auto it = std::remove_if(c.begin(), c.end(), pred);
+  const auto n = static_cast<std::size_t>(c.end() - it);
+  c.erase(it, c.end());
+  return n;
+}
+
 }  // namespace mystl
 
 #endif  // MYSTL_CONTAINERS_INPLACE_VECTOR_HPP
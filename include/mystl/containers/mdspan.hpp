@@ -1,24 +1,949 @@
 #ifndef MYSTL_CONTAINERS_MDSPAN_HPP
 #define MYSTL_CONTAINERS_MDSPAN_HPP
 
-// placeholder for mystl::mdspan (C++23)
-// Multi-dimensional span over contiguous memory
-// Similar to std::mdspan
+/**
+ * @file containers/mdspan.hpp
+ * @brief 多维数组视图 (mdspan, C++23)
+ *
+ * 本文件实现 mystl::mdspan 及其组成部分，接口与 std::mdspan 对齐：
+ * - extents<IndexType, Es...>：静态维度不占存储，只有 dynamic_extent 维度保存在对象中
+ * - layout_right（行优先，C 风格）、layout_left（列优先，Fortran 风格）、layout_stride（任意步长）
+ * - layout_blocked<TileRows, TileCols>：二维分块布局，配合 for_each_tile 按块遍历
+ * - default_accessor<T>：直接解引用 T*
+ * - aligned_accessor<T, N>：通过 std::assume_aligned 告知编译器数据按 N 字节对齐
+ * - restrict_accessor<T>：数据句柄带 restrict 限定，承诺视图之间没有别名
+ * - streaming_accessor<T>：只写视图，赋值使用非临时（non-temporal）存储绕过缓存，
+ *   写完后需调用 streaming_fence()
+ *
+ * ## 零开销
+ * - extents<int, 3, 3> 是空类，extent(r) 在 r 为常量时折叠为编译期常量
+ * - layout 的索引计算按维度展开（index_sequence），不含运行期循环，
+ *   全静态维度时 mapping(i, j) 编译为 i * 3 + j
+ * - mdspan 本身只保存数据指针以及（必要时）动态维度
+ *
+ * ## 前置条件
+ * - 下标越界、静态维度与构造实参不一致等属于前置条件违例，仅在调试构建中断言
+ */
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/config/compiler.hpp"
+#include "mystl/config/platform.hpp"
+#include "mystl/containers/span.hpp"
+#include "mystl/core/assert.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace mystl {
 
-// Layout policies (simplified)
-struct layout_left;    // row-major
-struct layout_right;   // column-major
-struct layout_stride;  // custom stride
+namespace __details {
+
+// 动态维度存储：个数为 0 时为空类
+template <class IndexType, std::size_t N>
+struct mdspan_dynamic_values {
+  std::array<IndexType, N> values{};
+
+  constexpr IndexType operator[](std::size_t i) const noexcept { return values[i]; }
+  constexpr IndexType& operator[](std::size_t i) noexcept { return values[i]; }
+};
+
+template <class IndexType>
+struct mdspan_dynamic_values<IndexType, 0> {
+  constexpr IndexType operator[](std::size_t) const noexcept { return 0; }
+};
+
+template <class From, class IndexType>
+concept mdspan_index_convertible =
+    std::is_convertible_v<const From&, IndexType> && std::is_nothrow_constructible_v<IndexType, const From&>;
+
+template <class IndexType, class From>
+constexpr IndexType mdspan_index_cast(From&& i) noexcept {
+  return static_cast<IndexType>(std::forward<From>(i));
+}
+
+}  // namespace __details
+
+template <class IndexType, std::size_t... Extents>
+class extents {
+  static_assert(std::is_integral_v<IndexType> && !std::is_same_v<IndexType, bool>,
+                "extents index type must be an integral type");
+
+public:
+  using index_type = IndexType;
+  using size_type = std::make_unsigned_t<IndexType>;
+  using rank_type = std::size_t;
+
+  static constexpr rank_type rank() noexcept { return sizeof...(Extents); }
+  static constexpr rank_type rank_dynamic() noexcept { return ((Extents == dynamic_extent) + ... + 0); }
+  static constexpr std::size_t static_extent(rank_type r) noexcept { return static_extents_[r]; }
+
+  constexpr index_type extent(rank_type r) const noexcept {
+    if (static_extents_[r] != dynamic_extent) {
+      return static_cast<index_type>(static_extents_[r]);
+    }
+    return dynamic_[dynamic_index_[r]];
+  }
+
+  // 构造函数
+  constexpr extents() noexcept = default;
+
+  // 只给出动态维度，或者给出全部维度（静态维度必须与模板实参一致）
+  template <class... OtherIndexTypes>
+    requires((__details::mdspan_index_convertible<OtherIndexTypes, index_type> && ...) &&
+             (sizeof...(OtherIndexTypes) == rank_dynamic() || sizeof...(OtherIndexTypes) == rank()) &&
+             (sizeof...(OtherIndexTypes) > 0))
+  constexpr explicit extents(OtherIndexTypes... exts) noexcept {
+    const std::array<index_type, sizeof...(OtherIndexTypes)> values{
+        __details::mdspan_index_cast<index_type>(exts)...};
+    init_from(values);
+  }
+
+  template <class OtherIndexType, std::size_t N>
+    requires(__details::mdspan_index_convertible<OtherIndexType, index_type> && (N == rank_dynamic() || N == rank()))
+  constexpr explicit(N != rank_dynamic()) extents(const std::array<OtherIndexType, N>& exts) noexcept {
+    std::array<index_type, N> values{};
+    for (std::size_t i = 0; i < N; ++i) {
+      values[i] = __details::mdspan_index_cast<index_type>(exts[i]);
+    }
+    init_from(values);
+  }
+
+  template <class OtherIndexType, std::size_t N>
+    requires(__details::mdspan_index_convertible<OtherIndexType, index_type> && (N == rank_dynamic() || N == rank()))
+  constexpr explicit(N != rank_dynamic()) extents(std::span<OtherIndexType, N> exts) noexcept {
+    std::array<index_type, N> values{};
+    for (std::size_t i = 0; i < N; ++i) {
+      values[i] = __details::mdspan_index_cast<index_type>(exts[i]);
+    }
+    init_from(values);
+  }
+
+  // 由其他 extents 转换（维度数相同，静态维度兼容）
+  template <class OtherIndexType, std::size_t... OtherExtents>
+    requires(sizeof...(OtherExtents) == sizeof...(Extents) &&
+             ((OtherExtents == dynamic_extent || Extents == dynamic_extent || OtherExtents == Extents) && ...))
+  constexpr explicit(((Extents != dynamic_extent && OtherExtents == dynamic_extent) || ...) ||
+                     (std::numeric_limits<index_type>::max() < std::numeric_limits<OtherIndexType>::max()))
+      extents(const extents<OtherIndexType, OtherExtents...>& other) noexcept {
+    for (rank_type r = 0; r < rank(); ++r) {
+      if (static_extents_[r] == dynamic_extent) {
+        dynamic_[dynamic_index_[r]] = static_cast<index_type>(other.extent(r));
+      } else {
+        MYSTL_ASSERT(static_cast<std::size_t>(other.extent(r)) == static_extents_[r]);
+      }
+    }
+  }
+
+  template <class OtherIndexType, std::size_t... OtherExtents>
+  friend constexpr bool operator==(const extents& a, const extents<OtherIndexType, OtherExtents...>& b) noexcept {
+    if constexpr (sizeof...(OtherExtents) != rank()) {
+      return false;
+    } else {
+      for (rank_type r = 0; r < rank(); ++r) {
+        if (static_cast<std::size_t>(a.extent(r)) != static_cast<std::size_t>(b.extent(r))) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+private:
+  static constexpr std::array<std::size_t, sizeof...(Extents)> static_extents_{Extents...};
+
+  // 第 r 维在动态维度数组中的下标
+  static constexpr std::array<std::size_t, sizeof...(Extents)> dynamic_index_ = [] {
+    std::array<std::size_t, sizeof...(Extents)> result{};
+    std::size_t count = 0;
+    for (std::size_t r = 0; r < sizeof...(Extents); ++r) {
+      result[r] = count;
+      if (static_extents_[r] == dynamic_extent) {
+        ++count;
+      }
+    }
+    return result;
+  }();
+
+  template <std::size_t N>
+  constexpr void init_from(const std::array<index_type, N>& values) noexcept {
+    if constexpr (N == rank_dynamic()) {
+      for (std::size_t i = 0; i < N; ++i) {
+        dynamic_[i] = values[i];
+      }
+    } else {
+      for (rank_type r = 0; r < rank(); ++r) {
+        if (static_extents_[r] == dynamic_extent) {
+          dynamic_[dynamic_index_[r]] = values[r];
+        } else {
+          MYSTL_ASSERT(static_cast<std::size_t>(values[r]) == static_extents_[r]);
+        }
+      }
+    }
+  }
+
+  [[no_unique_address]] __details::mdspan_dynamic_values<index_type, rank_dynamic()> dynamic_{};
+};
+
+namespace __details {
+
+template <class IndexType, class Seq>
+struct make_dextents;
+
+template <class IndexType, std::size_t... Is>
+struct make_dextents<IndexType, std::index_sequence<Is...>> {
+  using type = extents<IndexType, ((void)Is, dynamic_extent)...>;
+};
+
+template <class T>
+struct is_extents : std::false_type {};
+
+template <class IndexType, std::size_t... Es>
+struct is_extents<extents<IndexType, Es...>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_extents_v = is_extents<T>::value;
+
+// 维度 [First, Last) 的乘积，按编译期下标展开
+template <std::size_t First, std::size_t Last, class Extents>
+constexpr typename Extents::index_type extents_product(const Extents& exts) noexcept {
+  if constexpr (First >= Last) {
+    return 1;
+  } else {
+    return exts.extent(First) * extents_product<First + 1, Last>(exts);
+  }
+}
+
+template <class Extents>
+constexpr typename Extents::index_type extents_size(const Extents& exts) noexcept {
+  return extents_product<0, Extents::rank()>(exts);
+}
+
+}  // namespace __details
+
+template <class IndexType, std::size_t Rank>
+using dextents = typename __details::make_dextents<IndexType, std::make_index_sequence<Rank>>::type;
+
+template <class... Integrals>
+  requires(std::is_convertible_v<Integrals, std::size_t> && ...)
+explicit extents(Integrals...) -> extents<std::size_t, ((void)sizeof(Integrals), dynamic_extent)...>;
+
+// 行优先：最后一维步长为 1
+struct layout_right {
+  template <class Extents>
+  class mapping;
+};
+
+// 列优先：第一维步长为 1
+struct layout_left {
+  template <class Extents>
+  class mapping;
+};
+
+// 任意步长
+struct layout_stride {
+  template <class Extents>
+  class mapping;
+};
+
+// 分块（tile-major）：仅用于二维。TileRows x TileCols 的块按行优先排列，块内同样行优先，
+// 每个块在内存中连续；转置、卷积等按块遍历时两个方向都有良好的局部性
+template <std::size_t TileRows, std::size_t TileCols>
+struct layout_blocked {
+  static_assert(TileRows > 0 && TileCols > 0, "layout_blocked tile size must be positive");
+
+  static constexpr std::size_t tile_rows = TileRows;
+  static constexpr std::size_t tile_cols = TileCols;
+
+  template <class Extents>
+  class mapping;
+};
+
+template <class Extents>
+class layout_right::mapping {
+  static_assert(__details::is_extents_v<Extents>, "layout_right::mapping requires an extents type");
+
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_right;
+
+  constexpr mapping() noexcept = default;
+  constexpr mapping(const extents_type& exts) noexcept : extents_(exts) {}
+
+  template <class OtherExtents>
+    requires std::is_constructible_v<extents_type, OtherExtents>
+  constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>)
+      mapping(const layout_right::mapping<OtherExtents>& other) noexcept
+      : extents_(other.extents()) {}
+
+  constexpr const extents_type& extents() const noexcept { return extents_; }
+
+  constexpr index_type required_span_size() const noexcept { return __details::extents_size(extents_); }
+
+  template <class... Indices>
+    requires(sizeof...(Indices) == extents_type::rank() &&
+             (__details::mdspan_index_convertible<Indices, index_type> && ...))
+  constexpr index_type operator()(Indices... indices) const noexcept {
+    return offset(std::make_index_sequence<sizeof...(Indices)>{}, __details::mdspan_index_cast<index_type>(indices)...);
+  }
+
+  static constexpr bool is_always_unique() noexcept { return true; }
+  static constexpr bool is_always_exhaustive() noexcept { return true; }
+  static constexpr bool is_always_strided() noexcept { return true; }
+  static constexpr bool is_unique() noexcept { return true; }
+  static constexpr bool is_exhaustive() noexcept { return true; }
+  static constexpr bool is_strided() noexcept { return true; }
+
+  constexpr index_type stride(rank_type r) const noexcept {
+    index_type s = 1;
+    for (rank_type i = r + 1; i < extents_type::rank(); ++i) {
+      s *= extents_.extent(i);
+    }
+    return s;
+  }
+
+  template <class OtherExtents>
+  friend constexpr bool operator==(const mapping& a, const layout_right::mapping<OtherExtents>& b) noexcept {
+    return a.extents() == b.extents();
+  }
+
+private:
+  // Horner 展开：((i0 * e1 + i1) * e2 + i2) ...
+  template <std::size_t... Rs, class... Idx>
+  constexpr index_type offset(std::index_sequence<Rs...>, Idx... indices) const noexcept {
+    index_type result = 0;
+    ((result = result * extents_.extent(Rs) + indices), ...);
+    return result;
+  }
+
+  [[no_unique_address]] extents_type extents_{};
+};
+
+template <class Extents>
+class layout_left::mapping {
+  static_assert(__details::is_extents_v<Extents>, "layout_left::mapping requires an extents type");
+
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_left;
+
+  constexpr mapping() noexcept = default;
+  constexpr mapping(const extents_type& exts) noexcept : extents_(exts) {}
+
+  template <class OtherExtents>
+    requires std::is_constructible_v<extents_type, OtherExtents>
+  constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>)
+      mapping(const layout_left::mapping<OtherExtents>& other) noexcept
+      : extents_(other.extents()) {}
+
+  constexpr const extents_type& extents() const noexcept { return extents_; }
+
+  constexpr index_type required_span_size() const noexcept { return __details::extents_size(extents_); }
+
+  template <class... Indices>
+    requires(sizeof...(Indices) == extents_type::rank() &&
+             (__details::mdspan_index_convertible<Indices, index_type> && ...))
+  constexpr index_type operator()(Indices... indices) const noexcept {
+    const std::array<index_type, sizeof...(Indices)> idx{__details::mdspan_index_cast<index_type>(indices)...};
+    return offset(std::make_index_sequence<sizeof...(Indices)>{}, idx);
+  }
+
+  static constexpr bool is_always_unique() noexcept { return true; }
+  static constexpr bool is_always_exhaustive() noexcept { return true; }
+  static constexpr bool is_always_strided() noexcept { return true; }
+  static constexpr bool is_unique() noexcept { return true; }
+  static constexpr bool is_exhaustive() noexcept { return true; }
+  static constexpr bool is_strided() noexcept { return true; }
+
+  constexpr index_type stride(rank_type r) const noexcept {
+    index_type s = 1;
+    for (rank_type i = 0; i < r; ++i) {
+      s *= extents_.extent(i);
+    }
+    return s;
+  }
+
+  template <class OtherExtents>
+  friend constexpr bool operator==(const mapping& a, const layout_left::mapping<OtherExtents>& b) noexcept {
+    return a.extents() == b.extents();
+  }
+
+private:
+  // Horner 展开（从最后一维开始）：((i2 * e1 + i1) * e0 + i0)
+  template <std::size_t... Rs>
+  constexpr index_type offset(std::index_sequence<Rs...>,
+                              const std::array<index_type, sizeof...(Rs)>& idx) const noexcept {
+    constexpr std::size_t last = sizeof...(Rs) - 1;
+    index_type result = 0;
+    ((result = result * extents_.extent(last - Rs) + idx[last - Rs]), ...);
+    return result;
+  }
+
+  [[no_unique_address]] extents_type extents_{};
+};
+
+template <class Extents>
+class layout_stride::mapping {
+  static_assert(__details::is_extents_v<Extents>, "layout_stride::mapping requires an extents type");
+
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_stride;
+
+  // 默认：与 layout_right 相同的步长
+  constexpr mapping() noexcept {
+    const layout_right::mapping<extents_type> right(extents_);
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      strides_[r] = right.stride(r);
+    }
+  }
+
+  template <class OtherIndexType>
+    requires __details::mdspan_index_convertible<OtherIndexType, index_type>
+  constexpr mapping(const extents_type& exts, const std::array<OtherIndexType, extents_type::rank()>& strides) noexcept
+      : extents_(exts) {
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      strides_[r] = __details::mdspan_index_cast<index_type>(strides[r]);
+    }
+  }
+
+  // 由任意 strided 映射（layout_left/right/stride 等）转换
+  template <class StridedMapping>
+    requires(!std::is_same_v<StridedMapping, mapping> &&
+             std::is_constructible_v<extents_type, typename StridedMapping::extents_type> &&
+             StridedMapping::is_always_unique() && StridedMapping::is_always_strided())
+  constexpr explicit(!std::is_convertible_v<typename StridedMapping::extents_type, extents_type>)
+      mapping(const StridedMapping& other) noexcept
+      : extents_(other.extents()) {
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      strides_[r] = static_cast<index_type>(other.stride(r));
+    }
+  }
+
+  constexpr const extents_type& extents() const noexcept { return extents_; }
+  constexpr std::array<index_type, extents_type::rank()> strides() const noexcept { return strides_; }
+
+  constexpr index_type required_span_size() const noexcept {
+    index_type result = 1;
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      if (extents_.extent(r) == 0) {
+        return 0;
+      }
+      result += (extents_.extent(r) - 1) * strides_[r];
+    }
+    return result;
+  }
+
+  template <class... Indices>
+    requires(sizeof...(Indices) == extents_type::rank() &&
+             (__details::mdspan_index_convertible<Indices, index_type> && ...))
+  constexpr index_type operator()(Indices... indices) const noexcept {
+    return offset(std::make_index_sequence<sizeof...(Indices)>{}, __details::mdspan_index_cast<index_type>(indices)...);
+  }
+
+  static constexpr bool is_always_unique() noexcept { return true; }
+  static constexpr bool is_always_exhaustive() noexcept { return false; }
+  static constexpr bool is_always_strided() noexcept { return true; }
+  static constexpr bool is_unique() noexcept { return true; }
+  static constexpr bool is_strided() noexcept { return true; }
+
+  // 步长恰好覆盖 [0, size) 时为 exhaustive
+  constexpr bool is_exhaustive() const noexcept {
+    return required_span_size() == __details::extents_size(extents_) || __details::extents_size(extents_) == 0
+               ? is_dense()
+               : false;
+  }
+
+  constexpr index_type stride(rank_type r) const noexcept { return strides_[r]; }
+
+  template <class OtherMapping>
+    requires(OtherMapping::extents_type::rank() == extents_type::rank() && OtherMapping::is_always_strided())
+  friend constexpr bool operator==(const mapping& a, const OtherMapping& b) noexcept {
+    if (!(a.extents() == b.extents())) {
+      return false;
+    }
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      if (a.stride(r) != static_cast<index_type>(b.stride(r))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  template <std::size_t... Rs, class... Idx>
+  constexpr index_type offset(std::index_sequence<Rs...>, Idx... indices) const noexcept {
+    return ((indices * strides_[Rs]) + ... + index_type(0));
+  }
+
+  // 稠密性检查：按步长从小到大排列后，每一维步长等于前面各维大小之积
+  constexpr bool is_dense() const noexcept {
+    std::array<rank_type, extents_type::rank()> order{};
+    for (rank_type r = 0; r < extents_type::rank(); ++r) {
+      order[r] = r;
+    }
+    for (rank_type i = 1; i < extents_type::rank(); ++i) {
+      for (rank_type j = i; j > 0 && strides_[order[j]] < strides_[order[j - 1]]; --j) {
+        std::swap(order[j], order[j - 1]);
+      }
+    }
+    index_type expected = 1;
+    for (rank_type i = 0; i < extents_type::rank(); ++i) {
+      if (strides_[order[i]] != expected) {
+        return false;
+      }
+      expected *= extents_.extent(order[i]);
+    }
+    return true;
+  }
+
+  [[no_unique_address]] extents_type extents_{};
+  std::array<index_type, extents_type::rank()> strides_{};
+};
+
+template <std::size_t TileRows, std::size_t TileCols>
+template <class Extents>
+class layout_blocked<TileRows, TileCols>::mapping {
+  static_assert(__details::is_extents_v<Extents>, "layout_blocked::mapping requires an extents type");
+  static_assert(Extents::rank() == 2, "layout_blocked only supports rank-2 extents");
+
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_blocked;
+
+  constexpr mapping() noexcept = default;
+  constexpr mapping(const extents_type& exts) noexcept : extents_(exts) {}
+
+  template <class OtherExtents>
+    requires std::is_constructible_v<extents_type, OtherExtents>
+  constexpr explicit(!std::is_convertible_v<OtherExtents, extents_type>)
+      mapping(const typename layout_blocked::template mapping<OtherExtents>& other) noexcept
+      : extents_(other.extents()) {}
+
+  constexpr const extents_type& extents() const noexcept { return extents_; }
+
+  // 每一维向上补齐到块大小，末尾不完整的块也占满整块存储
+  constexpr index_type tiles_in_row() const noexcept { return ceil_div(extents_.extent(0), tile_r); }
+  constexpr index_type tiles_in_col() const noexcept { return ceil_div(extents_.extent(1), tile_c); }
+
+  constexpr index_type required_span_size() const noexcept {
+    return tiles_in_row() * tiles_in_col() * tile_r * tile_c;
+  }
+
+  // 块大小为 2 的幂时除法与取模编译为移位和掩码
+  template <class I0, class I1>
+    requires(__details::mdspan_index_convertible<I0, index_type> && __details::mdspan_index_convertible<I1, index_type>)
+  constexpr index_type operator()(I0 i0, I1 i1) const noexcept {
+    const auto i = __details::mdspan_index_cast<index_type>(i0);
+    const auto j = __details::mdspan_index_cast<index_type>(i1);
+    const index_type tile = (i / tile_r) * tiles_in_col() + j / tile_c;
+    return tile * (tile_r * tile_c) + (i % tile_r) * tile_c + j % tile_c;
+  }
+
+  static constexpr bool is_always_unique() noexcept { return true; }
+  static constexpr bool is_always_exhaustive() noexcept { return false; }
+  static constexpr bool is_always_strided() noexcept { return false; }
+  static constexpr bool is_unique() noexcept { return true; }
+  constexpr bool is_exhaustive() const noexcept {
+    return extents_.extent(0) % tile_r == 0 && extents_.extent(1) % tile_c == 0;
+  }
+  static constexpr bool is_strided() noexcept { return false; }
+
+  template <class OtherExtents>
+  friend constexpr bool operator==(const mapping& a,
+                                   const typename layout_blocked::template mapping<OtherExtents>& b) noexcept {
+    return a.extents() == b.extents();
+  }
+
+private:
+  static constexpr index_type tile_r = static_cast<index_type>(TileRows);
+  static constexpr index_type tile_c = static_cast<index_type>(TileCols);
+
+  static constexpr index_type ceil_div(index_type n, index_type d) noexcept { return (n + d - 1) / d; }
+
+  [[no_unique_address]] extents_type extents_{};
+};
+
+/**
+ * @brief 按块遍历二维区域
+ *
+ * 以 TileRows x TileCols 为单位，按块的行优先顺序调用 f(row_begin, row_end, col_begin, col_end)，
+ * 边缘的块会被裁剪到 extents 范围内。对 layout_blocked 而言，该顺序正是内存顺序。
+ */
+template <std::size_t TileRows, std::size_t TileCols, class Extents, class F>
+  requires(__details::is_extents_v<Extents> && Extents::rank() == 2)
+constexpr void for_each_tile(const Extents& exts, F&& f) {
+  using index_type = typename Extents::index_type;
+  const index_type rows = exts.extent(0);
+  const index_type cols = exts.extent(1);
+  constexpr auto tr = static_cast<index_type>(TileRows);
+  constexpr auto tc = static_cast<index_type>(TileCols);
+  for (index_type r0 = 0; r0 < rows; r0 += tr) {
+    const index_type r1 = rows - r0 < tr ? rows : r0 + tr;
+    for (index_type c0 = 0; c0 < cols; c0 += tc) {
+      const index_type c1 = cols - c0 < tc ? cols : c0 + tc;
+      f(r0, r1, c0, c1);
+    }
+  }
+}
+
+template <class ElementType>
+struct default_accessor {
+  using offset_policy = default_accessor;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  constexpr default_accessor() noexcept = default;
+
+  template <class OtherElementType>
+    requires std::is_convertible_v<OtherElementType (*)[], element_type (*)[]>
+  constexpr default_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  constexpr reference access(data_handle_type p, std::size_t i) const noexcept { return p[i]; }
+  constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+};
+
+template <std::size_t ByteAlignment, class ElementType>
+bool is_sufficiently_aligned(ElementType* p) noexcept {
+  return reinterpret_cast<std::uintptr_t>(p) % ByteAlignment == 0;
+}
+
+// 数据句柄按 ByteAlignment 对齐；offset 之后不再保证对齐，因此 offset_policy 退化为 default_accessor
+template <class ElementType, std::size_t ByteAlignment>
+struct aligned_accessor {
+  static_assert(std::has_single_bit(ByteAlignment), "aligned_accessor alignment must be a power of two");
+  static_assert(ByteAlignment >= alignof(ElementType), "aligned_accessor alignment must not be weaker than the type's");
+
+  using offset_policy = default_accessor<ElementType>;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  static constexpr std::size_t byte_alignment = ByteAlignment;
+
+  constexpr aligned_accessor() noexcept = default;
+
+  template <class OtherElementType, std::size_t OtherByteAlignment>
+    requires(std::is_convertible_v<OtherElementType (*)[], element_type (*)[]> && OtherByteAlignment >= ByteAlignment)
+  constexpr aligned_accessor(aligned_accessor<OtherElementType, OtherByteAlignment>) noexcept {}
+
+  // 对齐是调用方的承诺，必须显式转换
+  template <class OtherElementType>
+    requires std::is_convertible_v<OtherElementType (*)[], element_type (*)[]>
+  constexpr explicit aligned_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  template <class OtherElementType>
+    requires std::is_convertible_v<element_type (*)[], OtherElementType (*)[]>
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  constexpr reference access(data_handle_type p, std::size_t i) const noexcept {
+    if !consteval {
+      MYSTL_ASSERT(is_sufficiently_aligned<ByteAlignment>(p));
+    }
+    return std::assume_aligned<ByteAlignment>(p)[i];
+  }
+
+  constexpr typename offset_policy::data_handle_type offset(data_handle_type p, std::size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+// 数据句柄带 restrict 限定：调用方保证通过该视图访问的元素不会经由其他指针读写
+template <class ElementType>
+struct restrict_accessor {
+  using offset_policy = restrict_accessor;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType* MYSTL_RESTRICT;
+
+  constexpr restrict_accessor() noexcept = default;
+
+  template <class OtherElementType>
+    requires std::is_convertible_v<OtherElementType (*)[], element_type (*)[]>
+  constexpr restrict_accessor(restrict_accessor<OtherElementType>) noexcept {}
+
+  // 无别名是调用方的承诺，必须显式转换
+  template <class OtherElementType>
+    requires std::is_convertible_v<OtherElementType (*)[], element_type (*)[]>
+  constexpr explicit restrict_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  template <class OtherElementType>
+    requires std::is_convertible_v<element_type (*)[], OtherElementType (*)[]>
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  constexpr reference access(data_handle_type p, std::size_t i) const noexcept { return p[i]; }
+  // 按值返回时顶层 restrict 限定无意义，返回普通指针，赋给 data_handle_type 时重新带上
+  constexpr element_type* offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+};
+
+namespace __details {
+
+// 4/8 字节的标量在 x86 上走 MOVNTI，其余情况退化为普通存储
+template <class T>
+inline void stream_store(T* p, const T& value) noexcept {
+#if MYSTL_HAS_SSE2
+  if constexpr (sizeof(T) == 4 && alignof(T) >= 4) {
+    _mm_stream_si32(reinterpret_cast<int*>(p), std::bit_cast<int>(value));
+    return;
+  }
+#if MYSTL_ARCH_X86_64
+  if constexpr (sizeof(T) == 8 && alignof(T) >= 8) {
+    _mm_stream_si64(reinterpret_cast<long long*>(p), std::bit_cast<long long>(value));
+    return;
+  }
+#endif
+#elif MYSTL_COMPILER_CLANG
+  if constexpr (std::is_arithmetic_v<T>) {
+    __builtin_nontemporal_store(value, p);
+    return;
+  }
+#endif
+  *p = value;
+}
+
+// 只写引用：不提供读取，避免把刚绕过缓存的数据又读回来
+template <class T>
+class streaming_reference {
+public:
+  explicit streaming_reference(T* p) noexcept : ptr_(p) {}
+
+  const streaming_reference& operator=(const T& value) const noexcept {
+    stream_store(ptr_, value);
+    return *this;
+  }
+
+private:
+  T* ptr_;
+};
+
+}  // namespace __details
+
+/**
+ * @brief 非临时存储访问器，用于一次性写出、短期内不会再读的大块输出
+ *
+ * 非临时存储是弱序的：写完后必须调用 streaming_fence()，其他线程（或后续读取）才能保证看到结果。
+ */
+template <class ElementType>
+struct streaming_accessor {
+  static_assert(std::is_trivially_copyable_v<ElementType> && !std::is_const_v<ElementType>,
+                "streaming_accessor requires a writable trivially copyable element type");
+
+  using offset_policy = streaming_accessor;
+  using element_type = ElementType;
+  using reference = __details::streaming_reference<ElementType>;
+  using data_handle_type = ElementType*;
+
+  constexpr streaming_accessor() noexcept = default;
+
+  template <class OtherElementType>
+    requires std::is_convertible_v<OtherElementType (*)[], element_type (*)[]>
+  constexpr explicit streaming_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  reference access(data_handle_type p, std::size_t i) const noexcept { return reference(p + i); }
+  constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+};
+
+// 使之前的非临时存储对后续访存可见
+inline void streaming_fence() noexcept {
+#if MYSTL_HAS_SSE2
+  _mm_sfence();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
 
 template <class ElementType, class Extents, class LayoutPolicy = layout_right,
-          class AccessorPolicy = void>
-class mdspan;  // to be implemented
+          class AccessorPolicy = default_accessor<ElementType>>
+class mdspan {
+  static_assert(__details::is_extents_v<Extents>, "mdspan requires an extents type");
+
+public:
+  using extents_type = Extents;
+  using layout_type = LayoutPolicy;
+  using accessor_type = AccessorPolicy;
+  using mapping_type = typename layout_type::template mapping<extents_type>;
+  using element_type = ElementType;
+  using value_type = std::remove_cv_t<element_type>;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using data_handle_type = typename accessor_type::data_handle_type;
+  using reference = typename accessor_type::reference;
+
+  static constexpr rank_type rank() noexcept { return extents_type::rank(); }
+  static constexpr rank_type rank_dynamic() noexcept { return extents_type::rank_dynamic(); }
+  static constexpr std::size_t static_extent(rank_type r) noexcept { return extents_type::static_extent(r); }
+  constexpr index_type extent(rank_type r) const noexcept { return extents().extent(r); }
+
+  // 构造函数
+  constexpr mdspan()
+    requires(rank_dynamic() > 0 && std::is_default_constructible_v<data_handle_type> &&
+             std::is_default_constructible_v<mapping_type> && std::is_default_constructible_v<accessor_type>)
+  = default;
+
+  template <class... OtherIndexTypes>
+    requires((__details::mdspan_index_convertible<OtherIndexTypes, index_type> && ...) &&
+             (sizeof...(OtherIndexTypes) == rank() || sizeof...(OtherIndexTypes) == rank_dynamic()) &&
+             std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>)
+  constexpr explicit mdspan(data_handle_type p, OtherIndexTypes... exts)
+      : ptr_(std::move(p)), map_(extents_type(__details::mdspan_index_cast<index_type>(exts)...)) {}
+
+  template <class OtherIndexType, std::size_t N>
+    requires(__details::mdspan_index_convertible<OtherIndexType, index_type> && (N == rank() || N == rank_dynamic()) &&
+             std::is_constructible_v<mapping_type, extents_type> && std::is_default_constructible_v<accessor_type>)
+  constexpr explicit(N != rank_dynamic()) mdspan(data_handle_type p, const std::array<OtherIndexType, N>& exts)
+      : ptr_(std::move(p)), map_(extents_type(exts)) {}
+
+  constexpr mdspan(data_handle_type p, const extents_type& exts)
+    requires(std::is_constructible_v<mapping_type, const extents_type&> &&
+             std::is_default_constructible_v<accessor_type>)
+      : ptr_(std::move(p)), map_(exts) {}
+
+  constexpr mdspan(data_handle_type p, const mapping_type& m)
+    requires std::is_default_constructible_v<accessor_type>
+      : ptr_(std::move(p)), map_(m) {}
+
+  constexpr mdspan(data_handle_type p, const mapping_type& m, const accessor_type& a)
+      : ptr_(std::move(p)), map_(m), acc_(a) {}
+
+  template <class OtherElementType, class OtherExtents, class OtherLayoutPolicy, class OtherAccessor>
+    requires(std::is_constructible_v<mapping_type,
+                                     const typename OtherLayoutPolicy::template mapping<OtherExtents>&> &&
+             std::is_constructible_v<accessor_type, const OtherAccessor&> &&
+             std::is_constructible_v<data_handle_type, const typename OtherAccessor::data_handle_type&>)
+  constexpr explicit(
+      !std::is_convertible_v<const typename OtherLayoutPolicy::template mapping<OtherExtents>&, mapping_type> ||
+      !std::is_convertible_v<const OtherAccessor&, accessor_type>)
+      mdspan(const mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>& other)
+      : ptr_(other.data_handle()), map_(other.mapping()), acc_(other.accessor()) {}
+
+  constexpr mdspan(const mdspan&) = default;
+  constexpr mdspan(mdspan&&) = default;
+  constexpr mdspan& operator=(const mdspan&) = default;
+  constexpr mdspan& operator=(mdspan&&) = default;
+
+  // 元素访问（C++23 多维下标）
+  template <class... OtherIndexTypes>
+    requires(sizeof...(OtherIndexTypes) == rank() &&
+             (__details::mdspan_index_convertible<OtherIndexTypes, index_type> && ...))
+  constexpr reference operator[](OtherIndexTypes... indices) const {
+    const auto i = static_cast<std::size_t>(map_(__details::mdspan_index_cast<index_type>(indices)...));
+    MYSTL_ASSERT(in_bounds(__details::mdspan_index_cast<index_type>(indices)...));
+    return acc_.access(ptr_, i);
+  }
+
+  template <class OtherIndexType>
+    requires __details::mdspan_index_convertible<OtherIndexType, index_type>
+  constexpr reference operator[](const std::array<OtherIndexType, rank()>& indices) const {
+    return index_with(indices, std::make_index_sequence<rank()>{});
+  }
+
+  template <class OtherIndexType>
+    requires __details::mdspan_index_convertible<OtherIndexType, index_type>
+  constexpr reference operator[](std::span<OtherIndexType, rank()> indices) const {
+    return index_with(indices, std::make_index_sequence<rank()>{});
+  }
+
+  constexpr size_type size() const noexcept { return static_cast<size_type>(__details::extents_size(extents())); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+  friend constexpr void swap(mdspan& a, mdspan& b) noexcept {
+    using std::swap;
+    swap(a.ptr_, b.ptr_);
+    swap(a.map_, b.map_);
+    swap(a.acc_, b.acc_);
+  }
+
+  constexpr const extents_type& extents() const noexcept { return map_.extents(); }
+  constexpr const data_handle_type& data_handle() const noexcept { return ptr_; }
+  constexpr const mapping_type& mapping() const noexcept { return map_; }
+  constexpr const accessor_type& accessor() const noexcept { return acc_; }
+
+  static constexpr bool is_always_unique() { return mapping_type::is_always_unique(); }
+  static constexpr bool is_always_exhaustive() { return mapping_type::is_always_exhaustive(); }
+  static constexpr bool is_always_strided() { return mapping_type::is_always_strided(); }
+  constexpr bool is_unique() const { return map_.is_unique(); }
+  constexpr bool is_exhaustive() const { return map_.is_exhaustive(); }
+  constexpr bool is_strided() const { return map_.is_strided(); }
+  constexpr index_type stride(rank_type r) const { return map_.stride(r); }
+
+private:
+  template <class Indices, std::size_t... Rs>
+  constexpr reference index_with(const Indices& indices, std::index_sequence<Rs...>) const {
+    return (*this)[__details::mdspan_index_cast<index_type>(indices[Rs])...];
+  }
+
+  template <class... Idx>
+  constexpr bool in_bounds(Idx... indices) const noexcept {
+    rank_type r = 0;
+    return ((indices >= 0 && indices < extent(r++)) && ...);
+  }
+
+  data_handle_type ptr_{};
+  [[no_unique_address]] mapping_type map_{};
+  [[no_unique_address]] accessor_type acc_{};
+};
+
+// 推导指引
+template <class ElementType, class... Integrals>
+  requires((std::is_convertible_v<Integrals, std::size_t> && ...) && sizeof...(Integrals) > 0)
+explicit mdspan(ElementType*, Integrals...) -> mdspan<ElementType, dextents<std::size_t, sizeof...(Integrals)>>;
+
+template <class ElementType, class OtherIndexType, std::size_t N>
+mdspan(ElementType*, const std::array<OtherIndexType, N>&) -> mdspan<ElementType, dextents<std::size_t, N>>;
+
+template <class ElementType, class IndexType, std::size_t... Extents>
+mdspan(ElementType*, const extents<IndexType, Extents...>&) -> mdspan<ElementType, extents<IndexType, Extents...>>;
+
+template <class ElementType, class MappingType>
+mdspan(ElementType*, const MappingType&)
+    -> mdspan<ElementType, typename MappingType::extents_type, typename MappingType::layout_type>;
+
+template <class MappingType, class AccessorType>
+mdspan(const typename AccessorType::data_handle_type&, const MappingType&, const AccessorType&)
+    -> mdspan<typename AccessorType::element_type, typename MappingType::extents_type,
+              typename MappingType::layout_type, AccessorType>;
+
+// 以 mdspan 自身的块大小遍历 layout_blocked 视图
+template <class ElementType, class Extents, std::size_t TileRows, std::size_t TileCols, class AccessorPolicy, class F>
+constexpr void for_each_tile(const mdspan<ElementType, Extents, layout_blocked<TileRows, TileCols>, AccessorPolicy>& m,
+                             F&& f) {
+  for_each_tile<TileRows, TileCols>(m.extents(), std::forward<F>(f));
+}
 
-// Helper to create mdspan
-template <class ElementType, class Extents, class LayoutPolicy = layout_right>
-mdspan<ElementType, Extents, LayoutPolicy> make_mdspan(ElementType* data, const Extents& extents);  // to be implemented
+// 便捷构造
+template <class LayoutPolicy = layout_right, class ElementType, class Extents>
+constexpr mdspan<ElementType, Extents, LayoutPolicy> make_mdspan(ElementType* data, const Extents& exts) {
+  return mdspan<ElementType, Extents, LayoutPolicy>(data, typename LayoutPolicy::template mapping<Extents>(exts));
+}
 
 }  // namespace mystl
 
@@ -0,0 +1,569 @@
+#ifndef MYSTL_CONTAINERS_ROPE_HPP
+#define MYSTL_CONTAINERS_ROPE_HPP
+
+/**
+ * @file containers/rope.hpp
+ * @brief 分块字符串 (rope)，面向大文本的随机插入、删除与截取
+ *
+ * ## 设计
+ * - 文本切成若干块，每块是一个 mystl::string，按中序串联成完整文本
+ * - 块组织为隐式 treap（按位置而非键排序的随机平衡树），每个节点保存子树总长度，
+ *   按位置 split / merge 的期望复杂度为 O(log n)
+ * - 节点带引用计数，rope 拷贝只共享根节点；修改时沿路径写时复制（copy-on-write），
+ *   因此 substr 也是 O(log n)：拷贝后切两刀，只复制路径上的节点与两端的块
+ * - 小段插入与落在单块内的删除直接改块（块不超过 max_chunk 字节），不产生新节点；
+ *   其余情况先在端点处 split，再 merge
+ * - 按块遍历：for_each_chunk 为中序递归；chunks() 返回以 string_view 为元素的前向范围
+ *
+ * ## 复杂度（n 为块数，期望）
+ * - insert / erase / substr / operator[]：O(log n) + O(max_chunk)
+ * - 拷贝 O(1)，遍历全部块 O(n)（chunks() 迭代器每步 O(log n)）
+ *
+ * ## 线程安全
+ * - 引用计数为原子操作：不同线程可以分别修改共享节点的不同 rope 拷贝
+ * - 同一个 rope 对象的并发修改需要外部同步
+ *
+ * ## 异常安全
+ * - 越界位置抛出 std::out_of_range
+ * - 分配失败时抛出 std::bad_alloc，此时 rope 处于有效但未指定的状态（基本保证）：
+ *   原地修改失败时内容不变；split / merge 途中失败时 rope 被清空，已拆出的各段全部释放，
+ *   与之共享节点的其他拷贝不受影响
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#include "mystl/containers/string.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/core/assert.hpp"
+#include "mystl/memory/allocator.hpp"
+
+namespace mystl {
+
+class rope {
+  struct node;
+
+public:
+  // 类型定义
+  using value_type = char;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // 新建块的目标大小与原地插入允许增长到的上限
+  static constexpr size_type chunk_size = 1024;
+  static constexpr size_type max_chunk = 2 * chunk_size;
+
+  // 按块前向遍历，元素为 string_view；修改 rope 后迭代器失效
+  class chunk_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const string_view*;
+    using reference = const string_view&;
+
+    chunk_iterator() noexcept = default;
+
+    reference operator*() const noexcept { return chunk_; }
+    pointer operator->() const noexcept { return &chunk_; }
+
+    chunk_iterator& operator++() noexcept {
+      offset_ += chunk_.size();
+      chunk_ = rope::chunk_containing(root_, offset_);
+      return *this;
+    }
+
+    chunk_iterator operator++(int) noexcept {
+      chunk_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const chunk_iterator& a, const chunk_iterator& b) noexcept {
+      return a.offset_ == b.offset_;
+    }
+
+  private:
+    friend class rope;
+
+    chunk_iterator(const node* root, size_type offset) noexcept
+        : root_(root), offset_(offset), chunk_(rope::chunk_containing(root, offset)) {}
+
+    const node* root_ = nullptr;
+    size_type offset_ = 0;
+    string_view chunk_;
+  };
+
+  struct chunk_range {
+    chunk_iterator first;
+    chunk_iterator last;
+    chunk_iterator begin() const noexcept { return first; }
+    chunk_iterator end() const noexcept { return last; }
+  };
+
+  // 构造与析构
+  rope() noexcept = default;
+  explicit rope(string_view s) { root_ = build(s); }
+  explicit rope(const char* s) : rope(string_view(s)) {}
+
+  rope(const rope& other) noexcept : root_(retain(other.root_)), seed_(other.seed_) {}
+  rope(rope&& other) noexcept : root_(std::exchange(other.root_, nullptr)), seed_(other.seed_) {}
+
+  rope& operator=(const rope& other) noexcept {
+    rope(other).swap(*this);
+    return *this;
+  }
+
+  rope& operator=(rope&& other) noexcept {
+    rope(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~rope() { release(root_); }
+
+  void swap(rope& other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(seed_, other.seed_);
+  }
+
+  friend void swap(rope& a, rope& b) noexcept { a.swap(b); }
+
+  // 容量
+  size_type size() const noexcept { return total(root_); }
+  size_type length() const noexcept { return size(); }
+  [[nodiscard]] bool empty() const noexcept { return root_ == nullptr; }
+
+  // 块数（主要用于观察碎片化程度）
+  size_type chunk_count() const noexcept { return count_nodes(root_); }
+
+  // 元素访问，O(log n)
+  char operator[](size_type pos) const noexcept {
+    MYSTL_ASSERT(pos < size());
+    const node* t = root_;
+    for (;;) {
+      const size_type lsize = total(t->left);
+      if (pos < lsize) {
+        t = t->left;
+      } else if (pos - lsize < t->text.size()) {
+        return t->text[pos - lsize];
+      } else {
+        pos -= lsize + t->text.size();
+        t = t->right;
+      }
+    }
+  }
+
+  char at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("mystl::rope::at: position out of range");
+    }
+    return (*this)[pos];
+  }
+
+  // 修改
+  rope& insert(size_type pos, string_view s) {
+    check_pos(pos);
+    if (s.empty()) {
+      return *this;
+    }
+    if (s.size() <= max_chunk && root_ != nullptr) {
+      root_ = unshare(root_);
+      if (insert_in_place(root_, pos, s)) {
+        return *this;
+      }
+    }
+    // 先建好新段再拆树：拆开之后 root_ 不再持有引用，中途失败时 rope 为空
+    node_guard middle{build(s)};
+    auto [left, right] = split(std::exchange(root_, nullptr), pos);
+    node_guard tail{right};
+    node* head = merge(left, middle.dismiss());
+    root_ = merge(head, tail.dismiss());
+    return *this;
+  }
+
+  rope& insert(size_type pos, const rope& r) {
+    check_pos(pos);
+    if (r.empty()) {
+      return *this;
+    }
+    node_guard middle{retain(r.root_)};
+    auto [left, right] = split(std::exchange(root_, nullptr), pos);
+    node_guard tail{right};
+    node* head = merge(left, middle.dismiss());
+    root_ = merge(head, tail.dismiss());
+    return *this;
+  }
+
+  rope& append(string_view s) { return insert(size(), s); }
+  rope& append(const rope& r) { return insert(size(), r); }
+  rope& operator+=(string_view s) { return append(s); }
+  rope& operator+=(const rope& r) { return append(r); }
+
+  rope& erase(size_type pos = 0, size_type count = npos) {
+    check_pos(pos);
+    count = clamp_count(pos, count);
+    if (count == 0) {
+      return *this;
+    }
+    root_ = unshare(root_);
+    if (erase_in_place(root_, pos, count)) {
+      return *this;
+    }
+    auto [left, rest] = split(std::exchange(root_, nullptr), pos);
+    node_guard head{left};
+    auto [middle, right] = split(rest, count);
+    release(middle);
+    root_ = merge(head.dismiss(), right);
+    return *this;
+  }
+
+  rope& replace(size_type pos, size_type count, string_view s) {
+    erase(pos, count);
+    return insert(pos, s);
+  }
+
+  void clear() noexcept {
+    release(root_);
+    root_ = nullptr;
+  }
+
+  // 截取：与原 rope 共享中间部分的节点
+  rope substr(size_type pos = 0, size_type count = npos) const {
+    check_pos(pos);
+    count = clamp_count(pos, count);
+    rope result(*this);
+    auto [left, rest] = result.split(std::exchange(result.root_, nullptr), pos);
+    node_guard head{left};
+    auto [middle, right] = result.split(rest, count);
+    release(right);
+    result.root_ = middle;
+    return result;
+  }
+
+  // 按块遍历
+  template <class F>
+  void for_each_chunk(F&& f) const {
+    visit(root_, f);
+  }
+
+  chunk_range chunks() const noexcept { return {chunk_iterator(root_, 0), chunk_iterator(root_, size())}; }
+
+  // 拼接为连续字符串
+  string to_string() const {
+    string out;
+    out.resize_and_overwrite(size(), [this](char* p, size_type n) {
+      for_each_chunk([&p](string_view chunk) {
+        std::memcpy(p, chunk.data(), chunk.size());
+        p += chunk.size();
+      });
+      return n;
+    });
+    return out;
+  }
+
+  // 比较
+  friend bool operator==(const rope& a, string_view b) noexcept {
+    if (a.size() != b.size()) {
+      return false;
+    }
+    size_type offset = 0;
+    bool equal = true;
+    a.for_each_chunk([&](string_view chunk) {
+      equal = equal && chunk == b.substr(offset, chunk.size());
+      offset += chunk.size();
+    });
+    return equal;
+  }
+
+  friend bool operator==(const rope& a, const rope& b) noexcept {
+    if (a.root_ == b.root_) {
+      return true;
+    }
+    if (a.size() != b.size()) {
+      return false;
+    }
+    // 两侧分块边界不同，按最短公共段逐段比较
+    auto ia = a.chunks().begin();
+    auto ib = b.chunks().begin();
+    size_type oa = 0;
+    size_type ob = 0;
+    for (size_type done = 0; done < a.size();) {
+      const size_type n = std::min(ia->size() - oa, ib->size() - ob);
+      if (ia->substr(oa, n) != ib->substr(ob, n)) {
+        return false;
+      }
+      done += n;
+      oa += n;
+      ob += n;
+      if (oa == ia->size()) {
+        ++ia;
+        oa = 0;
+      }
+      if (ob == ib->size()) {
+        ++ib;
+        ob = 0;
+      }
+    }
+    return true;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const rope& r) {
+    r.for_each_chunk([&os](string_view chunk) { os << chunk; });
+    return os;
+  }
+
+private:
+  struct node {
+    std::atomic<std::size_t> refs{1};
+    std::uint32_t priority;
+    size_type total;  // 子树内字符总数
+    node* left = nullptr;
+    node* right = nullptr;
+    string text;
+  };
+
+  using node_allocator = allocator<node>;
+
+  static size_type total(const node* t) noexcept { return t ? t->total : 0; }
+
+  static void update(node* t) noexcept { t->total = total(t->left) + t->text.size() + total(t->right); }
+
+  static size_type count_nodes(const node* t) noexcept {
+    return t ? 1 + count_nodes(t->left) + count_nodes(t->right) : 0;
+  }
+
+  static node* retain(node* t) noexcept {
+    if (t) {
+      t->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return t;
+  }
+
+  static void release(node* t) noexcept {
+    while (t && t->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      release(t->left);
+      node* next = t->right;
+      t->~node();
+      node_allocator().deallocate(t, 1);
+      t = next;  // 右子树尾递归改为循环
+    }
+  }
+
+  // 持有一个节点引用，离开作用域时释放；用于在异常路径上归还已拆出的子树
+  struct node_guard {
+    node* t;
+
+    explicit node_guard(node* p) noexcept : t(p) {}
+    node_guard(const node_guard&) = delete;
+    node_guard& operator=(const node_guard&) = delete;
+    ~node_guard() { release(t); }
+
+    node* dismiss() noexcept { return std::exchange(t, nullptr); }
+  };
+
+  // xorshift32，仅用于 treap 优先级
+  std::uint32_t next_priority() noexcept {
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 17;
+    seed_ ^= seed_ << 5;
+    return seed_;
+  }
+
+  node* make_node(string_view s) {
+    node* t = node_allocator().allocate(1);
+    try {
+      ::new (static_cast<void*>(t)) node{{1}, next_priority(), s.size(), nullptr, nullptr, string(s)};
+    } catch (...) {
+      node_allocator().deallocate(t, 1);
+      throw;
+    }
+    return t;
+  }
+
+  // 取得独占的节点：被共享时复制一份（子节点增加引用），并释放对原节点的引用
+  static node* unshare(node* t) {
+    if (t == nullptr || t->refs.load(std::memory_order_acquire) == 1) {
+      return t;
+    }
+    node* copy = node_allocator().allocate(1);
+    try {
+      ::new (static_cast<void*>(copy)) node{{1}, t->priority, t->total, retain(t->left), retain(t->right), t->text};
+    } catch (...) {
+      release(t->left);
+      release(t->right);
+      node_allocator().deallocate(copy, 1);
+      throw;
+    }
+    release(t);
+    return copy;
+  }
+
+  // 把文本切成 chunk_size 的块依次并入
+  node* build(string_view s) {
+    node_guard t{nullptr};
+    for (size_type pos = 0; pos < s.size(); pos += chunk_size) {
+      node* chunk = make_node(s.substr(pos, chunk_size));
+      t.t = merge(t.dismiss(), chunk);
+    }
+    return t.dismiss();
+  }
+
+  // 按位置拆成 [0, pos) 与 [pos, size)，消耗 t 的引用（抛出异常时同样释放）
+  std::pair<node*, node*> split(node* t, size_type pos) {
+    if (t == nullptr) {
+      return {nullptr, nullptr};
+    }
+    node_guard guard{t};
+    t = guard.t = unshare(t);
+    const size_type lsize = total(t->left);
+    const size_type len = t->text.size();
+    if (pos <= lsize) {
+      auto [a, b] = split(std::exchange(t->left, nullptr), pos);
+      t->left = b;
+      update(t);
+      return {a, guard.dismiss()};
+    }
+    if (pos >= lsize + len) {
+      auto [a, b] = split(std::exchange(t->right, nullptr), pos - lsize - len);
+      t->right = a;
+      update(t);
+      return {guard.dismiss(), b};
+    }
+    // 切点落在本块内部：块尾独立成新节点，与右子树合并
+    const size_type cut = pos - lsize;
+    node* tail = make_node(string_view(t->text).substr(cut));
+    t->text.resize(cut);
+    node* right = std::exchange(t->right, nullptr);
+    update(t);
+    node* rest = merge(tail, right);
+    return {guard.dismiss(), rest};
+  }
+
+  // 按顺序拼接，消耗 a、b 的引用（抛出异常时同样释放）
+  static node* merge(node* a, node* b) {
+    if (a == nullptr) {
+      return b;
+    }
+    if (b == nullptr) {
+      return a;
+    }
+    node_guard ga{a};
+    node_guard gb{b};
+    if (a->priority > b->priority) {
+      a = ga.t = unshare(a);
+      a->right = merge(std::exchange(a->right, nullptr), gb.dismiss());
+      update(a);
+      return ga.dismiss();
+    }
+    b = gb.t = unshare(b);
+    b->left = merge(ga.dismiss(), std::exchange(b->left, nullptr));
+    update(b);
+    return gb.dismiss();
+  }
+
+  // 插入点所在块放得下时直接改块；t 已独占（或为空）
+  static bool insert_in_place(node* t, size_type pos, string_view s) {
+    if (t == nullptr) {
+      return false;
+    }
+    const size_type lsize = total(t->left);
+    const size_type len = t->text.size();
+    if (pos < lsize) {
+      t->left = unshare(t->left);
+      if (!insert_in_place(t->left, pos, s)) {
+        return false;
+      }
+    } else if (pos <= lsize + len) {
+      if (len + s.size() > max_chunk) {
+        return false;
+      }
+      t->text.insert(pos - lsize, s);
+    } else {
+      t->right = unshare(t->right);
+      if (!insert_in_place(t->right, pos - lsize - len, s)) {
+        return false;
+      }
+    }
+    t->total += s.size();
+    return true;
+  }
+
+  // 删除范围落在单块内且不会删空该块时直接改块；t 已独占（或为空）
+  static bool erase_in_place(node* t, size_type pos, size_type count) {
+    if (t == nullptr) {
+      return false;
+    }
+    const size_type lsize = total(t->left);
+    const size_type len = t->text.size();
+    if (pos + count <= lsize) {
+      t->left = unshare(t->left);
+      if (!erase_in_place(t->left, pos, count)) {
+        return false;
+      }
+    } else if (pos >= lsize && pos + count <= lsize + len) {
+      if (count == len) {
+        return false;
+      }
+      t->text.erase(pos - lsize, count);
+    } else if (pos >= lsize + len) {
+      t->right = unshare(t->right);
+      if (!erase_in_place(t->right, pos - lsize - len, count)) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+    t->total -= count;
+    return true;
+  }
+
+  // 返回从 pos 开始、到所在块末尾为止的视图；pos 为总长时返回空视图
+  static string_view chunk_containing(const node* t, size_type pos) noexcept {
+    while (t) {
+      const size_type lsize = total(t->left);
+      if (pos < lsize) {
+        t = t->left;
+      } else if (pos - lsize < t->text.size()) {
+        return string_view(t->text).substr(pos - lsize);
+      } else {
+        pos -= lsize + t->text.size();
+        t = t->right;
+      }
+    }
+    return {};
+  }
+
+  template <class F>
+  static void visit(const node* t, F& f) {
+    while (t) {
+      visit(t->left, f);
+      f(string_view(t->text));
+      t = t->right;
+    }
+  }
+
+  void check_pos(size_type pos) const {
+    if (pos > size()) {
+      throw std::out_of_range("mystl::rope: position out of range");
+    }
+  }
+
+  size_type clamp_count(size_type pos, size_type count) const noexcept { return std::min(count, size() - pos); }
+
+  node* root_ = nullptr;
+  std::uint32_t seed_ = 0x9E3779B9u;
+};
+
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS_ROPE_HPP
@@ -0,0 +1,181 @@
+#ifndef MYSTL_CONTAINERS_SHARED_STRING_HPP
+#define MYSTL_CONTAINERS_SHARED_STRING_HPP
+
+/**
+ * @file containers/shared_string.hpp
+ * @brief 引用计数的不可变字符串 (shared_string)，适合在多个容器间共享的键
+ *
+ * ## 设计
+ * - 对象本身只有一个指针；引用计数、长度、缓存的哈希值与字符数据放在同一次分配中：
+ *   [refs | size | hash | chars... | '\0']
+ * - 拷贝只是原子地递增引用计数，不复制字节；最后一个持有者析构时释放
+ * - 哈希在构造时计算一次并缓存，cached_hash() 与 string_hash 对同内容的 string_view 结果一致，
+ *   因此可以配合 string_hash / string_equal 在无序容器中直接用 string_view 查找
+ * - 空字符串不分配，内部指针为空
+ *
+ * ## 线程安全
+ * - 引用计数为原子操作，不同线程可以同时拷贝、析构指向同一数据的 shared_string
+ * - 内容不可变，因此并发读取无需同步
+ *
+ * ## 异常安全
+ * - 只有从内容构造时可能分配失败并抛出 std::bad_alloc，拷贝与移动不抛异常
+ */
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+#include "mystl/config/config.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/core/assert.hpp"
+#include "mystl/memory/allocator.hpp"
+
+namespace mystl {
+
+class shared_string {
+public:
+  // 类型定义
+  using value_type = char;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = const char&;
+  using const_pointer = const char*;
+  using const_iterator = const char*;
+  using iterator = const_iterator;
+
+  static constexpr size_type npos = string_view::npos;
+
+  // 构造函数
+  shared_string() noexcept = default;
+
+  explicit shared_string(string_view v) : rep_(v.empty() ? nullptr : make_rep(v)) {}
+  shared_string(const char* s) : shared_string(string_view(s)) {}
+  shared_string(const char* s, size_type n) : shared_string(string_view(s, n)) {}
+  shared_string(std::nullptr_t) = delete;
+
+  shared_string(const shared_string& other) noexcept : rep_(other.rep_) { retain(); }
+  shared_string(shared_string&& other) noexcept : rep_(std::exchange(other.rep_, nullptr)) {}
+
+  ~shared_string() { release(); }
+
+  shared_string& operator=(const shared_string& other) noexcept {
+    shared_string(other).swap(*this);
+    return *this;
+  }
+
+  shared_string& operator=(shared_string&& other) noexcept {
+    shared_string(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  void swap(shared_string& other) noexcept { std::swap(rep_, other.rep_); }
+  friend void swap(shared_string& a, shared_string& b) noexcept { a.swap(b); }
+
+  // 元素访问
+  const char* data() const noexcept { return rep_ ? rep_->chars() : ""; }
+  const char* c_str() const noexcept { return data(); }
+  size_type size() const noexcept { return rep_ ? rep_->size : 0; }
+  size_type length() const noexcept { return size(); }
+  [[nodiscard]] bool empty() const noexcept { return rep_ == nullptr; }
+
+  const_reference operator[](size_type pos) const noexcept {
+    MYSTL_ASSERT(pos <= size());
+    return data()[pos];
+  }
+
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + size(); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  operator string_view() const noexcept { return string_view(data(), size()); }
+  string_view view() const noexcept { return *this; }
+
+  // 构造时计算的哈希，与 string_hash{}(view()) 相同
+  size_type cached_hash() const noexcept { return rep_ ? rep_->hash : empty_hash(); }
+
+  // 共享同一数据的 shared_string 个数；空字符串返回 0
+  long use_count() const noexcept {
+    return rep_ ? static_cast<long>(rep_->refs.load(std::memory_order_relaxed)) : 0;
+  }
+
+  // 比较：指向同一数据时直接判等
+  friend bool operator==(const shared_string& a, const shared_string& b) noexcept {
+    return a.rep_ == b.rep_ || (a.cached_hash() == b.cached_hash() && a.view() == b.view());
+  }
+  friend bool operator==(const shared_string& a, string_view b) noexcept { return a.view() == b; }
+  friend bool operator==(const shared_string& a, const char* b) noexcept { return a.view() == string_view(b); }
+  friend std::strong_ordering operator<=>(const shared_string& a, const shared_string& b) noexcept {
+    return a.view() <=> b.view();
+  }
+  friend std::strong_ordering operator<=>(const shared_string& a, string_view b) noexcept {
+    return a.view() <=> b;
+  }
+  friend std::strong_ordering operator<=>(const shared_string& a, const char* b) noexcept {
+    return a.view() <=> string_view(b);
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const shared_string& s) { return os << s.view(); }
+
+private:
+  // 分配块的头部，字符数据紧跟其后
+  struct rep {
+    std::atomic<std::size_t> refs;
+    std::size_t size;
+    std::size_t hash;
+
+    char* chars() noexcept { return reinterpret_cast<char*>(this + 1); }
+  };
+
+  using rep_allocator = allocator<rep>;
+
+  // 以 rep 为单位分配，容纳头部、字符与结尾的 '\0'
+  static size_type blocks_for(size_type n) noexcept { return 1 + (n + 1 + sizeof(rep) - 1) / sizeof(rep); }
+
+  static size_type empty_hash() noexcept {
+    static const size_type h = string_hash{}(string_view());
+    return h;
+  }
+
+  static rep* make_rep(string_view v) {
+    rep* r = rep_allocator().allocate(blocks_for(v.size()));
+    ::new (static_cast<void*>(r)) rep{{1}, v.size(), string_hash{}(v)};
+    std::memcpy(r->chars(), v.data(), v.size());
+    r->chars()[v.size()] = '\0';
+    return r;
+  }
+
+  void retain() const noexcept {
+    if (rep_) {
+      rep_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void release() noexcept {
+    if (rep_ && rep_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      const size_type blocks = blocks_for(rep_->size);
+      rep_->~rep();
+      rep_allocator().deallocate(rep_, blocks);
+    }
+  }
+
+  rep* rep_ = nullptr;
+};
+
+// 直接返回缓存的哈希
+template <>
+struct hash<shared_string> : string_hash {};
+
+}  // namespace mystl
+
+template <>
+struct std::hash<mystl::shared_string> {
+  std::size_t operator()(const mystl::shared_string& s) const noexcept { return s.cached_hash(); }
+};
+
+#endif  // MYSTL_CONTAINERS_SHARED_STRING_HPP
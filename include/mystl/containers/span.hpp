@@ -1,12 +1,248 @@
 #ifndef MYSTL_CONTAINERS_SPAN_HPP
 #define MYSTL_CONTAINERS_SPAN_HPP
 
-// placeholder for mystl::span (C++20)
-// Non-owning view over contiguous memory
+/**
+ * @file containers/span.hpp
+ * @brief 连续内存的非拥有视图 (span, C++20)
+ *
+ * ## 设计
+ * - span<T, N>（静态长度）只保存数据指针；span<T>（dynamic_extent）保存指针与长度
+ * - 可从指针 + 长度、迭代器区间、内建数组、std::array 以及任意连续且有大小的范围构造
+ * - 迭代器直接使用 T*，与标准库算法和 SIMD 内核零成本衔接
+ * - first / last / subspan 在参数为模板实参时返回静态长度的 span
+ *
+ * ## 前置条件
+ * - 越界访问、静态长度与实参长度不一致属于前置条件违例，仅在调试构建中断言
+ */
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+#include "mystl/config/config.hpp"
+#include "mystl/core/assert.hpp"
 
 namespace mystl {
-template <class T, long long Extent = -1>
-class span;  // to be implemented
+
+inline constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+template <class T, std::size_t Extent = dynamic_extent>
+class span;
+
+namespace __details {
+
+template <class T>
+inline constexpr bool is_span_v = false;
+template <class T, std::size_t E>
+inline constexpr bool is_span_v<span<T, E>> = true;
+
+template <class T>
+inline constexpr bool is_std_array_v = false;
+template <class T, std::size_t N>
+inline constexpr bool is_std_array_v<std::array<T, N>> = true;
+
+// 元素类型只允许增加 const（限定转换），不允许派生类到基类的指针转换
+template <class From, class To>
+concept span_convertible = std::is_convertible_v<From (*)[], To (*)[]>;
+
+// 静态长度部分为空类，动态长度时保存 size
+template <std::size_t Extent>
+struct span_extent {
+  constexpr span_extent() noexcept = default;
+  constexpr explicit span_extent(std::size_t n) noexcept { MYSTL_ASSERT(n == Extent); }
+  static constexpr std::size_t size() noexcept { return Extent; }
+};
+
+template <>
+struct span_extent<dynamic_extent> {
+  constexpr span_extent() noexcept = default;
+  constexpr explicit span_extent(std::size_t n) noexcept : size_(n) {}
+  constexpr std::size_t size() const noexcept { return size_; }
+
+  std::size_t size_ = 0;
+};
+
+}  // namespace __details
+
+template <class T, std::size_t Extent>
+class span {
+public:
+  // 类型定义
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  static constexpr size_type extent = Extent;
+
+  // 构造函数
+  constexpr span() noexcept
+    requires(Extent == 0 || Extent == dynamic_extent)
+  = default;
+
+  template <std::contiguous_iterator It>
+    requires __details::span_convertible<std::remove_reference_t<std::iter_reference_t<It>>, T>
+  constexpr explicit(Extent != dynamic_extent) span(It first, size_type count) noexcept
+      : data_(std::to_address(first)), size_(count) {}
+
+  template <std::contiguous_iterator It, std::sized_sentinel_for<It> End>
+    requires(__details::span_convertible<std::remove_reference_t<std::iter_reference_t<It>>, T> &&
+             !std::is_convertible_v<End, size_type>)
+  constexpr explicit(Extent != dynamic_extent) span(It first, End last) noexcept
+      : data_(std::to_address(first)), size_(static_cast<size_type>(last - first)) {}
+
+  template <std::size_t N>
+    requires((Extent == dynamic_extent || Extent == N) && __details::span_convertible<std::type_identity_t<T>, T>)
+  constexpr span(std::type_identity_t<T> (&arr)[N]) noexcept : data_(arr), size_(N) {}
+
+  template <class U, std::size_t N>
+    requires((Extent == dynamic_extent || Extent == N) && __details::span_convertible<U, T>)
+  constexpr span(std::array<U, N>& arr) noexcept : data_(arr.data()), size_(N) {}
+
+  template <class U, std::size_t N>
+    requires((Extent == dynamic_extent || Extent == N) && __details::span_convertible<const U, T>)
+  constexpr span(const std::array<U, N>& arr) noexcept : data_(arr.data()), size_(N) {}
+
+  template <class R>
+    requires(std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+             (std::ranges::borrowed_range<R> || std::is_const_v<T>) &&
+             !__details::is_span_v<std::remove_cvref_t<R>> &&
+             !__details::is_std_array_v<std::remove_cvref_t<R>> && !std::is_array_v<std::remove_cvref_t<R>> &&
+             __details::span_convertible<std::remove_reference_t<std::ranges::range_reference_t<R>>, T>)
+  constexpr explicit(Extent != dynamic_extent) span(R&& r) noexcept
+      : data_(std::ranges::data(r)), size_(static_cast<size_type>(std::ranges::size(r))) {}
+
+  template <class U, std::size_t N>
+    requires((Extent == dynamic_extent || N == dynamic_extent || Extent == N) && __details::span_convertible<U, T>)
+  constexpr explicit(Extent != dynamic_extent && N == dynamic_extent) span(const span<U, N>& s) noexcept
+      : data_(s.data()), size_(s.size()) {}
+
+  constexpr span(const span&) noexcept = default;
+  constexpr span& operator=(const span&) noexcept = default;
+
+  // 子视图
+  template <std::size_t Count>
+  constexpr span<T, Count> first() const noexcept {
+    static_assert(Extent == dynamic_extent || Count <= Extent);
+    MYSTL_ASSERT(Count <= size());
+    return span<T, Count>(data(), Count);
+  }
+
+  template <std::size_t Count>
+  constexpr span<T, Count> last() const noexcept {
+    static_assert(Extent == dynamic_extent || Count <= Extent);
+    MYSTL_ASSERT(Count <= size());
+    return span<T, Count>(data() + (size() - Count), Count);
+  }
+
+  template <std::size_t Offset, std::size_t Count = dynamic_extent>
+  constexpr auto subspan() const noexcept {
+    static_assert(Extent == dynamic_extent || Offset <= Extent);
+    static_assert(Count == dynamic_extent || Extent == dynamic_extent || Count <= Extent - Offset);
+    constexpr std::size_t E =
+        Count != dynamic_extent ? Count : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+    MYSTL_ASSERT(Offset <= size());
+    MYSTL_ASSERT(Count == dynamic_extent || Count <= size() - Offset);
+    return span<T, E>(data() + Offset, Count != dynamic_extent ? Count : size() - Offset);
+  }
+
+  constexpr span<T> first(size_type count) const noexcept {
+    MYSTL_ASSERT(count <= size());
+    return {data(), count};
+  }
+
+  constexpr span<T> last(size_type count) const noexcept {
+    MYSTL_ASSERT(count <= size());
+    return {data() + (size() - count), count};
+  }
+
+  constexpr span<T> subspan(size_type offset, size_type count = dynamic_extent) const noexcept {
+    MYSTL_ASSERT(offset <= size());
+    MYSTL_ASSERT(count == dynamic_extent || count <= size() - offset);
+    return {data() + offset, count == dynamic_extent ? size() - offset : count};
+  }
+
+  // 容量
+  constexpr size_type size() const noexcept { return size_.size(); }
+  constexpr size_type size_bytes() const noexcept { return size() * sizeof(T); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+  // 元素访问
+  constexpr reference operator[](size_type i) const noexcept {
+    MYSTL_ASSERT(i < size());
+    return data_[i];
+  }
+
+  constexpr reference front() const noexcept {
+    MYSTL_ASSERT(!empty());
+    return data_[0];
+  }
+
+  constexpr reference back() const noexcept {
+    MYSTL_ASSERT(!empty());
+    return data_[size() - 1];
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  // 迭代器
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size(); }
+  constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  constexpr reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+private:
+  pointer data_ = nullptr;
+  [[no_unique_address]] __details::span_extent<Extent> size_;
+};
+
+// 推导指引
+template <std::contiguous_iterator It, class EndOrSize>
+span(It, EndOrSize) -> span<std::remove_reference_t<std::iter_reference_t<It>>>;
+
+template <class T, std::size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template <class T, std::size_t N>
+span(std::array<T, N>&) -> span<T, N>;
+
+template <class T, std::size_t N>
+span(const std::array<T, N>&) -> span<const T, N>;
+
+template <std::ranges::contiguous_range R>
+span(R&&) -> span<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+// 字节视图
+template <class T, std::size_t N>
+auto as_bytes(span<T, N> s) noexcept {
+  constexpr std::size_t E = N == dynamic_extent ? dynamic_extent : N * sizeof(T);
+  return span<const std::byte, E>(reinterpret_cast<const std::byte*>(s.data()), s.size_bytes());
 }
 
+template <class T, std::size_t N>
+  requires(!std::is_const_v<T>)
+auto as_writable_bytes(span<T, N> s) noexcept {
+  constexpr std::size_t E = N == dynamic_extent ? dynamic_extent : N * sizeof(T);
+  return span<std::byte, E>(reinterpret_cast<std::byte*>(s.data()), s.size_bytes());
+}
+
+}  // namespace mystl
+
+template <class T, std::size_t E>
+inline constexpr bool std::ranges::enable_borrowed_range<mystl::span<T, E>> = true;
+
+template <class T, std::size_t E>
+inline constexpr bool std::ranges::enable_view<mystl::span<T, E>> = E == 0 || E == mystl::dynamic_extent;
+
 #endif  // MYSTL_CONTAINERS_SPAN_HPP
@@ -1,10 +1,797 @@
 #ifndef MYSTL_CONTAINERS_STRING_HPP
 #define MYSTL_CONTAINERS_STRING_HPP
 
-// placeholder for mystl::string (SBO planned) reusing vector facilities
+/**
+ * @file containers/string.hpp
+ * @brief 字节字符串 (string)，24 字节对象内联存放最多 23 个字符
+ *
+ * ## 设计
+ * - 对象大小为 3 个指针（64 位平台 24 字节），分为短模式与长模式：
+ *   - 短模式：前 23 字节存字符，最后一个字节存 23 - size。长度恰为 23 时该字节为 0，
+ *     同时充当结尾的 '\0'，因此 23 个字符都能内联存放
+ *   - 长模式：{data, size, capacity}，capacity 字的最后一个字节最高位为 1 作为长模式标记
+ *     （小端平台即 capacity 的最高位；大端平台 capacity 左移 8 位后在低字节写入标记）
+ * - 短模式下最后一个字节不超过 23，最高位恒为 0，因此模式判断只需读一个字节
+ * - 堆分配走 allocator<char>::allocate_at_least，分配器多给的尾部字节直接计入 capacity
+ * - 增长至少按 2 倍进行，摊还 O(1) 追加
+ * - resize_and_overwrite 直接把未初始化的缓冲区交给调用方填充，避免先清零再覆盖
+ * - 查找与比较委托给 string_view（向量化内核）
+ * - append_number 用 mystl::to_chars 把数值直接写进尾部空闲容量，不经过 iostream
+ *
+ * ## 异常安全
+ * - 需要重新分配的操作提供强异常安全保证：分配失败时原字符串保持不变
+ * - 越界位置抛出 std::out_of_range，超过 max_size() 抛出 std::length_error
+ *
+ * ## 约束
+ * - 依赖对象表示（按字节读取模式标记），因此不是 constexpr 的
+ */
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "mystl/config/config.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/core/assert.hpp"
+#include "mystl/core/charconv.hpp"
+#include "mystl/memory/allocator.hpp"
 
 namespace mystl {
-class string;  // to be implemented
+
+class string {
+public:
+  // 类型定义
+  using value_type = char;
+  using allocator_type = allocator<char>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = char&;
+  using const_reference = const char&;
+  using pointer = char*;
+  using const_pointer = const char*;
+  using iterator = char*;
+  using const_iterator = const char*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // 短模式可内联的最大字符数
+  static constexpr size_type sso_capacity = 3 * sizeof(void*) - 1;
+
+  // 构造函数
+  string() noexcept { init_short(); }
+
+  string(const char* s) { init(s, std::strlen(s)); }
+  string(const char* s, size_type n) { init(s, n); }
+  string(std::nullptr_t) = delete;
+
+  string(size_type n, char c) {
+    char* p = init_uninitialized(n);
+    std::memset(p, static_cast<unsigned char>(c), n);
+  }
+
+  template <class InputIt>
+    requires std::is_base_of_v<std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>
+  string(InputIt first, InputIt last) {
+    init_short();
+    append(first, last);
+  }
+
+  string(std::initializer_list<char> ilist) { init(ilist.begin(), ilist.size()); }
+
+  explicit string(string_view sv) { init(sv.data(), sv.size()); }
+
+  string(const string& other, size_type pos, size_type count = npos) {
+    other.check_pos(pos);
+    init(other.data() + pos, std::min(count, other.size() - pos));
+  }
+
+  // 短字符串直接复制 24 字节
+  string(const string& other) {
+    if (!other.is_long()) {
+      std::memcpy(static_cast<void*>(this), static_cast<const void*>(&other), sizeof(string));
+    } else {
+      init(other.l_.data, other.l_.size);
+    }
+  }
+
+  string(string&& other) noexcept {
+    std::memcpy(static_cast<void*>(this), static_cast<const void*>(&other), sizeof(string));
+    other.init_short();
+  }
+
+  ~string() {
+    if (is_long()) {
+      deallocate(l_.data, long_capacity());
+    }
+  }
+
+  string& operator=(const string& other) {
+    if (this != &other) {
+      assign(other.data(), other.size());
+    }
+    return *this;
+  }
+
+  string& operator=(string&& other) noexcept {
+    if (this != &other) {
+      if (is_long()) {
+        deallocate(l_.data, long_capacity());
+      }
+      std::memcpy(static_cast<void*>(this), static_cast<const void*>(&other), sizeof(string));
+      other.init_short();
+    }
+    return *this;
+  }
+
+  string& operator=(const char* s) { return assign(s, std::strlen(s)); }
+  string& operator=(char c) { return assign(&c, 1); }
+  string& operator=(std::initializer_list<char> ilist) { return assign(ilist.begin(), ilist.size()); }
+  string& operator=(std::nullptr_t) = delete;
+
+  string& assign(const char* s, size_type n) {
+    if (n <= capacity()) {
+      char* p = data();
+      std::memmove(p, s, n);
+      set_size_and_terminate(n);
+      return *this;
+    }
+    string tmp(s, n);
+    swap(tmp);
+    return *this;
+  }
+
+  string& assign(const char* s) { return assign(s, std::strlen(s)); }
+  string& assign(string_view sv) { return assign(sv.data(), sv.size()); }
+  string& assign(const string& str) { return *this = str; }
+  string& assign(string&& str) noexcept { return *this = std::move(str); }
+
+  string& assign(size_type n, char c) {
+    clear();
+    return append(n, c);
+  }
+
+  template <class InputIt>
+    requires std::is_base_of_v<std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>
+  string& assign(InputIt first, InputIt last) {
+    string tmp(first, last);
+    swap(tmp);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return {}; }
+
+  // 元素访问
+  reference operator[](size_type pos) noexcept {
+    MYSTL_ASSERT(pos <= size());
+    return data()[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    MYSTL_ASSERT(pos <= size());
+    return data()[pos];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("mystl::string::at");
+    }
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("mystl::string::at");
+    }
+    return data()[pos];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size() - 1]; }
+  const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+  char* data() noexcept { return is_long() ? l_.data : s_.data; }
+  const char* data() const noexcept { return is_long() ? l_.data : s_.data; }
+  const char* c_str() const noexcept { return data(); }
+
+  operator string_view() const noexcept { return string_view(data(), size()); }
+
+  // 迭代器
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator cbegin() const noexcept { return data(); }
+  iterator end() noexcept { return data() + size(); }
+  const_iterator end() const noexcept { return data() + size(); }
+  const_iterator cend() const noexcept { return end(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+  const_reverse_iterator crend() const noexcept { return rend(); }
+
+  // 容量
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept { return is_long() ? l_.size : sso_capacity - s_.remaining; }
+  size_type length() const noexcept { return size(); }
+  size_type capacity() const noexcept { return is_long() ? long_capacity() : sso_capacity; }
+  bool is_inline() const noexcept { return !is_long(); }
+
+  static constexpr size_type max_size() noexcept {
+    constexpr size_type by_encoding = std::endian::native == std::endian::little
+                                          ? (long_flag - 1)
+                                          : (std::numeric_limits<size_type>::max() >> 8);
+    constexpr auto by_ptrdiff = static_cast<size_type>(std::numeric_limits<difference_type>::max());
+    return std::min(by_encoding, by_ptrdiff) - 1;
+  }
+
+  void reserve(size_type new_cap) {
+    if (new_cap > capacity()) {
+      reallocate(recommend(new_cap));
+    }
+  }
+
+  // 能放回短模式时释放堆内存；否则按实际长度重新分配
+  void shrink_to_fit() {
+    if (!is_long()) {
+      return;
+    }
+    const size_type n = l_.size;
+    if (n <= sso_capacity) {
+      char* old = l_.data;
+      const size_type old_cap = long_capacity();
+      init_short();
+      std::memcpy(s_.data, old, n);
+      set_size_and_terminate(n);
+      deallocate(old, old_cap);
+    } else if (n < long_capacity()) {
+      reallocate(n);
+    }
+  }
+
+  // 修改器
+  void clear() noexcept { set_size_and_terminate(0); }
+
+  void push_back(char c) {
+    const size_type n = size();
+    if (n == capacity()) MYSTL_UNLIKELY {
+      reallocate(recommend(n + 1));
+    }
+    char* p = data();
+    p[n] = c;
+    set_size_and_terminate(n + 1);
+  }
+
+  void pop_back() noexcept {
+    MYSTL_ASSERT(!empty());
+    set_size_and_terminate(size() - 1);
+  }
+
+  string& append(const char* s, size_type n) {
+    // 快速路径按模式分开处理，每条路径只判断一次模式
+    // s 可能指向自身（例如 s.append(s.data(), k)），用 memmove
+    if (!is_long()) {
+      const size_type old = sso_capacity - s_.remaining;
+      if (n <= s_.remaining) {
+        std::memmove(s_.data + old, s, n);
+        set_short_size(old + n);
+        return *this;
+      }
+    } else if (n <= long_capacity() - l_.size) {
+      std::memmove(l_.data + l_.size, s, n);
+      l_.size += n;
+      l_.data[l_.size] = '\0';
+      return *this;
+    }
+    const size_type old = size();
+    check_length(old, n);
+    // 新缓冲区先复制旧内容与 s，最后才释放旧缓冲区，s 指向自身时依然有效
+    const size_type new_size = old + n;
+    auto [p, cap] = allocate(recommend(new_size));
+    std::memcpy(p, data(), old);
+    std::memcpy(p + old, s, n);
+    p[new_size] = '\0';
+    adopt(p, new_size, cap);
+    return *this;
+  }
+
+  string& append(const char* s) { return append(s, std::strlen(s)); }
+  string& append(const string& str) { return append(str.data(), str.size()); }
+  string& append(string_view sv) { return append(sv.data(), sv.size()); }
+
+  string& append(const string& str, size_type pos, size_type count = npos) {
+    str.check_pos(pos);
+    return append(str.data() + pos, std::min(count, str.size() - pos));
+  }
+
+  string& append(size_type n, char c) {
+    const size_type old = size();
+    if (n > capacity() - old) {
+      check_length(old, n);
+      reallocate(recommend(old + n));
+    }
+    std::memset(data() + old, static_cast<unsigned char>(c), n);
+    set_size_and_terminate(old + n);
+    return *this;
+  }
+
+  string& append(std::initializer_list<char> ilist) { return append(ilist.begin(), ilist.size()); }
+
+  // 追加数值的十进制表示（浮点为最短往返表示），空闲容量足够时直接写入尾部
+  template <class T>
+    requires(__details::charconv_integer<T> || std::is_same_v<T, double> || std::is_same_v<T, float>)
+  string& append_number(T value) {
+    constexpr size_type max_len = max_chars_length<T>;
+    const size_type old = size();
+    if (max_len > capacity() - old) {
+      // 按最坏长度扩容会让短数字也触发分配，先写到栈上再按实际长度追加
+      char buf[max_len];
+      const auto r = mystl::to_chars(buf, buf + max_len, value);
+      return append(buf, static_cast<size_type>(r.ptr - buf));
+    }
+    char* p = data() + old;
+    const auto r = mystl::to_chars(p, p + max_len, value);
+    set_size_and_terminate(old + static_cast<size_type>(r.ptr - p));
+    return *this;
+  }
+
+  template <class InputIt>
+    requires std::is_base_of_v<std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>
+  string& append(InputIt first, InputIt last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<InputIt>::iterator_category>) {
+      const auto n = static_cast<size_type>(std::distance(first, last));
+      const size_type old = size();
+      if (n > capacity() - old) {
+        check_length(old, n);
+        // 迭代器可能指向自身，先拷贝到临时对象
+        string tmp;
+        tmp.reserve(old + n);
+        tmp.append(data(), old);
+        char* p = tmp.data() + old;
+        for (; first != last; ++first, ++p) {
+          *p = static_cast<char>(*first);
+        }
+        tmp.set_size_and_terminate(old + n);
+        swap(tmp);
+      } else {
+        char* p = data() + old;
+        for (; first != last; ++first, ++p) {
+          *p = static_cast<char>(*first);
+        }
+        set_size_and_terminate(old + n);
+      }
+    } else {
+      for (; first != last; ++first) {
+        push_back(static_cast<char>(*first));
+      }
+    }
+    return *this;
+  }
+
+  string& operator+=(const string& str) { return append(str); }
+  string& operator+=(const char* s) { return append(s); }
+  string& operator+=(string_view sv) { return append(sv); }
+  string& operator+=(char c) {
+    push_back(c);
+    return *this;
+  }
+  string& operator+=(std::initializer_list<char> ilist) { return append(ilist); }
+
+  string& insert(size_type pos, const char* s, size_type n) { return replace(pos, 0, s, n); }
+  string& insert(size_type pos, const char* s) { return replace(pos, 0, s, std::strlen(s)); }
+  string& insert(size_type pos, const string& str) { return replace(pos, 0, str.data(), str.size()); }
+  string& insert(size_type pos, string_view sv) { return replace(pos, 0, sv.data(), sv.size()); }
+
+  string& insert(size_type pos, size_type n, char c) {
+    check_pos(pos);
+    const string fill(n, c);
+    return replace(pos, 0, fill.data(), n);
+  }
+
+  iterator insert(const_iterator it, char c) {
+    const auto pos = static_cast<size_type>(it - cbegin());
+    replace(pos, 0, &c, 1);
+    return begin() + pos;
+  }
+
+  string& erase(size_type pos = 0, size_type count = npos) {
+    check_pos(pos);
+    const size_type n = size();
+    count = std::min(count, n - pos);
+    char* p = data();
+    std::memmove(p + pos, p + pos + count, n - pos - count);
+    set_size_and_terminate(n - count);
+    return *this;
+  }
+
+  iterator erase(const_iterator it) noexcept {
+    const auto pos = static_cast<size_type>(it - cbegin());
+    erase(pos, 1);
+    return begin() + pos;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    const auto pos = static_cast<size_type>(first - cbegin());
+    erase(pos, static_cast<size_type>(last - first));
+    return begin() + pos;
+  }
+
+  // 把 [pos, pos + count) 替换为 [s, s + n)
+  string& replace(size_type pos, size_type count, const char* s, size_type n) {
+    check_pos(pos);
+    const size_type old = size();
+    count = std::min(count, old - pos);
+    const size_type tail = old - pos - count;
+    if (n > count && n - count > capacity() - old) {
+      check_length(old - count, n);
+      const size_type new_size = old - count + n;
+      auto [p, cap] = allocate(recommend(new_size));
+      const char* src = data();
+      std::memcpy(p, src, pos);
+      std::memcpy(p + pos, s, n);
+      std::memcpy(p + pos + n, src + pos + count, tail);
+      p[new_size] = '\0';
+      adopt(p, new_size, cap);
+      return *this;
+    }
+    char* p = data();
+    if (s >= p && s < p + old) {
+      // s 指向自身：先复制出来再原地搬移
+      const string tmp(s, n);
+      return replace(pos, count, tmp.data(), n);
+    }
+    std::memmove(p + pos + n, p + pos + count, tail);
+    std::memcpy(p + pos, s, n);
+    set_size_and_terminate(old - count + n);
+    return *this;
+  }
+
+  string& replace(size_type pos, size_type count, const char* s) { return replace(pos, count, s, std::strlen(s)); }
+  string& replace(size_type pos, size_type count, const string& str) {
+    return replace(pos, count, str.data(), str.size());
+  }
+
+  void resize(size_type n) { resize(n, '\0'); }
+
+  void resize(size_type n, char c) {
+    const size_type old = size();
+    if (n <= old) {
+      set_size_and_terminate(n);
+    } else {
+      append(n - old, c);
+    }
+  }
+
+  /**
+   * @brief 把至多 n 个字符的缓冲区交给 op 填充，不预先初始化新增部分
+   *
+   * op(char* p, size_type n) 返回实际长度 r（0 <= r <= n）；[p, p + r) 成为新内容。
+   * 旧内容 [0, min(size(), n)) 在调用 op 时保持不变。
+   */
+  template <class Operation>
+  void resize_and_overwrite(size_type n, Operation op) {
+    if (n > capacity()) {
+      check_length(0, n);
+      reallocate(recommend(n));
+    }
+    char* p = data();
+    const auto r = static_cast<size_type>(std::move(op)(p, n));
+    MYSTL_ASSERT(r <= n);
+    set_size_and_terminate(r);
+  }
+
+  void swap(string& other) noexcept {
+    alignas(string) unsigned char tmp[sizeof(string)];
+    std::memcpy(tmp, static_cast<const void*>(this), sizeof(string));
+    std::memcpy(static_cast<void*>(this), static_cast<const void*>(&other), sizeof(string));
+    std::memcpy(static_cast<void*>(&other), tmp, sizeof(string));
+  }
+
+  friend void swap(string& a, string& b) noexcept { a.swap(b); }
+
+  // 操作
+  string substr(size_type pos = 0, size_type count = npos) const& { return string(*this, pos, count); }
+
+  string substr(size_type pos = 0, size_type count = npos) && {
+    erase(0, pos);
+    if (count < size()) {
+      set_size_and_terminate(count);
+    }
+    return std::move(*this);
+  }
+
+  size_type copy(char* dest, size_type count, size_type pos = 0) const {
+    check_pos(pos);
+    count = std::min(count, size() - pos);
+    std::memcpy(dest, data() + pos, count);
+    return count;
+  }
+
+  int compare(const char* s, size_type n) const noexcept { return compare_bytes(data(), size(), s, n); }
+  int compare(const char* s) const noexcept { return compare(s, std::strlen(s)); }
+  int compare(const string& str) const noexcept { return compare(str.data(), str.size()); }
+  int compare(string_view sv) const noexcept { return compare(sv.data(), sv.size()); }
+
+  bool starts_with(const char* s, size_type n) const noexcept {
+    return size() >= n && std::memcmp(data(), s, n) == 0;
+  }
+  bool starts_with(const char* s) const noexcept { return starts_with(s, std::strlen(s)); }
+  bool starts_with(char c) const noexcept { return !empty() && front() == c; }
+  bool starts_with(string_view sv) const noexcept { return starts_with(sv.data(), sv.size()); }
+
+  bool ends_with(const char* s, size_type n) const noexcept {
+    return size() >= n && std::memcmp(data() + size() - n, s, n) == 0;
+  }
+  bool ends_with(const char* s) const noexcept { return ends_with(s, std::strlen(s)); }
+  bool ends_with(char c) const noexcept { return !empty() && back() == c; }
+  bool ends_with(string_view sv) const noexcept { return ends_with(sv.data(), sv.size()); }
+
+  bool contains(string_view sv) const noexcept { return view().contains(sv); }
+  bool contains(char c) const noexcept { return view().contains(c); }
+  bool contains(const char* s) const noexcept { return view().contains(s); }
+
+  // 查找（委托给 string_view）
+  size_type find(string_view sv, size_type pos = 0) const noexcept { return view().find(sv, pos); }
+  size_type find(char c, size_type pos = 0) const noexcept { return view().find(c, pos); }
+  size_type find(const char* s, size_type pos, size_type n) const noexcept { return view().find(s, pos, n); }
+  size_type find(const char* s, size_type pos = 0) const noexcept { return view().find(s, pos); }
+
+  size_type rfind(string_view sv, size_type pos = npos) const noexcept { return view().rfind(sv, pos); }
+  size_type rfind(char c, size_type pos = npos) const noexcept { return view().rfind(c, pos); }
+  size_type rfind(const char* s, size_type pos, size_type n) const noexcept { return view().rfind(s, pos, n); }
+  size_type rfind(const char* s, size_type pos = npos) const noexcept { return view().rfind(s, pos); }
+
+  size_type find_first_of(string_view sv, size_type pos = 0) const noexcept { return view().find_first_of(sv, pos); }
+  size_type find_first_of(char c, size_type pos = 0) const noexcept { return view().find_first_of(c, pos); }
+  size_type find_first_of(const char* s, size_type pos, size_type n) const noexcept {
+    return view().find_first_of(s, pos, n);
+  }
+  size_type find_first_of(const char* s, size_type pos = 0) const noexcept { return view().find_first_of(s, pos); }
+
+  size_type find_first_not_of(string_view sv, size_type pos = 0) const noexcept {
+    return view().find_first_not_of(sv, pos);
+  }
+  size_type find_first_not_of(char c, size_type pos = 0) const noexcept { return view().find_first_not_of(c, pos); }
+  size_type find_first_not_of(const char* s, size_type pos, size_type n) const noexcept {
+    return view().find_first_not_of(s, pos, n);
+  }
+  size_type find_first_not_of(const char* s, size_type pos = 0) const noexcept {
+    return view().find_first_not_of(s, pos);
+  }
+
+  size_type find_last_of(string_view sv, size_type pos = npos) const noexcept { return view().find_last_of(sv, pos); }
+  size_type find_last_of(char c, size_type pos = npos) const noexcept { return view().find_last_of(c, pos); }
+  size_type find_last_of(const char* s, size_type pos, size_type n) const noexcept {
+    return view().find_last_of(s, pos, n);
+  }
+  size_type find_last_of(const char* s, size_type pos = npos) const noexcept { return view().find_last_of(s, pos); }
+
+  size_type find_last_not_of(string_view sv, size_type pos = npos) const noexcept {
+    return view().find_last_not_of(sv, pos);
+  }
+  size_type find_last_not_of(char c, size_type pos = npos) const noexcept { return view().find_last_not_of(c, pos); }
+  size_type find_last_not_of(const char* s, size_type pos, size_type n) const noexcept {
+    return view().find_last_not_of(s, pos, n);
+  }
+  size_type find_last_not_of(const char* s, size_type pos = npos) const noexcept {
+    return view().find_last_not_of(s, pos);
+  }
+
+  // 比较
+  friend bool operator==(const string& a, const string& b) noexcept {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size()) == 0;
+  }
+
+  friend bool operator==(const string& a, const char* b) noexcept {
+    const size_type n = std::strlen(b);
+    return a.size() == n && std::memcmp(a.data(), b, n) == 0;
+  }
+
+  friend std::strong_ordering operator<=>(const string& a, const string& b) noexcept { return a.compare(b) <=> 0; }
+  friend std::strong_ordering operator<=>(const string& a, const char* b) noexcept { return a.compare(b) <=> 0; }
+
+  friend std::ostream& operator<<(std::ostream& os, const string& str) {
+    return os.write(str.data(), static_cast<std::streamsize>(str.size()));
+  }
+
+private:
+  string_view view() const noexcept { return string_view(data(), size()); }
+
+  struct long_rep {
+    char* data;
+    size_type size;
+    size_type cap;  // 编码后的容量，含长模式标记
+  };
+
+  struct short_rep {
+    char data[sso_capacity];
+    unsigned char remaining;  // sso_capacity - size
+  };
+
+  static constexpr size_type long_flag = std::endian::native == std::endian::little
+                                             ? size_type(1) << (sizeof(size_type) * 8 - 1)
+                                             : size_type(0x80);
+
+  static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                "mystl::string requires a little- or big-endian platform");
+
+  static constexpr size_type encode_capacity(size_type cap) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+      return cap | long_flag;
+    } else {
+      return (cap << 8) | long_flag;
+    }
+  }
+
+  static constexpr size_type decode_capacity(size_type encoded) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+      return encoded & ~long_flag;
+    } else {
+      return encoded >> 8;
+    }
+  }
+
+  // 最后一个字节：短模式为剩余容量（<= 23），长模式最高位为 1
+  bool is_long() const noexcept {
+    return (reinterpret_cast<const unsigned char*>(this)[sizeof(string) - 1] & 0x80) != 0;
+  }
+
+  size_type long_capacity() const noexcept { return decode_capacity(l_.cap); }
+
+  void init_short() noexcept {
+    s_.data[0] = '\0';
+    s_.remaining = static_cast<unsigned char>(sso_capacity);
+  }
+
+  // 按长度选择模式，返回待写入的缓冲区；已写好结尾 '\0'
+  char* init_uninitialized(size_type n) {
+    if (n <= sso_capacity) {
+      set_short_size(n);
+      return s_.data;
+    }
+    check_length(0, n);
+    auto [p, cap] = allocate(n);
+    p[n] = '\0';
+    l_.data = p;
+    l_.size = n;
+    l_.cap = encode_capacity(cap);
+    return p;
+  }
+
+  void init(const char* s, size_type n) { std::memcpy(init_uninitialized(n), s, n); }
+
+  // 设置长度并写入结尾 '\0'；短模式下 n == 23 时 remaining 恰好为 0，即结尾符
+  void set_size_and_terminate(size_type n) noexcept {
+    if (is_long()) {
+      l_.size = n;
+      l_.data[n] = '\0';
+    } else {
+      set_short_size(n);
+    }
+  }
+
+  void set_short_size(size_type n) noexcept {
+    if (n < sso_capacity) {
+      s_.data[n] = '\0';
+    }
+    s_.remaining = static_cast<unsigned char>(sso_capacity - n);
+  }
+
+  // 至少容纳 cap 个字符（另加 '\0'），实际容量取分配器返回的大小
+  static allocation_result<char*> allocate(size_type cap) {
+    auto result = allocator_type().allocate_at_least(cap + 1);
+    return {result.ptr, result.count - 1};
+  }
+
+  static void deallocate(char* p, size_type cap) noexcept { allocator_type().deallocate(p, cap + 1); }
+
+  // 接管新缓冲区，释放旧的堆缓冲区
+  void adopt(char* p, size_type n, size_type cap) noexcept {
+    if (is_long()) {
+      deallocate(l_.data, long_capacity());
+    }
+    l_.data = p;
+    l_.size = n;
+    l_.cap = encode_capacity(cap);
+  }
+
+  void reallocate(size_type new_cap) {
+    const size_type n = size();
+    auto [p, cap] = allocate(new_cap);
+    std::memcpy(p, data(), n + 1);
+    adopt(p, n, cap);
+  }
+
+  // 几何增长：至少翻倍
+  size_type recommend(size_type required) const {
+    if (required > max_size()) {
+      throw std::length_error("mystl::string: length exceeds max_size()");
+    }
+    const size_type cap = capacity();
+    if (cap >= max_size() / 2) {
+      return max_size();
+    }
+    return std::max(required, 2 * cap);
+  }
+
+  static void check_length(size_type old, size_type add) {
+    if (add > max_size() - old) {
+      throw std::length_error("mystl::string: length exceeds max_size()");
+    }
+  }
+
+  void check_pos(size_type pos) const {
+    if (pos > size()) {
+      throw std::out_of_range("mystl::string: position out of range");
+    }
+  }
+
+  static int compare_bytes(const char* a, size_type na, const char* b, size_type nb) noexcept {
+    const int r = std::memcmp(a, b, std::min(na, nb));
+    if (r != 0) {
+      return r;
+    }
+    return na < nb ? -1 : (na > nb ? 1 : 0);
+  }
+
+  union {
+    long_rep l_;
+    short_rep s_;
+  };
+};
+
+static_assert(sizeof(string) == 3 * sizeof(void*), "mystl::string must be three pointers wide");
+
+inline string operator+(const string& a, const string& b) {
+  string result;
+  result.reserve(a.size() + b.size());
+  result.append(a).append(b);
+  return result;
+}
+
+inline string operator+(string&& a, const string& b) { return std::move(a.append(b)); }
+inline string operator+(string&& a, const char* b) { return std::move(a.append(b)); }
+inline string operator+(string&& a, char c) { return std::move(a += c); }
+
+inline string operator+(const string& a, const char* b) {
+  const std::size_t n = std::strlen(b);
+  string result;
+  result.reserve(a.size() + n);
+  result.append(a).append(b, n);
+  return result;
 }
 
+inline string operator+(const char* a, const string& b) {
+  const std::size_t n = std::strlen(a);
+  string result;
+  result.reserve(n + b.size());
+  result.append(a, n).append(b);
+  return result;
+}
+
+inline string operator+(const string& a, char c) {
+  string result;
+  result.reserve(a.size() + 1);
+  result.append(a).push_back(c);
+  return result;
+}
+
+// 与 string_view 及其他字符串类型哈希一致
+template <>
+struct hash<string> : string_hash {};
+
+}  // namespace mystl
+
 #endif  // MYSTL_CONTAINERS_STRING_HPP
@@ -0,0 +1,400 @@
+#ifndef MYSTL_CONTAINERS_STRING_POOL_HPP
+#define MYSTL_CONTAINERS_STRING_POOL_HPP
+
+/**
+ * @file containers/string_pool.hpp
+ * @brief 字符串驻留池 (string_pool)：相同内容只存一份，返回稳定的 string_view 或 32 位符号 ID
+ *
+ * ## 设计
+ * - 字节存放在大块 arena 中（默认 64 KiB 一块），块只增不减、从不移动，
+ *   因此返回的 string_view 在池销毁前一直有效（池被移动后仍然有效）；每个字符串后附 '\0'
+ * - 超过块大小四分之一的长字符串单独分配一块，不浪费当前块的剩余空间
+ * - ID 从 0 开始按驻留顺序连续分配，view(id) 是一次数组下标访问
+ * - 查找表为开放寻址 + 线性探测，槽位 8 字节：{哈希高 32 位, ID}，
+ *   只有高位哈希相同时才比较字节；装载率超过 3/4 时容量翻倍
+ * - 每个条目缓存完整哈希，扩容重排时不需要重新计算
+ * - concurrent_string_pool 为线程安全版本：按哈希高位分到 16 个分片，每片一把互斥锁，
+ *   ID 的低 4 位记录分片号
+ *
+ * ## 使用建议
+ * - 热路径上保存 ID 并比较 ID，只在需要内容时调用 view(id)
+ *
+ * ## 异常安全
+ * - intern 提供强异常安全保证：分配失败时池保持不变
+ * - ID 用尽（超过 2^32 - 1 个不同字符串）时抛出 std::length_error
+ * - concurrent_string_pool 的查询成员需要加锁，std::mutex::lock 可能抛出 std::system_error，因此不标 noexcept
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "mystl/config/config.hpp"
+#include "mystl/config/platform.hpp"
+#include "mystl/containers/string_view.hpp"
+#include "mystl/core/assert.hpp"
+#include "mystl/memory/allocator.hpp"
+
+namespace mystl {
+
+class concurrent_string_pool;
+
+class string_pool {
+public:
+  // 类型定义
+  using size_type = std::size_t;
+  using id_type = std::uint32_t;
+
+  static constexpr id_type invalid_id = std::numeric_limits<id_type>::max();
+  static constexpr size_type default_chunk_size = 64 * 1024;
+
+  // 构造与析构
+  string_pool() noexcept = default;
+  explicit string_pool(size_type chunk_size) noexcept : chunk_size_(chunk_size) {}
+
+  string_pool(const string_pool&) = delete;
+  string_pool& operator=(const string_pool&) = delete;
+
+  string_pool(string_pool&& other) noexcept
+      : chunks_(std::exchange(other.chunks_, nullptr)),
+        cursor_(std::exchange(other.cursor_, nullptr)),
+        chunk_end_(std::exchange(other.chunk_end_, nullptr)),
+        entries_(std::exchange(other.entries_, nullptr)),
+        slots_(std::exchange(other.slots_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        entry_capacity_(std::exchange(other.entry_capacity_, 0)),
+        slot_count_(std::exchange(other.slot_count_, 0)),
+        bytes_(std::exchange(other.bytes_, 0)),
+        chunk_size_(other.chunk_size_),
+        id_limit_(other.id_limit_) {}
+
+  string_pool& operator=(string_pool&& other) noexcept {
+    string_pool(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~string_pool() { release(); }
+
+  void swap(string_pool& other) noexcept {
+    std::swap(chunks_, other.chunks_);
+    std::swap(cursor_, other.cursor_);
+    std::swap(chunk_end_, other.chunk_end_);
+    std::swap(entries_, other.entries_);
+    std::swap(slots_, other.slots_);
+    std::swap(size_, other.size_);
+    std::swap(entry_capacity_, other.entry_capacity_);
+    std::swap(slot_count_, other.slot_count_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(chunk_size_, other.chunk_size_);
+    std::swap(id_limit_, other.id_limit_);
+  }
+
+  friend void swap(string_pool& a, string_pool& b) noexcept { a.swap(b); }
+
+  // 驻留：已存在时返回原有 ID，否则复制字节并分配新 ID
+  id_type intern(string_view s) { return intern(s, string_hash{}(s)); }
+
+  // 驻留并返回池内的稳定视图
+  string_view intern_view(string_view s) { return view(intern(s)); }
+
+  // 只查找不插入，不存在时返回 invalid_id
+  id_type find(string_view s) const noexcept { return find(s, string_hash{}(s)); }
+  bool contains(string_view s) const noexcept { return find(s) != invalid_id; }
+
+  // 按 ID 取内容
+  string_view view(id_type id) const noexcept {
+    MYSTL_ASSERT(id < size_);
+    return entries_[id].text;
+  }
+  const char* c_str(id_type id) const noexcept { return view(id).data(); }
+
+  // 容量
+  size_type size() const noexcept { return size_; }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  // 已存放的字符字节数（含每个字符串结尾的 '\0'）
+  size_type bytes_used() const noexcept { return bytes_; }
+
+  // 预留 n 个字符串的查找表与条目空间
+  void reserve(size_type n) {
+    if (n > entry_capacity_) {
+      grow_entries(n);
+    }
+    size_type slots = slot_count_ == 0 ? min_slots : slot_count_;
+    while (n * 4 > slots * 3) {
+      slots *= 2;
+    }
+    if (slots > slot_count_) {
+      rehash(slots);
+    }
+  }
+
+private:
+  friend class concurrent_string_pool;
+
+  struct entry {
+    string_view text;
+    std::size_t hash;
+  };
+
+  // id == invalid_id 表示空槽
+  struct slot {
+    std::uint32_t tag;
+    id_type id;
+  };
+
+  // 块头部，字符数据紧跟其后
+  struct chunk_header {
+    chunk_header* next;
+    size_type capacity;
+  };
+
+  using entry_allocator = allocator<entry>;
+  using slot_allocator = allocator<slot>;
+  using chunk_allocator = allocator<char>;
+
+  static constexpr size_type min_slots = 16;
+
+  // 槽位中保存哈希的高 32 位，与决定起始槽位的低位相互独立
+  static std::uint32_t tag_of(std::size_t h) noexcept {
+    if constexpr (sizeof(std::size_t) > sizeof(std::uint32_t)) {
+      return static_cast<std::uint32_t>(h >> 32);
+    } else {
+      return static_cast<std::uint32_t>(h);
+    }
+  }
+
+  id_type find(string_view s, std::size_t h) const noexcept {
+    if (slot_count_ == 0) {
+      return invalid_id;
+    }
+    const size_type mask = slot_count_ - 1;
+    const std::uint32_t tag = tag_of(h);
+    for (size_type i = h & mask;; i = (i + 1) & mask) {
+      const slot& sl = slots_[i];
+      if (sl.id == invalid_id) {
+        return invalid_id;
+      }
+      if (sl.tag == tag && entries_[sl.id].text == s) {
+        return sl.id;
+      }
+    }
+  }
+
+  id_type intern(string_view s, std::size_t h) {
+    if ((size_ + 1) * 4 > slot_count_ * 3) {
+      rehash(slot_count_ == 0 ? min_slots : slot_count_ * 2);
+    }
+    const size_type mask = slot_count_ - 1;
+    const std::uint32_t tag = tag_of(h);
+    size_type i = h & mask;
+    for (;; i = (i + 1) & mask) {
+      const slot& sl = slots_[i];
+      if (sl.id == invalid_id) {
+        break;
+      }
+      if (sl.tag == tag && entries_[sl.id].text == s) {
+        return sl.id;
+      }
+    }
+
+    if (size_ >= id_limit_) MYSTL_UNLIKELY {
+      throw std::length_error("mystl::string_pool: out of symbol ids");
+    }
+    if (size_ == entry_capacity_) {
+      grow_entries(entry_capacity_ == 0 ? min_slots : entry_capacity_ * 2);
+    }
+    const char* text = store(s);
+    const auto id = static_cast<id_type>(size_);
+    ::new (static_cast<void*>(entries_ + size_)) entry{string_view(text, s.size()), h};
+    slots_[i] = slot{tag, id};
+    ++size_;
+    return id;
+  }
+
+  // 把字节复制进 arena，返回池内地址
+  const char* store(string_view s) {
+    const size_type need = s.size() + 1;
+    char* dst = nullptr;
+    if (need <= static_cast<size_type>(chunk_end_ - cursor_)) {
+      dst = cursor_;
+      cursor_ += need;
+    } else if (need > chunk_size_ / 4) {
+      dst = new_chunk(need);
+    } else {
+      dst = new_chunk(chunk_size_);
+      cursor_ = dst + need;
+      chunk_end_ = reinterpret_cast<char*>(chunks_ + 1) + chunks_->capacity;
+    }
+    if (!s.empty()) {
+      std::memcpy(dst, s.data(), s.size());
+    }
+    dst[s.size()] = '\0';
+    bytes_ += need;
+    return dst;
+  }
+
+  // 分配至少 bytes 字节的新块并挂到块链表头部，返回数据起始地址
+  char* new_chunk(size_type bytes) {
+    auto result = chunk_allocator().allocate_at_least(sizeof(chunk_header) + bytes);
+    auto* header = ::new (static_cast<void*>(result.ptr)) chunk_header{chunks_, result.count - sizeof(chunk_header)};
+    chunks_ = header;
+    return reinterpret_cast<char*>(header + 1);
+  }
+
+  void grow_entries(size_type capacity) {
+    entry* fresh = entry_allocator().allocate(capacity);
+    if (size_ != 0) {
+      std::memcpy(static_cast<void*>(fresh), entries_, size_ * sizeof(entry));
+    }
+    if (entries_ != nullptr) {
+      entry_allocator().deallocate(entries_, entry_capacity_);
+    }
+    entries_ = fresh;
+    entry_capacity_ = capacity;
+  }
+
+  // 按缓存的哈希把所有条目重新放入新表
+  void rehash(size_type slot_count) {
+    slot* fresh = slot_allocator().allocate(slot_count);
+    std::memset(static_cast<void*>(fresh), 0xFF, slot_count * sizeof(slot));
+    const size_type mask = slot_count - 1;
+    for (size_type id = 0; id < size_; ++id) {
+      const std::size_t h = entries_[id].hash;
+      size_type i = h & mask;
+      while (fresh[i].id != invalid_id) {
+        i = (i + 1) & mask;
+      }
+      fresh[i] = slot{tag_of(h), static_cast<id_type>(id)};
+    }
+    if (slots_ != nullptr) {
+      slot_allocator().deallocate(slots_, slot_count_);
+    }
+    slots_ = fresh;
+    slot_count_ = slot_count;
+  }
+
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      chunk_header* next = chunks_->next;
+      chunk_allocator().deallocate(reinterpret_cast<char*>(chunks_), sizeof(chunk_header) + chunks_->capacity);
+      chunks_ = next;
+    }
+    if (entries_ != nullptr) {
+      entry_allocator().deallocate(entries_, entry_capacity_);
+    }
+    if (slots_ != nullptr) {
+      slot_allocator().deallocate(slots_, slot_count_);
+    }
+  }
+
+  chunk_header* chunks_ = nullptr;
+  char* cursor_ = nullptr;     // 当前块的下一个空闲字节
+  char* chunk_end_ = nullptr;  // 当前块的末尾
+  entry* entries_ = nullptr;   // 按 ID 下标
+  slot* slots_ = nullptr;
+  size_type size_ = 0;
+  size_type entry_capacity_ = 0;
+  size_type slot_count_ = 0;
+  size_type bytes_ = 0;
+  size_type chunk_size_ = default_chunk_size;
+  size_type id_limit_ = invalid_id;  // 可分配的 ID 个数
+};
+
+// 线程安全的字符串驻留池：按哈希分片加锁，不同分片上的 intern 互不阻塞
+class concurrent_string_pool {
+public:
+  using size_type = std::size_t;
+  using id_type = string_pool::id_type;
+
+  static constexpr id_type invalid_id = string_pool::invalid_id;
+  static constexpr unsigned shard_bits = 4;
+  static constexpr size_type shard_count = size_type{1} << shard_bits;
+
+  concurrent_string_pool() {
+    for (auto& sh : shards_) {
+      sh.pool.id_limit_ = (size_type{1} << (32 - shard_bits)) - 1;
+    }
+  }
+
+  explicit concurrent_string_pool(size_type chunk_size) : concurrent_string_pool() {
+    for (auto& sh : shards_) {
+      sh.pool.chunk_size_ = chunk_size;
+    }
+  }
+
+  concurrent_string_pool(const concurrent_string_pool&) = delete;
+  concurrent_string_pool& operator=(const concurrent_string_pool&) = delete;
+
+  id_type intern(string_view s) {
+    const std::size_t h = string_hash{}(s);
+    const size_type index = shard_of(h);
+    shard& sh = shards_[index];
+    std::lock_guard<std::mutex> lock(sh.mutex);
+    return compose(sh.pool.intern(s, h), index);
+  }
+
+  // 返回的视图指向分片的 arena，此后读取无需加锁
+  string_view intern_view(string_view s) {
+    const std::size_t h = string_hash{}(s);
+    shard& sh = shards_[shard_of(h)];
+    std::lock_guard<std::mutex> lock(sh.mutex);
+    return sh.pool.view(sh.pool.intern(s, h));
+  }
+
+  id_type find(string_view s) const {
+    const std::size_t h = string_hash{}(s);
+    const size_type index = shard_of(h);
+    const shard& sh = shards_[index];
+    std::lock_guard<std::mutex> lock(sh.mutex);
+    const id_type local = sh.pool.find(s, h);
+    return local == invalid_id ? invalid_id : compose(local, index);
+  }
+
+  bool contains(string_view s) const { return find(s) != invalid_id; }
+
+  // 条目表可能被同分片的 intern 重新分配，因此按 ID 取内容需要加锁
+  string_view view(id_type id) const {
+    const shard& sh = shards_[id & (shard_count - 1)];
+    std::lock_guard<std::mutex> lock(sh.mutex);
+    return sh.pool.view(id >> shard_bits);
+  }
+
+  size_type size() const {
+    size_type total = 0;
+    for (const auto& sh : shards_) {
+      std::lock_guard<std::mutex> lock(sh.mutex);
+      total += sh.pool.size();
+    }
+    return total;
+  }
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+private:
+  // 每个分片独占缓存行，避免相邻分片的锁互相伪共享
+  struct alignas(MYSTL_CACHE_LINE_SIZE) shard {
+    mutable std::mutex mutex;
+    string_pool pool;
+  };
+
+  // 分片取哈希最高几位，与分片内查找表使用的低位错开
+  static size_type shard_of(std::size_t h) noexcept {
+    return static_cast<size_type>(h >> (std::numeric_limits<std::size_t>::digits - shard_bits));
+  }
+
+  static id_type compose(id_type local, size_type index) noexcept {
+    return static_cast<id_type>((local << shard_bits) | index);
+  }
+
+  std::array<shard, shard_count> shards_;
+};
+
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS_STRING_POOL_HPP
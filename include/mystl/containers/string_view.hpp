@@ -1,10 +1,399 @@
 #ifndef MYSTL_CONTAINERS_STRING_VIEW_HPP
 #define MYSTL_CONTAINERS_STRING_VIEW_HPP
 
-// placeholder for mystl::string_view (non-owning)
+/**
+ * @file containers/string_view.hpp
+ * @brief 非拥有的字节字符串视图 (string_view)
+ *
+ * ## 设计
+ * - 只保存 {data, size}，接口与 std::string_view 对齐，全部为 constexpr
+ * - 查找在运行期走 __details/string_search.hpp 中的向量内核（SSE2 基线，支持时运行期分派到 AVX2），
+ *   常量求值时走标量版本：
+ *   - find(char) / rfind(char)：逐块比较取掩码，相当于 memchr / memrchr
+ *   - find(子串) / rfind(子串)：首尾字节过滤，只对候选位置做 memcmp；rfind 从末尾逐块向前
+ *   - find_first_of / find_first_not_of 及 find_last_of / find_last_not_of：AVX2 下用 nibble 查找表，
+ *     集合较小时用 SSE2 逐字符比较，其余情况用 256 位位图
+ * - compare 直接使用 memcmp（C 库已经是向量化实现）
+ * - 可与 std::string_view 相互转换，便于和标准库接口配合
+ * - string_hash / string_equal 为透明函数对象，供无序容器做异构查找
+ *
+ * ## 异常安全
+ * - 只有 at / substr / copy 在位置越界时抛出 std::out_of_range，其余操作不抛异常
+ */
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "mystl/containers/__details/string_search.hpp"
+#include "mystl/core/assert.hpp"
+#include "mystl/core/hash.hpp"
 
 namespace mystl {
-class string_view;  // to be implemented
-}
+
+class string_view {
+public:
+  // 类型定义
+  using value_type = char;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = char*;
+  using const_pointer = const char*;
+  using reference = char&;
+  using const_reference = const char&;
+  using iterator = const char*;
+  using const_iterator = const char*;
+  using reverse_iterator = std::reverse_iterator<const_iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // 构造函数
+  constexpr string_view() noexcept = default;
+  constexpr string_view(const char* s, size_type n) noexcept : data_(s), size_(n) {}
+  constexpr string_view(const char* s) noexcept : data_(s), size_(length_of(s)) {}
+  string_view(std::nullptr_t) = delete;
+
+  template <std::contiguous_iterator It, std::sized_sentinel_for<It> End>
+    requires(std::is_same_v<std::iter_value_t<It>, char> && !std::is_convertible_v<End, size_type>)
+  constexpr string_view(It first, End last) noexcept
+      : data_(std::to_address(first)), size_(static_cast<size_type>(last - first)) {}
+
+  constexpr explicit string_view(std::string_view sv) noexcept : data_(sv.data()), size_(sv.size()) {}
+  constexpr operator std::string_view() const noexcept { return {data_, size_}; }
+
+  // 迭代器
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator cbegin() const noexcept { return data_; }
+  constexpr const_iterator end() const noexcept { return data_ + size_; }
+  constexpr const_iterator cend() const noexcept { return data_ + size_; }
+  constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+  constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+  // 元素访问
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    MYSTL_ASSERT(pos < size_);
+    return data_[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("mystl::string_view::at");
+    }
+    return data_[pos];
+  }
+
+  constexpr const_reference front() const noexcept { return (*this)[0]; }
+  constexpr const_reference back() const noexcept { return (*this)[size_ - 1]; }
+  constexpr const_pointer data() const noexcept { return data_; }
+
+  // 容量
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type length() const noexcept { return size_; }
+  static constexpr size_type max_size() noexcept {
+    return static_cast<size_type>(std::numeric_limits<difference_type>::max());
+  }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  // 修改器
+  constexpr void remove_prefix(size_type n) noexcept {
+    MYSTL_ASSERT(n <= size_);
+    data_ += n;
+    size_ -= n;
+  }
+
+  constexpr void remove_suffix(size_type n) noexcept {
+    MYSTL_ASSERT(n <= size_);
+    size_ -= n;
+  }
+
+  constexpr void swap(string_view& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+
+  // 操作
+  constexpr size_type copy(char* dest, size_type count, size_type pos = 0) const {
+    check_pos(pos);
+    count = std::min(count, size_ - pos);
+    std::copy_n(data_ + pos, count, dest);
+    return count;
+  }
+
+  constexpr string_view substr(size_type pos = 0, size_type count = npos) const {
+    check_pos(pos);
+    return string_view(data_ + pos, std::min(count, size_ - pos));
+  }
+
+  constexpr int compare(string_view v) const noexcept {
+    const size_type n = std::min(size_, v.size_);
+    int r = 0;
+    if consteval {
+      for (size_type i = 0; i < n && r == 0; ++i) {
+        const auto a = static_cast<unsigned char>(data_[i]);
+        const auto b = static_cast<unsigned char>(v.data_[i]);
+        r = a < b ? -1 : (a > b ? 1 : 0);
+      }
+    } else {
+      r = n == 0 ? 0 : std::memcmp(data_, v.data_, n);
+    }
+    if (r != 0) {
+      return r;
+    }
+    return size_ < v.size_ ? -1 : (size_ > v.size_ ? 1 : 0);
+  }
+
+  constexpr int compare(size_type pos1, size_type count1, string_view v) const {
+    return substr(pos1, count1).compare(v);
+  }
+
+  constexpr int compare(size_type pos1, size_type count1, string_view v, size_type pos2, size_type count2) const {
+    return substr(pos1, count1).compare(v.substr(pos2, count2));
+  }
+
+  constexpr int compare(const char* s) const noexcept { return compare(string_view(s)); }
+
+  constexpr bool starts_with(string_view v) const noexcept {
+    return size_ >= v.size_ && string_view(data_, v.size_).compare(v) == 0;
+  }
+  constexpr bool starts_with(char c) const noexcept { return !empty() && front() == c; }
+  constexpr bool starts_with(const char* s) const noexcept { return starts_with(string_view(s)); }
+
+  constexpr bool ends_with(string_view v) const noexcept {
+    return size_ >= v.size_ && string_view(data_ + size_ - v.size_, v.size_).compare(v) == 0;
+  }
+  constexpr bool ends_with(char c) const noexcept { return !empty() && back() == c; }
+  constexpr bool ends_with(const char* s) const noexcept { return ends_with(string_view(s)); }
+
+  constexpr bool contains(string_view v) const noexcept { return find(v) != npos; }
+  constexpr bool contains(char c) const noexcept { return find(c) != npos; }
+  constexpr bool contains(const char* s) const noexcept { return find(s) != npos; }
+
+  // 查找
+  constexpr size_type find(char c, size_type pos = 0) const noexcept {
+    if (pos >= size_) {
+      return npos;
+    }
+    size_type r = 0;
+    if consteval {
+      r = __details::find_char_scalar(data_ + pos, size_ - pos, c);
+    } else {
+      r = __details::find_char(data_ + pos, size_ - pos, c);
+    }
+    return offset(r, pos);
+  }
+
+  constexpr size_type find(string_view v, size_type pos = 0) const noexcept {
+    if (pos > size_) {
+      return npos;
+    }
+    size_type r = 0;
+    if consteval {
+      r = __details::find_substr_scalar(data_ + pos, size_ - pos, v.data_, v.size_);
+    } else {
+      r = __details::find_substr(data_ + pos, size_ - pos, v.data_, v.size_);
+    }
+    return offset(r, pos);
+  }
+
+  constexpr size_type find(const char* s, size_type pos, size_type n) const noexcept {
+    return find(string_view(s, n), pos);
+  }
+  constexpr size_type find(const char* s, size_type pos = 0) const noexcept { return find(string_view(s), pos); }
+
+  constexpr size_type rfind(char c, size_type pos = npos) const noexcept {
+    if (size_ == 0) {
+      return npos;
+    }
+    const size_type n = std::min(pos, size_ - 1) + 1;
+    if consteval {
+      return __details::rfind_char_scalar(data_, n, c);
+    } else {
+      return __details::rfind_char(data_, n, c);
+    }
+  }
+
+  constexpr size_type rfind(string_view v, size_type pos = npos) const noexcept {
+    if (v.size_ > size_) {
+      return npos;
+    }
+    // 匹配起点不超过 pos
+    const size_type n = std::min(pos, size_ - v.size_) + v.size_;
+    if consteval {
+      return __details::rfind_substr_scalar(data_, n, v.data_, v.size_);
+    } else {
+      return __details::rfind_substr(data_, n, v.data_, v.size_);
+    }
+  }
+
+  constexpr size_type rfind(const char* s, size_type pos, size_type n) const noexcept {
+    return rfind(string_view(s, n), pos);
+  }
+  constexpr size_type rfind(const char* s, size_type pos = npos) const noexcept { return rfind(string_view(s), pos); }
+
+  constexpr size_type find_first_of(string_view v, size_type pos = 0) const noexcept {
+    return find_of(v, pos, true);
+  }
+  constexpr size_type find_first_of(char c, size_type pos = 0) const noexcept { return find(c, pos); }
+  constexpr size_type find_first_of(const char* s, size_type pos, size_type n) const noexcept {
+    return find_first_of(string_view(s, n), pos);
+  }
+  constexpr size_type find_first_of(const char* s, size_type pos = 0) const noexcept {
+    return find_first_of(string_view(s), pos);
+  }
+
+  constexpr size_type find_first_not_of(string_view v, size_type pos = 0) const noexcept {
+    return find_of(v, pos, false);
+  }
+  constexpr size_type find_first_not_of(char c, size_type pos = 0) const noexcept {
+    return find_of(string_view(&c, 1), pos, false);
+  }
+  constexpr size_type find_first_not_of(const char* s, size_type pos, size_type n) const noexcept {
+    return find_first_not_of(string_view(s, n), pos);
+  }
+  constexpr size_type find_first_not_of(const char* s, size_type pos = 0) const noexcept {
+    return find_first_not_of(string_view(s), pos);
+  }
+
+  constexpr size_type find_last_of(string_view v, size_type pos = npos) const noexcept {
+    return rfind_of(v, pos, true);
+  }
+  constexpr size_type find_last_of(char c, size_type pos = npos) const noexcept { return rfind(c, pos); }
+  constexpr size_type find_last_of(const char* s, size_type pos, size_type n) const noexcept {
+    return find_last_of(string_view(s, n), pos);
+  }
+  constexpr size_type find_last_of(const char* s, size_type pos = npos) const noexcept {
+    return find_last_of(string_view(s), pos);
+  }
+
+  constexpr size_type find_last_not_of(string_view v, size_type pos = npos) const noexcept {
+    return rfind_of(v, pos, false);
+  }
+  constexpr size_type find_last_not_of(char c, size_type pos = npos) const noexcept {
+    return rfind_of(string_view(&c, 1), pos, false);
+  }
+  constexpr size_type find_last_not_of(const char* s, size_type pos, size_type n) const noexcept {
+    return find_last_not_of(string_view(s, n), pos);
+  }
+  constexpr size_type find_last_not_of(const char* s, size_type pos = npos) const noexcept {
+    return find_last_not_of(string_view(s), pos);
+  }
+
+  // 比较
+  friend constexpr bool operator==(string_view a, string_view b) noexcept {
+    return a.size_ == b.size_ && a.compare(b) == 0;
+  }
+
+  friend constexpr std::strong_ordering operator<=>(string_view a, string_view b) noexcept {
+    return a.compare(b) <=> 0;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, string_view v) {
+    return os.write(v.data_, static_cast<std::streamsize>(v.size_));
+  }
+
+private:
+  static constexpr size_type length_of(const char* s) noexcept {
+    if consteval {
+      size_type n = 0;
+      while (s[n] != '\0') {
+        ++n;
+      }
+      return n;
+    } else {
+      return std::strlen(s);
+    }
+  }
+
+  static constexpr size_type offset(size_type r, size_type pos) noexcept { return r == npos ? npos : r + pos; }
+
+  constexpr void check_pos(size_type pos) const {
+    if (pos > size_) {
+      throw std::out_of_range("mystl::string_view: position out of range");
+    }
+  }
+
+  constexpr size_type find_of(string_view set, size_type pos, bool in_set) const noexcept {
+    if (pos >= size_) {
+      return npos;
+    }
+    size_type r = 0;
+    if consteval {
+      r = __details::find_of_scalar(data_ + pos, size_ - pos, __details::char_bitmap(set.data_, set.size_), in_set);
+    } else {
+      r = __details::find_of(data_ + pos, size_ - pos, set.data_, set.size_, in_set);
+    }
+    return offset(r, pos);
+  }
+
+  constexpr size_type rfind_of(string_view set, size_type pos, bool in_set) const noexcept {
+    if (size_ == 0) {
+      return npos;
+    }
+    const size_type n = std::min(pos, size_ - 1) + 1;
+    if consteval {
+      return __details::rfind_of_scalar(data_, n, __details::char_bitmap(set.data_, set.size_), in_set);
+    } else {
+      return __details::rfind_of(data_, n, set.data_, set.size_, in_set);
+    }
+  }
+
+  const char* data_ = nullptr;
+  size_type size_ = 0;
+};
+
+inline namespace literals {
+inline namespace string_view_literals {
+
+constexpr string_view operator""_sv(const char* s, std::size_t n) noexcept { return string_view(s, n); }
+
+}  // namespace string_view_literals
+}  // namespace literals
+
+// 透明哈希：各种字符串类型统一按 string_view 的内容求哈希（mystl::hash_bytes），关联容器可以直接用 string_view 查找。
+// 自带缓存哈希的类型（如 shared_string）通过 cached_hash() 直接返回缓存值
+struct string_hash {
+  using is_transparent = void;
+
+  std::size_t operator()(string_view v) const noexcept {
+    return static_cast<std::size_t>(hash_bytes(v.data(), v.size()));
+  }
+
+  template <class S>
+    requires requires(const S& s) {
+      { s.cached_hash() } noexcept -> std::same_as<std::size_t>;
+    }
+  std::size_t operator()(const S& s) const noexcept {
+    return s.cached_hash();
+  }
+};
+
+// 透明相等比较，与 string_hash 配套使用
+struct string_equal {
+  using is_transparent = void;
+
+  constexpr bool operator()(string_view a, string_view b) const noexcept { return a == b; }
+};
+
+template <>
+struct hash<string_view> : string_hash {};
+
+}  // namespace mystl
+
+template <>
+struct std::hash<mystl::string_view> {
+  std::size_t operator()(mystl::string_view v) const noexcept { return mystl::string_hash{}(v); }
+};
 
 #endif  // MYSTL_CONTAINERS_STRING_VIEW_HPP
@@ -0,0 +1,255 @@
+#ifndef MYSTL_CONTAINERS_UTF8_HPP
+#define MYSTL_CONTAINERS_UTF8_HPP
+
+/**
+ * @file containers/utf8.hpp
+ * @brief UTF-8 校验、码点计数与 UTF-8 <-> UTF-16 / UTF-32 转码（mystl::utf8）
+ *
+ * ## 设计
+ * - validate：AVX2 可用时（运行期分派）用查表法整块校验，每 32 字节约二十条向量指令且无分支；
+ *   否则用 SSE2 跳过 ASCII 块、逐序列校验
+ * - 校验规则与 RFC 3629 一致：拒绝过长编码、代理区码点（U+D800..U+DFFF）、超过 U+10FFFF 的码点与截断序列
+ * - first_invalid 返回第一个非法序列的起点，用于报告错误位置
+ * - count_code_points / utf16_length 只数字节类别（非续字节、四字节首字节），向量比较后 popcount
+ * - UTF-8 转出时先用 validate 整体校验，合法且输出足够时逐块解码、不再逐码点检查；
+ *   否则逐码点检查以报告错误位置
+ * - 16 字节（UTF-16 / UTF-32 输入为 8 个单元）全为 ASCII 时整块扩展或收窄，否则逐码点处理该块
+ *
+ * ## 错误报告
+ * - 转码返回 convert_result{read, written, ec}：
+ *   - 成功：ec == std::errc{}，read 为输入长度
+ *   - 非法输入：ec == std::errc::illegal_byte_sequence，read 指向非法序列的起点
+ *   - 输出空间不足：ec == std::errc::value_too_large，read 指向第一个未转换的码点
+ *   - 出错时 [0, written) 已写入，且只包含完整的码点
+ *
+ * ## 前置条件
+ * - count_code_points、utf16_length、utf8_length 假定输入合法；对非法输入结果无意义但不越界
+ */
+
+#include <cstddef>
+#include <system_error>
+
+#include "mystl/config/config.hpp"
+#include "mystl/containers/__details/utf8_kernels.hpp"
+#include "mystl/containers/span.hpp"
+#include "mystl/containers/string_view.hpp"
+
+namespace mystl {
+namespace utf8 {
+
+inline constexpr std::size_t npos = __details::utf8_npos;
+
+struct convert_result {
+  std::size_t read;
+  std::size_t written;
+  std::errc ec;
+
+  friend bool operator==(const convert_result&, const convert_result&) = default;
+};
+
+// 校验
+inline bool validate(string_view s) noexcept { return __details::utf8_validate(s.data(), s.size()); }
+
+// 第一个非法序列的起点，合法时返回 npos
+inline std::size_t first_invalid(string_view s) noexcept {
+  return __details::utf8_first_invalid(s.data(), s.size());
+}
+
+// 计数
+inline std::size_t count_code_points(string_view s) noexcept { return __details::utf8_count(s.data(), s.size()); }
+
+// 转成 UTF-16 所需的单元数
+inline std::size_t utf16_length(string_view s) noexcept {
+  return __details::utf8_utf16_length(s.data(), s.size());
+}
+
+// UTF-16 / UTF-32 转成 UTF-8 所需的字节数
+inline std::size_t utf8_length(span<const char16_t> s) noexcept {
+  std::size_t n = 0;
+  for (const char16_t u : s) {
+    // 代理对的两个单元各计 2 字节，合计 4
+    n += u < 0x80u ? 1 : (u < 0x800u || (u >= 0xD800u && u <= 0xDFFFu)) ? 2 : 3;
+  }
+  return n;
+}
+
+inline std::size_t utf8_length(span<const char32_t> s) noexcept {
+  std::size_t n = 0;
+  for (const char32_t c : s) {
+    n += static_cast<std::size_t>(__details::utf8_encoded_length(c));
+  }
+  return n;
+}
+
+namespace __utf8_impl {
+
+// 已知输入合法且输出足够时的转码：不再逐码点检查。
+// 以 16 字节为一块，全为 ASCII 时整块扩展，否则逐码点解码到块尾
+template <class Unit>
+std::size_t decode_valid(const char* p, std::size_t n, Unit* dst) noexcept {
+  std::size_t i = 0;
+  std::size_t o = 0;
+#if MYSTL_HAS_SSE2
+  while (i + 16 <= n) {
+    if (__details::utf8_ascii_block_sse2(p + i)) {
+      if constexpr (sizeof(Unit) == 2) {
+        __details::utf8_widen16_sse2(p + i, dst + o);
+      } else {
+        __details::utf8_widen32_sse2(p + i, dst + o);
+      }
+      i += 16;
+      o += 16;
+      continue;
+    }
+    const std::size_t block_end = i + 16;
+    while (i < block_end) {
+      char32_t cp = 0;
+      i += static_cast<std::size_t>(__details::utf8_decode_valid(p + i, cp));
+      if (sizeof(Unit) == 4 || cp < 0x10000u) {
+        dst[o++] = static_cast<Unit>(cp);
+      } else {
+        cp -= 0x10000u;
+        dst[o++] = static_cast<Unit>(0xD800u + (cp >> 10));
+        dst[o++] = static_cast<Unit>(0xDC00u + (cp & 0x3FFu));
+      }
+    }
+  }
+#endif
+  while (i < n) {
+    char32_t cp = 0;
+    i += static_cast<std::size_t>(__details::utf8_decode(p, n, i, cp));
+    if (sizeof(Unit) == 4 || cp < 0x10000u) {
+      dst[o++] = static_cast<Unit>(cp);
+    } else {
+      cp -= 0x10000u;
+      dst[o++] = static_cast<Unit>(0xD800u + (cp >> 10));
+      dst[o++] = static_cast<Unit>(0xDC00u + (cp & 0x3FFu));
+    }
+  }
+  return o;
+}
+
+// 逐码点检查的转码：定位非法序列与输出不足的位置
+template <class Unit>
+convert_result decode_checked(const char* p, std::size_t n, Unit* dst, std::size_t cap) noexcept {
+  std::size_t i = 0;
+  std::size_t o = 0;
+  while (i < n) {
+    char32_t cp = 0;
+    const int len = __details::utf8_decode(p, n, i, cp);
+    if (len == 0) {
+      return {i, o, std::errc::illegal_byte_sequence};
+    }
+    const std::size_t units = sizeof(Unit) == 4 || cp < 0x10000u ? 1 : 2;
+    if (cap - o < units) {
+      return {i, o, std::errc::value_too_large};
+    }
+    if (units == 1) {
+      dst[o++] = static_cast<Unit>(cp);
+    } else {
+      cp -= 0x10000u;
+      dst[o++] = static_cast<Unit>(0xD800u + (cp >> 10));
+      dst[o++] = static_cast<Unit>(0xDC00u + (cp & 0x3FFu));
+    }
+    i += static_cast<std::size_t>(len);
+  }
+  return {i, o, std::errc{}};
+}
+
+}  // namespace __utf8_impl
+
+// UTF-8 -> UTF-16：先整体校验（AVX2 下远快于逐码点检查），合法且输出足够时走无检查的解码
+inline convert_result to_utf16(string_view in, span<char16_t> out) noexcept {
+  if (validate(in) && (out.size() >= in.size() || out.size() >= utf16_length(in))) {
+    return {in.size(), __utf8_impl::decode_valid(in.data(), in.size(), out.data()), std::errc{}};
+  }
+  return __utf8_impl::decode_checked(in.data(), in.size(), out.data(), out.size());
+}
+
+// UTF-8 -> UTF-32
+inline convert_result to_utf32(string_view in, span<char32_t> out) noexcept {
+  if (validate(in) && (out.size() >= in.size() || out.size() >= count_code_points(in))) {
+    return {in.size(), __utf8_impl::decode_valid(in.data(), in.size(), out.data()), std::errc{}};
+  }
+  return __utf8_impl::decode_checked(in.data(), in.size(), out.data(), out.size());
+}
+
+// UTF-16 -> UTF-8：孤立的代理单元视为非法
+inline convert_result from_utf16(span<const char16_t> in, span<char> out) noexcept {
+  const char16_t* p = in.data();
+  const std::size_t n = in.size();
+  char* dst = out.data();
+  const std::size_t cap = out.size();
+  std::size_t i = 0;
+  std::size_t o = 0;
+  while (i < n) {
+    std::size_t block_end = n;
+#if MYSTL_HAS_SSE2
+    if (i + 8 <= n) {
+      if (cap - o >= 8 && __details::utf16_narrow8_sse2(p + i, dst + o)) {
+        i += 8;
+        o += 8;
+        continue;
+      }
+      block_end = i + 8;
+    }
+#endif
+    while (i < block_end) {
+      const char16_t u = p[i];
+      char32_t cp = u;
+      std::size_t units = 1;
+      if (u >= 0xD800u && u <= 0xDFFFu) {
+        if (u > 0xDBFFu || i + 1 == n || p[i + 1] < 0xDC00u || p[i + 1] > 0xDFFFu) {
+          return {i, o, std::errc::illegal_byte_sequence};
+        }
+        cp = 0x10000u + ((static_cast<char32_t>(u) - 0xD800u) << 10) + (static_cast<char32_t>(p[i + 1]) - 0xDC00u);
+        units = 2;
+      }
+      if (cap - o < static_cast<std::size_t>(__details::utf8_encoded_length(cp))) {
+        return {i, o, std::errc::value_too_large};
+      }
+      o += static_cast<std::size_t>(__details::utf8_encode(cp, dst + o));
+      i += units;
+    }
+  }
+  return {i, o, std::errc{}};
+}
+
+// UTF-32 -> UTF-8：代理区与超过 U+10FFFF 的值视为非法
+inline convert_result from_utf32(span<const char32_t> in, span<char> out) noexcept {
+  const char32_t* p = in.data();
+  const std::size_t n = in.size();
+  char* dst = out.data();
+  const std::size_t cap = out.size();
+  std::size_t i = 0;
+  std::size_t o = 0;
+  while (i < n) {
+    std::size_t block_end = n;
+#if MYSTL_HAS_SSE2
+    if (i + 8 <= n) {
+      if (cap - o >= 8 && __details::utf32_narrow8_sse2(p + i, dst + o)) {
+        i += 8;
+        o += 8;
+        continue;
+      }
+      block_end = i + 8;
+    }
+#endif
+    for (; i < block_end; ++i) {
+      const char32_t cp = p[i];
+      if (cp > 0x10FFFFu || (cp >= 0xD800u && cp <= 0xDFFFu)) {
+        return {i, o, std::errc::illegal_byte_sequence};
+      }
+      if (cap - o < static_cast<std::size_t>(__details::utf8_encoded_length(cp))) {
+        return {i, o, std::errc::value_too_large};
+      }
+      o += static_cast<std::size_t>(__details::utf8_encode(cp, dst + o));
+    }
+  }
+  return {i, o, std::errc{}};
+}
+
+}  // namespace utf8
+}  // namespace mystl
+
+#endif  // MYSTL_CONTAINERS_UTF8_HPP
@@ -0,0 +1,634 @@
+#ifndef MYSTL_CORE_CHARCONV_HPP
+#define MYSTL_CORE_CHARCONV_HPP
+
+/**
+ * @file core/charconv.hpp
+ * @brief 数值与字符序列的相互转换（to_chars / from_chars），接口与 <charconv> 一致
+ *
+ * ## 设计
+ * - 整数 to_chars（十进制）：
+ *   - 位数由 bit_width 估算后查一次 10 的幂表修正，无循环、无分支链
+ *   - 从低位起每次用两位数字表写出两位，除法次数减半
+ *   - 其他进制走通用循环
+ * - 整数 from_chars：逐位累加，溢出用编译器内建的带溢出检查乘加判断
+ * - 浮点 to_chars：最短往返表示（Schubfach 算法）
+ *   - 用 128 位（float 为 64 位）的 10 的幂近似值一次乘法得到区间端点的十进制缩放值，
+ *     在 10^(k+1) 与 10^k 两个精度上判断落在舍入区间内的候选，选出最短且最接近的十进制数
+ *   - 输出格式与 std::to_chars(first, last, value) 相同：定点与科学计数法中取较短者，等长时取定点
+ * - 浮点 from_chars：
+ *   - 有效数字不超过 2^53（float 为 2^24）且十进制指数在精确范围内时，
+ *     一次浮点乘除即为正确舍入的结果（Clinger 快速路径）
+ *   - 其余输入（长尾数、极端指数、inf / nan）交给 std::from_chars
+ *
+ * ## 与标准的差异
+ * - 浮点 to_chars 只提供最短表示的重载，不支持 chars_format 与精度参数
+ * - 结果类型直接使用 std::to_chars_result / std::from_chars_result
+ */
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#include "mystl/config/compiler.hpp"
+#include "mystl/core/__details/charconv_tables.hpp"
+#include "mystl/core/assert.hpp"
+
+namespace mystl {
+
+using to_chars_result = std::to_chars_result;
+using from_chars_result = std::from_chars_result;
+
+namespace __details {
+
+template <class T>
+concept charconv_integer = std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool>;
+
+inline constexpr char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// 首项为 0，使 v = 0 时也得到 1 位
+inline constexpr std::uint64_t powers_of_10[] = {0,
+                                                 10ULL,
+                                                 100ULL,
+                                                 1000ULL,
+                                                 10000ULL,
+                                                 100000ULL,
+                                                 1000000ULL,
+                                                 10000000ULL,
+                                                 100000000ULL,
+                                                 1000000000ULL,
+                                                 10000000000ULL,
+                                                 100000000000ULL,
+                                                 1000000000000ULL,
+                                                 10000000000000ULL,
+                                                 100000000000000ULL,
+                                                 1000000000000000ULL,
+                                                 10000000000000000ULL,
+                                                 100000000000000000ULL,
+                                                 1000000000000000000ULL,
+                                                 10000000000000000000ULL};
+
+// 十进制位数：log10(v) ≈ bit_width(v) * 1233 / 4096，再与 10 的幂比较修正一次
+constexpr int count_digits(std::uint64_t v) noexcept {
+  const auto t = static_cast<int>((std::bit_width(v | 1) * 1233) >> 12);
+  return t - (v < powers_of_10[t] ? 1 : 0) + 1;
+}
+
+// 把 v 的 n 位十进制数字写到 [p, p + n)，n 必须等于 count_digits(v)
+template <class UInt>
+constexpr void write_digits(char* p, UInt v, int n) noexcept {
+  char* out = p + n;
+  while (v >= 100) {
+    const auto pair = static_cast<std::size_t>(v % 100) * 2;
+    v /= 100;
+    out -= 2;
+    out[0] = digit_pairs[pair];
+    out[1] = digit_pairs[pair + 1];
+  }
+  if (v >= 10) {
+    const auto pair = static_cast<std::size_t>(v) * 2;
+    out -= 2;
+    out[0] = digit_pairs[pair];
+    out[1] = digit_pairs[pair + 1];
+  } else {
+    *--out = static_cast<char>('0' + v);
+  }
+}
+
+template <class UInt>
+constexpr void write_decimal(char* p, UInt v, int n) noexcept {
+  // 能放进 32 位时用 32 位除法，比 64 位快
+  if (v <= std::numeric_limits<std::uint32_t>::max()) {
+    write_digits(p, static_cast<std::uint32_t>(v), n);
+  } else {
+    write_digits(p, static_cast<std::uint64_t>(v), n);
+  }
+}
+
+template <class UInt>
+constexpr to_chars_result unsigned_to_chars(char* first, char* last, UInt v, int base) noexcept {
+  if (base == 10) {
+    const int n = count_digits(v);
+    if (last - first < n) {
+      return {last, std::errc::value_too_large};
+    }
+    write_decimal(first, v, n);
+    return {first + n, std::errc{}};
+  }
+  int n = 1;
+  for (UInt rest = v / static_cast<UInt>(base); rest != 0; rest /= static_cast<UInt>(base)) {
+    ++n;
+  }
+  if (last - first < n) {
+    return {last, std::errc::value_too_large};
+  }
+  constexpr char alphabet[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  for (char* out = first + n; out != first; v /= static_cast<UInt>(base)) {
+    *--out = alphabet[v % static_cast<UInt>(base)];
+  }
+  return {first + n, std::errc{}};
+}
+
+// 字符对应的数位值，非数位字符返回一个不小于 36 的值
+constexpr unsigned digit_value(char c) noexcept {
+  const unsigned u = static_cast<unsigned char>(c);
+  if (u - '0' < 10u) {
+    return u - '0';
+  }
+  const unsigned lower = u | 0x20u;
+  if (lower - 'a' < 26u) {
+    return lower - 'a' + 10;
+  }
+  return 36;
+}
+
+template <class UInt>
+constexpr bool mul_add_overflow(UInt& acc, unsigned base, unsigned d) noexcept {
+#if MYSTL_COMPILER_GCC || MYSTL_COMPILER_CLANG
+  return __builtin_mul_overflow(acc, static_cast<UInt>(base), &acc) ||
+         __builtin_add_overflow(acc, static_cast<UInt>(d), &acc);
+#else
+  constexpr UInt max = std::numeric_limits<UInt>::max();
+  if (acc > (max - d) / base) {
+    return true;
+  }
+  acc = static_cast<UInt>(acc * base + d);
+  return false;
+#endif
+}
+
+// ---- 浮点数最短输出（Schubfach） ----
+
+// floor(log10(2^e))，|e| <= 2620
+constexpr int floor_log10_pow2(int e) noexcept { return (e * 1262611) >> 22; }
+
+// floor(log10(3/4 * 2^e))，|e| <= 2620
+constexpr int floor_log10_three_quarters_pow2(int e) noexcept { return (e * 1262611 - 524031) >> 22; }
+
+// floor(log2(10^e))，|e| <= 1233
+constexpr int floor_log2_pow10(int e) noexcept { return (e * 1741647) >> 19; }
+
+struct uint128_parts {
+  std::uint64_t hi;
+  std::uint64_t lo;
+};
+
+inline uint128_parts umul128(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  const uint128 r = static_cast<uint128>(a) * b;
+  return {static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r)};
+#else
+  const std::uint64_t a_lo = a & 0xFFFFFFFFu;
+  const std::uint64_t a_hi = a >> 32;
+  const std::uint64_t b_lo = b & 0xFFFFFFFFu;
+  const std::uint64_t b_hi = b >> 32;
+  const std::uint64_t lo_lo = a_lo * b_lo;
+  const std::uint64_t hi_lo = a_hi * b_lo;
+  const std::uint64_t lo_hi = a_lo * b_hi;
+  const std::uint64_t hi_hi = a_hi * b_hi;
+  const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi;
+  return {hi_hi + (hi_lo >> 32) + (cross >> 32), (cross << 32) | (lo_lo & 0xFFFFFFFFu)};
+#endif
+}
+
+// g * cp / 2^128 向下取整，丢弃的部分非零时把最低位置 1（round to odd），
+// 保证与区间端点的比较结果和精确值一致
+inline std::uint64_t round_to_odd(const std::uint64_t* g, std::uint64_t cp) noexcept {
+  const uint128_parts x = umul128(g[1], cp);
+  const uint128_parts y = umul128(g[0], cp);
+  const std::uint64_t z = y.lo + x.hi;
+  const std::uint64_t carry = z < y.lo ? 1 : 0;
+  return (y.hi + carry) | (z > 1 ? 1 : 0);
+}
+
+inline std::uint32_t round_to_odd(std::uint64_t g, std::uint32_t cp) noexcept {
+  const std::uint64_t low = (g & 0xFFFFFFFFu) * cp;
+  const std::uint64_t high = (g >> 32) * cp + (low >> 32);
+  return static_cast<std::uint32_t>(high >> 32) | (static_cast<std::uint32_t>(high) > 1 ? 1u : 0u);
+}
+
+template <class UInt>
+struct decimal_fp {
+  UInt digits;
+  int exponent;  // 值为 digits * 10^exponent
+};
+
+// IEEE 二进制浮点的参数：有效数字位数（不含隐含位）与指数偏移
+template <class Float>
+struct float_traits;
+
+template <>
+struct float_traits<double> {
+  using bits_type = std::uint64_t;
+  static constexpr int significand_bits = 52;
+  static constexpr int exponent_bits = 11;
+  static constexpr int exponent_bias = 1023;
+};
+
+template <>
+struct float_traits<float> {
+  using bits_type = std::uint32_t;
+  static constexpr int significand_bits = 23;
+  static constexpr int exponent_bits = 8;
+  static constexpr int exponent_bias = 127;
+};
+
+/**
+ * 求落在 value 舍入区间内、位数最少且最接近 value 的十进制数（value 为有限正数）
+ *
+ * value = c * 2^q。区间端点按 4 倍缩放为 cbl、cbr（cb = 4c 为 value 本身），
+ * 乘以 10^-k 后得到 vbl、vb、vbr，k 取使 vb / 4 恰好比 c 多约一位十进制数字的值。
+ * 先看 10^(k+1) 精度上是否恰有一个候选落在区间内，否则在 10^k 精度上取最接近者。
+ */
+template <class Float>
+decimal_fp<typename float_traits<Float>::bits_type> to_decimal(typename float_traits<Float>::bits_type ieee_significand,
+                                                               int ieee_exponent) noexcept {
+  using traits = float_traits<Float>;
+  using bits_type = typename traits::bits_type;
+  constexpr int min_exponent = 1 - traits::exponent_bias - traits::significand_bits;
+
+  bits_type c = 0;
+  int q = 0;
+  if (ieee_exponent != 0) {
+    c = (bits_type{1} << traits::significand_bits) | ieee_significand;
+    q = ieee_exponent + min_exponent - 1;
+    // 小整数值直接得到精确的十进制表示
+    if (q <= 0 && -q <= traits::significand_bits) {
+      const bits_type mask = (bits_type{1} << -q) - 1;
+      if ((c & mask) == 0) {
+        return {static_cast<bits_type>(c >> -q), 0};
+      }
+    }
+  } else {
+    c = ieee_significand;
+    q = min_exponent;
+  }
+
+  const bool is_even = c % 2 == 0;
+  // 有效数字为 2 的幂时，下方相邻浮点数的间距只有上方的一半
+  const bool lower_boundary_is_closer = ieee_significand == 0 && ieee_exponent > 1;
+
+  const bits_type cbl = 4 * c - 2 + (lower_boundary_is_closer ? 1 : 0);
+  const bits_type cb = 4 * c;
+  const bits_type cbr = 4 * c + 2;
+
+  const int k = lower_boundary_is_closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+  const int h = q + floor_log2_pow10(-k) + 1;
+  const std::uint64_t* g = pow10_significands[-k - pow10_min_exponent];
+
+  bits_type vbl = 0;
+  bits_type vb = 0;
+  bits_type vbr = 0;
+  if constexpr (sizeof(bits_type) == sizeof(std::uint64_t)) {
+    vbl = round_to_odd(g, cbl << h);
+    vb = round_to_odd(g, cb << h);
+    vbr = round_to_odd(g, cbr << h);
+  } else {
+    // float 只需要 64 位精度：取 128 位值的高半部分并向上取整
+    const std::uint64_t g64 = g[0] + (g[1] != 0 ? 1 : 0);
+    vbl = round_to_odd(g64, static_cast<bits_type>(cbl << h));
+    vb = round_to_odd(g64, static_cast<bits_type>(cb << h));
+    vbr = round_to_odd(g64, static_cast<bits_type>(cbr << h));
+  }
+
+  const bits_type lower = vbl + (is_even ? 0 : 1);
+  const bits_type upper = vbr - (is_even ? 0 : 1);
+
+  const bits_type s = vb / 4;
+  if (s >= 10) {
+    const bits_type sp = s / 10;
+    const bool up_inside = lower <= 40 * sp;
+    const bool wp_inside = 40 * sp + 40 <= upper;
+    if (up_inside != wp_inside) {
+      return {static_cast<bits_type>(sp + (wp_inside ? 1 : 0)), k + 1};
+    }
+  }
+
+  const bool u_inside = lower <= 4 * s;
+  const bool w_inside = 4 * s + 4 <= upper;
+  if (u_inside != w_inside) {
+    return {static_cast<bits_type>(s + (w_inside ? 1 : 0)), k};
+  }
+
+  const bits_type mid = 4 * s + 2;
+  const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+  return {static_cast<bits_type>(s + (round_up ? 1 : 0)), k};
+}
+
+// 写出整数 c * 2^q（q > 0）的全部十进制数字，返回位数。
+// 以 10^9 为基的三个分量逐次乘 2，足以容纳定点格式下可能出现的整数（< 10^27）
+inline int write_exact_integer(char* out, std::uint64_t c, int q) noexcept {
+  constexpr std::uint32_t base = 1000000000;
+  std::uint32_t limbs[3] = {static_cast<std::uint32_t>(c % base), static_cast<std::uint32_t>(c / base % base),
+                            static_cast<std::uint32_t>(c / base / base)};
+  for (int i = 0; i < q; ++i) {
+    std::uint32_t carry = 0;
+    for (auto& limb : limbs) {
+      const std::uint32_t doubled = limb * 2 + carry;
+      carry = doubled >= base ? 1 : 0;
+      limb = doubled - (carry != 0 ? base : 0);
+    }
+  }
+  // 最高的非零分量不补零，其后的分量各占 9 位
+  int top = 2;
+  while (top > 0 && limbs[top] == 0) {
+    --top;
+  }
+  int n = count_digits(limbs[top]);
+  write_decimal(out, limbs[top], n);
+  for (int i = top - 1; i >= 0; --i) {
+    const int width = count_digits(limbs[i]);
+    std::memset(out + n, '0', static_cast<std::size_t>(9 - width));
+    write_decimal(out + n + 9 - width, limbs[i], width);
+    n += 9;
+  }
+  return n;
+}
+
+// 按 std::to_chars 的默认格式写出 digits * 10^exponent：定点与科学计数法取较短者。
+// 与标准库一致，定点格式下的大整数写出精确值而不是补零，value = c * 2^q 为其二进制表示
+template <class UInt>
+to_chars_result format_shortest(char* first, char* last, decimal_fp<UInt> d, UInt c, int q) noexcept {
+  while (d.digits % 10 == 0) {
+    d.digits /= 10;
+    ++d.exponent;
+  }
+  const int n = count_digits(d.digits);
+  const int k = d.exponent;
+  const int sci_exponent = k + n - 1;
+  const int abs_exponent = sci_exponent < 0 ? -sci_exponent : sci_exponent;
+  const int sci_length = n + (n > 1 ? 1 : 0) + 2 + (abs_exponent >= 100 ? 3 : 2);
+  const int fixed_length = k >= 0 ? n + k : (-k < n ? n + 1 : 2 - k);
+
+  char digits[24];
+  write_decimal(digits, d.digits, n);
+
+  if (fixed_length <= sci_length) {
+    if (last - first < fixed_length) {
+      return {last, std::errc::value_too_large};
+    }
+    if (k > 0 && q > 0) {
+      char exact[32];
+      const int length = write_exact_integer(exact, c, q);
+      MYSTL_ASSERT(length == fixed_length);
+      std::memcpy(first, exact, static_cast<std::size_t>(length));
+    } else if (k >= 0) {
+      std::memcpy(first, digits, static_cast<std::size_t>(n));
+      std::memset(first + n, '0', static_cast<std::size_t>(k));
+    } else if (-k < n) {
+      const int whole = n + k;
+      std::memcpy(first, digits, static_cast<std::size_t>(whole));
+      first[whole] = '.';
+      std::memcpy(first + whole + 1, digits + whole, static_cast<std::size_t>(-k));
+    } else {
+      first[0] = '0';
+      first[1] = '.';
+      std::memset(first + 2, '0', static_cast<std::size_t>(-k - n));
+      std::memcpy(first + 2 - k - n, digits, static_cast<std::size_t>(n));
+    }
+    return {first + fixed_length, std::errc{}};
+  }
+
+  if (last - first < sci_length) {
+    return {last, std::errc::value_too_large};
+  }
+  char* out = first;
+  *out++ = digits[0];
+  if (n > 1) {
+    *out++ = '.';
+    std::memcpy(out, digits + 1, static_cast<std::size_t>(n - 1));
+    out += n - 1;
+  }
+  *out++ = 'e';
+  *out++ = sci_exponent < 0 ? '-' : '+';
+  if (abs_exponent >= 100) {
+    *out++ = static_cast<char>('0' + abs_exponent / 100);
+  }
+  const auto pair = static_cast<std::size_t>(abs_exponent % 100) * 2;
+  *out++ = digit_pairs[pair];
+  *out++ = digit_pairs[pair + 1];
+  return {out, std::errc{}};
+}
+
+template <class Float>
+to_chars_result float_to_chars(char* first, char* last, Float value) noexcept {
+  using traits = float_traits<Float>;
+  using bits_type = typename traits::bits_type;
+  const auto bits = std::bit_cast<bits_type>(value);
+  const bool negative = (bits >> (traits::significand_bits + traits::exponent_bits)) != 0;
+  const int ieee_exponent =
+      static_cast<int>((bits >> traits::significand_bits) & ((bits_type{1} << traits::exponent_bits) - 1));
+  const bits_type ieee_significand = bits & ((bits_type{1} << traits::significand_bits) - 1);
+
+  if (negative) {
+    if (first == last) {
+      return {last, std::errc::value_too_large};
+    }
+    *first++ = '-';
+  }
+
+  const auto write_literal = [&](const char* text, std::size_t n) -> to_chars_result {
+    if (static_cast<std::size_t>(last - first) < n) {
+      return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, text, n);
+    return {first + n, std::errc{}};
+  };
+
+  if (ieee_exponent == (1 << traits::exponent_bits) - 1) {
+    return ieee_significand == 0 ? write_literal("inf", 3) : write_literal("nan", 3);
+  }
+  if (ieee_exponent == 0 && ieee_significand == 0) {
+    return write_literal("0", 1);
+  }
+  const bits_type c = ieee_exponent == 0 ? ieee_significand : ((bits_type{1} << traits::significand_bits) | ieee_significand);
+  const int q = (ieee_exponent == 0 ? 1 : ieee_exponent) - traits::exponent_bias - traits::significand_bits;
+  return format_shortest(first, last, to_decimal<Float>(ieee_significand, ieee_exponent), c, q);
+}
+
+// 可由一次浮点乘除精确得到的 10 的幂
+inline constexpr double exact_powers_of_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+template <class Float>
+from_chars_result float_from_chars(const char* first, const char* last, Float& value) noexcept {
+  // 指数与有效数字的精确上限：10^22 / 2^53（double），10^10 / 2^24（float）
+  constexpr int max_exact_exponent = std::same_as<Float, double> ? 22 : 10;
+  constexpr std::uint64_t max_exact_significand = std::uint64_t{1} << std::numeric_limits<Float>::digits;
+
+  const char* p = first;
+  const bool negative = p != last && *p == '-';
+  if (negative) {
+    ++p;
+  }
+
+  std::uint64_t significand = 0;
+  int digits = 0;
+  int exponent = 0;
+  const char* const digits_begin = p;
+  // 有效数字一旦超出精确范围就不可能走快速路径，立即交给标准库，避免重复扫描
+  for (; p != last && static_cast<unsigned>(*p - '0') < 10u; ++p) {
+    significand = significand * 10 + static_cast<unsigned>(*p - '0');
+    if (++digits > 19 || significand > max_exact_significand) {
+      return std::from_chars(first, last, value);
+    }
+  }
+  bool any_digit = p != digits_begin;
+  if (p != last && *p == '.') {
+    const char* const fraction_begin = ++p;
+    for (; p != last && static_cast<unsigned>(*p - '0') < 10u; ++p) {
+      significand = significand * 10 + static_cast<unsigned>(*p - '0');
+      if (++digits > 19 || significand > max_exact_significand) {
+        return std::from_chars(first, last, value);
+      }
+    }
+    exponent = -static_cast<int>(p - fraction_begin);
+    any_digit = any_digit || p != fraction_begin;
+  }
+  if (!any_digit) {
+    // 包括 inf、nan 与非法输入
+    return std::from_chars(first, last, value);
+  }
+  if (p != last && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    const bool negative_exponent = q != last && *q == '-';
+    if (q != last && (*q == '-' || *q == '+')) {
+      ++q;
+    }
+    int e = 0;
+    const char* const exponent_begin = q;
+    for (; q != last && static_cast<unsigned>(*q - '0') < 10u && e < 10000; ++q) {
+      e = e * 10 + (*q - '0');
+    }
+    if (q != exponent_begin) {
+      if (q != last && static_cast<unsigned>(*q - '0') < 10u) {
+        return std::from_chars(first, last, value);
+      }
+      exponent += negative_exponent ? -e : e;
+      p = q;
+    }
+  }
+
+  if (exponent < -max_exact_exponent || exponent > max_exact_exponent) {
+    return std::from_chars(first, last, value);
+  }
+  auto result = static_cast<Float>(significand);
+  if (exponent < 0) {
+    result /= static_cast<Float>(exact_powers_of_10[-exponent]);
+  } else {
+    result *= static_cast<Float>(exact_powers_of_10[exponent]);
+  }
+  value = negative ? -result : result;
+  return {p, std::errc{}};
+}
+
+}  // namespace __details
+
+// 整数 -> 字符
+template <__details::charconv_integer T>
+constexpr to_chars_result to_chars(char* first, char* last, T value, int base = 10) noexcept {
+  MYSTL_ASSERT(2 <= base && base <= 36);
+  using U = std::make_unsigned_t<T>;
+  auto magnitude = static_cast<U>(value);
+  if constexpr (std::is_signed_v<T>) {
+    if (value < 0) {
+      if (first == last) {
+        return {last, std::errc::value_too_large};
+      }
+      *first++ = '-';
+      magnitude = static_cast<U>(U{0} - magnitude);
+    }
+  }
+  if constexpr (sizeof(U) <= sizeof(std::uint32_t)) {
+    return __details::unsigned_to_chars(first, last, static_cast<std::uint32_t>(magnitude), base);
+  } else {
+    return __details::unsigned_to_chars(first, last, static_cast<std::uint64_t>(magnitude), base);
+  }
+}
+
+to_chars_result to_chars(char*, char*, bool, int = 10) = delete;
+
+// 字符 -> 整数：不接受前导空白、'+' 与进制前缀；溢出时 value 保持不变
+template <__details::charconv_integer T>
+constexpr from_chars_result from_chars(const char* first, const char* last, T& value, int base = 10) noexcept {
+  MYSTL_ASSERT(2 <= base && base <= 36);
+  using U = std::make_unsigned_t<T>;
+  const char* p = first;
+  bool negative = false;
+  if constexpr (std::is_signed_v<T>) {
+    if (p != last && *p == '-') {
+      negative = true;
+      ++p;
+    }
+  }
+  const char* const digits_begin = p;
+  const auto ubase = static_cast<unsigned>(base);
+  U acc = 0;
+  bool overflow = false;
+  for (; p != last; ++p) {
+    const unsigned d = __details::digit_value(*p);
+    if (d >= ubase) {
+      break;
+    }
+    overflow = overflow || __details::mul_add_overflow(acc, ubase, d);
+  }
+  if (p == digits_begin) {
+    return {first, std::errc::invalid_argument};
+  }
+  if constexpr (std::is_signed_v<T>) {
+    const U limit = static_cast<U>(std::numeric_limits<T>::max()) + (negative ? 1u : 0u);
+    overflow = overflow || acc > limit;
+  }
+  if (overflow) {
+    return {p, std::errc::result_out_of_range};
+  }
+  value = static_cast<T>(negative ? static_cast<U>(U{0} - acc) : acc);
+  return {p, std::errc{}};
+}
+
+// 浮点 -> 字符：最短往返表示
+inline to_chars_result to_chars(char* first, char* last, double value) noexcept {
+  return __details::float_to_chars(first, last, value);
+}
+
+inline to_chars_result to_chars(char* first, char* last, float value) noexcept {
+  return __details::float_to_chars(first, last, value);
+}
+
+// 字符 -> 浮点：只接受十进制（对应 chars_format::general）
+inline from_chars_result from_chars(const char* first, const char* last, double& value) noexcept {
+  return __details::float_from_chars(first, last, value);
+}
+
+inline from_chars_result from_chars(const char* first, const char* last, float& value) noexcept {
+  return __details::float_from_chars(first, last, value);
+}
+
+// 十进制输出的最大字符数（含符号），用于预留缓冲区
+template <class T>
+inline constexpr std::size_t max_chars_length = std::numeric_limits<T>::digits10 + 1 + (std::is_signed_v<T> ? 1 : 0);
+template <>
+inline constexpr std::size_t max_chars_length<double> = 24;  // -2.2250738585072014e-308
+template <>
+inline constexpr std::size_t max_chars_length<float> = 15;  // -1.17549435e-38
+
+}  // namespace mystl
+
+#endif  // MYSTL_CORE_CHARCONV_HPP
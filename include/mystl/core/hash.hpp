@@ -0,0 +1,228 @@
+#ifndef MYSTL_CORE_HASH_HPP
+#define MYSTL_CORE_HASH_HPP
+
+/**
+ * @file core/hash.hpp
+ * @brief 64 位哈希函数对象 mystl::hash<T> 与字节串哈希 hash_bytes
+ *
+ * ## 设计
+ * - hash_bytes：wyhash 系列的字节串哈希
+ *   - 核心操作是 64x64 -> 128 位乘法后把高低两半异或（mum），一次乘法即可充分混合两个 64 位字
+ *   - 不超过 16 字节时用两到四次重叠的 4 / 8 字节读取覆盖全部输入，无循环、无逐字节分支
+ *   - 长输入每轮读 48 字节，三条独立的乘法链并行推进，最后合并
+ *   - 输入长度参与最终混合，只差末尾零字节的两个输入哈希不同
+ * - 整数、枚举、指针：与常数做两次 mum，结果的低位也依赖输入的全部位，
+ *   按 2 的幂取模的哈希表不会因为连续或步长规律的键（如对齐的指针、i << 12）聚集到少数桶
+ * - is_uniquely_represented<T>：值相等当且仅当对象表示（字节）相等的类型，直接按字节哈希
+ *   - 默认取 std::has_unique_object_representations_v<T>：无填充字节、不含浮点成员的平凡可复制结构体为真
+ *   - 用户可以为自己的类型特化为 true_type，以启用按字节哈希
+ * - float / double 先把 -0.0 归一为 +0.0 再按位哈希，保证 hash(a) == hash(b) 当 a == b
+ * - 字符串的特化在 string_view.hpp 中，所有字符串类型对同样的内容得到同样的哈希
+ *
+ * ## 注意
+ * - 种子是固定的常数，哈希值在同一版本内稳定，但不同版本之间不保证；
+ *   不抵御针对性构造的碰撞输入（hash flooding），需要时用 hash_bytes 的 seed 参数自行加盐
+ */
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "mystl/config/config.hpp"
+#include "mystl/core/charconv.hpp"
+
+namespace mystl {
+
+template <class T>
+struct is_uniquely_represented : std::bool_constant<std::has_unique_object_representations_v<T>> {};
+
+template <class T>
+inline constexpr bool is_uniquely_represented_v = is_uniquely_represented<T>::value;
+
+namespace __details {
+
+inline constexpr std::uint64_t hash_secret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                                 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+// a, b <- 128 位乘积的低 / 高 64 位
+MYSTL_FORCE_INLINE void hash_mum(std::uint64_t& a, std::uint64_t& b) noexcept {
+  const uint128_parts r = umul128(a, b);
+  a = r.lo;
+  b = r.hi;
+}
+
+MYSTL_FORCE_INLINE std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept {
+  hash_mum(a, b);
+  return a ^ b;
+}
+
+// 按小端序读取，使哈希值与平台字节序无关
+MYSTL_FORCE_INLINE std::uint64_t hash_read8(const unsigned char* p) noexcept {
+  std::uint64_t v;
+  std::memcpy(&v, p, 8);
+  if constexpr (std::endian::native == std::endian::big) {
+    v = std::byteswap(v);
+  }
+  return v;
+}
+
+MYSTL_FORCE_INLINE std::uint64_t hash_read4(const unsigned char* p) noexcept {
+  std::uint32_t v;
+  std::memcpy(&v, p, 4);
+  if constexpr (std::endian::native == std::endian::big) {
+    v = std::byteswap(v);
+  }
+  return v;
+}
+
+// 1 到 3 字节：首、中、尾三个字节拼成一个字
+MYSTL_FORCE_INLINE std::uint64_t hash_read3(const unsigned char* p, std::size_t n) noexcept {
+  return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[n >> 1]} << 8) | p[n - 1];
+}
+
+// 整数的混合终结：两次 128 位乘法。只做一次时连续整数的低位仍带有规律，
+// 2 的幂大小的表中桶的负载明显偏离随机分布
+MYSTL_FORCE_INLINE std::uint64_t hash_integer(std::uint64_t x) noexcept {
+  std::uint64_t a = x ^ hash_secret[0];
+  std::uint64_t b = hash_secret[1];
+  hash_mum(a, b);
+  return hash_mix(a ^ hash_secret[0], b ^ hash_secret[1]);
+}
+
+}  // namespace __details
+
+/**
+ * @brief 对 [data, data + n) 求 64 位哈希
+ */
+inline std::uint64_t hash_bytes(const void* data, std::size_t n, std::uint64_t seed = 0) noexcept {
+  const auto* p = static_cast<const unsigned char*>(data);
+  seed ^= __details::hash_mix(seed ^ __details::hash_secret[0], __details::hash_secret[1]);
+  std::uint64_t a;
+  std::uint64_t b;
+  if (n <= 16) MYSTL_LIKELY {
+    if (n >= 4) {
+      // 4..16 字节：首尾各两次 4 字节读取，n >= 8 时中间两次读取错开 4 字节
+      const std::size_t off = (n >> 3) << 2;
+      a = (__details::hash_read4(p) << 32) | __details::hash_read4(p + off);
+      b = (__details::hash_read4(p + n - 4) << 32) | __details::hash_read4(p + n - 4 - off);
+    } else if (n > 0) {
+      a = __details::hash_read3(p, n);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    std::size_t i = n;
+    if (i > 48) {
+      std::uint64_t seed1 = seed;
+      std::uint64_t seed2 = seed;
+      do {
+        seed = __details::hash_mix(__details::hash_read8(p) ^ __details::hash_secret[1],
+                                   __details::hash_read8(p + 8) ^ seed);
+        seed1 = __details::hash_mix(__details::hash_read8(p + 16) ^ __details::hash_secret[2],
+                                    __details::hash_read8(p + 24) ^ seed1);
+        seed2 = __details::hash_mix(__details::hash_read8(p + 32) ^ __details::hash_secret[3],
+                                    __details::hash_read8(p + 40) ^ seed2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (i > 16) {
+      seed = __details::hash_mix(__details::hash_read8(p) ^ __details::hash_secret[1],
+                                 __details::hash_read8(p + 8) ^ seed);
+      p += 16;
+      i -= 16;
+    }
+    // 最后 16 字节与前面重叠读取
+    a = __details::hash_read8(p + i - 16);
+    b = __details::hash_read8(p + i - 8);
+  }
+  a ^= __details::hash_secret[1];
+  b ^= seed;
+  __details::hash_mum(a, b);
+  return __details::hash_mix(a ^ __details::hash_secret[0] ^ n, b ^ __details::hash_secret[1]);
+}
+
+namespace __details {
+
+template <class T>
+concept hash_scalar = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> ||
+                      std::is_same_v<T, std::nullptr_t>;
+
+template <class T>
+concept hash_bytewise = !hash_scalar<T> && !std::is_floating_point_v<T> && std::is_trivially_copyable_v<T> &&
+                        is_uniquely_represented_v<T>;
+
+// 不可哈希的类型：与 std::hash 相同，得到一个不可构造的函数对象
+struct hash_disabled {
+  hash_disabled() = delete;
+  hash_disabled(const hash_disabled&) = delete;
+  hash_disabled& operator=(const hash_disabled&) = delete;
+};
+
+}  // namespace __details
+
+template <class T>
+struct hash : __details::hash_disabled {};
+
+// 整数、枚举、指针：混合后的值，2 的幂大小的表可以直接取低位
+template <__details::hash_scalar T>
+struct hash<T> {
+  std::size_t operator()(T v) const noexcept {
+    if constexpr (std::is_same_v<T, std::nullptr_t>) {
+      return static_cast<std::size_t>(__details::hash_integer(0));
+    } else if constexpr (std::is_pointer_v<T>) {
+      return static_cast<std::size_t>(__details::hash_integer(reinterpret_cast<std::uintptr_t>(v)));
+    } else if constexpr (std::is_enum_v<T>) {
+      return hash<std::underlying_type_t<T>>{}(static_cast<std::underlying_type_t<T>>(v));
+    } else if constexpr (sizeof(T) <= 8) {
+      return static_cast<std::size_t>(__details::hash_integer(static_cast<std::uint64_t>(v)));
+    } else {
+      return static_cast<std::size_t>(hash_bytes(&v, sizeof(T)));
+    }
+  }
+};
+
+// 对象表示唯一的平凡类型：按字节哈希
+template <__details::hash_bytewise T>
+struct hash<T> {
+  std::size_t operator()(const T& v) const noexcept { return static_cast<std::size_t>(hash_bytes(&v, sizeof(T))); }
+};
+
+// 浮点：+0.0 与 -0.0 相等，哈希也必须相同
+template <class T>
+  requires std::is_floating_point_v<T>
+struct hash<T> {
+  std::size_t operator()(T v) const noexcept {
+    if (v == T(0)) {
+      v = T(0);
+    }
+    if constexpr (sizeof(T) == 8) {
+      return static_cast<std::size_t>(__details::hash_integer(std::bit_cast<std::uint64_t>(v)));
+    } else if constexpr (sizeof(T) == 4) {
+      return static_cast<std::size_t>(__details::hash_integer(std::bit_cast<std::uint32_t>(v)));
+    } else {
+      // long double 的对象表示含填充字节，转成 double 后哈希：相等的值仍得到相同的哈希
+      const auto bits = std::bit_cast<std::uint64_t>(static_cast<double>(v));
+      return static_cast<std::size_t>(__details::hash_integer(bits));
+    }
+  }
+};
+
+// std::string_view（std::string 可隐式转换）：内容相同则与 mystl 字符串的哈希相同
+template <>
+struct hash<std::string_view> {
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view v) const noexcept {
+    return static_cast<std::size_t>(hash_bytes(v.data(), v.size()));
+  }
+};
+
+}  // namespace mystl
+
+#endif  // MYSTL_CORE_HASH_HPP
@@ -0,0 +1,69 @@
+#ifndef MYSTL_EXECUTION_POLICY_HPP
+#define MYSTL_EXECUTION_POLICY_HPP
+
+/**
+ * @file execution/policy.hpp
+ * @brief 执行策略：execution::seq / execution::par，作为算法的第一个参数选择顺序或并行版本
+ *
+ * ## 与 <execution> 的差异
+ * - 只有 seq 与 par 两种策略，没有 par_unseq / unseq
+ * - par 默认在 thread_pool::default_pool() 上执行，par.on(pool) 指定线程池，
+ *   便于控制线程数或与其他工作隔离
+ * - 并行算法中元素访问函数（比较器、键函数）会被多个线程同时调用，不能有未同步的可变状态
+ */
+
+#include <type_traits>
+
+#include "mystl/execution/thread_pool.hpp"
+
+namespace mystl::execution {
+
+class sequenced_policy {};
+
+class parallel_policy {
+public:
+  constexpr parallel_policy() noexcept = default;
+
+  /**
+   * @brief 返回在 pool 上执行的并行策略
+   */
+  constexpr parallel_policy on(thread_pool& pool) const noexcept {
+    parallel_policy p;
+    p.pool_ = &pool;
+    return p;
+  }
+
+  thread_pool& pool() const { return pool_ != nullptr ? *pool_ : thread_pool::default_pool(); }
+
+private:
+  thread_pool* pool_ = nullptr;
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+template <class T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+template <class T>
+concept execution_policy = is_execution_policy_v<std::remove_cvref_t<T>>;
+
+}  // namespace mystl::execution
+
+namespace mystl::__details {
+
+template <class Policy>
+inline constexpr bool is_parallel_policy_v = std::is_same_v<std::remove_cvref_t<Policy>, execution::parallel_policy>;
+
+}  // namespace mystl::__details
+
+#endif  // MYSTL_EXECUTION_POLICY_HPP
@@ -0,0 +1,296 @@
+#ifndef MYSTL_EXECUTION_THREAD_POOL_HPP
+#define MYSTL_EXECUTION_THREAD_POOL_HPP
+
+/**
+ * @file execution/thread_pool.hpp
+ * @brief 工作窃取线程池 (thread_pool)：并行算法的 fork-join 执行器
+ *
+ * ## 设计
+ * - 每个工作线程一个任务双端队列：自己从尾部压入 / 取出（LIFO，刚拆出的子任务数据还在缓存中），
+ *   空闲线程从其他队列的头部窃取（FIFO，偷到的是最早拆出、粒度最大的任务）
+ * - invoke(a, b) 是唯一的 fork-join 原语：b 压入当前线程的队列供窃取，a 就地执行，
+ *   然后等待 b；等待期间当前线程继续执行自己队列中的任务或去窃取，不会阻塞占住线程
+ * - 任务对象位于发起 invoke 的栈帧中，等待结束前栈帧不会退出，因此不做堆分配
+ * - 池外的线程通过 run(f) 把 f 交给池并阻塞等待；在池外调用 invoke 时整个 invoke 经由 run 进入池
+ * - 没有任务时工作线程在条件变量上休眠，压入任务时只有存在休眠线程才加锁唤醒
+ * - 队列用互斥锁保护：任务粒度为数万元素的排序 / 归并，锁的开销可以忽略
+ *
+ * ## 异常
+ * - 任务中的异常在 invoke / run 返回处重新抛出；a 与 b 都抛出时保留 a 的异常
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "mystl/config/config.hpp"
+
+namespace mystl::execution {
+
+class thread_pool {
+public:
+  /**
+   * @brief 启动 threads 个工作线程（至少 1 个）
+   */
+  explicit thread_pool(std::size_t threads = default_concurrency()) : size_(std::max<std::size_t>(threads, 1)) {
+    workers_ = std::make_unique<worker[]>(size_);
+    try {
+      for (std::size_t i = 0; i < size_; ++i) {
+        workers_[i].thread = std::thread([this, i] { worker_loop(i); });
+      }
+    } catch (...) {
+      shutdown();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  /**
+   * @brief 等待已提交的任务完成后结束所有工作线程
+   */
+  ~thread_pool() { shutdown(); }
+
+  std::size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief 当前线程是否为本池的工作线程
+   */
+  bool in_pool() const noexcept { return current_pool_ == this; }
+
+  /**
+   * @brief 在池中执行 f 并等待其完成；在本池的工作线程中调用时直接执行
+   */
+  template <class F>
+  void run(F&& f) {
+    if (in_pool()) {
+      std::forward<F>(f)();
+      return;
+    }
+    root_task<F> t(f);
+    {
+      std::lock_guard<std::mutex> lock(inject_.mutex);
+      inject_.tasks.push_back(&t);
+    }
+    announce();
+    std::unique_lock<std::mutex> lock(t.mutex);
+    t.cv.wait(lock, [&] { return t.finished; });
+    if (t.error) {
+      std::rethrow_exception(t.error);
+    }
+  }
+
+  /**
+   * @brief fork-join：a 与 b 可能并行执行，两者都完成后返回
+   */
+  template <class F1, class F2>
+  void invoke(F1&& a, F2&& b) {
+    if (!in_pool()) {
+      run([&] { invoke(a, b); });
+      return;
+    }
+    fork_task<F2> tb(b);
+    worker& self = workers_[current_index_];
+    {
+      std::lock_guard<std::mutex> lock(self.mutex);
+      self.tasks.push_back(&tb);
+    }
+    announce();
+    try {
+      std::forward<F1>(a)();
+    } catch (...) {
+      join(tb);
+      throw;
+    }
+    join(tb);
+    if (tb.error) {
+      std::rethrow_exception(tb.error);
+    }
+  }
+
+  /**
+   * @brief 进程级默认线程池，线程数为 hardware_concurrency，首次使用时创建
+   */
+  static thread_pool& default_pool() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  static std::size_t default_concurrency() noexcept {
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+private:
+  // 任务只有一个函数指针；完成通知由各自的 execute 负责，通知之后不再访问任务对象
+  struct task {
+    void (*execute)(task*);
+  };
+
+  template <class F>
+  struct fork_task : task {
+    explicit fork_task(F& f) : task{&fork_task::call}, fn(f) {}
+
+    static void call(task* base) {
+      auto* self = static_cast<fork_task*>(base);
+      try {
+        self->fn();
+      } catch (...) {
+        self->error = std::current_exception();
+      }
+      self->done.store(true, std::memory_order_release);
+    }
+
+    F& fn;
+    std::exception_ptr error;
+    std::atomic<bool> done{false};
+  };
+
+  template <class F>
+  struct root_task : task {
+    explicit root_task(F& f) : task{&root_task::call}, fn(f) {}
+
+    static void call(task* base) {
+      auto* self = static_cast<root_task*>(base);
+      try {
+        self->fn();
+      } catch (...) {
+        self->error = std::current_exception();
+      }
+      // 持锁通知：等待方在锁释放前无法返回并销毁 self
+      std::lock_guard<std::mutex> lock(self->mutex);
+      self->finished = true;
+      self->cv.notify_one();
+    }
+
+    F& fn;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool finished = false;
+  };
+
+  struct task_queue {
+    std::mutex mutex;
+    std::deque<task*> tasks;
+  };
+
+  struct worker : task_queue {
+    std::thread thread;
+  };
+
+  // 压入任务后调用：pending_ 与 sleepers_ 都是顺序一致的原子操作，
+  // 与 worker_loop 中"先登记休眠再检查 pending_"配对，不会丢失唤醒
+  void announce() {
+    pending_.fetch_add(1);
+    if (sleepers_.load() > 0) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      sleep_cv_.notify_one();
+    }
+  }
+
+  task* take_back(task_queue& q) {
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty()) {
+      return nullptr;
+    }
+    task* t = q.tasks.back();
+    q.tasks.pop_back();
+    pending_.fetch_sub(1);
+    return t;
+  }
+
+  task* take_front(task_queue& q) {
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty()) {
+      return nullptr;
+    }
+    task* t = q.tasks.front();
+    q.tasks.pop_front();
+    pending_.fetch_sub(1);
+    return t;
+  }
+
+  // 先取自己的队列尾部，再从下一个线程开始轮流窃取其他队列的头部
+  task* find_task(std::size_t index) {
+    if (task* t = take_back(workers_[index])) {
+      return t;
+    }
+    for (std::size_t k = 1; k < size_; ++k) {
+      if (task* t = take_front(workers_[(index + k) % size_])) {
+        return t;
+      }
+    }
+    return nullptr;
+  }
+
+  // 等待 t 完成，期间执行其他任务；不取池外提交的新任务，避免在深层栈帧中开始无关的工作
+  template <class F>
+  void join(fork_task<F>& t) {
+    while (!t.done.load(std::memory_order_acquire)) {
+      if (task* other = find_task(current_index_)) {
+        other->execute(other);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void worker_loop(std::size_t index) {
+    current_pool_ = this;
+    current_index_ = index;
+    for (;;) {
+      task* t = find_task(index);
+      if (t == nullptr) {
+        t = take_front(inject_);
+      }
+      if (t != nullptr) {
+        t->execute(t);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleepers_.fetch_add(1);
+      sleep_cv_.wait(lock, [&] { return stop_ || pending_.load() > 0; });
+      sleepers_.fetch_sub(1);
+      if (stop_ && pending_.load() == 0) {
+        return;
+      }
+    }
+  }
+
+  void shutdown() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (std::size_t i = 0; i < size_; ++i) {
+      if (workers_[i].thread.joinable()) {
+        workers_[i].thread.join();
+      }
+    }
+  }
+
+  static inline thread_local const thread_pool* current_pool_ = nullptr;
+  static inline thread_local std::size_t current_index_ = 0;
+
+  std::size_t size_;
+  std::unique_ptr<worker[]> workers_;
+  task_queue inject_;
+  std::atomic<std::size_t> pending_{0};
+  std::atomic<std::size_t> sleepers_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool stop_ = false;
+};
+
+}  // namespace mystl::execution
+
+#endif  // MYSTL_EXECUTION_THREAD_POOL_HPP
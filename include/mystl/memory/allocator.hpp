@@ -76,9 +76,17 @@ struct allocator {
     constexpr std::size_t align = alignof(T);
 
     // allocate_at_least 允许分配至少 n 个元素，可能分配更多
-    // 当前实现分配恰好 n 个元素，这是符合标准的（至少分配了 n 个）
-    // 未来可以优化为分配更多元素以减少重新分配次数
+    // operator new 返回的块至少按默认对齐粒度（通常 16 字节）分配，
+    // 因此把字节数向上取整到该粒度，多出的尾部元素交给调用方使用（如 string 的容量）
+#ifdef __STDCPP_DEFAULT_NEW_ALIGNMENT__
+    constexpr std::size_t granule = __STDCPP_DEFAULT_NEW_ALIGNMENT__ > align ? __STDCPP_DEFAULT_NEW_ALIGNMENT__ : align;
+#else
+    constexpr std::size_t granule = 16 > align ? 16 : align;
+#endif
     std::size_t count = n;
+    if (n * sizeof(T) <= std::numeric_limits<std::size_t>::max() - granule) {
+      count = ((n * sizeof(T) + granule - 1) / granule * granule) / sizeof(T);
+    }
 
     // 如果对齐要求超过默认对齐，使用对齐的 operator new（C++17）
     // 默认对齐通常是 16 字节（__STDCPP_DEFAULT_NEW_ALIGNMENT__）
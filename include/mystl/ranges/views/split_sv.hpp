@@ -0,0 +1,281 @@
+#ifndef MYSTL_RANGES_VIEWS_SPLIT_SV_HPP
+#define MYSTL_RANGES_VIEWS_SPLIT_SV_HPP
+
+/**
+ * @file ranges/views/split_sv.hpp
+ * @brief 按分隔符惰性切分字符串，逐个产出 string_view（views::split_sv）
+ *
+ * ## 设计
+ * - split_sv(s, ',') 按单个字符切分，split_sv(s, " \t") 以集合中任意字符为分隔符
+ * - 不分配内存：视图只保存原字符串与分隔符，迭代器产出指向原字符串的 string_view
+ * - 分隔符按 16 字节一块向量比较得到位掩码，迭代器缓存当前块的掩码，
+ *   之后每个字段只需取最低置位（countr_zero），短字段不会重复扫描同一块
+ * - 最后不足 16 字节的部分与前面重叠加载一整块再移位，字符串本身不足 16 字节时逐字节扫描
+ * - 是 std::ranges::forward_range 与 view，可与 std::views::transform / take 等组合；
+ *   支持管道写法 s | views::split_sv(',')
+ *
+ * ## 语义
+ * - 与 std::views::split 以单个元素为模式时一致：相邻分隔符之间产出空字段，
+ *   以分隔符结尾时最后产出一个空字段，空字符串不产出任何字段
+ *
+ * ## 生命周期
+ * - 产出的 string_view 指向原字符串，原字符串必须比这些 string_view 活得更久
+ */
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "mystl/config/config.hpp"
+#include "mystl/config/platform.hpp"
+#include "mystl/containers/string_view.hpp"
+
+#if MYSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace mystl {
+
+namespace __details {
+
+// 单字符分隔符
+class split_char_matcher {
+public:
+  constexpr split_char_matcher() noexcept = default;
+  constexpr explicit split_char_matcher(char c) noexcept : c_(c) {}
+
+  constexpr bool match(char c) const noexcept { return c == c_; }
+
+#if MYSTL_HAS_SSE2
+  unsigned block_mask(const char* p) const noexcept {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c_))));
+  }
+#endif
+
+private:
+  char c_ = '\0';
+};
+
+// 字符集合分隔符：不超过 max_simd 个字符时按块逐字符比较后按位或，否则查 256 位位图
+class split_set_matcher {
+public:
+  static constexpr std::size_t max_simd = 8;
+
+  constexpr split_set_matcher() noexcept = default;
+  constexpr explicit split_set_matcher(string_view set) noexcept : size_(set.size()) {
+    for (std::size_t i = 0; i < set.size(); ++i) {
+      const auto b = static_cast<unsigned char>(set[i]);
+      bits_[b >> 6] |= std::uint64_t{1} << (b & 63);
+      if (i < max_simd) {
+        chars_[i] = set[i];
+      }
+    }
+  }
+
+  constexpr bool match(char c) const noexcept {
+    const auto b = static_cast<unsigned char>(c);
+    return (bits_[b >> 6] >> (b & 63)) & 1;
+  }
+
+#if MYSTL_HAS_SSE2
+  unsigned block_mask(const char* p) const noexcept {
+    if (size_ > max_simd) {
+      unsigned mask = 0;
+      for (unsigned i = 0; i < 16; ++i) {
+        mask |= static_cast<unsigned>(match(p[i])) << i;
+      }
+      return mask;
+    }
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i any = _mm_setzero_si128();
+    for (std::size_t i = 0; i < size_; ++i) {
+      any = _mm_or_si128(any, _mm_cmpeq_epi8(block, _mm_set1_epi8(chars_[i])));
+    }
+    return static_cast<unsigned>(_mm_movemask_epi8(any));
+  }
+#endif
+
+private:
+  std::uint64_t bits_[4] = {};
+  char chars_[max_simd] = {};
+  std::size_t size_ = 0;
+};
+
+}  // namespace __details
+
+template <class Matcher>
+class split_sv_view;
+
+namespace __details {
+
+// views::split_sv(',') 返回的管道对象
+template <class Matcher>
+struct split_sv_closure {
+  Matcher matcher;
+
+  template <class S>
+    requires std::is_convertible_v<const S&, string_view>
+  friend split_sv_view<Matcher> operator|(const S& s, const split_sv_closure& c) noexcept {
+    return split_sv_view<Matcher>(string_view(s), c.matcher);
+  }
+};
+
+}  // namespace __details
+
+/**
+ * @brief 惰性切分视图，产出 string_view
+ */
+template <class Matcher>
+class split_sv_view : public std::ranges::view_interface<split_sv_view<Matcher>> {
+public:
+  static constexpr std::size_t block_size = 16;
+
+  class iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = string_view;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+
+    string_view operator*() const noexcept {
+      return string_view(cur_, static_cast<std::size_t>(delim_ - cur_));
+    }
+
+    iterator& operator++() noexcept {
+      const char* end = end_;
+      if (delim_ == end) {
+        cur_ = end;
+        trailing_empty_ = false;
+        return *this;
+      }
+      cur_ = delim_ + 1;
+      if (cur_ == end) {
+        // 以分隔符结尾：还有一个空字段
+        trailing_empty_ = true;
+        delim_ = end;
+      } else {
+        delim_ = next_delimiter();
+      }
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const iterator& a, const iterator& b) noexcept {
+      return a.cur_ == b.cur_ && a.trailing_empty_ == b.trailing_empty_;
+    }
+
+    friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept { return it.at_end(); }
+
+  private:
+    friend class split_sv_view;
+
+    explicit iterator(const split_sv_view* parent) noexcept
+        : parent_(parent), cur_(parent->begin_), end_(parent->end_), block_(parent->begin_) {
+      if (cur_ != end_) {
+        mask_ = block_mask_at(block_);
+        delim_ = next_delimiter();
+      } else {
+        delim_ = cur_;
+      }
+    }
+
+    bool at_end() const noexcept { return cur_ == end_ && !trailing_empty_; }
+
+    // [p, min(p + 16, end)) 中分隔符的位掩码
+    unsigned block_mask_at(const char* p) const noexcept {
+      const char* begin = parent_->begin_;
+      const char* end = end_;
+      const auto rest = static_cast<std::size_t>(end - p);
+#if MYSTL_HAS_SSE2
+      if (rest >= block_size) {
+        return parent_->matcher_.block_mask(p);
+      }
+      if (static_cast<std::size_t>(end - begin) >= block_size) {
+        // 与前面重叠加载最后 16 字节，移掉已经扫描过的部分
+        return parent_->matcher_.block_mask(end - block_size) >> (block_size - rest);
+      }
+#endif
+      unsigned mask = 0;
+      for (std::size_t i = 0; i < rest && i < block_size; ++i) {
+        mask |= static_cast<unsigned>(parent_->matcher_.match(p[i])) << i;
+      }
+      return mask;
+    }
+
+    // 取出下一个分隔符的位置；没有时返回 end
+    const char* next_delimiter() noexcept {
+      const char* end = end_;
+      while (mask_ == 0) {
+        if (static_cast<std::size_t>(end - block_) <= block_size) {
+          block_ = end;
+          return end;
+        }
+        block_ += block_size;
+        mask_ = block_mask_at(block_);
+      }
+      const char* pos = block_ + std::countr_zero(mask_);
+      mask_ &= mask_ - 1;
+      return pos;
+    }
+
+    const split_sv_view* parent_ = nullptr;
+    const char* cur_ = nullptr;    // 当前字段起点
+    const char* end_ = nullptr;
+    const char* delim_ = nullptr;  // 当前字段终点（分隔符位置或 end）
+    const char* block_ = nullptr;  // 当前扫描块的起点
+    unsigned mask_ = 0;            // 当前块中尚未消费的分隔符
+    bool trailing_empty_ = false;
+  };
+
+  constexpr split_sv_view() = default;
+  constexpr split_sv_view(string_view s, Matcher m) noexcept
+      : begin_(s.data()), end_(s.data() + s.size()), matcher_(m) {}
+
+  iterator begin() const noexcept { return iterator(this); }
+  std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+  string_view base() const noexcept { return string_view(begin_, static_cast<std::size_t>(end_ - begin_)); }
+
+private:
+  const char* begin_ = nullptr;
+  const char* end_ = nullptr;
+  Matcher matcher_{};
+};
+
+namespace views {
+
+// split_sv(s, ',')：按单个字符切分
+inline split_sv_view<mystl::__details::split_char_matcher> split_sv(string_view s, char delimiter) noexcept {
+  return {s, mystl::__details::split_char_matcher(delimiter)};
+}
+
+// split_sv(s, " \t")：以集合中任意字符为分隔符
+inline split_sv_view<mystl::__details::split_set_matcher> split_sv(string_view s, string_view delimiters) noexcept {
+  return {s, mystl::__details::split_set_matcher(delimiters)};
+}
+
+// 管道写法：s | views::split_sv(',')
+inline mystl::__details::split_sv_closure<mystl::__details::split_char_matcher> split_sv(char delimiter) noexcept {
+  return {mystl::__details::split_char_matcher(delimiter)};
+}
+
+inline mystl::__details::split_sv_closure<mystl::__details::split_set_matcher> split_sv(string_view delimiters) noexcept {
+  return {mystl::__details::split_set_matcher(delimiters)};
+}
+
+}  // namespace views
+
+}  // namespace mystl
+
+#endif  // MYSTL_RANGES_VIEWS_SPLIT_SV_HPP
@@ -7,6 +7,8 @@
 
 // core utilities
 #include "core/assert.hpp"
+#include "core/charconv.hpp"
+#include "core/hash.hpp"
 #include "core/move_if_noexcept.hpp"
 #include "core/utility.hpp"
 
@@ -27,12 +29,24 @@
 #include "containers/array.hpp"
 #include "containers/deque.hpp"
 #include "containers/forward_list.hpp"
+#include "containers/format.hpp"
 #include "containers/list.hpp"
+#include "containers/rope.hpp"
+#include "containers/shared_string.hpp"
+#include "containers/string_pool.hpp"
 #include "containers/span.hpp"
 #include "containers/string.hpp"
 #include "containers/string_view.hpp"
+#include "containers/utf8.hpp"
 #include "containers/vector.hpp"
 
+// ranges
+#include "ranges/views/split_sv.hpp"
+
+// execution
+#include "execution/policy.hpp"
+#include "execution/thread_pool.hpp"
+
 // algorithms
 #include "algorithms/heap.hpp"
 #include "algorithms/modifying.hpp"
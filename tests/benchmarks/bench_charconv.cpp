@@ -0,0 +1,122 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/string.hpp"
+#include "mystl/core/charconv.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 指标导出场景的数值格式化与解析：mystl::to_chars / from_chars 对比 std::to_chars、snprintf、iostream
+
+namespace {
+
+constexpr int kCount = 100000;
+
+// 按位宽均匀分布，位数从 1 到 20 都有
+const std::vector<std::uint64_t> g_integers = [] {
+  std::vector<std::uint64_t> v;
+  for (int i = 0; i < kCount; ++i) {
+    v.push_back(mystl_bench::next_random() >> (mystl_bench::next_random() % 64));
+  }
+  return v;
+}();
+
+// 典型指标值：延迟、比率、计数的混合
+const std::vector<double> g_doubles = [] {
+  std::vector<double> v;
+  for (int i = 0; i < kCount; ++i) {
+    const std::uint64_t r = mystl_bench::next_random();
+    // 三分之一是任意位模式，其余均匀落在 [0, 1000)
+    v.push_back(i % 3 == 0 ? std::bit_cast<double>(r >> 2) : static_cast<double>(r >> 11) * 0x1p-53 * 1000.0);
+  }
+  return v;
+}();
+
+std::vector<std::string> format_all_doubles() {
+  std::vector<std::string> out;
+  for (double d : g_doubles) {
+    char buf[32];
+    out.emplace_back(buf, std::to_chars(buf, buf + 32, d).ptr);
+  }
+  return out;
+}
+
+const std::vector<std::string> g_double_texts = format_all_doubles();
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(int_to_chars_mystl, {
+    char buf[32];
+    for (std::uint64_t v : g_integers) {
+      mystl_bench::do_not_optimize(mystl::to_chars(buf, buf + 32, v).ptr);
+    }
+  });
+  MYSTL_BENCH(int_to_chars_std, {
+    char buf[32];
+    for (std::uint64_t v : g_integers) {
+      mystl_bench::do_not_optimize(std::to_chars(buf, buf + 32, v).ptr);
+    }
+  });
+  MYSTL_BENCH(int_snprintf, {
+    char buf[32];
+    for (std::uint64_t v : g_integers) {
+      mystl_bench::do_not_optimize(std::snprintf(buf, 32, "%llu", static_cast<unsigned long long>(v)));
+    }
+  });
+  MYSTL_BENCH(double_to_chars_mystl, {
+    char buf[32];
+    for (double d : g_doubles) {
+      mystl_bench::do_not_optimize(mystl::to_chars(buf, buf + 32, d).ptr);
+    }
+  });
+  MYSTL_BENCH(double_to_chars_std, {
+    char buf[32];
+    for (double d : g_doubles) {
+      mystl_bench::do_not_optimize(std::to_chars(buf, buf + 32, d).ptr);
+    }
+  });
+  MYSTL_BENCH(double_snprintf, {
+    char buf[32];
+    for (double d : g_doubles) {
+      mystl_bench::do_not_optimize(std::snprintf(buf, 32, "%.17g", d));
+    }
+  });
+  MYSTL_BENCH(double_from_chars_mystl, {
+    double d = 0;
+    for (const auto& s : g_double_texts) {
+      mystl::from_chars(s.data(), s.data() + s.size(), d);
+      mystl_bench::do_not_optimize(d);
+    }
+  });
+  MYSTL_BENCH(double_from_chars_std, {
+    double d = 0;
+    for (const auto& s : g_double_texts) {
+      std::from_chars(s.data(), s.data() + s.size(), d);
+      mystl_bench::do_not_optimize(d);
+    }
+  });
+  // 拼一行 "name value\n" 形式的导出文本
+  MYSTL_BENCH(export_append_number, {
+    mystl::string out;
+    for (int i = 0; i < kCount; ++i) {
+      out.append("metric_").append_number(g_integers[static_cast<std::size_t>(i)]).push_back(' ');
+      out.append_number(g_doubles[static_cast<std::size_t>(i)]).push_back('\n');
+    }
+    mystl_bench::do_not_optimize(out.size());
+  });
+  MYSTL_BENCH(export_ostringstream, {
+    std::ostringstream out;
+    out.precision(17);
+    for (int i = 0; i < kCount; ++i) {
+      out << "metric_" << g_integers[static_cast<std::size_t>(i)] << ' ' << g_doubles[static_cast<std::size_t>(i)] << '\n';
+    }
+    mystl_bench::do_not_optimize(out.tellp());
+  });
+  return 0;
+}
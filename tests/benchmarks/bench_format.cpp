@@ -0,0 +1,84 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/format.hpp"
+#include "mystl/containers/string.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 日志热路径：把一条结构化日志行格式化进复用的行缓冲区
+// mystl::format_to 对比 snprintf + append、ostringstream
+
+namespace {
+
+using mystl_bench::next_random;
+
+constexpr int kCount = 100000;
+
+struct record {
+  std::int64_t timestamp;
+  unsigned thread_id;
+  const char* level;
+  std::string message;
+  double latency_ms;
+  std::uint32_t status;
+};
+
+const std::vector<record> g_records = [] {
+  const char* levels[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+  const char* messages[] = {"request served", "cache miss on shard", "retrying upstream connection",
+                            "slow query detected in orders table"};
+  std::vector<record> v;
+  for (int i = 0; i < kCount; ++i) {
+    v.push_back({1700000000000LL + static_cast<std::int64_t>(next_random() % 100000000),
+                 static_cast<unsigned>(next_random() % 64), levels[next_random() % 4], messages[next_random() % 4],
+                 static_cast<double>(next_random() % 100000) / 1000.0, static_cast<std::uint32_t>(next_random())});
+  }
+  return v;
+}();
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(log_line_format_to, {
+    mystl::string line;
+    std::size_t total = 0;
+    for (const record& r : g_records) {
+      line.clear();
+      mystl::format_to(line, "{} [{}] tid={} {} latency={}ms status={:x}\n", r.timestamp, r.level, r.thread_id,
+                       r.message, r.latency_ms, r.status);
+      total += line.size();
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  MYSTL_BENCH(log_line_snprintf, {
+    mystl::string line;
+    std::size_t total = 0;
+    for (const record& r : g_records) {
+      char buf[256];
+      const int n = std::snprintf(buf, sizeof(buf), "%lld [%s] tid=%u %s latency=%.17gms status=%x\n",
+                                  static_cast<long long>(r.timestamp), r.level, r.thread_id, r.message.c_str(),
+                                  r.latency_ms, r.status);
+      line.clear();
+      line.append(buf, std::min(static_cast<std::size_t>(n), sizeof(buf) - 1));
+      total += line.size();
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  MYSTL_BENCH(log_line_ostringstream, {
+    std::ostringstream out;
+    std::size_t total = 0;
+    for (const record& r : g_records) {
+      out.str(std::string());
+      out << r.timestamp << " [" << r.level << "] tid=" << r.thread_id << ' ' << r.message
+          << " latency=" << r.latency_ms << "ms status=" << std::hex << r.status << std::dec << '\n';
+      total += static_cast<std::size_t>(out.tellp());
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/core/hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 速度：不同长度的字符串键与整数键，mystl::hash 对比 std::hash
+// 质量：键放进 2 的幂大小的表（低位取桶）后的最大桶负载与空桶数，理想的随机哈希约为 max 23、empty 22
+
+namespace {
+
+constexpr std::size_t kKeys = 1 << 16;
+
+std::vector<std::string> make_keys(std::size_t len) {
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < kKeys * 64 / (len + 16); ++i) {
+    std::string s(len, '\0');
+    for (auto& c : s) {
+      c = static_cast<char>('a' + mystl_bench::next_random() % 26);
+    }
+    keys.push_back(std::move(s));
+  }
+  return keys;
+}
+
+const std::vector<std::string> g_keys8 = make_keys(8);
+const std::vector<std::string> g_keys16 = make_keys(16);
+const std::vector<std::string> g_keys32 = make_keys(32);
+const std::vector<std::string> g_keys64 = make_keys(64);
+const std::vector<std::string> g_keys1k = make_keys(1024);
+
+template <class Hash>
+std::size_t hash_all(const std::vector<std::string>& keys) {
+  std::size_t acc = 0;
+  for (const auto& k : keys) {
+    acc += Hash{}(std::string_view(k));
+  }
+  return acc;
+}
+
+template <class Hash>
+std::size_t hash_integers() {
+  std::size_t acc = 0;
+  for (std::uint64_t i = 0; i < kKeys * 16; ++i) {
+    acc += Hash{}(i);
+  }
+  return acc;
+}
+
+// 2^16 个桶、8 倍键数，返回 {最大桶负载, 空桶数}
+template <class Hash, class Key>
+void report_buckets(const char* name, const std::vector<Key>& keys) {
+  std::vector<int> load(kKeys);
+  for (const auto& k : keys) {
+    ++load[Hash{}(k) & (kKeys - 1)];
+  }
+  int max_load = 0;
+  int empty = 0;
+  for (const int l : load) {
+    max_load = l > max_load ? l : max_load;
+    empty += l == 0;
+  }
+  std::cout << "[QUALITY] " << name << " max: " << max_load << " empty: " << empty << "\n";
+}
+
+std::vector<std::uint64_t> strided(std::uint64_t stride) {
+  std::vector<std::uint64_t> keys(kKeys * 8);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = i * stride;
+  }
+  return keys;
+}
+
+std::vector<std::string> numbered(std::string_view prefix) {
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < kKeys * 8; ++i) {
+    keys.push_back(std::string(prefix) + std::to_string(i));
+  }
+  return keys;
+}
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(string8_mystl, { mystl_bench::do_not_optimize(hash_all<mystl::hash<std::string_view>>(g_keys8)); });
+  MYSTL_BENCH(string8_std, { mystl_bench::do_not_optimize(hash_all<std::hash<std::string_view>>(g_keys8)); });
+  MYSTL_BENCH(string16_mystl, { mystl_bench::do_not_optimize(hash_all<mystl::hash<std::string_view>>(g_keys16)); });
+  MYSTL_BENCH(string16_std, { mystl_bench::do_not_optimize(hash_all<std::hash<std::string_view>>(g_keys16)); });
+  MYSTL_BENCH(string32_mystl, { mystl_bench::do_not_optimize(hash_all<mystl::hash<std::string_view>>(g_keys32)); });
+  MYSTL_BENCH(string32_std, { mystl_bench::do_not_optimize(hash_all<std::hash<std::string_view>>(g_keys32)); });
+  MYSTL_BENCH(string64_mystl, { mystl_bench::do_not_optimize(hash_all<mystl::hash<std::string_view>>(g_keys64)); });
+  MYSTL_BENCH(string64_std, { mystl_bench::do_not_optimize(hash_all<std::hash<std::string_view>>(g_keys64)); });
+  MYSTL_BENCH(string1k_mystl, { mystl_bench::do_not_optimize(hash_all<mystl::hash<std::string_view>>(g_keys1k)); });
+  MYSTL_BENCH(string1k_std, { mystl_bench::do_not_optimize(hash_all<std::hash<std::string_view>>(g_keys1k)); });
+  MYSTL_BENCH(uint64_mystl, { mystl_bench::do_not_optimize(hash_integers<mystl::hash<std::uint64_t>>()); });
+  MYSTL_BENCH(uint64_std, { mystl_bench::do_not_optimize(hash_integers<std::hash<std::uint64_t>>()); });
+
+  // std::hash<uint64_t> 在 libstdc++ 中是恒等函数，2 的幂的表只看低位
+  for (const std::uint64_t stride : {std::uint64_t{1}, std::uint64_t{8}, std::uint64_t{4096}}) {
+    const auto keys = strided(stride);
+    const std::string suffix = "_stride" + std::to_string(stride);
+    report_buckets<mystl::hash<std::uint64_t>>(("uint64_mystl" + suffix).c_str(), keys);
+    report_buckets<std::hash<std::uint64_t>>(("uint64_std" + suffix).c_str(), keys);
+  }
+  const auto names = numbered("host-");
+  report_buckets<mystl::hash<std::string_view>>("string_mystl_numbered", names);
+  report_buckets<std::hash<std::string_view>>("string_std_numbered", names);
+  return 0;
+}
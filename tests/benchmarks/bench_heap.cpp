@@ -0,0 +1,109 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/adapters/priority_queue.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+// 定时器堆：1M 个 {到期时间, id}（16 字节）的最小堆，远超 L2
+// - hold：每次取出最早到期的定时器，按随机延迟重新排期（pop + push 或 replace_top），共 1M 次
+// - drain：从 1M 个元素建堆后逐个 pop 到空（build 一行是建堆本身的开销）
+// mystl::priority_queue 的 2 / 4 / 8 叉对比 std::priority_queue。
+// 命令行参数可调元素个数：mystl_bench_heap 10000000
+
+namespace {
+
+using mystl_bench::next_random;
+
+struct timer {
+  std::uint64_t deadline;
+  std::uint64_t id;
+};
+
+struct later {
+  bool operator()(const timer& a, const timer& b) const noexcept { return a.deadline > b.deadline; }
+};
+
+constexpr std::uint64_t kMaxDelay = 1u << 24;
+
+template <class Queue>
+void hold_pop_push(Queue& q, std::size_t ops) {
+  for (std::size_t i = 0; i < ops; ++i) {
+    timer t = q.top();
+    q.pop();
+    t.deadline += next_random() % kMaxDelay;
+    q.push(t);
+  }
+  mystl_bench::do_not_optimize(&q);
+}
+
+template <class Queue>
+void hold_replace_top(Queue& q, std::size_t ops) {
+  for (std::size_t i = 0; i < ops; ++i) {
+    timer t = q.top();
+    t.deadline += next_random() % kMaxDelay;
+    q.replace_top(t);
+  }
+  mystl_bench::do_not_optimize(&q);
+}
+
+template <class Queue>
+void drain(Queue& q) {
+  std::uint64_t sum = 0;
+  while (!q.empty()) {
+    sum += q.top().id;
+    q.pop();
+  }
+  mystl_bench::do_not_optimize(sum);
+}
+
+template <std::size_t Arity>
+void bench_arity(const std::vector<timer>& src, mystl_bench::BenchConfig cfg) {
+  using queue = mystl::priority_queue<timer, std::vector<timer>, later, Arity>;
+  const std::string suffix = "_arity" + std::to_string(Arity);
+  queue held(later(), src);
+  mystl_bench::run(("mystl_hold_pop_push" + suffix).c_str(), [&] { hold_pop_push(held, src.size()); }, cfg);
+  mystl_bench::run(("mystl_hold_replace_top" + suffix).c_str(), [&] { hold_replace_top(held, src.size()); }, cfg);
+  mystl_bench::run(("mystl_build" + suffix).c_str(), [&] {
+    queue q(later(), src);
+    mystl_bench::do_not_optimize(&q);
+  }, cfg);
+  mystl_bench::run(("mystl_drain" + suffix).c_str(), [&] {
+    queue q(later(), src);
+    drain(q);
+  }, cfg);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+  mystl_bench::BenchConfig cfg;
+  cfg.warmup_iters = 1;
+  cfg.measure_iters = 5;
+
+  std::vector<timer> src(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    src[i] = {next_random() % kMaxDelay, i};
+  }
+
+  std::priority_queue<timer, std::vector<timer>, later> std_held(later(), src);
+  mystl_bench::run("std_hold_pop_push", [&] { hold_pop_push(std_held, n); }, cfg);
+  mystl_bench::run("std_build", [&] {
+    std::priority_queue<timer, std::vector<timer>, later> q(later(), src);
+    mystl_bench::do_not_optimize(&q);
+  }, cfg);
+  mystl_bench::run("std_drain", [&] {
+    std::priority_queue<timer, std::vector<timer>, later> q(later(), src);
+    drain(q);
+  }, cfg);
+  bench_arity<2>(src, cfg);
+  bench_arity<4>(src, cfg);
+  bench_arity<8>(src, cfg);
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/adapters/indexed_priority_queue.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// 随机有向图（默认 200K 顶点、每个顶点 8 条出边）上的 Dijkstra：
+// mystl::indexed_priority_queue（decrease_key，2 / 4 / 8 叉）对比 std::priority_queue 重复入队 + 跳过过期项。
+// [PEAK] 行为各自的队列峰值元素个数。
+// 命令行参数可调顶点数：mystl_bench_indexed_priority_queue 1000000
+
+namespace {
+
+using mystl_bench::next_random;
+
+// 压缩邻接表
+struct graph {
+  std::vector<std::size_t> offsets;
+  std::vector<std::uint32_t> targets;
+  std::vector<std::uint32_t> weights;
+};
+
+graph make_graph(std::size_t nodes, std::size_t degree) {
+  graph g;
+  g.offsets.resize(nodes + 1);
+  g.targets.resize(nodes * degree);
+  g.weights.resize(nodes * degree);
+  for (std::size_t u = 0; u <= nodes; ++u) {
+    g.offsets[u] = u * degree;
+  }
+  for (std::size_t e = 0; e < nodes * degree; ++e) {
+    g.targets[e] = static_cast<std::uint32_t>(next_random() % nodes);
+    g.weights[e] = static_cast<std::uint32_t>(next_random() % 100000);
+  }
+  return g;
+}
+
+constexpr std::uint64_t kInf = std::numeric_limits<std::uint64_t>::max();
+
+template <std::size_t Arity>
+std::size_t dijkstra_indexed(const graph& g, std::vector<std::uint64_t>& dist) {
+  const std::size_t nodes = g.offsets.size() - 1;
+  dist.assign(nodes, kInf);
+  mystl::indexed_priority_queue<std::uint64_t, std::greater<std::uint64_t>, Arity> q(nodes);
+  std::size_t peak = 0;
+  dist[0] = 0;
+  q.push(0, 0);
+  while (!q.empty()) {
+    const std::size_t u = q.top_id();
+    const std::uint64_t d = q.top_key();
+    q.pop();
+    for (std::size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      const std::uint32_t v = g.targets[e];
+      if (d + g.weights[e] < dist[v]) {
+        dist[v] = d + g.weights[e];
+        q.push_or_update(v, dist[v]);
+      }
+    }
+    peak = std::max(peak, q.size());
+  }
+  return peak;
+}
+
+std::size_t dijkstra_lazy(const graph& g, std::vector<std::uint64_t>& dist) {
+  using item = std::pair<std::uint64_t, std::uint32_t>;
+  dist.assign(g.offsets.size() - 1, kInf);
+  std::priority_queue<item, std::vector<item>, std::greater<item>> q;
+  std::size_t peak = 0;
+  dist[0] = 0;
+  q.emplace(0, 0);
+  while (!q.empty()) {
+    const auto [d, u] = q.top();
+    q.pop();
+    if (d != dist[u]) {
+      continue;
+    }
+    for (std::size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      const std::uint32_t v = g.targets[e];
+      if (d + g.weights[e] < dist[v]) {
+        dist[v] = d + g.weights[e];
+        q.emplace(dist[v], v);
+      }
+    }
+    peak = std::max(peak, q.size());
+  }
+  return peak;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t nodes = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 200000;
+  mystl_bench::BenchConfig cfg;
+  cfg.warmup_iters = 1;
+  cfg.measure_iters = 3;
+
+  const graph g = make_graph(nodes, 8);
+  std::vector<std::uint64_t> dist;
+  std::size_t peak = 0;
+
+  mystl_bench::run("std_lazy_deletion", [&] { peak = dijkstra_lazy(g, dist); }, cfg);
+  std::cout << "[PEAK] std_lazy_deletion: " << peak << "\n";
+  mystl_bench::run("mystl_indexed_arity2", [&] { peak = dijkstra_indexed<2>(g, dist); }, cfg);
+  std::cout << "[PEAK] mystl_indexed_arity2: " << peak << "\n";
+  mystl_bench::run("mystl_indexed_arity4", [&] { peak = dijkstra_indexed<4>(g, dist); }, cfg);
+  std::cout << "[PEAK] mystl_indexed_arity4: " << peak << "\n";
+  mystl_bench::run("mystl_indexed_arity8", [&] { peak = dijkstra_indexed<8>(g, dist); }, cfg);
+  std::cout << "[PEAK] mystl_indexed_arity8: " << peak << "\n";
+  mystl_bench::do_not_optimize(dist.data());
+  return 0;
+}
@@ -0,0 +1,220 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/mdspan.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// 2D 五点 / 3D 七点模板计算：mdspan（静态与动态维度）对比手写指针运算
+// 2048x2048 转置与分块遍历的模板计算：layout_blocked 对比 layout_right
+// 访问器：axpy 内核下 default / aligned / restrict 对比，大块输出下普通存储对比 streaming 存储
+
+namespace {
+
+constexpr std::size_t kN2 = 512;
+constexpr std::size_t kN3 = 64;
+
+std::vector<double> g_in2(kN2 * kN2, 1.0);
+std::vector<double> g_out2(kN2 * kN2, 0.0);
+std::vector<double> g_in3(kN3 * kN3 * kN3, 1.0);
+std::vector<double> g_out3(kN3 * kN3 * kN3, 0.0);
+
+constexpr std::size_t kNT = 2048;
+constexpr std::size_t kTile = 32;
+using blocked = mystl::layout_blocked<kTile, kTile>;
+using square_t = mystl::dextents<std::size_t, 2>;
+
+std::vector<double> g_in_t(kNT * kNT, 1.0);
+std::vector<double> g_out_t(kNT * kNT, 0.0);
+
+constexpr std::size_t kAxpy = 1 << 14;
+alignas(64) float g_x[kAxpy];
+alignas(64) float g_y[kAxpy];
+using vec_t = mystl::dextents<std::size_t, 1>;
+
+template <class Accessor>
+using vec_view = mystl::mdspan<float, vec_t, mystl::layout_right, Accessor>;
+
+template <class In, class Out>
+void stencil2d(In in, Out out) {
+  for (std::size_t i = 1; i + 1 < in.extent(0); ++i) {
+    for (std::size_t j = 1; j + 1 < in.extent(1); ++j) {
+      out[i, j] = 0.25 * (in[i - 1, j] + in[i + 1, j] + in[i, j - 1] + in[i, j + 1]);
+    }
+  }
+}
+
+template <class In, class Out>
+void stencil3d(In in, Out out) {
+  for (std::size_t i = 1; i + 1 < in.extent(0); ++i) {
+    for (std::size_t j = 1; j + 1 < in.extent(1); ++j) {
+      for (std::size_t k = 1; k + 1 < in.extent(2); ++k) {
+        out[i, j, k] = (in[i - 1, j, k] + in[i + 1, j, k] + in[i, j - 1, k] + in[i, j + 1, k] + in[i, j, k - 1] +
+                        in[i, j, k + 1]) /
+                       6.0;
+      }
+    }
+  }
+}
+
+template <class In, class Out>
+void stencil2d_tiled(In in, Out out) {
+  const std::size_t n = in.extent(0);
+  mystl::for_each_tile<kTile, kTile>(in.extents(), [&](std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1) {
+    for (std::size_t i = r0 == 0 ? 1 : r0; i < r1 && i + 1 < n; ++i) {
+      for (std::size_t j = c0 == 0 ? 1 : c0; j < c1 && j + 1 < n; ++j) {
+        out[i, j] = 0.25 * (in[i - 1, j] + in[i + 1, j] + in[i, j - 1] + in[i, j + 1]);
+      }
+    }
+  });
+}
+
+// 禁止内联，使内核只能依赖访问器提供的对齐和别名信息
+template <class Accessor>
+[[gnu::noinline]] void axpy(float a, vec_view<Accessor> x, vec_view<Accessor> y) {
+  for (std::size_t i = 0; i < x.extent(0); ++i) {
+    y[i] += a * x[i];
+  }
+}
+
+template <class Accessor>
+void axpy_repeat() {
+  // 经由 launder_pointer 隐藏全局数组的地址，避免编译器常量传播出对齐和别名信息
+  vec_view<Accessor> x(mystl_bench::launder_pointer(g_x), vec_t(kAxpy), Accessor{});
+  vec_view<Accessor> y(mystl_bench::launder_pointer(g_y), vec_t(kAxpy), Accessor{});
+  for (int rep = 0; rep < 64; ++rep) {
+    axpy(0.5f, x, y);
+  }
+  mystl_bench::do_not_optimize(g_y[0]);
+}
+
+template <class Accessor>
+void fill_output(mystl::mdspan<double, square_t, mystl::layout_right, Accessor> out) {
+  for (std::size_t i = 0; i < out.extent(0); ++i) {
+    for (std::size_t j = 0; j < out.extent(1); ++j) {
+      out[i, j] = static_cast<double>(i + j);
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(stencil2d_raw_pointer_512, {
+    const double* in = g_in2.data();
+    double* out = g_out2.data();
+    const std::size_t n = kN2;
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+      for (std::size_t j = 1; j + 1 < n; ++j) {
+        out[i * n + j] = 0.25 * (in[(i - 1) * n + j] + in[(i + 1) * n + j] + in[i * n + j - 1] + in[i * n + j + 1]);
+      }
+    }
+    mystl_bench::do_not_optimize(out[n + 1]);
+  });
+
+  MYSTL_BENCH(stencil2d_mdspan_static_512, {
+    using ext = mystl::extents<std::size_t, kN2, kN2>;
+    stencil2d(mystl::mdspan<const double, ext>(g_in2.data()), mystl::mdspan<double, ext>(g_out2.data()));
+    mystl_bench::do_not_optimize(g_out2[kN2 + 1]);
+  });
+
+  MYSTL_BENCH(stencil2d_mdspan_dynamic_512, {
+    stencil2d(mystl::mdspan<const double, mystl::dextents<std::size_t, 2>>(g_in2.data(), kN2, kN2),
+              mystl::mdspan<double, mystl::dextents<std::size_t, 2>>(g_out2.data(), kN2, kN2));
+    mystl_bench::do_not_optimize(g_out2[kN2 + 1]);
+  });
+
+  MYSTL_BENCH(stencil3d_raw_pointer_64, {
+    const double* in = g_in3.data();
+    double* out = g_out3.data();
+    const std::size_t n = kN3;
+    const std::size_t nn = n * n;
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+      for (std::size_t j = 1; j + 1 < n; ++j) {
+        for (std::size_t k = 1; k + 1 < n; ++k) {
+          const std::size_t c = i * nn + j * n + k;
+          out[c] = (in[c - nn] + in[c + nn] + in[c - n] + in[c + n] + in[c - 1] + in[c + 1]) / 6.0;
+        }
+      }
+    }
+    mystl_bench::do_not_optimize(out[nn + n + 1]);
+  });
+
+  MYSTL_BENCH(stencil3d_mdspan_static_64, {
+    using ext = mystl::extents<std::size_t, kN3, kN3, kN3>;
+    stencil3d(mystl::mdspan<const double, ext>(g_in3.data()), mystl::mdspan<double, ext>(g_out3.data()));
+    mystl_bench::do_not_optimize(g_out3[kN3 * kN3 + kN3 + 1]);
+  });
+
+  MYSTL_BENCH(stencil3d_mdspan_dynamic_64, {
+    stencil3d(mystl::mdspan<const double, mystl::dextents<std::size_t, 3>>(g_in3.data(), kN3, kN3, kN3),
+              mystl::mdspan<double, mystl::dextents<std::size_t, 3>>(g_out3.data(), kN3, kN3, kN3));
+    mystl_bench::do_not_optimize(g_out3[kN3 * kN3 + kN3 + 1]);
+  });
+
+  MYSTL_BENCH(transpose_layout_right_2048, {
+    mystl::mdspan<const double, square_t> in(g_in_t.data(), kNT, kNT);
+    mystl::mdspan<double, square_t> out(g_out_t.data(), kNT, kNT);
+    for (std::size_t i = 0; i < kNT; ++i) {
+      for (std::size_t j = 0; j < kNT; ++j) {
+        out[j, i] = in[i, j];
+      }
+    }
+    mystl_bench::do_not_optimize(g_out_t[1]);
+  });
+
+  MYSTL_BENCH(transpose_layout_right_tiled_loop_2048, {
+    mystl::mdspan<const double, square_t> in(g_in_t.data(), kNT, kNT);
+    mystl::mdspan<double, square_t> out(g_out_t.data(), kNT, kNT);
+    mystl::for_each_tile<kTile, kTile>(in.extents(), [&](std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1) {
+      for (std::size_t i = r0; i < r1; ++i) {
+        for (std::size_t j = c0; j < c1; ++j) {
+          out[j, i] = in[i, j];
+        }
+      }
+    });
+    mystl_bench::do_not_optimize(g_out_t[1]);
+  });
+
+  MYSTL_BENCH(transpose_layout_blocked_2048, {
+    mystl::mdspan<const double, square_t, blocked> in(g_in_t.data(), kNT, kNT);
+    mystl::mdspan<double, square_t, blocked> out(g_out_t.data(), kNT, kNT);
+    mystl::for_each_tile(in, [&](std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1) {
+      for (std::size_t i = r0; i < r1; ++i) {
+        for (std::size_t j = c0; j < c1; ++j) {
+          out[j, i] = in[i, j];
+        }
+      }
+    });
+    mystl_bench::do_not_optimize(g_out_t[1]);
+  });
+
+  MYSTL_BENCH(stencil2d_layout_right_2048, {
+    stencil2d(mystl::mdspan<const double, square_t>(g_in_t.data(), kNT, kNT),
+              mystl::mdspan<double, square_t>(g_out_t.data(), kNT, kNT));
+    mystl_bench::do_not_optimize(g_out_t[kNT + 1]);
+  });
+
+  MYSTL_BENCH(stencil2d_layout_blocked_2048, {
+    stencil2d_tiled(mystl::mdspan<const double, square_t, blocked>(g_in_t.data(), kNT, kNT),
+                    mystl::mdspan<double, square_t, blocked>(g_out_t.data(), kNT, kNT));
+    mystl_bench::do_not_optimize(g_out_t[kNT + 1]);
+  });
+
+  MYSTL_BENCH(axpy_default_accessor_16k, { axpy_repeat<mystl::default_accessor<float>>(); });
+  MYSTL_BENCH(axpy_aligned_accessor_16k, { axpy_repeat<mystl::aligned_accessor<float, 64>>(); });
+  MYSTL_BENCH(axpy_restrict_accessor_16k, { axpy_repeat<mystl::restrict_accessor<float>>(); });
+
+  MYSTL_BENCH(fill_default_accessor_2048, {
+    fill_output<mystl::default_accessor<double>>({g_out_t.data(), square_t(kNT, kNT)});
+    mystl_bench::do_not_optimize(g_out_t[1]);
+  });
+
+  MYSTL_BENCH(fill_streaming_accessor_2048, {
+    using acc = mystl::streaming_accessor<double>;
+    fill_output<acc>({g_out_t.data(), mystl::layout_right::mapping<square_t>(square_t(kNT, kNT)), acc{}});
+    mystl::streaming_fence();
+    mystl_bench::do_not_optimize(g_out_t[1]);
+  });
+  return 0;
+}
@@ -0,0 +1,136 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/non_modifying.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// 非修改算法逐个对比 std：find / count（uint8_t、int32_t）、mismatch / equal（int32_t、double）、
+// search（字母表上的随机文本）、adjacent_find（int32_t）、min_element / max_element / minmax_element（int32_t、float）。
+// find / mismatch / adjacent_find / search 的命中都放在区间末尾，扫描整个区间。
+// 命令行参数可调元素个数：mystl_bench_non_modifying 100000000
+
+namespace {
+
+using mystl_bench::next_random;
+
+// 取值在 [lo, lo + range) 内
+template <class T>
+std::vector<T> make_values(std::size_t n, std::int64_t lo, std::uint64_t range) {
+  std::vector<T> v(n);
+  for (auto& x : v) {
+    x = static_cast<T>(lo + static_cast<std::int64_t>(next_random() % range));
+  }
+  return v;
+}
+
+template <class T>
+void bench_find_count(const std::string& type, std::size_t n, const mystl_bench::BenchConfig& cfg) {
+  auto v = make_values<T>(n, 0, 100);
+  v.back() = T(100);
+  mystl_bench::run(("mystl_find_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::find(v.begin(), v.end(), T(100)));
+  }, cfg);
+  mystl_bench::run(("std_find_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::find(v.begin(), v.end(), T(100)));
+  }, cfg);
+  mystl_bench::run(("mystl_count_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::count(v.begin(), v.end(), T(7)));
+  }, cfg);
+  mystl_bench::run(("std_count_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::count(v.begin(), v.end(), T(7)));
+  }, cfg);
+}
+
+template <class T>
+void bench_compare(const std::string& type, std::size_t n, const mystl_bench::BenchConfig& cfg) {
+  const auto a = make_values<T>(n, -1000000, 2000000);
+  auto b = a;
+  mystl_bench::run(("mystl_equal_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::equal(a.begin(), a.end(), b.begin()));
+  }, cfg);
+  mystl_bench::run(("std_equal_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::equal(a.begin(), a.end(), b.begin()));
+  }, cfg);
+  b.back() = static_cast<T>(b.back() + T(1));
+  mystl_bench::run(("mystl_mismatch_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::mismatch(a.begin(), a.end(), b.begin()).first);
+  }, cfg);
+  mystl_bench::run(("std_mismatch_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::mismatch(a.begin(), a.end(), b.begin()).first);
+  }, cfg);
+}
+
+template <class T>
+void bench_extremes(const std::string& type, std::size_t n, const mystl_bench::BenchConfig& cfg) {
+  const auto v = make_values<T>(n, -1000000, 2000000);
+  mystl_bench::run(("mystl_min_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::min_element(v.begin(), v.end()));
+  }, cfg);
+  mystl_bench::run(("std_min_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::min_element(v.begin(), v.end()));
+  }, cfg);
+  mystl_bench::run(("mystl_max_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::max_element(v.begin(), v.end()));
+  }, cfg);
+  mystl_bench::run(("std_max_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::max_element(v.begin(), v.end()));
+  }, cfg);
+  mystl_bench::run(("mystl_minmax_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::minmax_element(v.begin(), v.end()).first);
+  }, cfg);
+  mystl_bench::run(("std_minmax_element_" + type).c_str(), [&] {
+    mystl_bench::do_not_optimize(std::minmax_element(v.begin(), v.end()).first);
+  }, cfg);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+  mystl_bench::BenchConfig cfg;
+  cfg.warmup_iters = 2;
+  cfg.measure_iters = 20;
+
+  bench_find_count<std::uint8_t>("u8", n, cfg);
+  bench_find_count<std::int32_t>("i32", n, cfg);
+  bench_compare<std::int32_t>("i32", n, cfg);
+  bench_compare<double>("f64", n, cfg);
+
+  // 模式为 8 个字母，文本中首字母约每 26 个字符出现一次
+  std::string text(n, 'a');
+  for (auto& c : text) {
+    c = static_cast<char>('a' + next_random() % 26);
+  }
+  const std::string needle = "qzjxkvwy";
+  text.replace(text.size() - needle.size(), needle.size(), needle);
+  mystl_bench::run("mystl_search_text", [&] {
+    mystl_bench::do_not_optimize(mystl::search(text.begin(), text.end(), needle.begin(), needle.end()));
+  }, cfg);
+  mystl_bench::run("std_search_text", [&] {
+    mystl_bench::do_not_optimize(std::search(text.begin(), text.end(), needle.begin(), needle.end()));
+  }, cfg);
+
+  // 相邻元素互不相等，只有末尾一对相等
+  std::vector<std::int32_t> steps(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    steps[i] = static_cast<std::int32_t>(i);
+  }
+  if (n >= 2) {
+    steps[n - 1] = steps[n - 2];
+  }
+  mystl_bench::run("mystl_adjacent_find_i32", [&] {
+    mystl_bench::do_not_optimize(mystl::adjacent_find(steps.begin(), steps.end()));
+  }, cfg);
+  mystl_bench::run("std_adjacent_find_i32", [&] {
+    mystl_bench::do_not_optimize(std::adjacent_find(steps.begin(), steps.end()));
+  }, cfg);
+
+  bench_extremes<std::int32_t>("i32", n, cfg);
+  bench_extremes<float>("f32", n, cfg);
+  return 0;
+}
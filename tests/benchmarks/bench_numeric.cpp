@@ -0,0 +1,195 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/numeric.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// 4M 个 double / float / int32 / int64：
+// - reduce / transform_reduce（点积）对比 std::accumulate、std::reduce、std::inner_product
+// - inclusive_scan / exclusive_scan 对比 std::inclusive_scan、std::partial_sum（输出到另一个数组）
+// - execution::par 版本在 1 / 2 / 4 / 8 个线程的池上
+// - 数值稳定的求和（kahan_reduce、pairwise_reduce）与 stats 对比 std::accumulate、朴素的 Σx / Σx² 统计，
+//   [ERROR] 行为相对 long double 参考值的误差
+// 命令行参数可调元素个数：mystl_bench_numeric 100000000
+
+namespace {
+
+using mystl_bench::next_random;
+
+template <class T>
+std::vector<T> make_values(std::size_t n) {
+  std::vector<T> v(n);
+  for (auto& x : v) {
+    x = static_cast<T>(next_random() % 1000);
+  }
+  return v;
+}
+
+template <class T>
+void bench_type(const char* type, std::size_t n, mystl_bench::BenchConfig cfg) {
+  const std::vector<T> src = make_values<T>(n);
+  std::vector<T> out(n);
+  const std::string t = type;
+
+  mystl_bench::run((t + "_reduce_mystl").c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::reduce(src.begin(), src.end(), T{}));
+  }, cfg);
+  mystl_bench::run((t + "_reduce_std").c_str(), [&] {
+    mystl_bench::do_not_optimize(std::reduce(src.begin(), src.end(), T{}));
+  }, cfg);
+  mystl_bench::run((t + "_accumulate_std").c_str(), [&] {
+    mystl_bench::do_not_optimize(std::accumulate(src.begin(), src.end(), T{}));
+  }, cfg);
+  mystl_bench::run((t + "_dot_mystl").c_str(), [&] {
+    mystl_bench::do_not_optimize(mystl::transform_reduce(src.begin(), src.end(), src.begin(), T{}));
+  }, cfg);
+  mystl_bench::run((t + "_dot_std_inner_product").c_str(), [&] {
+    mystl_bench::do_not_optimize(std::inner_product(src.begin(), src.end(), src.begin(), T{}));
+  }, cfg);
+  mystl_bench::run((t + "_inclusive_scan_mystl").c_str(), [&] {
+    mystl::inclusive_scan(src.begin(), src.end(), out.begin());
+    mystl_bench::do_not_optimize(out.data());
+  }, cfg);
+  mystl_bench::run((t + "_exclusive_scan_mystl").c_str(), [&] {
+    mystl::exclusive_scan(src.begin(), src.end(), out.begin(), T{});
+    mystl_bench::do_not_optimize(out.data());
+  }, cfg);
+  mystl_bench::run((t + "_inclusive_scan_std").c_str(), [&] {
+    std::inclusive_scan(src.begin(), src.end(), out.begin());
+    mystl_bench::do_not_optimize(out.data());
+  }, cfg);
+  mystl_bench::run((t + "_partial_sum_std").c_str(), [&] {
+    std::partial_sum(src.begin(), src.end(), out.begin());
+    mystl_bench::do_not_optimize(out.data());
+  }, cfg);
+}
+
+// 相对误差大的数据：正负相间、跨多个数量级，再整体平移
+std::vector<double> make_ill_conditioned(std::size_t n) {
+  std::vector<double> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double mag = std::pow(10.0, static_cast<double>(next_random() % 12));
+    v[i] = 1e6 + (i % 2 == 0 ? 1 : -1) * mag * static_cast<double>(next_random() % 1000) / 1000.0;
+  }
+  return v;
+}
+
+void report_error(const char* name, double got, long double ref) {
+  std::cout << "[ERROR] " << name << " relative error: " << static_cast<double>(std::fabs((got - ref) / ref))
+            << "\n";
+}
+
+void bench_stable(std::size_t n, mystl_bench::BenchConfig cfg) {
+  const std::vector<double> v = make_ill_conditioned(n);
+  long double ref_sum = 0;
+  for (const double x : v) {
+    ref_sum += x;
+  }
+  const long double ref_mean = ref_sum / static_cast<long double>(n);
+  long double ref_m2 = 0;
+  for (const double x : v) {
+    ref_m2 += (x - ref_mean) * (x - ref_mean);
+  }
+
+  mystl_bench::run("double_sum_std_accumulate", [&] {
+    mystl_bench::do_not_optimize(std::accumulate(v.begin(), v.end(), 0.0));
+  }, cfg);
+  mystl_bench::run("double_sum_mystl_reduce", [&] {
+    mystl_bench::do_not_optimize(mystl::reduce(v.begin(), v.end(), 0.0));
+  }, cfg);
+  mystl_bench::run("double_sum_mystl_pairwise_reduce", [&] {
+    mystl_bench::do_not_optimize(mystl::pairwise_reduce(v.begin(), v.end(), 0.0));
+  }, cfg);
+  mystl_bench::run("double_sum_mystl_kahan_reduce", [&] {
+    mystl_bench::do_not_optimize(mystl::kahan_reduce(v.begin(), v.end(), 0.0));
+  }, cfg);
+  report_error("std_accumulate", std::accumulate(v.begin(), v.end(), 0.0), ref_sum);
+  report_error("mystl_reduce", mystl::reduce(v.begin(), v.end(), 0.0), ref_sum);
+  report_error("mystl_pairwise_reduce", mystl::pairwise_reduce(v.begin(), v.end(), 0.0), ref_sum);
+  report_error("mystl_kahan_reduce", mystl::kahan_reduce(v.begin(), v.end(), 0.0), ref_sum);
+
+  // 朴素统计：一遍求 Σx 与 Σx²，方差为 Σx²/n - mean²
+  const auto naive_variance = [&] {
+    double sum = 0;
+    double sq = 0;
+    for (const double x : v) {
+      sum += x;
+      sq += x * x;
+    }
+    const double mean = sum / static_cast<double>(n);
+    return sq / static_cast<double>(n) - mean * mean;
+  };
+  const auto welford_variance = [&] {
+    mystl::statistics<double> s;
+    for (const double x : v) {
+      s.add(x);
+    }
+    return s.variance();
+  };
+  mystl_bench::run("double_variance_naive_sum_of_squares", [&] {
+    mystl_bench::do_not_optimize(naive_variance());
+  }, cfg);
+  mystl_bench::run("double_variance_welford_add", [&] {
+    mystl_bench::do_not_optimize(welford_variance());
+  }, cfg);
+  mystl_bench::run("double_variance_mystl_stats", [&] {
+    mystl_bench::do_not_optimize(mystl::stats(v).variance());
+  }, cfg);
+  const long double ref_variance = ref_m2 / static_cast<long double>(n);
+  report_error("variance_naive_sum_of_squares", naive_variance(), ref_variance);
+  report_error("variance_welford_add", welford_variance(), ref_variance);
+  report_error("variance_mystl_stats", mystl::stats(v).variance(), ref_variance);
+
+  const std::size_t thread_counts[] = {1, 2, 4, 8};
+  for (const std::size_t threads : thread_counts) {
+    mystl::execution::thread_pool pool(threads);
+    const auto par = mystl::execution::par.on(pool);
+    const std::string suffix = "_threads" + std::to_string(threads);
+    mystl_bench::run(("double_par_kahan_reduce" + suffix).c_str(), [&] {
+      mystl_bench::do_not_optimize(mystl::kahan_reduce(par, v.begin(), v.end()));
+    }, cfg);
+    mystl_bench::run(("double_par_stats" + suffix).c_str(), [&] {
+      mystl_bench::do_not_optimize(mystl::stats(par, v.begin(), v.end()).variance());
+    }, cfg);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 4000000;
+  mystl_bench::BenchConfig cfg;
+  cfg.warmup_iters = 2;
+  cfg.measure_iters = 10;
+
+  bench_type<double>("double", n, cfg);
+  bench_type<float>("float", n, cfg);
+  bench_type<std::int32_t>("int32", n, cfg);
+  bench_type<std::int64_t>("int64", n, cfg);
+
+  const std::vector<double> src = make_values<double>(n);
+  std::vector<double> out(n);
+  const std::size_t thread_counts[] = {1, 2, 4, 8};
+  for (const std::size_t threads : thread_counts) {
+    mystl::execution::thread_pool pool(threads);
+    const auto par = mystl::execution::par.on(pool);
+    const std::string suffix = "_threads" + std::to_string(threads);
+    mystl_bench::run(("double_par_reduce" + suffix).c_str(), [&] {
+      mystl_bench::do_not_optimize(mystl::reduce(par, src.begin(), src.end()));
+    }, cfg);
+    mystl_bench::run(("double_par_inclusive_scan" + suffix).c_str(), [&] {
+      mystl::inclusive_scan(par, src.begin(), src.end(), out.begin());
+      mystl_bench::do_not_optimize(out.data());
+    }, cfg);
+  }
+
+  bench_stable(n, cfg);
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/sorting.hpp"
+#include "mystl/execution/thread_pool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// execution::par 版本的 sort / stable_sort / radix_sort 随线程数（1 到 64）的扩展性，随机 uint64_t。
+// 每个线程数一个独立的 thread_pool，threads_1 即顺序版本（单线程池直接走顺序路径）。
+// 每次计时都先把源数据复制到工作区，copy 一行是复制本身的开销。
+// 默认 1M 个元素，命令行参数可调：mystl_bench_parallel_sort 100000000
+
+int main(int argc, char** argv) {
+  const std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+  mystl_bench::BenchConfig cfg;
+  if (n >= 10000000) {
+    cfg.warmup_iters = 0;
+    cfg.measure_iters = 1;
+  } else {
+    cfg.warmup_iters = 1;
+    cfg.measure_iters = 3;
+  }
+
+  std::vector<std::uint64_t> src(n);
+  for (auto& v : src) {
+    v = mystl_bench::next_random();
+  }
+  std::vector<std::uint64_t> work(n);
+  auto reset = [&] {
+    std::memcpy(work.data(), src.data(), n * sizeof(std::uint64_t));
+  };
+
+  mystl_bench::run("copy", [&] {
+    reset();
+    mystl_bench::do_not_optimize(work.data());
+  }, cfg);
+  const std::size_t thread_counts[] = {1, 2, 4, 8, 16, 32, 64};
+  for (const std::size_t threads : thread_counts) {
+    mystl::execution::thread_pool pool(threads);
+    const auto par = mystl::execution::par.on(pool);
+    const std::string suffix = "_threads_" + std::to_string(threads);
+    mystl_bench::run(("sort" + suffix).c_str(), [&] {
+      reset();
+      mystl::sort(par, work.begin(), work.end());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+    mystl_bench::run(("stable_sort" + suffix).c_str(), [&] {
+      reset();
+      mystl::stable_sort(par, work.begin(), work.end());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+    mystl_bench::run(("radix_sort" + suffix).c_str(), [&] {
+      reset();
+      mystl::radix_sort(par, work.begin(), work.end());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+  }
+  return 0;
+}
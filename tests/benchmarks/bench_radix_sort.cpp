@@ -0,0 +1,121 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/sorting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// radix_sort 对比 mystl::sort / std::sort：
+// - 1M 个时间戳（同一天内的微秒，高位字节全部相同）与 1M 个完整 64 位随机数
+// - 1M 个 double、1M 个 {id, payload} 按 id 排序、20 万个带公共前缀的字符串
+// 每次计时都包含把源数据复制到工作区
+
+namespace {
+
+constexpr std::size_t kN = 1000000;
+
+using mystl_bench::next_random;
+
+struct record {
+  std::uint64_t id;
+  std::uint64_t payload[3];
+};
+
+template <class T, class Gen>
+std::vector<T> generate(std::size_t n, Gen gen) {
+  std::vector<T> v(n);
+  for (auto& x : v) {
+    x = gen();
+  }
+  return v;
+}
+
+const std::vector<std::uint64_t> g_timestamps =
+    generate<std::uint64_t>(kN, [] { return 1700000000000000ULL + next_random() % 86400000000ULL; });
+const std::vector<std::uint64_t> g_random64 = generate<std::uint64_t>(kN, [] { return next_random(); });
+const std::vector<double> g_doubles = generate<double>(
+    kN, [] { return (static_cast<double>(next_random() >> 11) - 4503599627370496.0) / 1048576.0; });
+const std::vector<record> g_records = generate<record>(kN, [] { return record{next_random() % 1000000007, {}}; });
+const std::vector<std::string> g_strings = generate<std::string>(200000, [] {
+  return "svc.requests." + std::to_string(next_random() % 1000) + ".host-" + std::to_string(next_random() % 100000);
+});
+
+std::vector<std::uint64_t> g_work64(kN);
+std::vector<double> g_work_double(kN);
+std::vector<record> g_work_records(kN);
+std::vector<std::string> g_work_strings;
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(timestamps_radix, {
+    g_work64 = g_timestamps;
+    mystl::radix_sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(timestamps_mystl_sort, {
+    g_work64 = g_timestamps;
+    mystl::sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(timestamps_std_sort, {
+    g_work64 = g_timestamps;
+    std::sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(random64_radix, {
+    g_work64 = g_random64;
+    mystl::radix_sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(random64_mystl_sort, {
+    g_work64 = g_random64;
+    mystl::sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(random64_std_sort, {
+    g_work64 = g_random64;
+    std::sort(g_work64.begin(), g_work64.end());
+    mystl_bench::do_not_optimize(g_work64.data());
+  });
+  MYSTL_BENCH(double_radix, {
+    g_work_double = g_doubles;
+    mystl::radix_sort(g_work_double.begin(), g_work_double.end());
+    mystl_bench::do_not_optimize(g_work_double.data());
+  });
+  MYSTL_BENCH(double_std_sort, {
+    g_work_double = g_doubles;
+    std::sort(g_work_double.begin(), g_work_double.end());
+    mystl_bench::do_not_optimize(g_work_double.data());
+  });
+  MYSTL_BENCH(records_radix_by_key, {
+    g_work_records = g_records;
+    mystl::radix_sort_by_key(g_work_records.begin(), g_work_records.end(), [](const record& r) { return r.id; });
+    mystl_bench::do_not_optimize(g_work_records.data());
+  });
+  MYSTL_BENCH(records_std_stable_sort, {
+    g_work_records = g_records;
+    std::stable_sort(g_work_records.begin(), g_work_records.end(),
+                     [](const record& a, const record& b) { return a.id < b.id; });
+    mystl_bench::do_not_optimize(g_work_records.data());
+  });
+  // 复制 std::string 本身要分配内存，单独计时作为基线
+  MYSTL_BENCH(strings_copy_only, {
+    g_work_strings = g_strings;
+    mystl_bench::do_not_optimize(g_work_strings.data());
+  });
+  MYSTL_BENCH(strings_radix, {
+    g_work_strings = g_strings;
+    mystl::radix_sort(g_work_strings.begin(), g_work_strings.end());
+    mystl_bench::do_not_optimize(g_work_strings.data());
+  });
+  MYSTL_BENCH(strings_std_sort, {
+    g_work_strings = g_strings;
+    std::sort(g_work_strings.begin(), g_work_strings.end());
+    mystl_bench::do_not_optimize(g_work_strings.data());
+  });
+  return 0;
+}
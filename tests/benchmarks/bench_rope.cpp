@@ -0,0 +1,77 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/rope.hpp"
+#include "mystl/containers/string.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 10MB 文档上的随机插入 / 删除 / 截取：mystl::rope 对比连续存储的 mystl::string 与 std::string
+
+namespace {
+
+constexpr std::size_t kDocSize = 10 * 1024 * 1024;
+constexpr int kEdits = 200;
+
+const std::string g_doc = [] {
+  std::string doc(kDocSize, ' ');
+  for (std::size_t i = 0; i < doc.size(); ++i) {
+    doc[i] = static_cast<char>('a' + i % 26);
+  }
+  return doc;
+}();
+
+const mystl::string_view g_view(g_doc.data(), g_doc.size());
+const mystl::rope g_rope(g_view);
+
+// 插入与删除交替，文档长度大致不变
+template <class Text>
+void random_edits(Text& text) {
+  for (int i = 0; i < kEdits; ++i) {
+    const std::size_t pos = mystl_bench::next_random() % (text.size() - 64);
+    if (i % 2 == 0) {
+      text.insert(pos, mystl::string_view("inserted text "));
+    } else {
+      text.erase(pos, 14);
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(random_edits_rope, {
+    mystl::rope text = g_rope;
+    random_edits(text);
+    mystl_bench::do_not_optimize(text.size());
+  });
+  MYSTL_BENCH(random_edits_mystl_string, {
+    mystl::string text(g_view);
+    random_edits(text);
+    mystl_bench::do_not_optimize(text.size());
+  });
+  MYSTL_BENCH(random_edits_std_string, {
+    std::string text = g_doc;
+    random_edits(text);
+    mystl_bench::do_not_optimize(text.size());
+  });
+  // 取中间 1MB
+  MYSTL_BENCH(substr_rope, {
+    for (int i = 0; i < kEdits; ++i) {
+      mystl_bench::do_not_optimize(g_rope.substr(static_cast<std::size_t>(i) * 4096, 1 << 20).size());
+    }
+  });
+  MYSTL_BENCH(substr_std_string, {
+    for (int i = 0; i < kEdits; ++i) {
+      mystl_bench::do_not_optimize(g_doc.substr(static_cast<std::size_t>(i) * 4096, 1 << 20).size());
+    }
+  });
+  // 按块遍历整篇文档
+  MYSTL_BENCH(iterate_chunks_rope, {
+    std::size_t spaces = 0;
+    g_rope.for_each_chunk([&spaces](mystl::string_view chunk) { spaces += chunk.find('#') == mystl::string_view::npos; });
+    mystl_bench::do_not_optimize(spaces);
+  });
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/sorting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+// 从 10M 个 float 分数中取最大的 k 个（k = 100、10K、1M）：
+// mystl::top_k（只读输入）、mystl::partial_sort 对比 std::partial_sort、std::nth_element + std::sort；
+// 另有 10M 个 float 的 nth_element（取中位数）对比 std::nth_element。
+// 原地算法每次计时都先把源数据复制到工作区，copy 一行是复制本身的开销。
+// 命令行参数可调元素个数：mystl_bench_select 100000000
+
+using mystl_bench::next_random;
+
+int main(int argc, char** argv) {
+  const std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+  mystl_bench::BenchConfig cfg;
+  cfg.warmup_iters = 1;
+  cfg.measure_iters = 5;
+
+  std::vector<float> src(n);
+  for (auto& x : src) {
+    x = static_cast<float>(next_random() >> 40) / 16777216.0f;
+  }
+  std::vector<float> work(n);
+  auto reset = [&] { std::memcpy(work.data(), src.data(), n * sizeof(float)); };
+
+  mystl_bench::run("copy", [&] {
+    reset();
+    mystl_bench::do_not_optimize(work.data());
+  }, cfg);
+  for (const std::size_t k : {std::size_t{100}, std::size_t{10000}, std::size_t{100000}, std::size_t{1000000}}) {
+    if (k > n) {
+      break;
+    }
+    const std::string suffix = "_top" + std::to_string(k);
+    const auto middle = work.begin() + static_cast<std::ptrdiff_t>(k);
+    std::vector<float> out(k);
+    mystl_bench::run(("mystl_top_k" + suffix).c_str(), [&] {
+      mystl::top_k(src, k, out.begin());
+      mystl_bench::do_not_optimize(out.data());
+    }, cfg);
+    mystl_bench::run(("mystl_partial_sort" + suffix).c_str(), [&] {
+      reset();
+      mystl::partial_sort(work.begin(), middle, work.end(), std::greater<>());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+    mystl_bench::run(("std_partial_sort" + suffix).c_str(), [&] {
+      reset();
+      std::partial_sort(work.begin(), middle, work.end(), std::greater<>());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+    mystl_bench::run(("std_nth_element_then_sort" + suffix).c_str(), [&] {
+      reset();
+      std::nth_element(work.begin(), middle - 1, work.end(), std::greater<>());
+      std::sort(work.begin(), middle, std::greater<>());
+      mystl_bench::do_not_optimize(work.data());
+    }, cfg);
+  }
+  const auto median = work.begin() + static_cast<std::ptrdiff_t>(n / 2);
+  mystl_bench::run("mystl_nth_element_median", [&] {
+    reset();
+    mystl::nth_element(work.begin(), median, work.end());
+    mystl_bench::do_not_optimize(work.data());
+  }, cfg);
+  mystl_bench::run("std_nth_element_median", [&] {
+    reset();
+    std::nth_element(work.begin(), median, work.end());
+    mystl_bench::do_not_optimize(work.data());
+  }, cfg);
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/shared_string.hpp"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 同一批指标名作为键复制进多张表：shared_string（拷贝只增加计数）对比 std::string（逐个复制字节）
+
+namespace {
+
+constexpr int kKeys = 4000;
+constexpr int kMaps = 16;
+
+std::vector<std::string> make_names() {
+  std::vector<std::string> names;
+  for (int i = 0; i < kKeys; ++i) {
+    names.push_back("service.frontend.http.requests.latency.bucket_" + std::to_string(i));
+  }
+  return names;
+}
+
+const std::vector<std::string> g_names = make_names();
+
+mystl::string_view as_view(const std::string& s) noexcept { return mystl::string_view(s.data(), s.size()); }
+
+struct std_string_hash {
+  using is_transparent = void;
+  std::size_t operator()(const std::string& s) const noexcept { return mystl::string_hash{}(as_view(s)); }
+  std::size_t operator()(mystl::string_view v) const noexcept { return mystl::string_hash{}(v); }
+};
+
+struct std_string_equal {
+  using is_transparent = void;
+  bool operator()(mystl::string_view a, mystl::string_view b) const noexcept { return a == b; }
+  bool operator()(const std::string& a, mystl::string_view b) const noexcept { return as_view(a) == b; }
+  bool operator()(mystl::string_view a, const std::string& b) const noexcept { return a == as_view(b); }
+  bool operator()(const std::string& a, const std::string& b) const noexcept { return a == b; }
+};
+
+template <class Key, class Hash, class Equal>
+void fan_out() {
+  std::vector<Key> keys;
+  keys.reserve(g_names.size());
+  for (const auto& name : g_names) {
+    keys.emplace_back(as_view(name));
+  }
+  std::vector<std::unordered_map<Key, int, Hash, Equal>> maps(kMaps);
+  for (auto& m : maps) {
+    m.reserve(keys.size());
+    for (const auto& k : keys) {
+      m.emplace(k, 0);
+    }
+  }
+  // 查询用视图，不构造临时键
+  int hits = 0;
+  for (const auto& m : maps) {
+    hits += static_cast<int>(m.count(as_view(g_names[7])));
+  }
+  mystl_bench::do_not_optimize(hits);
+}
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(fan_out_shared_string, { fan_out<mystl::shared_string, mystl::string_hash, mystl::string_equal>(); });
+  MYSTL_BENCH(fan_out_std_string, { fan_out<std::string, std_string_hash, std_string_equal>(); });
+  return 0;
+}
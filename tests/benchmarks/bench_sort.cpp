@@ -0,0 +1,74 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/sorting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// mystl::sort 对比 std::sort：随机、有序、逆序、风琴管、大量重复五种输入，1K 到 100M 个 int。
+// 每次计时都先把源数据复制到工作区，copy 一行是复制本身的开销。
+// 默认最大 1M，命令行参数可调到 100M（约 800 MB 内存）：mystl_bench_sort 100000000
+
+namespace {
+
+std::vector<int> make_input(const std::string& kind, std::size_t n) {
+  std::vector<int> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::uint64_t x = mystl_bench::next_random();
+    const auto k = static_cast<int>(i);
+    if (kind == "random") {
+      v[i] = static_cast<int>(x);
+    } else if (kind == "sorted") {
+      v[i] = k;
+    } else if (kind == "reversed") {
+      v[i] = static_cast<int>(n) - k;
+    } else if (kind == "organ_pipe") {
+      v[i] = i < n / 2 ? k : static_cast<int>(n) - k;
+    } else {
+      v[i] = static_cast<int>(x % 16);
+    }
+  }
+  return v;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t max_n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+  for (std::size_t n = 1000; n <= max_n; n *= 10) {
+    // 大规模时减少重复次数
+    mystl_bench::BenchConfig cfg;
+    if (n >= 10000000) {
+      cfg.warmup_iters = 0;
+      cfg.measure_iters = 1;
+    } else if (n >= 1000000) {
+      cfg.warmup_iters = 1;
+      cfg.measure_iters = 3;
+    }
+    std::vector<int> work(n);
+    for (const char* kind : {"random", "sorted", "reversed", "organ_pipe", "many_dup"}) {
+      const std::vector<int> src = make_input(kind, n);
+      const std::string suffix = std::string(kind) + "_" + std::to_string(n);
+      mystl_bench::run(("copy_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(int));
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+      mystl_bench::run(("mystl_sort_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(int));
+        mystl::sort(work.begin(), work.end());
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+      mystl_bench::run(("std_sort_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(int));
+        std::sort(work.begin(), work.end());
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+    }
+  }
+  return 0;
+}
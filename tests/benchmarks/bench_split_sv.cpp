@@ -0,0 +1,92 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/string_view.hpp"
+#include "mystl/ranges/views/split_sv.hpp"
+
+#include <cstddef>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// CSV 行切分：每行 12 个字段（时间戳、级别、短标识与数值），统计字段总长度
+// views::split_sv 对比 getline 切成 vector<string>、std::views::split 与 string_view::find 循环
+
+namespace {
+
+using mystl_bench::next_random;
+
+constexpr int kLines = 100000;
+
+const std::vector<std::string> g_lines = [] {
+  const char* levels[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+  std::vector<std::string> lines;
+  for (int i = 0; i < kLines; ++i) {
+    std::string line = "2024-05-01T12:" + std::to_string(next_random() % 60) + ":" + std::to_string(next_random() % 60);
+    line += ',';
+    line += levels[next_random() % 4];
+    for (int f = 0; f < 10; ++f) {
+      line += ',';
+      line += f % 3 == 0 ? std::to_string(next_random() % 100000)
+                         : std::string(1 + next_random() % 14, static_cast<char>('a' + f));
+    }
+    lines.push_back(std::move(line));
+  }
+  return lines;
+}();
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(csv_split_sv, {
+    std::size_t total = 0;
+    for (const std::string& line : g_lines) {
+      for (mystl::string_view field : mystl::views::split_sv(mystl::string_view(line.data(), line.size()), ',')) {
+        total += field.size();
+      }
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  MYSTL_BENCH(csv_find_loop, {
+    std::size_t total = 0;
+    for (const std::string& line : g_lines) {
+      std::string_view rest(line);
+      for (;;) {
+        const std::size_t pos = rest.find(',');
+        total += pos == std::string_view::npos ? rest.size() : pos;
+        if (pos == std::string_view::npos) {
+          break;
+        }
+        rest.remove_prefix(pos + 1);
+      }
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  MYSTL_BENCH(csv_std_views_split, {
+    std::size_t total = 0;
+    for (const std::string& line : g_lines) {
+      for (auto field : std::views::split(std::string_view(line), ',')) {
+        total += static_cast<std::size_t>(std::ranges::distance(field));
+      }
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  MYSTL_BENCH(csv_getline_vector_string, {
+    std::size_t total = 0;
+    std::vector<std::string> fields;
+    for (const std::string& line : g_lines) {
+      fields.clear();
+      std::istringstream in(line);
+      std::string field;
+      while (std::getline(in, field, ',')) {
+        fields.push_back(field);
+      }
+      for (const auto& f : fields) {
+        total += f.size();
+      }
+    }
+    mystl_bench::do_not_optimize(total);
+  });
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/algorithms/sorting.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// mystl::stable_sort（powersort）对比 std::stable_sort，10K 到 1M 个 uint64_t：
+// - sorted / reversed：单个段，应随 n 线性增长
+// - nearly_sorted：每 100 个元素中有一个 8 元素的乱序窗口（模拟到达时间略有抖动的事件流）
+// - runs：随机长度（最长 4096）的有序段拼接；random：完全随机
+// 每次计时都先把源数据复制到工作区，copy 一行是复制本身的开销。
+// 默认最大 1M，命令行参数可调：mystl_bench_stable_sort 100000000
+
+namespace {
+
+using mystl_bench::next_random;
+
+std::vector<std::uint64_t> make_input(const std::string& kind, std::size_t n) {
+  std::vector<std::uint64_t> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i] = kind == "reversed" ? n - i : kind == "random" ? next_random() : i;
+  }
+  if (kind == "nearly_sorted") {
+    for (std::size_t i = 0; i + 8 <= n; i += 100) {
+      for (std::size_t k = 7; k > 0; --k) {
+        std::swap(v[i + k], v[i + next_random() % (k + 1)]);
+      }
+    }
+  } else if (kind == "runs") {
+    for (std::size_t i = 0; i < n;) {
+      const std::size_t len = std::min<std::size_t>(1 + next_random() % 4096, n - i);
+      const std::uint64_t base = next_random() % n;
+      for (std::size_t k = 0; k < len; ++k) {
+        v[i + k] = base + k;
+      }
+      i += len;
+    }
+  }
+  return v;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t max_n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+  for (std::size_t n = 10000; n <= max_n; n *= 10) {
+    mystl_bench::BenchConfig cfg;
+    if (n >= 10000000) {
+      cfg.warmup_iters = 0;
+      cfg.measure_iters = 1;
+    } else if (n >= 1000000) {
+      cfg.warmup_iters = 1;
+      cfg.measure_iters = 3;
+    }
+    std::vector<std::uint64_t> work(n);
+    for (const char* kind : {"sorted", "reversed", "nearly_sorted", "runs", "random"}) {
+      const std::vector<std::uint64_t> src = make_input(kind, n);
+      const std::string suffix = std::string(kind) + "_" + std::to_string(n);
+      mystl_bench::run(("copy_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(std::uint64_t));
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+      mystl_bench::run(("mystl_stable_sort_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(std::uint64_t));
+        mystl::stable_sort(work.begin(), work.end());
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+      mystl_bench::run(("std_stable_sort_" + suffix).c_str(), [&] {
+        std::memcpy(work.data(), src.data(), n * sizeof(std::uint64_t));
+        std::stable_sort(work.begin(), work.end());
+        mystl_bench::do_not_optimize(work.data());
+      }, cfg);
+    }
+  }
+  return 0;
+}
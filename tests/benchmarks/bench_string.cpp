@@ -0,0 +1,78 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/string.hpp"
+
+#include <cstddef>
+#include <string>
+
+// 长度 0..64 下构造、追加、拷贝：mystl::string（23 字节 SSO）对比 std::string
+
+namespace {
+
+constexpr int kReps = 100000;
+constexpr std::size_t kLengths[] = {0, 8, 15, 16, 23, 24, 32, 48, 64};
+
+const char kSource[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!?";
+
+template <class String>
+void construct(std::size_t len) {
+  const char* src = mystl_bench::launder_pointer(kSource);
+  for (int i = 0; i < kReps; ++i) {
+    String s(src, len);
+    mystl_bench::do_not_optimize(s);
+  }
+}
+
+template <class String>
+void append_chars(std::size_t len) {
+  for (int i = 0; i < kReps / 8; ++i) {
+    String s;
+    for (std::size_t k = 0; k < len; ++k) {
+      s.push_back(kSource[k]);
+    }
+    mystl_bench::do_not_optimize(s);
+  }
+}
+
+template <class String>
+void append_pieces(std::size_t len) {
+  const char* src = mystl_bench::launder_pointer(kSource);
+  for (int i = 0; i < kReps; ++i) {
+    String s;
+    for (std::size_t k = 0; k < len; k += 8) {
+      s.append(src + k, len - k < 8 ? len - k : 8);
+    }
+    mystl_bench::do_not_optimize(s);
+  }
+}
+
+template <class String>
+void copy(std::size_t len) {
+  const String original(kSource, len);
+  for (int i = 0; i < kReps; ++i) {
+    String s(original);
+    mystl_bench::do_not_optimize(s);
+  }
+}
+
+template <class Fn>
+void run_lengths(const char* op, Fn fn) {
+  for (std::size_t len : kLengths) {
+    const std::string name = std::string(op) + "_len" + std::to_string(len);
+    mystl_bench::run(name.c_str(), [&] { fn(len); });
+  }
+}
+
+}  // namespace
+
+int main() {
+  run_lengths("construct_mystl", construct<mystl::string>);
+  run_lengths("construct_std", construct<std::string>);
+  run_lengths("push_back_mystl", append_chars<mystl::string>);
+  run_lengths("push_back_std", append_chars<std::string>);
+  run_lengths("append8_mystl", append_pieces<mystl::string>);
+  run_lengths("append8_std", append_pieces<std::string>);
+  run_lengths("copy_mystl", copy<mystl::string>);
+  run_lengths("copy_std", copy<std::string>);
+  return 0;
+}
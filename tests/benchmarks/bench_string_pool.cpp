@@ -0,0 +1,73 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/string_pool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// 5 万个不同标签反复出现：驻留后比较 ID 对比直接比较字符串；驻留本身对比 unordered_set<std::string>
+
+namespace {
+
+constexpr int kDistinct = 50000;
+constexpr int kStream = 400000;
+
+std::vector<std::string> make_stream() {
+  std::vector<std::string> stream;
+  std::uint32_t x = 12345;
+  for (int i = 0; i < kStream; ++i) {
+    x = x * 1664525u + 1013904223u;
+    stream.push_back("region=eu-west,host=web-" + std::to_string(x % kDistinct));
+  }
+  return stream;
+}
+
+const std::vector<std::string> g_stream = make_stream();
+
+mystl::string_view as_view(const std::string& s) noexcept { return mystl::string_view(s.data(), s.size()); }
+
+std::vector<mystl::string_pool::id_type> intern_all(mystl::string_pool& pool) {
+  std::vector<mystl::string_pool::id_type> ids;
+  ids.reserve(g_stream.size());
+  for (const auto& s : g_stream) {
+    ids.push_back(pool.intern(as_view(s)));
+  }
+  return ids;
+}
+
+mystl::string_pool g_pool;
+const std::vector<mystl::string_pool::id_type> g_ids = intern_all(g_pool);
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(intern_string_pool, {
+    mystl::string_pool pool;
+    mystl_bench::do_not_optimize(intern_all(pool));
+  });
+  MYSTL_BENCH(intern_unordered_set, {
+    std::unordered_set<std::string> set;
+    for (const auto& s : g_stream) {
+      mystl_bench::do_not_optimize(*set.insert(s).first);
+    }
+  });
+  // 相邻元素判等：驻留后只比较 32 位 ID
+  MYSTL_BENCH(compare_ids, {
+    std::size_t equal = 0;
+    for (std::size_t i = 1; i < g_ids.size(); ++i) {
+      equal += g_ids[i] == g_ids[i - 1] ? 1u : 0u;
+    }
+    mystl_bench::do_not_optimize(equal);
+  });
+  MYSTL_BENCH(compare_strings, {
+    std::size_t equal = 0;
+    for (std::size_t i = 1; i < g_stream.size(); ++i) {
+      equal += g_stream[i] == g_stream[i - 1] ? 1u : 0u;
+    }
+    mystl_bench::do_not_optimize(equal);
+  });
+  return 0;
+}
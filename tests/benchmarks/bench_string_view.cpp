@@ -0,0 +1,120 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/string_view.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// 模拟 HTTP 头部解析中的查找：mystl::string_view（向量内核）对比 std::string_view
+
+namespace {
+
+std::string make_headers() {
+  std::string text;
+  for (int i = 0; i < 2000; ++i) {
+    text += "X-Custom-Header-" + std::to_string(i) + ":    some moderately long header value ";
+    text += std::string(static_cast<std::size_t>(i % 64), 'v');
+    text += "\r\n";
+  }
+  return text;
+}
+
+const std::string g_text = make_headers();
+
+template <class View>
+std::size_t count_lines(View v) {
+  std::size_t lines = 0;
+  for (std::size_t pos = v.find("\r\n"); pos != View::npos; pos = v.find("\r\n", pos + 2)) {
+    ++lines;
+  }
+  return lines;
+}
+
+template <class View>
+std::size_t count_newlines(View v) {
+  std::size_t lines = 0;
+  for (std::size_t pos = v.find('\n'); pos != View::npos; pos = v.find('\n', pos + 1)) {
+    ++lines;
+  }
+  return lines;
+}
+
+// 逐行拆出字段名与去掉前导空白的字段值
+template <class View>
+std::size_t parse_fields(View v) {
+  std::size_t total = 0;
+  std::size_t start = 0;
+  while (start < v.size()) {
+    const std::size_t colon = v.find_first_of(":\r\n", start);
+    if (colon == View::npos) {
+      break;
+    }
+    const std::size_t value = v.find_first_not_of(" \t", colon + 1);
+    const std::size_t end = v.find('\r', value);
+    total += colon - start + end - value;
+    start = end + 2;
+  }
+  return total;
+}
+
+// 从末尾向前逐行查找
+template <class View>
+std::size_t count_lines_backward(View v) {
+  std::size_t lines = 0;
+  for (std::size_t pos = v.rfind("\r\n"); pos != View::npos && pos > 0; pos = v.rfind("\r\n", pos - 1)) {
+    ++lines;
+  }
+  return lines;
+}
+
+// 逐行找字段值中最后一个非填充字符
+template <class View>
+std::size_t trim_trailing(View v) {
+  std::size_t total = 0;
+  for (std::size_t end = v.size(); end > 0;) {
+    const std::size_t last = v.find_last_not_of("v \r\n", end - 1);
+    if (last == View::npos) {
+      break;
+    }
+    total += last;
+    const std::size_t line = v.find_last_of('\n', last);
+    end = line == View::npos ? 0 : line;
+  }
+  return total;
+}
+
+template <class View>
+int compare_suffixes(View v) {
+  int acc = 0;
+  const View probe = v.substr(v.size() / 2);
+  for (std::size_t i = 0; i < 64; ++i) {
+    acc += v.substr(v.size() / 2 - i % 2).compare(probe) < 0 ? 1 : 0;
+  }
+  return acc;
+}
+
+template <class View>
+View whole() {
+  return View(mystl_bench::launder_pointer(g_text.data()), g_text.size());
+}
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(find_crlf_mystl, { mystl_bench::do_not_optimize(count_lines(whole<mystl::string_view>())); });
+  MYSTL_BENCH(find_crlf_std, { mystl_bench::do_not_optimize(count_lines(whole<std::string_view>())); });
+  MYSTL_BENCH(find_char_mystl, { mystl_bench::do_not_optimize(count_newlines(whole<mystl::string_view>())); });
+  MYSTL_BENCH(find_char_std, { mystl_bench::do_not_optimize(count_newlines(whole<std::string_view>())); });
+  MYSTL_BENCH(parse_fields_mystl, { mystl_bench::do_not_optimize(parse_fields(whole<mystl::string_view>())); });
+  MYSTL_BENCH(parse_fields_std, { mystl_bench::do_not_optimize(parse_fields(whole<std::string_view>())); });
+  MYSTL_BENCH(rfind_crlf_mystl,
+              { mystl_bench::do_not_optimize(count_lines_backward(whole<mystl::string_view>())); });
+  MYSTL_BENCH(rfind_crlf_std, { mystl_bench::do_not_optimize(count_lines_backward(whole<std::string_view>())); });
+  MYSTL_BENCH(find_last_not_of_mystl,
+              { mystl_bench::do_not_optimize(trim_trailing(whole<mystl::string_view>())); });
+  MYSTL_BENCH(find_last_not_of_std, { mystl_bench::do_not_optimize(trim_trailing(whole<std::string_view>())); });
+  MYSTL_BENCH(compare_mystl, { mystl_bench::do_not_optimize(compare_suffixes(whole<mystl::string_view>())); });
+  MYSTL_BENCH(compare_std, { mystl_bench::do_not_optimize(compare_suffixes(whole<std::string_view>())); });
+  return 0;
+}
@@ -0,0 +1,96 @@
+#include "tests/framework/mystl_bench.hpp"
+
+#include "mystl/containers/utf8.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// 校验与转码客户端上传的 UTF-8 文本：向量化内核对比逐字节的标量实现
+// 两种语料：ASCII 为主（日志、JSON 键名，约 1% 非 ASCII）与混合文本（约 60% 非 ASCII 码点）
+
+namespace {
+
+constexpr std::size_t kBytes = 4 << 20;
+
+std::string make_corpus(unsigned non_ascii_percent) {
+  std::string s;
+  while (s.size() < kBytes) {
+    const auto r = static_cast<unsigned>(mystl_bench::next_random());
+    char32_t cp;
+    if (r % 100 >= non_ascii_percent) {
+      cp = 0x20 + (r >> 8) % 0x5F;
+    } else {
+      switch ((r >> 8) % 3) {
+        case 0:
+          cp = 0x400 + (r >> 10) % 0x100;  // 西里尔字母
+          break;
+        case 1:
+          cp = 0x4E00 + (r >> 10) % 0x5000;  // CJK
+          break;
+        default:
+          cp = 0x1F600 + (r >> 10) % 0x50;  // emoji
+      }
+    }
+    char buf[4];
+    s.append(buf, static_cast<std::size_t>(mystl::__details::utf8_encode(cp, buf)));
+  }
+  return s;
+}
+
+const std::string g_ascii = make_corpus(1);
+const std::string g_mixed = make_corpus(60);
+std::vector<char16_t> g_u16(kBytes);
+
+// 逐字节的基线：先前线上使用的状态机写法
+bool naive_validate(const std::string& s) {
+  std::size_t i = 0;
+  while (i < s.size()) {
+    char32_t cp = 0;
+    const int len = mystl::__details::utf8_decode(s.data(), s.size(), i, cp);
+    if (len == 0) {
+      return false;
+    }
+    i += static_cast<std::size_t>(len);
+  }
+  return true;
+}
+
+std::size_t naive_to_utf16(const std::string& s, char16_t* out) {
+  std::size_t i = 0;
+  std::size_t o = 0;
+  while (i < s.size()) {
+    char32_t cp = 0;
+    const int len = mystl::__details::utf8_decode(s.data(), s.size(), i, cp);
+    if (cp >= 0x10000) {
+      out[o++] = static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+      out[o++] = static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+    } else {
+      out[o++] = static_cast<char16_t>(cp);
+    }
+    i += static_cast<std::size_t>(len);
+  }
+  return o;
+}
+
+mystl::string_view view(const std::string& s) { return mystl::string_view(s.data(), s.size()); }
+
+}  // namespace
+
+int main() {
+  MYSTL_BENCH(validate_ascii_mystl, { mystl_bench::do_not_optimize(mystl::utf8::validate(view(g_ascii))); });
+  MYSTL_BENCH(validate_ascii_naive, { mystl_bench::do_not_optimize(naive_validate(g_ascii)); });
+  MYSTL_BENCH(validate_mixed_mystl, { mystl_bench::do_not_optimize(mystl::utf8::validate(view(g_mixed))); });
+  MYSTL_BENCH(validate_mixed_naive, { mystl_bench::do_not_optimize(naive_validate(g_mixed)); });
+  MYSTL_BENCH(count_mixed_mystl,
+              { mystl_bench::do_not_optimize(mystl::utf8::count_code_points(view(g_mixed))); });
+  MYSTL_BENCH(to_utf16_ascii_mystl, {
+    mystl_bench::do_not_optimize(mystl::utf8::to_utf16(view(g_ascii), g_u16).written);
+  });
+  MYSTL_BENCH(to_utf16_ascii_naive, { mystl_bench::do_not_optimize(naive_to_utf16(g_ascii, g_u16.data())); });
+  MYSTL_BENCH(to_utf16_mixed_mystl, {
+    mystl_bench::do_not_optimize(mystl::utf8::to_utf16(view(g_mixed), g_u16).written);
+  });
+  MYSTL_BENCH(to_utf16_mixed_naive, { mystl_bench::do_not_optimize(naive_to_utf16(g_mixed, g_u16.data())); });
+  return 0;
+}
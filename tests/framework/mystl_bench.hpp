@@ -6,13 +6,37 @@
 #include <iostream>
 #include <string>
 
+#include "tests/framework/mystl_random.hpp"
+
 namespace mystl_bench {
 
+using mystl_test::next_random;
+
 struct BenchConfig {
   int warmup_iters = 3;
   int measure_iters = 10;
 };
 
+// 阻止编译器把基准结果当作死代码删除
+template <class T>
+inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static const void* volatile sink;
+  sink = &value;
+#endif
+}
+
+// 返回同一指针，但编译器无法推断其来源（对齐、是否与其他指针重叠）
+template <class T>
+inline T* launder_pointer(T* p) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : "+r"(p));
+#endif
+  return p;
+}
+
 inline void run(const char* name, const std::function<void()>& func, BenchConfig cfg = {}) {
   using clock = std::chrono::steady_clock;
   for (int i = 0; i < cfg.warmup_iters; ++i)
@@ -30,6 +54,7 @@ inline void run(const char* name, const std::function<void()>& func, BenchConfig
 
 }  // namespace mystl_bench
 
-#define MYSTL_BENCH(name, body) ::mystl_bench::run(#name, [] body)
+// 基准体为可变参数，允许其中出现未加括号的逗号
+#define MYSTL_BENCH(name, ...) ::mystl_bench::run(#name, [] __VA_ARGS__)
 
 #endif  // MYSTL_TEST_FRAMEWORK_BENCH_HPP
@@ -0,0 +1,19 @@
+#ifndef MYSTL_TEST_FRAMEWORK_RANDOM_HPP
+#define MYSTL_TEST_FRAMEWORK_RANDOM_HPP
+
+#include <cstdint>
+
+namespace mystl_test {
+
+// 固定种子的 xorshift64 序列：单元测试与基准的输入在各平台上都可复现
+inline std::uint64_t next_random() noexcept {
+  static std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+}  // namespace mystl_test
+
+#endif  // MYSTL_TEST_FRAMEWORK_RANDOM_HPP
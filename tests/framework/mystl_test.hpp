@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include "tests/framework/mystl_random.hpp"
+
 namespace mystl_test {
 
 struct TestCase {
@@ -62,10 +64,11 @@ inline void expect(bool cond, const char* expr, const char* file, int line) {
 
 }  // namespace mystl_test
 
-#define MYSTL_TEST(name, body)                                                         \
+// 测试体为可变参数，允许其中出现未加括号的逗号（如模板实参、花括号初始化列表）
+#define MYSTL_TEST(name, ...)                                                          \
   static void mystl_test_fn_##name();                                                  \
   static ::mystl_test::Registrar mystl_registrar_##name(#name, &mystl_test_fn_##name); \
-  static void mystl_test_fn_##name() body
+  static void mystl_test_fn_##name() __VA_ARGS__
 
 #define MYSTL_EXPECT(cond) ::mystl_test::expect((cond), #cond, __FILE__, __LINE__)
 #define MYSTL_EXPECT_EQ(a, b) ::mystl_test::expect_eq((a), (b), #a, #b, __FILE__, __LINE__)
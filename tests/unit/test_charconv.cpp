@@ -0,0 +1,202 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/string.hpp"
+#include "mystl/core/charconv.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace {
+
+using mystl_test::next_random;
+
+template <class T>
+std::string mystl_str(T value, int base = 10) {
+  char buf[80];
+  const auto r = mystl::to_chars(buf, buf + sizeof(buf), value, base);
+  return std::string(buf, r.ptr);
+}
+
+template <class T>
+std::string std_str(T value, int base = 10) {
+  char buf[80];
+  const auto r = std::to_chars(buf, buf + sizeof(buf), value, base);
+  return std::string(buf, r.ptr);
+}
+
+template <class F>
+std::string mystl_float(F value) {
+  char buf[64];
+  const auto r = mystl::to_chars(buf, buf + sizeof(buf), value);
+  return std::string(buf, r.ptr);
+}
+
+template <class F>
+std::string std_float(F value) {
+  char buf[64];
+  const auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  return std::string(buf, r.ptr);
+}
+
+// 输出与标准库逐字相同，且能精确解析回原值
+template <class F, class Bits>
+bool float_round_trips(F value) {
+  const std::string text = mystl_float(value);
+  if (text != std_float(value)) {
+    return false;
+  }
+  F back{};
+  const auto r = mystl::from_chars(text.data(), text.data() + text.size(), back);
+  return r.ec == std::errc{} && r.ptr == text.data() + text.size() && std::bit_cast<Bits>(back) == std::bit_cast<Bits>(value);
+}
+
+}  // namespace
+
+static_assert([] {
+  char buf[8] = {};
+  const auto r = mystl::to_chars(buf, buf + 8, -1234);
+  return r.ptr == buf + 5 && buf[0] == '-' && buf[4] == '4';
+}());
+
+MYSTL_TEST(charconv_integers_match_std, {
+  for (int i = 0; i < 20000; ++i) {
+    // 按位宽随机，覆盖各种位数
+    const std::uint64_t u = next_random() >> (next_random() % 64);
+    const auto s = static_cast<std::int64_t>(next_random()) >> (next_random() % 64);
+    MYSTL_EXPECT(mystl_str(u) == std_str(u));
+    MYSTL_EXPECT(mystl_str(s) == std_str(s));
+    MYSTL_EXPECT(mystl_str(static_cast<std::uint32_t>(u)) == std_str(static_cast<std::uint32_t>(u)));
+    MYSTL_EXPECT(mystl_str(static_cast<std::int16_t>(s)) == std_str(static_cast<std::int16_t>(s)));
+    const int base = 2 + static_cast<int>(next_random() % 35);
+    MYSTL_EXPECT(mystl_str(s, base) == std_str(s, base));
+  }
+  MYSTL_EXPECT(mystl_str(0) == "0");
+  MYSTL_EXPECT(mystl_str(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+  MYSTL_EXPECT(mystl_str(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+  MYSTL_EXPECT(mystl_str(std::numeric_limits<signed char>::min()) == "-128");
+
+  char small[3];
+  const auto r = mystl::to_chars(small, small + 3, 1000);
+  MYSTL_EXPECT(r.ec == std::errc::value_too_large);
+  MYSTL_EXPECT(r.ptr == small + 3);
+});
+
+MYSTL_TEST(charconv_from_chars_integers, {
+  const auto parse = [](const std::string& text, auto& value, int base = 10) {
+    return mystl::from_chars(text.data(), text.data() + text.size(), value, base);
+  };
+  std::int32_t i = 7;
+  MYSTL_EXPECT(parse("-2147483648xyz", i).ec == std::errc{});
+  MYSTL_EXPECT_EQ(i, std::numeric_limits<std::int32_t>::min());
+  const std::string big = "2147483648 rest";
+  const auto r = parse(big, i);
+  MYSTL_EXPECT(r.ec == std::errc::result_out_of_range);
+  MYSTL_EXPECT(r.ptr == big.data() + 10);
+  MYSTL_EXPECT_EQ(i, std::numeric_limits<std::int32_t>::min());
+  MYSTL_EXPECT(parse("+1", i).ec == std::errc::invalid_argument);
+  MYSTL_EXPECT(parse(" 1", i).ec == std::errc::invalid_argument);
+
+  std::uint8_t u8 = 0;
+  MYSTL_EXPECT(parse("255", u8).ec == std::errc{});
+  MYSTL_EXPECT_EQ(u8, 255);
+  MYSTL_EXPECT(parse("256", u8).ec == std::errc::result_out_of_range);
+  MYSTL_EXPECT(parse("-1", u8).ec == std::errc::invalid_argument);
+
+  std::uint64_t u = 0;
+  MYSTL_EXPECT(parse("ffFFffFFffFFffFF", u, 16).ec == std::errc{});
+  MYSTL_EXPECT_EQ(u, std::numeric_limits<std::uint64_t>::max());
+  MYSTL_EXPECT(parse("18446744073709551616", u).ec == std::errc::result_out_of_range);
+
+  for (int k = 0; k < 10000; ++k) {
+    const auto v = static_cast<std::int64_t>(next_random()) >> (next_random() % 64);
+    const std::string text = std_str(v);
+    std::int64_t back = 0;
+    MYSTL_EXPECT(parse(text, back).ec == std::errc{});
+    MYSTL_EXPECT_EQ(back, v);
+  }
+});
+
+MYSTL_TEST(charconv_floats_shortest_round_trip, {
+  for (int i = 0; i < 200000; ++i) {
+    const std::uint64_t bits = next_random();
+    const double d = std::bit_cast<double>(bits);
+    const float f = std::bit_cast<float>(static_cast<std::uint32_t>(bits));
+    if (!std::isnan(d)) {
+      MYSTL_EXPECT((float_round_trips<double, std::uint64_t>(d)));
+    }
+    if (!std::isnan(f)) {
+      MYSTL_EXPECT((float_round_trips<float, std::uint32_t>(f)));
+    }
+  }
+  // 2 的幂（下边界更近）、次正规数、整数与常见小数
+  for (int e = -1074; e < 1024; ++e) {
+    MYSTL_EXPECT((float_round_trips<double, std::uint64_t>(std::ldexp(1.0, e))));
+  }
+  for (int e = -149; e < 128; ++e) {
+    MYSTL_EXPECT((float_round_trips<float, std::uint32_t>(std::ldexp(1.0f, e))));
+  }
+  MYSTL_EXPECT(mystl_float(0.1) == "0.1");
+  MYSTL_EXPECT(mystl_float(1e23) == "1e+23");
+  MYSTL_EXPECT(mystl_float(123456.0) == "123456");
+  MYSTL_EXPECT(mystl_float(-0.0) == "-0");
+  MYSTL_EXPECT(mystl_float(5e-324) == "5e-324");
+  MYSTL_EXPECT(mystl_float(0.3f) == "0.3");
+  MYSTL_EXPECT(mystl_float(std::numeric_limits<double>::infinity()) == "inf");
+  MYSTL_EXPECT(mystl_float(-std::numeric_limits<float>::infinity()) == "-inf");
+  // 定点格式下的大整数写出精确值
+  MYSTL_EXPECT(mystl_float(9223372036854775808.0) == std_float(9223372036854775808.0));
+});
+
+MYSTL_TEST(charconv_from_chars_floats_match_std, {
+  const char* inputs[] = {"0",      "-0.0",   "3.14159", "1e10",   "1E-10",  "123.456e+2", ".5",
+                          "5.",     "1e",     "1e+",     "2.5e-3x", "inf",   "-nan",       "1e400",
+                          "0.1000000000000000055511151231257827", "9007199254740993", "abc", "-", "."};
+  for (const char* text : inputs) {
+    const char* end = text + std::char_traits<char>::length(text);
+    double a = -1.0;
+    double b = -1.0;
+    const auto ra = mystl::from_chars(text, end, a);
+    const auto rb = std::from_chars(text, end, b);
+    MYSTL_EXPECT(ra.ec == rb.ec);
+    MYSTL_EXPECT(ra.ptr == rb.ptr);
+    MYSTL_EXPECT(std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b));
+  }
+  for (int i = 0; i < 20000; ++i) {
+    // 短小数：走快速路径
+    const std::string text = std::to_string(next_random() % 1000000) + "." + std::to_string(next_random() % 10000);
+    double a = 0;
+    double b = 0;
+    mystl::from_chars(text.data(), text.data() + text.size(), a);
+    std::from_chars(text.data(), text.data() + text.size(), b);
+    MYSTL_EXPECT_EQ(a, b);
+    float fa = 0;
+    float fb = 0;
+    mystl::from_chars(text.data(), text.data() + text.size(), fa);
+    std::from_chars(text.data(), text.data() + text.size(), fb);
+    MYSTL_EXPECT_EQ(fa, fb);
+  }
+});
+
+MYSTL_TEST(string_append_number, {
+  mystl::string s("cpu=");
+  s.append_number(42).append(",t=").append_number(-7LL).append(",v=").append_number(0.25);
+  MYSTL_EXPECT(s == "cpu=42,t=-7,v=0.25");
+  MYSTL_EXPECT(s.is_inline());
+
+  // 空闲容量不足最坏长度时也只按实际长度增长
+  mystl::string t("0123456789012345678901");
+  t.append_number(5u);
+  MYSTL_EXPECT(t == "01234567890123456789015");
+  MYSTL_EXPECT(t.is_inline());
+
+  mystl::string big;
+  for (int i = 0; i < 1000; ++i) {
+    big.append_number(static_cast<float>(i) * 1.5f).push_back(' ');
+  }
+  MYSTL_EXPECT(big.starts_with("0 1.5 3 4.5 "));
+  MYSTL_EXPECT(big.ends_with("1498.5 "));
+});
@@ -0,0 +1,92 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/format.hpp"
+#include "mystl/containers/shared_string.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using mystl::string;
+using mystl::string_view;
+
+MYSTL_TEST(format_basic_arguments, {
+  string s = mystl::format("id={} name={} ok={} c={} r={}", 42, "alice", true, 'x', 0.5);
+  MYSTL_EXPECT(string_view(s) == "id=42 name=alice ok=true c=x r=0.5");
+
+  MYSTL_EXPECT(string_view(mystl::format("no placeholders")) == "no placeholders");
+  MYSTL_EXPECT(string_view(mystl::format("")) == "");
+  MYSTL_EXPECT(string_view(mystl::format("{}{}", -1, false)) == "-1false");
+  MYSTL_EXPECT(string_view(mystl::format("{}", INT64_MIN)) == "-9223372036854775808");
+  MYSTL_EXPECT(string_view(mystl::format("{}", UINT64_MAX)) == "18446744073709551615");
+  MYSTL_EXPECT(string_view(mystl::format("{}", -1.5e-300)) == "-1.5e-300");
+  MYSTL_EXPECT(string_view(mystl::format("{}", 0.1f)) == "0.1");
+});
+
+MYSTL_TEST(format_string_like_arguments, {
+  const string owned("owned");
+  const mystl::shared_string shared("shared");
+  const char* cstr = "cstr";
+  string s = mystl::format("[{}|{}|{}|{}]", owned, shared, cstr, string_view("view"));
+  MYSTL_EXPECT(string_view(s) == "[owned|shared|cstr|view]");
+  MYSTL_EXPECT(string_view(mystl::format("{}/{}", std::string("std"), std::string_view("sv"))) == "std/sv");
+
+  // 长字符串参数越过 SSO 并触发扩容
+  const string big(1000, 'z');
+  s = mystl::format("<{}>", big);
+  MYSTL_EXPECT_EQ(s.size(), 1002u);
+  MYSTL_EXPECT(s.front() == '<' && s[500] == 'z' && s.back() == '>');
+});
+
+MYSTL_TEST(format_specifiers_and_escapes, {
+  MYSTL_EXPECT(string_view(mystl::format("{:x} {:X} {:o} {:b}", 255, 255u, 8, 5)) == "ff FF 10 101");
+  MYSTL_EXPECT(string_view(mystl::format("{:x}", -255)) == "-ff");
+  MYSTL_EXPECT(string_view(mystl::format("{:b}", UINT64_MAX)) == string(64, '1'));
+  MYSTL_EXPECT(string_view(mystl::format("{:}", 7)) == "7");
+  MYSTL_EXPECT(string_view(mystl::format("{{{}}}", 1)) == "{1}");
+  MYSTL_EXPECT(string_view(mystl::format("a{{b}}c")) == "a{b}c");
+  MYSTL_EXPECT(string_view(mystl::format("{{}} {} {{", "x")) == "{} x {");
+});
+
+MYSTL_TEST(format_to_appends_in_place, {
+  string s;
+  s.reserve(200);
+  const char* before = s.data();
+  mystl::format_to(s, "ts={} ", 1700000000123LL);
+  mystl::format_to(s, "lvl={} msg={}", "INFO", "started");
+  MYSTL_EXPECT(string_view(s) == "ts=1700000000123 lvl=INFO msg=started");
+  MYSTL_EXPECT(s.data() == before);  // 空闲容量足够时不重新分配
+
+  // 追加到短字符串：旧内容保留，结果按实际长度截断
+  string t("x");
+  mystl::format_to(t, "{}{}", 1, 2);
+  MYSTL_EXPECT(string_view(t) == "x12");
+  MYSTL_EXPECT_EQ(t.size(), 3u);
+
+  // 参数可以是目标字符串自身的一个副本
+  string u("abc");
+  mystl::format_to(u, "-{}", string(u));
+  MYSTL_EXPECT(string_view(u) == "abc-abc");
+});
+
+MYSTL_TEST(format_to_argument_aliases_target, {
+  // 参数直接引用目标字符串的缓冲区，且追加后必须扩容
+  string s("0123456789abcdefghijklmnop");
+  const string_view v(s);
+  mystl::format_to(s, "[{}]", v);
+  MYSTL_EXPECT(string_view(s) == "0123456789abcdefghijklmnop[0123456789abcdefghijklmnop]");
+
+  string t("abc");
+  mystl::format_to(t, "-{}-{}", t, 7);
+  MYSTL_EXPECT(string_view(t) == "abc-abc-7");
+
+  // 只引用其中一段时同样成立
+  string u("hello world");
+  mystl::format_to(u, "{}!", string_view(u).substr(6));
+  MYSTL_EXPECT(string_view(u) == "hello worldworld!");
+});
+
+// 上界在编译期求得：字面文本长度 + 非字符串参数的最大长度
+static_assert(mystl::format_string<int>("v={}").fixed_bound() == 2 + mystl::max_chars_length<int>);
+static_assert(mystl::format_string<string_view>("{}!").fixed_bound() == 1);
+static_assert(mystl::format_string<>("{{}}").fixed_bound() == 2);
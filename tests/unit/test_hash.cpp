@@ -0,0 +1,153 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/shared_string.hpp"
+#include "mystl/containers/string.hpp"
+#include "mystl/core/hash.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct point {
+  std::int32_t x;
+  std::int32_t y;
+};
+
+struct padded {
+  char c;
+  std::int64_t v;
+};
+
+struct weighted {
+  int id;
+  float w;
+};
+
+enum class color : std::uint8_t { red, green };
+
+}  // namespace
+
+static_assert(mystl::is_uniquely_represented_v<point>);
+static_assert(!mystl::is_uniquely_represented_v<padded>);
+static_assert(!mystl::is_uniquely_represented_v<weighted>);
+static_assert(std::is_default_constructible_v<mystl::hash<point>>);
+static_assert(!std::is_default_constructible_v<mystl::hash<padded>>);
+static_assert(!std::is_default_constructible_v<mystl::hash<std::string>>);
+
+MYSTL_TEST(hash_strings_agree_across_types, {
+  const char* text = "requests.latency.p99";
+  const std::size_t h = mystl::hash<mystl::string_view>{}(mystl::string_view(text));
+  MYSTL_EXPECT_EQ(h, static_cast<std::size_t>(mystl::hash_bytes(text, std::strlen(text))));
+  MYSTL_EXPECT_EQ(h, mystl::hash<mystl::string>{}(mystl::string(text)));
+  MYSTL_EXPECT_EQ(h, mystl::hash<mystl::shared_string>{}(mystl::shared_string(text)));
+  MYSTL_EXPECT_EQ(h, mystl::hash<std::string_view>{}(std::string(text)));
+  MYSTL_EXPECT_EQ(h, mystl::string_hash{}(mystl::string_view(text)));
+  MYSTL_EXPECT_EQ(h, std::hash<mystl::string_view>{}(mystl::string_view(text)));
+
+  // 透明：hash<string_view> 也接受 string
+  MYSTL_EXPECT_EQ(mystl::hash<mystl::string_view>{}(mystl::string(text)), h);
+});
+
+MYSTL_TEST(hash_bytes_lengths_and_seed, {
+  // 各个长度分支（0、1..3、4..16、17..48、> 48）：前缀互不相同，只差末尾零字节的输入也不同
+  std::string buf(300, '\0');
+  for (std::size_t i = 0; i < buf.size(); ++i) {
+    buf[i] = static_cast<char>('a' + i % 23);
+  }
+  std::unordered_set<std::uint64_t> seen;
+  for (std::size_t n = 0; n <= buf.size(); ++n) {
+    MYSTL_EXPECT(seen.insert(mystl::hash_bytes(buf.data(), n)).second);
+  }
+  const std::string zeros(64, '\0');
+  for (std::size_t n = 0; n < zeros.size(); ++n) {
+    MYSTL_EXPECT(mystl::hash_bytes(zeros.data(), n) != mystl::hash_bytes(zeros.data(), n + 1));
+  }
+  MYSTL_EXPECT(mystl::hash_bytes("abc", 3) != mystl::hash_bytes("abc", 3, 1));
+  MYSTL_EXPECT_EQ(mystl::hash_bytes("abc", 3, 7), mystl::hash_bytes("abc", 3, 7));
+});
+
+MYSTL_TEST(hash_bytes_avalanche, {
+  // 翻转输入的任一位，输出平均约一半的位改变
+  std::uint64_t state = 0x1234567;
+  auto next = [&] {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 33;
+  };
+  for (const std::size_t n : {3u, 8u, 13u, 16u, 31u, 64u, 200u}) {
+    std::vector<unsigned char> key(n);
+    double flipped = 0;
+    int trials = 0;
+    for (int round = 0; round < 20; ++round) {
+      for (auto& b : key) {
+        b = static_cast<unsigned char>(next());
+      }
+      const std::uint64_t base = mystl::hash_bytes(key.data(), n);
+      for (std::size_t bit = 0; bit < n * 8; ++bit) {
+        key[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+        flipped += std::popcount(base ^ mystl::hash_bytes(key.data(), n));
+        key[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+        ++trials;
+      }
+    }
+    const double mean = flipped / trials;
+    MYSTL_EXPECT(mean > 30.0 && mean < 34.0);
+  }
+});
+
+MYSTL_TEST(hash_integers_spread_low_bits, {
+  // 步长为 4096 的键放进 1024 个桶：恒等哈希全部落到桶 0，混合后应接近均匀
+  constexpr std::size_t buckets = 1024;
+  constexpr std::size_t keys = buckets * 8;
+  for (const std::uint64_t stride : {1ULL, 8ULL, 4096ULL, 1ULL << 32}) {
+    std::vector<int> load(buckets);
+    for (std::uint64_t i = 0; i < keys; ++i) {
+      ++load[mystl::hash<std::uint64_t>{}(i * stride) & (buckets - 1)];
+    }
+    int max_load = 0;
+    int empty = 0;
+    for (const int l : load) {
+      max_load = l > max_load ? l : max_load;
+      empty += l == 0;
+    }
+    MYSTL_EXPECT(max_load < 24);
+    MYSTL_EXPECT(empty < 10);
+  }
+
+  // 对齐的指针同理
+  std::vector<std::uint64_t> storage(4096);
+  std::unordered_set<std::size_t> low;
+  for (auto& v : storage) {
+    low.insert(mystl::hash<std::uint64_t*>{}(&v) & (buckets - 1));
+  }
+  MYSTL_EXPECT(low.size() > buckets * 9 / 10);
+});
+
+MYSTL_TEST(hash_scalars_and_bytewise_structs, {
+  MYSTL_EXPECT_EQ(mystl::hash<int>{}(-1), mystl::hash<long long>{}(-1));
+  MYSTL_EXPECT(mystl::hash<int>{}(1) != mystl::hash<int>{}(2));
+  MYSTL_EXPECT(mystl::hash<bool>{}(true) != mystl::hash<bool>{}(false));
+  MYSTL_EXPECT_EQ(mystl::hash<color>{}(color::green), mystl::hash<std::uint8_t>{}(1));
+
+  MYSTL_EXPECT_EQ(mystl::hash<double>{}(0.0), mystl::hash<double>{}(-0.0));
+  MYSTL_EXPECT_EQ(mystl::hash<float>{}(0.0f), mystl::hash<float>{}(-0.0f));
+  MYSTL_EXPECT(mystl::hash<double>{}(1.0) != mystl::hash<double>{}(2.0));
+  MYSTL_EXPECT_EQ(mystl::hash<long double>{}(0.0L), mystl::hash<long double>{}(-0.0L));
+
+  const point p{3, -4};
+  MYSTL_EXPECT_EQ(mystl::hash<point>{}(p), static_cast<std::size_t>(mystl::hash_bytes(&p, sizeof(p))));
+  MYSTL_EXPECT(mystl::hash<point>{}(p) != mystl::hash<point>{}(point{-4, 3}));
+
+  std::unordered_set<point, mystl::hash<point>, decltype([](point a, point b) { return a.x == b.x && a.y == b.y; })>
+      set;
+  for (int i = 0; i < 100; ++i) {
+    set.insert(point{i, i * i});
+  }
+  MYSTL_EXPECT_EQ(set.size(), 100u);
+  MYSTL_EXPECT(set.contains(point{7, 49}));
+});
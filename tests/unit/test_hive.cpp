@@ -0,0 +1,319 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/hive.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+template <class Hive>
+std::vector<int> sorted_contents(const Hive& h) {
+  std::vector<int> out(h.begin(), h.end());
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+template <class Hive>
+std::size_t count_forward(const Hive& h) {
+  std::size_t n = 0;
+  for (auto it = h.begin(); it != h.end(); ++it) {
+    ++n;
+  }
+  return n;
+}
+
+template <class Hive>
+std::size_t count_backward(const Hive& h) {
+  std::size_t n = 0;
+  for (auto it = h.end(); it != h.begin();) {
+    --it;
+    ++n;
+  }
+  return n;
+}
+
+// 每个分配器 id 名下尚未归还的字节数；由错误的分配器释放时对应的计数不会归零
+long g_live_bytes[4] = {};
+
+// 有状态、移动赋值与交换时不传播的分配器，拷贝赋值是否传播由 Pocca 决定；不同 id 的实例互不相等
+template <class T, bool Pocca = false>
+struct tagged_allocator {
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::bool_constant<Pocca>;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  template <class U>
+  struct rebind {
+    using other = tagged_allocator<U, Pocca>;
+  };
+
+  int id = 0;
+
+  explicit tagged_allocator(int i) noexcept : id(i) {}
+  template <class U>
+  tagged_allocator(const tagged_allocator<U, Pocca>& other) noexcept : id(other.id) {}
+
+  T* allocate(std::size_t n) {
+    g_live_bytes[id] += static_cast<long>(n * sizeof(T));
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    g_live_bytes[id] -= static_cast<long>(n * sizeof(T));
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const tagged_allocator<U, Pocca>& other) const noexcept {
+    return id == other.id;
+  }
+};
+
+template <bool Pocca>
+void check_copy_assign_unequal_allocator() {
+  using alloc_t = tagged_allocator<int, Pocca>;
+  {
+    mystl::hive<int, alloc_t> a(mystl::hive_limits(64, 64), alloc_t(1));
+    for (int i = 0; i < 200; ++i) {
+      a.insert(i);
+    }
+    mystl::hive<int, alloc_t> b(mystl::hive_limits(8, 16), alloc_t(2));
+    b.set_reserved_block_limit(3);
+    for (int i = 0; i < 20; ++i) {
+      b.insert(i * 2);
+    }
+    a = b;
+    MYSTL_EXPECT_EQ(a.get_allocator().id, Pocca ? 2 : 1);
+    MYSTL_EXPECT_EQ(a.block_capacity_limits().max, 16u);
+    MYSTL_EXPECT_EQ(a.reserved_block_limit(), 3u);
+    MYSTL_EXPECT(a.capacity() < 64u);
+    MYSTL_EXPECT(sorted_contents(a) == sorted_contents(b));
+    MYSTL_EXPECT_EQ(b.size(), 20u);
+  }
+  // 每个块都由分配它的分配器归还
+  MYSTL_EXPECT_EQ(g_live_bytes[1], 0);
+  MYSTL_EXPECT_EQ(g_live_bytes[2], 0);
+}
+
+}  // namespace
+
+MYSTL_TEST(hive_insert_iterate, {
+  mystl::hive<int> h;
+  MYSTL_EXPECT(h.empty());
+  MYSTL_EXPECT(h.begin() == h.end());
+  for (int i = 0; i < 100; ++i) {
+    h.insert(i);
+  }
+  MYSTL_EXPECT_EQ(h.size(), 100u);
+  MYSTL_EXPECT_EQ(count_forward(h), 100u);
+  MYSTL_EXPECT_EQ(count_backward(h), 100u);
+  std::vector<int> expected(100);
+  for (int i = 0; i < 100; ++i) {
+    expected[static_cast<std::size_t>(i)] = i;
+  }
+  MYSTL_EXPECT(sorted_contents(h) == expected);
+});
+
+MYSTL_TEST(hive_erase_keeps_references_stable, {
+  mystl::hive<int> h(mystl::hive_limits(8, 8));
+  std::vector<int*> ptrs;
+  for (int i = 0; i < 64; ++i) {
+    ptrs.push_back(&*h.insert(i));
+  }
+  // 删除偶数，奇数元素的地址保持不变
+  for (auto it = h.begin(); it != h.end();) {
+    it = (*it % 2 == 0) ? h.erase(it) : std::next(it);
+  }
+  MYSTL_EXPECT_EQ(h.size(), 32u);
+  for (int i = 1; i < 64; i += 2) {
+    MYSTL_EXPECT_EQ(*ptrs[static_cast<std::size_t>(i)], i);
+  }
+  MYSTL_EXPECT_EQ(count_forward(h), 32u);
+  MYSTL_EXPECT_EQ(count_backward(h), 32u);
+});
+
+MYSTL_TEST(hive_reuses_erased_slots, {
+  mystl::hive<int> h(mystl::hive_limits(8, 8));
+  std::vector<int*> ptrs;
+  for (int i = 0; i < 16; ++i) {
+    ptrs.push_back(&*h.insert(i));
+  }
+  const auto cap = h.capacity();
+  h.erase(h.get_iterator(ptrs[3]));
+  h.erase(h.get_iterator(ptrs[4]));
+  h.erase(h.get_iterator(ptrs[5]));
+  int* reused = &*h.insert(100);
+  MYSTL_EXPECT(reused == ptrs[3] || reused == ptrs[4] || reused == ptrs[5]);
+  MYSTL_EXPECT_EQ(h.capacity(), cap);
+  MYSTL_EXPECT_EQ(h.size(), 14u);
+  MYSTL_EXPECT_EQ(count_forward(h), 14u);
+});
+
+MYSTL_TEST(hive_random_against_model, {
+  mystl::hive<int> h(mystl::hive_limits(4, 16));
+  std::vector<int> model;
+  int next = 0;
+  for (int step = 0; step < 20000; ++step) {
+    if (model.empty() || next_random() % 3 != 0) {
+      h.insert(next);
+      model.push_back(next);
+      ++next;
+    } else {
+      auto it = h.begin();
+      std::advance(it, static_cast<long>(next_random() % h.size()));
+      const int value = *it;
+      h.erase(it);
+      model.erase(std::find(model.begin(), model.end(), value));
+    }
+  }
+  std::sort(model.begin(), model.end());
+  MYSTL_EXPECT(sorted_contents(h) == model);
+  MYSTL_EXPECT_EQ(count_backward(h), model.size());
+});
+
+MYSTL_TEST(hive_erase_range_to_end, {
+  mystl::hive<std::string> h(mystl::hive_limits(4, 4));
+  for (int i = 0; i < 10; ++i) {
+    h.insert(std::to_string(i));
+  }
+  auto first = h.begin();
+  std::advance(first, 3);
+  auto it = h.erase(first, h.end());
+  MYSTL_EXPECT(it == h.end());
+  MYSTL_EXPECT_EQ(h.size(), 3u);
+  h.erase(h.begin(), h.end());
+  MYSTL_EXPECT(h.empty());
+});
+
+MYSTL_TEST(hive_empty_blocks_go_to_bounded_reserve, {
+  mystl::hive<int> h(mystl::hive_limits(8, 8));
+  h.set_reserved_block_limit(1);
+  std::vector<int*> ptrs;
+  for (int i = 0; i < 32; ++i) {
+    ptrs.push_back(&*h.insert(i));
+  }
+  MYSTL_EXPECT_EQ(h.capacity(), 32u);
+  // 清空前三个块：一个进入保留区，另外两个归还分配器
+  for (int i = 0; i < 24; ++i) {
+    h.erase(h.get_iterator(ptrs[static_cast<std::size_t>(i)]));
+  }
+  MYSTL_EXPECT_EQ(h.size(), 8u);
+  MYSTL_EXPECT_EQ(h.capacity(), 16u);
+  h.trim_capacity();
+  MYSTL_EXPECT_EQ(h.capacity(), 8u);
+  for (int i = 24; i < 32; ++i) {
+    MYSTL_EXPECT_EQ(*ptrs[static_cast<std::size_t>(i)], i);
+  }
+});
+
+MYSTL_TEST(hive_reserve_and_trim_capacity, {
+  mystl::hive<int> h(mystl::hive_limits(8, 64));
+  h.reserve(200);
+  MYSTL_EXPECT(h.capacity() >= 200u);
+  MYSTL_EXPECT(h.empty());
+  h.insert(1);
+  h.trim_capacity();
+  MYSTL_EXPECT(h.capacity() < 200u);
+  MYSTL_EXPECT_EQ(h.size(), 1u);
+  h.clear();
+  MYSTL_EXPECT(h.empty());
+  MYSTL_EXPECT(h.capacity() > 0u);
+  h.trim_capacity();
+  MYSTL_EXPECT_EQ(h.capacity(), 0u);
+});
+
+MYSTL_TEST(hive_shrink_to_fit_compacts, {
+  mystl::hive<int> h(mystl::hive_limits(8, 1024));
+  for (int i = 0; i < 1000; ++i) {
+    h.insert(i);
+  }
+  for (auto it = h.begin(); it != h.end();) {
+    it = (*it % 10 != 0) ? h.erase(it) : std::next(it);
+  }
+  MYSTL_EXPECT_EQ(h.size(), 100u);
+  h.shrink_to_fit();
+  MYSTL_EXPECT_EQ(h.size(), 100u);
+  MYSTL_EXPECT(h.capacity() <= 128u);
+  std::vector<int> expected;
+  for (int i = 0; i < 1000; i += 10) {
+    expected.push_back(i);
+  }
+  MYSTL_EXPECT(sorted_contents(h) == expected);
+});
+
+MYSTL_TEST(hive_reshape, {
+  mystl::hive<int> h(mystl::hive_limits(64, 64));
+  for (int i = 0; i < 100; ++i) {
+    h.insert(i);
+  }
+  h.reshape({8, 16});
+  MYSTL_EXPECT_EQ(h.block_capacity_limits().min, 8u);
+  MYSTL_EXPECT_EQ(h.block_capacity_limits().max, 16u);
+  MYSTL_EXPECT_EQ(h.size(), 100u);
+  MYSTL_EXPECT(h.capacity() < 128u);
+  MYSTL_EXPECT_EQ(count_backward(h), 100u);
+
+  bool threw = false;
+  try {
+    h.reshape({32, 16});
+  } catch (const std::length_error&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+  MYSTL_EXPECT_EQ(h.block_capacity_limits().max, 16u);
+});
+
+MYSTL_TEST(hive_move_assign_unequal_allocator_adopts_limits, {
+  using alloc_t = tagged_allocator<int>;
+  mystl::hive<int, alloc_t> a(mystl::hive_limits(64, 64), alloc_t(1));
+  for (int i = 0; i < 256; ++i) {
+    a.insert(i);
+  }
+  a.clear();
+  MYSTL_EXPECT(a.capacity() >= 256u);
+
+  mystl::hive<int, alloc_t> b(mystl::hive_limits(8, 16), alloc_t(2));
+  b.set_reserved_block_limit(3);
+  for (int i = 0; i < 20; ++i) {
+    b.insert(i);
+  }
+  a = std::move(b);
+  MYSTL_EXPECT_EQ(a.block_capacity_limits().max, 16u);
+  MYSTL_EXPECT_EQ(a.reserved_block_limit(), 3u);
+  MYSTL_EXPECT_EQ(a.size(), 20u);
+  // 旧的 64 槽块应已全部归还，剩下的块都在新上下限之内
+  MYSTL_EXPECT(a.capacity() < 64u);
+  MYSTL_EXPECT_EQ(count_backward(a), 20u);
+});
+
+MYSTL_TEST(hive_copy_assign_unequal_allocator, {
+  check_copy_assign_unequal_allocator<false>();
+  check_copy_assign_unequal_allocator<true>();
+});
+
+MYSTL_TEST(hive_copy_move_swap, {
+  mystl::hive<std::string> a;
+  a.insert(std::string("a"));
+  a.insert(std::string("b"));
+  a.insert(std::string("c"));
+  mystl::hive<std::string> b(a);
+  MYSTL_EXPECT_EQ(b.size(), 3u);
+  mystl::hive<std::string> c(std::move(a));
+  MYSTL_EXPECT_EQ(c.size(), 3u);
+  MYSTL_EXPECT(a.empty());
+  a = c;
+  MYSTL_EXPECT_EQ(a.size(), 3u);
+  mystl::hive<std::string> d(1, std::string("x"));
+  d.swap(a);
+  MYSTL_EXPECT_EQ(d.size(), 3u);
+  MYSTL_EXPECT_EQ(*a.begin(), std::string("x"));
+});
@@ -0,0 +1,182 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/adapters/indexed_priority_queue.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+// 随机 push / pop / update / decrease_key / erase，与"ID -> 键"的映射逐步比较；
+// 键相同时堆顶的 ID 不确定，只比较堆顶的键
+template <std::size_t Arity>
+void check_against_map() {
+  mystl::indexed_priority_queue<int, std::greater<int>, Arity> q;
+  std::map<std::size_t, int> ref;
+  constexpr std::size_t kIds = 300;
+  for (int step = 0; step < 20000; ++step) {
+    const std::size_t id = next_random() % kIds;
+    const int key = static_cast<int>(next_random() % 500);
+    switch (next_random() % 6) {
+      case 0:
+      case 1:
+        MYSTL_EXPECT_EQ(q.push_or_update(id, key), ref.count(id) == 0);
+        ref[id] = key;
+        break;
+      case 2:
+        if (!ref.empty()) {
+          const std::size_t top = q.top_id();
+          MYSTL_EXPECT_EQ(ref.at(top), q.top_key());
+          q.pop();
+          ref.erase(top);
+        }
+        break;
+      case 3:
+        if (ref.count(id) != 0 && key < ref[id]) {
+          q.decrease_key(id, key);
+          ref[id] = key;
+        }
+        break;
+      case 4:
+        MYSTL_EXPECT_EQ(q.erase(id), ref.erase(id) == 1);
+        break;
+      default:
+        if (ref.count(id) != 0) {
+          q.update(id, key);
+          ref[id] = key;
+        }
+        break;
+    }
+    MYSTL_EXPECT_EQ(q.size(), ref.size());
+    for (std::size_t i = 0; i < kIds; i += 37) {
+      MYSTL_EXPECT_EQ(q.contains(i), ref.count(i) != 0);
+      if (q.contains(i)) {
+        MYSTL_EXPECT_EQ(q.key(i), ref.at(i));
+      }
+    }
+    if (!ref.empty()) {
+      int best = std::numeric_limits<int>::max();
+      for (const auto& kv : ref) {
+        best = std::min(best, kv.second);
+      }
+      MYSTL_EXPECT_EQ(q.top_key(), best);
+    }
+  }
+}
+
+}  // namespace
+
+MYSTL_TEST(indexed_priority_queue_basic, {
+  mystl::indexed_priority_queue<int> q;
+  static_assert(decltype(q)::arity == 4);
+  MYSTL_EXPECT(q.empty());
+  q.push(3, 30);
+  q.push(7, 70);
+  q.push(1, 10);
+  MYSTL_EXPECT_EQ(q.size(), 3u);
+  MYSTL_EXPECT_EQ(q.id_bound(), 8u);
+  MYSTL_EXPECT_EQ(q.top_id(), 7u);
+
+  q.update(1, 100);
+  MYSTL_EXPECT_EQ(q.top_id(), 1u);
+  q.update(1, 5);
+  MYSTL_EXPECT_EQ(q.top_id(), 7u);
+  q.decrease_key(3, 80);  // 最大堆中"提高优先级"即增大键
+  MYSTL_EXPECT_EQ(q.top_id(), 3u);
+
+  MYSTL_EXPECT(q.erase(3));
+  MYSTL_EXPECT(!q.erase(3));
+  MYSTL_EXPECT(!q.erase(1000));
+  MYSTL_EXPECT_EQ(q.top_id(), 7u);
+  q.pop();
+  MYSTL_EXPECT_EQ(q.top_id(), 1u);
+  MYSTL_EXPECT_EQ(q.key(1), 5);
+
+  q.clear();
+  MYSTL_EXPECT(q.empty());
+  MYSTL_EXPECT(!q.contains(1));
+  q.push(1, 2);
+  MYSTL_EXPECT_EQ(q.top_key(), 2);
+});
+
+MYSTL_TEST(indexed_priority_queue_matches_reference, {
+  check_against_map<2>();
+  check_against_map<4>();
+  check_against_map<8>();
+});
+
+// Dijkstra：decrease_key 版本与"重复入队 + 跳过过期项"版本的距离一致，且队列从不超过顶点数
+MYSTL_TEST(indexed_priority_queue_dijkstra, {
+  constexpr std::size_t kNodes = 2000;
+  std::vector<std::vector<std::pair<std::size_t, std::uint32_t>>> adj(kNodes);
+  for (std::size_t e = 0; e < kNodes * 8; ++e) {
+    adj[next_random() % kNodes].emplace_back(next_random() % kNodes, next_random() % 1000);
+  }
+
+  constexpr auto inf = std::numeric_limits<std::uint64_t>::max();
+  std::vector<std::uint64_t> dist(kNodes, inf);
+  mystl::indexed_priority_queue<std::uint64_t, std::greater<std::uint64_t>> q(kNodes);
+  dist[0] = 0;
+  q.push(0, 0);
+  std::size_t peak = 0;
+  while (!q.empty()) {
+    const std::size_t u = q.top_id();
+    q.pop();
+    for (const auto& [v, w] : adj[u]) {
+      if (dist[u] + w < dist[v]) {
+        dist[v] = dist[u] + w;
+        q.push_or_update(v, dist[v]);
+      }
+    }
+    peak = std::max(peak, q.size());
+  }
+  MYSTL_EXPECT(peak <= kNodes);
+
+  using item = std::pair<std::uint64_t, std::size_t>;
+  std::vector<std::uint64_t> ref(kNodes, inf);
+  std::priority_queue<item, std::vector<item>, std::greater<item>> lazy;
+  ref[0] = 0;
+  lazy.emplace(0, 0);
+  while (!lazy.empty()) {
+    const auto [d, u] = lazy.top();
+    lazy.pop();
+    if (d != ref[u]) {
+      continue;
+    }
+    for (const auto& [v, w] : adj[u]) {
+      if (d + w < ref[v]) {
+        ref[v] = d + w;
+        lazy.emplace(ref[v], v);
+      }
+    }
+  }
+  MYSTL_EXPECT(dist == ref);
+});
+
+MYSTL_TEST(indexed_priority_queue_move_only_key, {
+  struct by_length {
+    bool operator()(const std::unique_ptr<std::string>& a, const std::unique_ptr<std::string>& b) const {
+      return a->size() < b->size();
+    }
+  };
+  mystl::indexed_priority_queue<std::unique_ptr<std::string>, by_length, 2> q;
+  q.push(0, std::make_unique<std::string>("ab"));
+  q.push(1, std::make_unique<std::string>("abcd"));
+  q.push(2, std::make_unique<std::string>("abc"));
+  MYSTL_EXPECT_EQ(*q.top_key(), std::string("abcd"));
+  q.update(0, std::make_unique<std::string>("abcdef"));
+  MYSTL_EXPECT_EQ(q.top_id(), 0u);
+  q.pop();
+  q.pop();
+  MYSTL_EXPECT_EQ(*q.key(2), std::string("abc"));
+});
@@ -0,0 +1,206 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/inplace_vector.hpp"
+
+#include <cstdint>
+#include <list>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+struct Tracked {
+  static int live;
+  int value;
+  Tracked(int v = 0) : value(v) { ++live; }
+  Tracked(const Tracked& other) : value(other.value) { ++live; }
+  Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+  Tracked& operator=(const Tracked&) = default;
+  Tracked& operator=(Tracked&&) = default;
+  ~Tracked() { --live; }
+  bool operator==(const Tracked& other) const { return value == other.value; }
+};
+
+int Tracked::live = 0;
+
+// 第 throw_at 次构造时抛出，用来检查构造函数中途失败后的回滚
+struct ThrowingTracked {
+  static int live;
+  static int throw_at;
+  int value;
+  ThrowingTracked(int v = 0) : value(v) { enter(); }
+  ThrowingTracked(const ThrowingTracked& other) : value(other.value) { enter(); }
+  ~ThrowingTracked() { --live; }
+
+  static void enter() {
+    if (--throw_at == 0) {
+      throw std::runtime_error("construct");
+    }
+    ++live;
+  }
+};
+
+int ThrowingTracked::live = 0;
+int ThrowingTracked::throw_at = 0;
+
+template <class F>
+bool throws_runtime_error(F&& f) {
+  try {
+    f();
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+constexpr int constexpr_sum() {
+  mystl::inplace_vector<int, 8> v{1, 2, 3};
+  v.push_back(4);
+  v.insert(v.begin(), 0);
+  v.erase(v.begin() + 2);
+  int sum = 0;
+  for (int x : v) {
+    sum += x;
+  }
+  return sum + static_cast<int>(v.size());
+}
+
+}  // namespace
+
+// 布局与平凡性
+static_assert(std::is_trivially_copyable_v<mystl::inplace_vector<int, 16>>);
+static_assert(std::is_trivially_destructible_v<mystl::inplace_vector<int, 16>>);
+static_assert(!std::is_trivially_copyable_v<mystl::inplace_vector<std::string, 4>>);
+static_assert(sizeof(mystl::inplace_vector<char, 15>) == 16);
+static_assert(sizeof(mystl::inplace_vector<std::uint32_t, 3>) == 16);
+static_assert(sizeof(mystl::inplace_vector<char, 300>) == 302);
+static_assert(sizeof(mystl::inplace_vector<int, 0>) == 1);
+static_assert(constexpr_sum() == 0 + 1 + 3 + 4 + 4);
+
+MYSTL_TEST(inplace_vector_basic, {
+  mystl::inplace_vector<int, 4> v;
+  MYSTL_EXPECT(v.empty());
+  v.push_back(1);
+  v.emplace_back(2);
+  v.push_back(3);
+  MYSTL_EXPECT_EQ(v.size(), 3u);
+  MYSTL_EXPECT_EQ(v.front(), 1);
+  MYSTL_EXPECT_EQ(v.back(), 3);
+  MYSTL_EXPECT_EQ(v.at(1), 2);
+  v.pop_back();
+  MYSTL_EXPECT_EQ(v.size(), 2u);
+  MYSTL_EXPECT_EQ(v.capacity(), 4u);
+});
+
+MYSTL_TEST(inplace_vector_capacity_errors, {
+  mystl::inplace_vector<int, 2> v{1, 2};
+  bool threw = false;
+  try {
+    v.push_back(3);
+  } catch (const std::bad_alloc&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+  MYSTL_EXPECT(v.try_push_back(3) == nullptr);
+  MYSTL_EXPECT_EQ(v.size(), 2u);
+
+  threw = false;
+  try {
+    (void)v.at(5);
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+
+  v.pop_back();
+  int* p = v.try_push_back(7);
+  MYSTL_EXPECT(p != nullptr && *p == 7);
+});
+
+MYSTL_TEST(inplace_vector_insert_erase, {
+  mystl::inplace_vector<int, 16> v{1, 5};
+  int mid[] = {2, 3, 4};
+  v.insert(v.begin() + 1, mid, mid + 3);
+  MYSTL_EXPECT((v == mystl::inplace_vector<int, 16>{1, 2, 3, 4, 5}));
+  v.insert(v.end(), 2, 9);
+  MYSTL_EXPECT_EQ(v.size(), 7u);
+  v.erase(v.begin(), v.begin() + 2);
+  MYSTL_EXPECT((v == mystl::inplace_vector<int, 16>{3, 4, 5, 9, 9}));
+  MYSTL_EXPECT_EQ(mystl::erase(v, 9), 2u);
+  MYSTL_EXPECT_EQ(mystl::erase_if(v, [](int x) { return x % 2 == 0; }), 1u);
+  MYSTL_EXPECT((v == mystl::inplace_vector<int, 16>{3, 5}));
+  MYSTL_EXPECT((v < mystl::inplace_vector<int, 16>{3, 6}));
+});
+
+MYSTL_TEST(inplace_vector_copy_prefix, {
+  mystl::inplace_vector<int, 64> a;
+  for (int i = 0; i < 10; ++i) {
+    a.push_back(i);
+  }
+  mystl::inplace_vector<int, 64> b = a;
+  MYSTL_EXPECT(a == b);
+  mystl::inplace_vector<int, 64> c;
+  c.assign(a.begin() + 2, a.begin() + 5);
+  MYSTL_EXPECT((c == mystl::inplace_vector<int, 64>{2, 3, 4}));
+  c.assign(c.begin() + 1, c.end());
+  MYSTL_EXPECT((c == mystl::inplace_vector<int, 64>{3, 4}));
+});
+
+MYSTL_TEST(inplace_vector_non_trivial_lifetime, {
+  Tracked::live = 0;
+  {
+    mystl::inplace_vector<Tracked, 8> v;
+    v.emplace_back(1);
+    v.emplace_back(2);
+    v.emplace_back(3);
+    MYSTL_EXPECT_EQ(Tracked::live, 3);
+    mystl::inplace_vector<Tracked, 8> copy(v);
+    MYSTL_EXPECT_EQ(Tracked::live, 6);
+    v.erase(v.begin());
+    MYSTL_EXPECT_EQ(Tracked::live, 5);
+    mystl::inplace_vector<Tracked, 8> other;
+    other.emplace_back(9);
+    other.swap(copy);
+    MYSTL_EXPECT_EQ(other.size(), 3u);
+    MYSTL_EXPECT_EQ(copy.size(), 1u);
+    MYSTL_EXPECT_EQ(copy[0].value, 9);
+    copy = other;
+    MYSTL_EXPECT_EQ(copy.size(), 3u);
+    v.resize(5);
+    MYSTL_EXPECT_EQ(v.size(), 5u);
+    v.clear();
+  }
+  MYSTL_EXPECT_EQ(Tracked::live, 0);
+});
+
+MYSTL_TEST(inplace_vector_ctor_rolls_back_on_throw, {
+  using vec = mystl::inplace_vector<ThrowingTracked, 8>;
+  ThrowingTracked::live = 0;
+  ThrowingTracked::throw_at = 4;
+  MYSTL_EXPECT(throws_runtime_error([] { vec v(6); }));
+  MYSTL_EXPECT_EQ(ThrowingTracked::live, 0);
+
+  const ThrowingTracked seed(7);
+  ThrowingTracked::throw_at = 3;
+  MYSTL_EXPECT(throws_runtime_error([&] { vec v(6, seed); }));
+  MYSTL_EXPECT_EQ(ThrowingTracked::live, 1);
+
+  // 非连续输入迭代器走逐个 emplace_back 的路径
+  const std::list<ThrowingTracked> src(5);
+  ThrowingTracked::throw_at = 3;
+  MYSTL_EXPECT(throws_runtime_error([&] { vec v(src.begin(), src.end()); }));
+  MYSTL_EXPECT_EQ(ThrowingTracked::live, 6);
+});
+
+MYSTL_TEST(inplace_vector_strings, {
+  mystl::inplace_vector<std::string, 4> v;
+  v.push_back("world");
+  v.emplace(v.begin(), "hello");
+  MYSTL_EXPECT_EQ(v[0], std::string("hello"));
+  MYSTL_EXPECT_EQ(v[1], std::string("world"));
+  mystl::inplace_vector<std::string, 4> moved(std::move(v));
+  MYSTL_EXPECT_EQ(moved.size(), 2u);
+  MYSTL_EXPECT_EQ(moved[1], std::string("world"));
+});
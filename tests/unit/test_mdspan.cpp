@@ -0,0 +1,240 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/mdspan.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using static_3x4 = mystl::extents<int, 3, 4>;
+using mixed_3xN = mystl::extents<int, 3, mystl::dynamic_extent>;
+
+constexpr int constexpr_trace() {
+  std::array<int, 9> data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  mystl::mdspan<int, mystl::extents<int, 3, 3>> m(data.data());
+  return m[0, 0] + m[1, 1] + m[2, 2];
+}
+
+}  // namespace
+
+// 静态维度不占存储
+static_assert(std::is_empty_v<static_3x4>);
+static_assert(sizeof(mixed_3xN) == sizeof(int));
+static_assert(sizeof(mystl::dextents<std::size_t, 3>) == 3 * sizeof(std::size_t));
+static_assert(sizeof(mystl::mdspan<double, mystl::extents<std::size_t, 8, 8>>) == sizeof(double*));
+static_assert(static_3x4::rank() == 2 && static_3x4::rank_dynamic() == 0);
+static_assert(mixed_3xN::rank_dynamic() == 1 && mixed_3xN::static_extent(1) == mystl::dynamic_extent);
+
+// 编译期索引计算
+static_assert(mystl::layout_right::mapping<static_3x4>()(1, 2) == 6);
+static_assert(mystl::layout_left::mapping<static_3x4>()(1, 2) == 7);
+static_assert(mystl::layout_right::mapping<static_3x4>().stride(0) == 4);
+static_assert(mystl::layout_left::mapping<static_3x4>().stride(1) == 3);
+static_assert(constexpr_trace() == 15);
+
+MYSTL_TEST(mdspan_extents, {
+  mixed_3xN e(5);
+  MYSTL_EXPECT_EQ(e.extent(0), 3);
+  MYSTL_EXPECT_EQ(e.extent(1), 5);
+  mixed_3xN all(3, 7);
+  MYSTL_EXPECT_EQ(all.extent(1), 7);
+
+  mystl::dextents<int, 2> d(e);
+  MYSTL_EXPECT(d == e);
+  MYSTL_EXPECT(!(d == all));
+
+  mystl::extents deduced(2, 3, 4);
+  static_assert(std::is_same_v<decltype(deduced), mystl::dextents<std::size_t, 3>>);
+  MYSTL_EXPECT_EQ(deduced.extent(2), 4u);
+
+  mystl::extents<int, mystl::dynamic_extent, 4, mystl::dynamic_extent> from_array(std::array<int, 2>{2, 6});
+  MYSTL_EXPECT_EQ(from_array.extent(0), 2);
+  MYSTL_EXPECT_EQ(from_array.extent(1), 4);
+  MYSTL_EXPECT_EQ(from_array.extent(2), 6);
+});
+
+MYSTL_TEST(mdspan_layout_right_and_left, {
+  std::vector<int> data(12);
+  for (int i = 0; i < 12; ++i) {
+    data[static_cast<std::size_t>(i)] = i;
+  }
+  mystl::mdspan<int, mystl::dextents<int, 2>> right(data.data(), 3, 4);
+  MYSTL_EXPECT_EQ((right[1, 2]), 6);
+  MYSTL_EXPECT_EQ((right[2, 3]), 11);
+  MYSTL_EXPECT_EQ(right.size(), 12u);
+  MYSTL_EXPECT(right.is_exhaustive());
+
+  mystl::mdspan<int, mystl::dextents<int, 2>, mystl::layout_left> left(data.data(), 3, 4);
+  MYSTL_EXPECT_EQ((left[1, 2]), 7);
+  MYSTL_EXPECT_EQ((left[2, 3]), 11);
+  MYSTL_EXPECT_EQ(left.stride(0), 1);
+  MYSTL_EXPECT_EQ(left.stride(1), 3);
+
+  right[0, 0] = 42;
+  MYSTL_EXPECT_EQ(data[0], 42);
+  MYSTL_EXPECT_EQ((right[std::array<int, 2>{2, 1}]), 9);
+});
+
+MYSTL_TEST(mdspan_three_dimensional, {
+  std::vector<double> data(2 * 3 * 4);
+  mystl::mdspan<double, mystl::extents<std::size_t, 2, 3, 4>> m(data.data());
+  for (std::size_t i = 0; i < 2; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      for (std::size_t k = 0; k < 4; ++k) {
+        m[i, j, k] = static_cast<double>(i * 100 + j * 10 + k);
+      }
+    }
+  }
+  MYSTL_EXPECT_EQ(data[1 * 12 + 2 * 4 + 3], 123.0);
+  MYSTL_EXPECT_EQ(m.stride(0), 12u);
+  MYSTL_EXPECT_EQ(m.mapping().required_span_size(), 24u);
+});
+
+MYSTL_TEST(mdspan_layout_stride, {
+  std::vector<int> data(20);
+  for (int i = 0; i < 20; ++i) {
+    data[static_cast<std::size_t>(i)] = i;
+  }
+  // 4x5 行优先矩阵中的第 1..2 行、第 1..3 列子块
+  using ext = mystl::dextents<int, 2>;
+  mystl::layout_stride::mapping<ext> map(ext(2, 3), std::array<int, 2>{5, 1});
+  mystl::mdspan<int, ext, mystl::layout_stride> sub(data.data() + 6, map);
+  MYSTL_EXPECT_EQ((sub[0, 0]), 6);
+  MYSTL_EXPECT_EQ((sub[1, 2]), 13);
+  MYSTL_EXPECT_EQ(map.required_span_size(), 8);
+  MYSTL_EXPECT(!map.is_exhaustive());
+
+  // 转置视图：交换步长
+  mystl::layout_stride::mapping<ext> transposed(ext(5, 4), std::array<int, 2>{1, 5});
+  mystl::mdspan<int, ext, mystl::layout_stride> t(data.data(), transposed);
+  MYSTL_EXPECT_EQ((t[3, 2]), 13);
+  MYSTL_EXPECT(transposed.is_exhaustive());
+
+  // layout_right 可以转换为 layout_stride
+  mystl::layout_stride::mapping<ext> from_right(mystl::layout_right::mapping<ext>(ext(4, 5)));
+  MYSTL_EXPECT_EQ(from_right.stride(0), 5);
+  MYSTL_EXPECT(from_right == mystl::layout_right::mapping<ext>(ext(4, 5)));
+});
+
+MYSTL_TEST(mdspan_conversions_and_deduction, {
+  std::vector<int> data(6, 1);
+  mystl::mdspan deduced(data.data(), 2, 3);
+  static_assert(std::is_same_v<decltype(deduced), mystl::mdspan<int, mystl::dextents<std::size_t, 2>>>);
+  MYSTL_EXPECT_EQ(deduced.extent(1), 3u);
+
+  mystl::mdspan<const int, mystl::dextents<std::size_t, 2>> as_const = deduced;
+  MYSTL_EXPECT_EQ((as_const[1, 2]), 1);
+
+  auto fixed = mystl::make_mdspan(data.data(), mystl::extents<int, 2, 3>{});
+  MYSTL_EXPECT_EQ(fixed.static_extent(0), 2u);
+  MYSTL_EXPECT(!fixed.empty());
+
+  mystl::mdspan<int, mystl::dextents<int, 2>> empty_span;
+  MYSTL_EXPECT(empty_span.empty());
+});
+
+MYSTL_TEST(mdspan_layout_blocked, {
+  using ext = mystl::dextents<int, 2>;
+  using blocked = mystl::layout_blocked<2, 2>;
+  blocked::mapping<ext> map(ext(3, 5));
+  // 补齐到 4x6，共 2x3 个 2x2 块
+  MYSTL_EXPECT_EQ(map.tiles_in_row(), 2);
+  MYSTL_EXPECT_EQ(map.tiles_in_col(), 3);
+  MYSTL_EXPECT_EQ(map.required_span_size(), 24);
+  MYSTL_EXPECT(!map.is_exhaustive());
+  MYSTL_EXPECT_EQ(map(0, 0), 0);
+  MYSTL_EXPECT_EQ(map(0, 1), 1);
+  MYSTL_EXPECT_EQ(map(1, 0), 2);
+  MYSTL_EXPECT_EQ(map(0, 2), 4);
+  MYSTL_EXPECT_EQ(map(2, 0), 12);
+  MYSTL_EXPECT_EQ(map(2, 4), 20);
+
+  // 映射是单射：所有下标落在 [0, required_span_size) 且互不相同
+  std::vector<int> hits(static_cast<std::size_t>(map.required_span_size()), 0);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      ++hits[static_cast<std::size_t>(map(i, j))];
+    }
+  }
+  int total = 0;
+  for (int h : hits) {
+    MYSTL_EXPECT(h <= 1);
+    total += h;
+  }
+  MYSTL_EXPECT_EQ(total, 15);
+});
+
+MYSTL_TEST(mdspan_for_each_tile_transpose, {
+  constexpr int n = 6;
+  using ext = mystl::extents<int, n, n>;
+  using blocked = mystl::layout_blocked<4, 4>;
+  std::vector<int> in_data(64), out_data(64);
+  mystl::mdspan<int, ext, blocked> in(in_data.data());
+  mystl::mdspan<int, ext, blocked> out(out_data.data());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      in[i, j] = i * 10 + j;
+    }
+  }
+  int tiles = 0;
+  mystl::for_each_tile(in, [&](int r0, int r1, int c0, int c1) {
+    ++tiles;
+    for (int i = r0; i < r1; ++i) {
+      for (int j = c0; j < c1; ++j) {
+        out[j, i] = in[i, j];
+      }
+    }
+  });
+  MYSTL_EXPECT_EQ(tiles, 4);
+  MYSTL_EXPECT_EQ((out[5, 2]), 25);
+  MYSTL_EXPECT_EQ((out[0, 4]), 40);
+});
+
+MYSTL_TEST(mdspan_aligned_and_restrict_accessors, {
+  alignas(64) std::array<float, 32> data{};
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i);
+  }
+  MYSTL_EXPECT(mystl::is_sufficiently_aligned<64>(data.data()));
+
+  using ext = mystl::extents<std::size_t, 4, 8>;
+  using aligned = mystl::aligned_accessor<float, 64>;
+  mystl::mdspan<float, ext, mystl::layout_right, aligned> a(data.data(), ext{}, aligned{});
+  MYSTL_EXPECT_EQ((a[3, 7]), 31.0f);
+  static_assert(std::is_same_v<aligned::offset_policy, mystl::default_accessor<float>>);
+
+  // 对齐要求更强的访问器可以隐式放宽，反向需要显式
+  static_assert(std::is_convertible_v<mystl::aligned_accessor<float, 64>, mystl::aligned_accessor<float, 16>>);
+  static_assert(!std::is_convertible_v<mystl::aligned_accessor<float, 16>, mystl::aligned_accessor<float, 64>>);
+  static_assert(!std::is_convertible_v<mystl::default_accessor<float>, aligned>);
+  mystl::mdspan<const float, ext> plain = a;
+  MYSTL_EXPECT_EQ((plain[1, 0]), 8.0f);
+
+  using restricted = mystl::restrict_accessor<float>;
+  mystl::mdspan<float, ext, mystl::layout_right, restricted> r(data.data(), ext{}, restricted{});
+  r[0, 0] = 100.0f;
+  MYSTL_EXPECT_EQ(data[0], 100.0f);
+});
+
+MYSTL_TEST(mdspan_streaming_accessor, {
+  std::vector<double> out(64, 0.0);
+  std::vector<std::int32_t> ints(64, 0);
+  using ext = mystl::dextents<std::size_t, 2>;
+  mystl::mdspan<double, ext, mystl::layout_right, mystl::streaming_accessor<double>> m(
+      out.data(), ext(8, 8), mystl::streaming_accessor<double>{});
+  mystl::mdspan<std::int32_t, ext, mystl::layout_right, mystl::streaming_accessor<std::int32_t>> mi(
+      ints.data(), ext(8, 8), mystl::streaming_accessor<std::int32_t>{});
+  for (std::size_t i = 0; i < 8; ++i) {
+    for (std::size_t j = 0; j < 8; ++j) {
+      m[i, j] = static_cast<double>(i * 8 + j) * 0.5;
+      mi[i, j] = static_cast<std::int32_t>(i * 8 + j);
+    }
+  }
+  mystl::streaming_fence();
+  MYSTL_EXPECT_EQ(out[63], 31.5);
+  MYSTL_EXPECT_EQ(ints[42], 42);
+});
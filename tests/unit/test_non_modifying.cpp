@@ -0,0 +1,380 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/algorithms/non_modifying.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+// 取值集中在少数几个数上，保证 find / count / adjacent_find 有命中、min / max 有重复
+template <class T>
+std::vector<T> make_values(std::size_t n, std::uint64_t spread) {
+  std::vector<T> v(n);
+  for (auto&& x : v) {
+    if constexpr (std::is_same_v<T, bool>) {
+      x = next_random() % spread == 0;
+    } else {
+      x = static_cast<T>(static_cast<std::int64_t>(next_random() % spread) - static_cast<std::int64_t>(spread / 2));
+    }
+  }
+  return v;
+}
+
+// 覆盖向量主循环、单向量循环与标量尾部的长度，以及跨越 min / max 分块的长度
+const std::size_t k_sizes[] = {0,  1,  2,   3,   7,   15,  16,   17,   31,   32,   33,
+                               63, 64, 65, 127, 128, 129, 200, 1000, 4097, 20000};
+
+template <class T>
+void check_find_count() {
+  for (const std::size_t n : k_sizes) {
+    for (const std::uint64_t spread : {std::uint64_t{2}, std::uint64_t{50}, std::uint64_t{100000}}) {
+      const auto v = make_values<T>(n, spread);
+      for (std::size_t probe = 0; probe < 4; ++probe) {
+        const T value = n > 0 && probe < 3 ? v[next_random() % n] : T(1);
+        MYSTL_EXPECT(mystl::find(v.begin(), v.end(), value) == std::find(v.begin(), v.end(), value));
+        MYSTL_EXPECT_EQ(mystl::count(v.begin(), v.end(), value), std::count(v.begin(), v.end(), value));
+      }
+      if (n > 0) {
+        // 唯一的命中在最后一个元素
+        auto w = v;
+        const T last = w.back();
+        std::replace(w.begin(), w.end() - 1, last, static_cast<T>(last == T(0) ? 1 : 0));
+        MYSTL_EXPECT(mystl::find(w.begin(), w.end(), last) == w.end() - 1);
+      }
+    }
+  }
+}
+
+template <class T>
+void check_compare() {
+  for (const std::size_t n : k_sizes) {
+    const auto a = make_values<T>(n, 100000);
+    MYSTL_EXPECT(mystl::equal(a.begin(), a.end(), a.begin()));
+    MYSTL_EXPECT(mystl::mismatch(a.begin(), a.end(), a.begin()).first == a.end());
+    for (std::size_t pos = 0; pos < n; pos += 1 + pos / 3) {
+      auto b = a;
+      b[pos] = static_cast<T>(b[pos] + T(1));
+      const auto got = mystl::mismatch(a.begin(), a.end(), b.begin());
+      MYSTL_EXPECT(got.first == a.begin() + static_cast<std::ptrdiff_t>(pos));
+      MYSTL_EXPECT(got.second == b.begin() + static_cast<std::ptrdiff_t>(pos));
+      MYSTL_EXPECT(!mystl::equal(a.begin(), a.end(), b.begin()));
+      MYSTL_EXPECT(!mystl::equal(a.begin(), a.end(), b.begin(), b.end()));
+      MYSTL_EXPECT(mystl::equal(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(pos), b.begin()));
+    }
+    // 长度不同的四迭代器版本
+    if (n > 0) {
+      MYSTL_EXPECT(!mystl::equal(a.begin(), a.end(), a.begin(), a.end() - 1));
+      const auto got = mystl::mismatch(a.begin(), a.end(), a.begin(), a.end() - 1);
+      MYSTL_EXPECT(got.first == a.end() - 1);
+    }
+
+    const auto runs = make_values<T>(n, 8);
+    MYSTL_EXPECT(mystl::adjacent_find(runs.begin(), runs.end()) == std::adjacent_find(runs.begin(), runs.end()));
+    MYSTL_EXPECT(mystl::adjacent_find(a.begin(), a.end()) == std::adjacent_find(a.begin(), a.end()));
+
+    for (const std::size_t m : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{3}, std::size_t{17}}) {
+      if (m > n) {
+        continue;
+      }
+      const auto at = static_cast<std::ptrdiff_t>(n == m ? 0 : next_random() % (n - m));
+      const std::vector<T> needle(runs.begin() + at, runs.begin() + at + static_cast<std::ptrdiff_t>(m));
+      MYSTL_EXPECT(mystl::search(runs.begin(), runs.end(), needle.begin(), needle.end()) ==
+                   std::search(runs.begin(), runs.end(), needle.begin(), needle.end()));
+    }
+  }
+}
+
+template <class T>
+void check_extremes() {
+  for (const std::size_t n : k_sizes) {
+    for (const std::uint64_t spread : {std::uint64_t{3}, std::uint64_t{1000}, std::uint64_t{1} << 40}) {
+      const auto v = make_values<T>(n, spread);
+      MYSTL_EXPECT(mystl::min_element(v.begin(), v.end()) == std::min_element(v.begin(), v.end()));
+      MYSTL_EXPECT(mystl::max_element(v.begin(), v.end()) == std::max_element(v.begin(), v.end()));
+      MYSTL_EXPECT(mystl::minmax_element(v.begin(), v.end()) == std::minmax_element(v.begin(), v.end()));
+    }
+    if (n > 0) {
+      // 类型的两端值：检验有符号 / 无符号的比较方式
+      auto v = make_values<T>(n, 1000);
+      v[next_random() % n] = std::numeric_limits<T>::lowest();
+      v[next_random() % n] = std::numeric_limits<T>::max();
+      MYSTL_EXPECT(mystl::min_element(v.begin(), v.end()) == std::min_element(v.begin(), v.end()));
+      MYSTL_EXPECT(mystl::max_element(v.begin(), v.end()) == std::max_element(v.begin(), v.end()));
+      MYSTL_EXPECT(mystl::minmax_element(v.begin(), v.end()) == std::minmax_element(v.begin(), v.end()));
+    }
+  }
+}
+
+template <class T>
+void check_all() {
+  check_find_count<T>();
+  check_compare<T>();
+  check_extremes<T>();
+}
+
+// 没有 SSE2 的平台上退化为标量版本；支持 AVX2 的机器上分派入口不会走到 SSE2 内核
+template <class T>
+std::size_t find_eq_sse2(const T* p, std::size_t n, T v) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::find_eq_sse2(p, n, v);
+#else
+  return mystl::__details::find_eq_scalar(p, n, v);
+#endif
+}
+
+template <class T>
+std::size_t find_eq_pair_sse2(const T* p, std::size_t n, std::size_t off, T v0, T v1) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::find_eq_pair_sse2(p, n, off, v0, v1);
+#else
+  return mystl::__details::find_eq_pair_scalar(p, n, off, v0, v1);
+#endif
+}
+
+template <class T>
+std::size_t count_eq_sse2(const T* p, std::size_t n, T v) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::count_eq_sse2(p, n, v);
+#else
+  return mystl::__details::count_eq_scalar(p, n, v);
+#endif
+}
+
+template <bool Equal, class T>
+std::size_t find_cmp_sse2(const T* a, const T* b, std::size_t n) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::find_cmp_sse2<Equal>(a, b, n);
+#else
+  return mystl::__details::find_cmp_scalar<Equal>(a, b, n);
+#endif
+}
+
+template <bool Max, class T>
+bool reduce_extreme_sse2(const T* p, std::size_t n, T& out) {
+#if MYSTL_HAS_SSE2
+  if constexpr (sizeof(T) != 8 || std::is_floating_point_v<T>) {
+    return mystl::__details::reduce_extreme_sse2<Max>(p, n, out);
+  }
+#endif
+  return mystl::__details::reduce_extreme_scalar<Max>(p, n, out);
+}
+
+template <class T>
+void check_kernels() {
+  for (const std::size_t n : k_sizes) {
+    const auto a = make_values<T>(n, 16);
+    auto b = a;
+    if (n > 0) {
+      b[n / 2] = static_cast<T>(b[n / 2] + T(1));
+    }
+    const T key = T(3);
+    MYSTL_EXPECT_EQ(mystl::__details::find_eq(a.data(), n, key), mystl::__details::find_eq_scalar(a.data(), n, key));
+    MYSTL_EXPECT_EQ(mystl::__details::count_eq(a.data(), n, key), mystl::__details::count_eq_scalar(a.data(), n, key));
+    MYSTL_EXPECT_EQ(mystl::__details::find_cmp<false>(a.data(), b.data(), n),
+                    mystl::__details::find_cmp_scalar<false>(a.data(), b.data(), n));
+    MYSTL_EXPECT_EQ(mystl::__details::find_cmp<true>(a.data(), b.data(), n),
+                    mystl::__details::find_cmp_scalar<true>(a.data(), b.data(), n));
+    MYSTL_EXPECT_EQ(find_eq_sse2(a.data(), n, key), mystl::__details::find_eq_scalar(a.data(), n, key));
+    if (n > 5) {
+      const T key2 = T(-2);
+      MYSTL_EXPECT_EQ(mystl::__details::find_eq_pair(a.data(), n - 5, 5, key, key2),
+                      mystl::__details::find_eq_pair_scalar(a.data(), n - 5, 5, key, key2));
+      MYSTL_EXPECT_EQ(find_eq_pair_sse2(a.data(), n - 5, 5, key, key2),
+                      mystl::__details::find_eq_pair_scalar(a.data(), n - 5, 5, key, key2));
+    }
+    MYSTL_EXPECT_EQ(count_eq_sse2(a.data(), n, key), mystl::__details::count_eq_scalar(a.data(), n, key));
+    MYSTL_EXPECT_EQ(find_cmp_sse2<false>(a.data(), b.data(), n),
+                    mystl::__details::find_cmp_scalar<false>(a.data(), b.data(), n));
+    MYSTL_EXPECT_EQ(find_cmp_sse2<true>(a.data(), b.data(), n),
+                    mystl::__details::find_cmp_scalar<true>(a.data(), b.data(), n));
+    if (n > 0) {
+      // 类型的两端值放在区间中部，检验 SSE2 下借助符号位翻转的比较
+      auto c = a;
+      c[n / 3] = std::numeric_limits<T>::lowest();
+      c[2 * n / 3] = std::numeric_limits<T>::max();
+      T lo{};
+      T hi{};
+      MYSTL_EXPECT(reduce_extreme_sse2<false>(c.data(), n, lo));
+      MYSTL_EXPECT(reduce_extreme_sse2<true>(c.data(), n, hi));
+      MYSTL_EXPECT(lo == std::numeric_limits<T>::lowest() || n == 1);
+      MYSTL_EXPECT(hi == std::numeric_limits<T>::max());
+      MYSTL_EXPECT(mystl::__details::reduce_extreme<false>(c.data(), n, lo));
+      MYSTL_EXPECT(lo == std::numeric_limits<T>::lowest() || n == 1);
+
+      T got{};
+      T expect{};
+      MYSTL_EXPECT(mystl::__details::reduce_extreme<true>(a.data(), n, got));
+      MYSTL_EXPECT(mystl::__details::reduce_extreme_scalar<true>(a.data(), n, expect));
+      MYSTL_EXPECT(got == expect);
+      MYSTL_EXPECT(mystl::__details::reduce_extreme<false>(a.data(), n, got));
+      MYSTL_EXPECT(mystl::__details::reduce_extreme_scalar<false>(a.data(), n, expect));
+      MYSTL_EXPECT(got == expect);
+      MYSTL_EXPECT(reduce_extreme_sse2<false>(a.data(), n, got));
+      MYSTL_EXPECT(got == expect);
+      MYSTL_EXPECT(reduce_extreme_sse2<true>(a.data(), n, got));
+      MYSTL_EXPECT(mystl::__details::reduce_extreme_scalar<true>(a.data(), n, expect));
+      MYSTL_EXPECT(got == expect);
+    }
+  }
+}
+
+}  // namespace
+
+MYSTL_TEST(non_modifying_integers, {
+  check_all<std::int8_t>();
+  check_all<std::uint8_t>();
+  check_all<std::int16_t>();
+  check_all<std::uint16_t>();
+  check_all<std::int32_t>();
+  check_all<std::uint32_t>();
+  check_all<std::int64_t>();
+  check_all<std::uint64_t>();
+  check_all<char>();
+});
+
+MYSTL_TEST(non_modifying_floating, {
+  check_all<float>();
+  check_all<double>();
+});
+
+MYSTL_TEST(non_modifying_kernels_match_scalar, {
+  check_kernels<std::int8_t>();
+  check_kernels<std::uint8_t>();
+  check_kernels<std::int16_t>();
+  check_kernels<std::uint16_t>();
+  check_kernels<std::int32_t>();
+  check_kernels<std::uint32_t>();
+  check_kernels<std::int64_t>();
+  check_kernels<std::uint64_t>();
+  check_kernels<float>();
+  check_kernels<double>();
+});
+
+MYSTL_TEST(non_modifying_bool, {
+  for (const std::size_t n : k_sizes) {
+    const auto v = make_values<bool>(n, 50);
+    MYSTL_EXPECT(mystl::find(v.begin(), v.end(), true) == std::find(v.begin(), v.end(), true));
+    MYSTL_EXPECT_EQ(mystl::count(v.begin(), v.end(), true), std::count(v.begin(), v.end(), true));
+    bool a[300] = {};
+    bool b[300] = {};
+    b[n % 300] = true;
+    MYSTL_EXPECT(mystl::find(b, b + 300, true) == b + n % 300);
+    MYSTL_EXPECT_EQ(mystl::count(b, b + 300, false), 299);
+    MYSTL_EXPECT(mystl::mismatch(a, a + 300, b).first == std::mismatch(a, a + 300, b).first);
+    MYSTL_EXPECT(!mystl::equal(a, a + 300, b));
+  }
+});
+
+MYSTL_TEST(non_modifying_mixed_value_type, {
+  const std::vector<std::uint8_t> bytes = {1, 200, 3, 255, 0};
+  // value 不在元素类型的范围内：没有元素相等
+  MYSTL_EXPECT(mystl::find(bytes.begin(), bytes.end(), 456) == bytes.end());
+  MYSTL_EXPECT(mystl::find(bytes.begin(), bytes.end(), -56) == bytes.end());
+  MYSTL_EXPECT(mystl::find(bytes.begin(), bytes.end(), 200) == bytes.begin() + 1);
+  MYSTL_EXPECT_EQ(mystl::count(bytes.begin(), bytes.end(), 255), 1);
+  const std::vector<std::int64_t> wide = {-5, 1LL << 40, 7, -5};
+  MYSTL_EXPECT(mystl::find(wide.begin(), wide.end(), 7) == wide.begin() + 2);
+  MYSTL_EXPECT_EQ(mystl::count(wide.begin(), wide.end(), -5), 2);
+  const std::vector<std::int16_t> narrow = {-1, 2, -1};
+  MYSTL_EXPECT(mystl::find(narrow.begin(), narrow.end(), std::int64_t{65535}) == narrow.end());
+  MYSTL_EXPECT_EQ(mystl::count(narrow.begin(), narrow.end(), std::int64_t{-1}), 2);
+  // 公共类型为 long long，按数值比较
+  const std::vector<std::uint32_t> words = {1, 0xFFFFFFFFu, 3};
+  MYSTL_EXPECT(mystl::find(words.begin(), words.end(), -1LL) == words.end());
+  MYSTL_EXPECT(mystl::find(words.begin(), words.end(), 0xFFFFFFFFLL) == words.begin() + 1);
+  const std::vector<double> reals = {0.5, 2.0, 3.0};
+  MYSTL_EXPECT(mystl::find(reals.begin(), reals.end(), 2) == reals.begin() + 1);
+});
+
+MYSTL_TEST(non_modifying_nan_and_signed_zero, {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (const std::size_t n : {std::size_t{5}, std::size_t{100}, std::size_t{10000}}) {
+    auto v = make_values<double>(n, 1000);
+    v[n / 3] = nan;
+    v[n / 2] = -0.0;
+    MYSTL_EXPECT(mystl::find(v.begin(), v.end(), nan) == v.end());
+    MYSTL_EXPECT(mystl::find(v.begin(), v.end(), 0.0) == std::find(v.begin(), v.end(), 0.0));
+    MYSTL_EXPECT_EQ(mystl::count(v.begin(), v.end(), 0.0), std::count(v.begin(), v.end(), 0.0));
+    // NaN 不等于自身：同一区间也不相等
+    MYSTL_EXPECT(!mystl::equal(v.begin(), v.end(), v.begin()));
+    const auto nan_at = v.begin() + static_cast<std::ptrdiff_t>(n / 3);
+    MYSTL_EXPECT(mystl::mismatch(v.begin(), v.end(), v.begin()).first == nan_at);
+    // NaN 使 < 不是严格弱序，结果与 std 的逐个比较相同
+    MYSTL_EXPECT(mystl::min_element(v.begin(), v.end()) == std::min_element(v.begin(), v.end()));
+    MYSTL_EXPECT(mystl::max_element(v.begin(), v.end()) == std::max_element(v.begin(), v.end()));
+    MYSTL_EXPECT(mystl::minmax_element(v.begin(), v.end()) == std::minmax_element(v.begin(), v.end()));
+    auto w = v;
+    w[n / 2] = 0.0;
+    MYSTL_EXPECT(mystl::mismatch(nan_at + 1, v.end(), w.begin() + (nan_at + 1 - v.begin())).first == v.end());
+  }
+  const std::vector<float> zeros = {0.0f, -0.0f, 1.0f};
+  MYSTL_EXPECT(mystl::adjacent_find(zeros.begin(), zeros.end()) == zeros.begin());
+});
+
+MYSTL_TEST(non_modifying_generic_paths, {
+  const std::list<int> l = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+  const std::vector<int> v(l.begin(), l.end());
+  MYSTL_EXPECT_EQ(*mystl::find(l.begin(), l.end(), 9), 9);
+  MYSTL_EXPECT_EQ(mystl::count(l.begin(), l.end(), 5), 3);
+  MYSTL_EXPECT_EQ(mystl::count_if(l.begin(), l.end(), [](int x) { return x % 2 == 0; }), 3);
+  MYSTL_EXPECT_EQ(*mystl::find_if(l.begin(), l.end(), [](int x) { return x > 4; }), 5);
+  MYSTL_EXPECT_EQ(*mystl::find_if_not(l.begin(), l.end(), [](int x) { return x < 4; }), 4);
+  MYSTL_EXPECT(mystl::all_of(l.begin(), l.end(), [](int x) { return x > 0; }));
+  MYSTL_EXPECT(mystl::any_of(l.begin(), l.end(), [](int x) { return x == 6; }));
+  MYSTL_EXPECT(mystl::none_of(l.begin(), l.end(), [](int x) { return x > 9; }));
+  int sum = 0;
+  mystl::for_each(l.begin(), l.end(), [&](int x) { sum += x; });
+  MYSTL_EXPECT_EQ(sum, 44);
+
+  MYSTL_EXPECT(mystl::equal(l.begin(), l.end(), v.begin(), v.end()));
+  MYSTL_EXPECT(!mystl::equal(l.begin(), l.end(), v.begin(), v.end() - 1));
+  const auto mm = mystl::mismatch(l.begin(), l.end(), v.rbegin(), v.rend());
+  MYSTL_EXPECT(mm.first == l.begin());
+  MYSTL_EXPECT(mystl::equal(l.begin(), l.end(), v.begin(), [](int a, int b) { return a == b; }));
+
+  const std::list<int> needle = {5, 3};
+  MYSTL_EXPECT(mystl::search(l.begin(), l.end(), needle.begin(), needle.end()) == std::next(l.begin(), 8));
+  MYSTL_EXPECT(mystl::adjacent_find(l.begin(), l.end(), std::less<>()) == std::next(l.begin()));
+
+  MYSTL_EXPECT(mystl::min_element(l.begin(), l.end()) == std::next(l.begin()));
+  MYSTL_EXPECT(mystl::max_element(l.begin(), l.end()) == std::next(l.begin(), 5));
+  const auto [lo, hi] = mystl::minmax_element(v.begin(), v.end(), std::greater<>());
+  MYSTL_EXPECT(lo == v.begin() + 5);
+  MYSTL_EXPECT(hi == v.begin() + 3);
+
+  // 类类型元素与自定义谓词
+  const std::vector<std::string> words = {"pear", "fig", "apple", "fig", "kiwi"};
+  MYSTL_EXPECT(mystl::find(words.begin(), words.end(), "apple") == words.begin() + 2);
+  MYSTL_EXPECT_EQ(mystl::count(words.begin(), words.end(), std::string("fig")), 2);
+  const auto shortest = mystl::min_element(words.begin(), words.end(), [](const std::string& a, const std::string& b) {
+    return a.size() < b.size();
+  });
+  MYSTL_EXPECT(shortest == words.begin() + 1);
+  MYSTL_EXPECT(mystl::minmax_element(words.begin(), words.end()) == std::minmax_element(words.begin(), words.end()));
+
+  // 指针元素走 memcmp
+  int x = 0;
+  int y = 0;
+  const std::vector<int*> p1 = {&x, &y, nullptr};
+  std::vector<int*> p2 = p1;
+  MYSTL_EXPECT(mystl::equal(p1.begin(), p1.end(), p2.begin()));
+  p2[2] = &x;
+  MYSTL_EXPECT(!mystl::equal(p1.begin(), p1.end(), p2.begin()));
+
+  const std::vector<int> empty;
+  MYSTL_EXPECT(mystl::min_element(empty.begin(), empty.end()) == empty.end());
+  MYSTL_EXPECT(mystl::minmax_element(empty.begin(), empty.end()).first == empty.end());
+  MYSTL_EXPECT(mystl::equal(empty.begin(), empty.end(), empty.begin()));
+  MYSTL_EXPECT(mystl::search(v.begin(), v.end(), empty.begin(), empty.end()) == v.begin());
+  MYSTL_EXPECT(mystl::search(empty.begin(), empty.end(), v.begin(), v.end()) == empty.end());
+});
@@ -0,0 +1,543 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/algorithms/numeric.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+template <class T>
+std::vector<T> make_values(std::size_t n) {
+  std::vector<T> v(n);
+  for (auto& x : v) {
+    if constexpr (std::is_floating_point_v<T>) {
+      x = static_cast<T>(static_cast<double>(next_random() % 2000001) / 1000.0 - 1000.0);
+    } else if constexpr (std::is_signed_v<T>) {
+      // 有符号数溢出是未定义行为，取值范围保证前缀和不溢出
+      x = static_cast<T>(static_cast<std::int64_t>(next_random() % 2000001) - 1000000);
+    } else {
+      x = static_cast<T>(next_random());
+    }
+  }
+  return v;
+}
+
+// 浮点数的前缀和只要求与顺序相加同阶的误差：按前缀绝对值之和的相对误差比较
+template <class T>
+bool scan_close(const std::vector<T>& got, const std::vector<T>& expect, const std::vector<T>& src) {
+  if (got.size() != expect.size()) {
+    return false;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    double abs_sum = 0;
+    for (std::size_t i = 0; i < got.size(); ++i) {
+      abs_sum += std::fabs(static_cast<double>(src[i]));
+      const double tol = 64 * static_cast<double>(std::numeric_limits<T>::epsilon()) * (abs_sum + 1);
+      if (std::fabs(static_cast<double>(got[i]) - static_cast<double>(expect[i])) > tol) {
+        return false;
+      }
+    }
+    return true;
+  } else {
+    return got == expect;
+  }
+}
+
+template <class T>
+void check_scans(std::size_t n) {
+  const std::vector<T> src = make_values<T>(n);
+  std::vector<T> expect(n);
+  std::vector<T> got(n);
+
+  std::inclusive_scan(src.begin(), src.end(), expect.begin());
+  MYSTL_EXPECT(mystl::inclusive_scan(src.begin(), src.end(), got.begin()) == got.end());
+  MYSTL_EXPECT(scan_close(got, expect, src));
+
+  std::inclusive_scan(src.begin(), src.end(), expect.begin(), std::plus<>(), T(7));
+  mystl::inclusive_scan(src.begin(), src.end(), got.begin(), std::plus<>(), T(7));
+  MYSTL_EXPECT(scan_close(got, expect, src));
+
+  std::exclusive_scan(src.begin(), src.end(), expect.begin(), T(3));
+  MYSTL_EXPECT(mystl::exclusive_scan(src.begin(), src.end(), got.begin(), T(3)) == got.end());
+  MYSTL_EXPECT(scan_close(got, expect, src));
+
+  // 原地
+  got = src;
+  mystl::exclusive_scan(got.begin(), got.end(), got.begin(), T(3), std::plus<T>());
+  MYSTL_EXPECT(scan_close(got, expect, src));
+
+  if constexpr (std::is_integral_v<T>) {
+    std::partial_sum(src.begin(), src.end(), expect.begin());
+    mystl::partial_sum(src.begin(), src.end(), got.begin());
+    MYSTL_EXPECT(got == expect);
+  }
+}
+
+// 没有 SSE2 的平台上退化为标量版本
+template <bool Exclusive, class T>
+T scan_add_sse2(const T* in, T* out, std::size_t n, T carry) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::scan_add_sse2<Exclusive>(in, out, n, carry);
+#else
+  return mystl::__details::scan_add_scalar<Exclusive>(in, out, n, carry);
+#endif
+}
+
+template <class T>
+void check_scan_kernels() {
+  const std::vector<T> src = make_values<T>(100);
+  for (std::size_t n = 0; n <= src.size(); n += 7) {
+    std::vector<T> expect(n);
+    std::vector<T> got(n);
+    const T total = mystl::__details::scan_add_scalar<false>(src.data(), expect.data(), n, T(5));
+    MYSTL_EXPECT_EQ(scan_add_sse2<false>(src.data(), got.data(), n, T(5)), total);
+    MYSTL_EXPECT(got == expect);
+    MYSTL_EXPECT_EQ(mystl::__details::scan_add<false>(src.data(), got.data(), n, T(5)), total);
+    MYSTL_EXPECT(got == expect);
+
+    mystl::__details::scan_add_scalar<true>(src.data(), expect.data(), n, T(5));
+    MYSTL_EXPECT_EQ(scan_add_sse2<true>(src.data(), got.data(), n, T(5)), total);
+    MYSTL_EXPECT(got == expect);
+    MYSTL_EXPECT_EQ(mystl::__details::scan_add<true>(src.data(), got.data(), n, T(5)), total);
+    MYSTL_EXPECT(got == expect);
+  }
+}
+
+// 没有 SSE2 的平台上退化为标量版本
+template <class T>
+void compensated_sum_sse2(const T* p, std::size_t n, T& sum, T& comp) {
+#if MYSTL_HAS_SSE2
+  mystl::__details::compensated_sum_sse2(p, n, sum, comp);
+#else
+  mystl::__details::compensated_sum_scalar(p, n, sum, comp);
+#endif
+}
+
+template <class T>
+void stats_sum_min_max_sse2(const T* p, std::size_t n, T& sum, T& mn, T& mx) {
+#if MYSTL_HAS_SSE2
+  mystl::__details::stats_sum_min_max_sse2(p, n, sum, mn, mx);
+#else
+  mystl::__details::stats_sum_min_max_scalar(p, n, sum, mn, mx);
+#endif
+}
+
+template <class T>
+void stats_deviations_sse2(const T* p, std::size_t n, T mean, T& dsum, T& dsq) {
+#if MYSTL_HAS_SSE2
+  mystl::__details::stats_deviations_sse2(p, n, mean, dsum, dsq);
+#else
+  mystl::__details::stats_deviations_scalar(p, n, mean, dsum, dsq);
+#endif
+}
+
+// 向量内核与标量版本只有结合顺序不同：和按绝对值之和的相对误差比较，最小值、最大值必须相同
+template <class T>
+void check_stable_kernels() {
+  std::vector<T> src = make_values<T>(200);
+  src[17] = std::numeric_limits<T>::quiet_NaN();
+  const double eps = static_cast<double>(std::numeric_limits<T>::epsilon());
+  const auto close = [&](T a, T b, double scale) {
+    return std::fabs(static_cast<double>(a) - static_cast<double>(b)) <= 8 * eps * scale;
+  };
+  for (std::size_t n = 0; n <= src.size(); n += 7) {
+    // 跳过 NaN 求和；NaN 只用于检查 min / max
+    const T* p = src.data() + 18;
+    const std::size_t m = std::min(n, src.size() - 18);
+    double abs_sum = 1;
+    for (std::size_t i = 0; i < m; ++i) {
+      abs_sum += std::fabs(static_cast<double>(p[i]));
+    }
+
+    T sum;
+    T comp;
+    mystl::__details::compensated_sum_scalar(p, m, sum, comp);
+    const double expect = static_cast<double>(sum) + static_cast<double>(comp);
+    compensated_sum_sse2(p, m, sum, comp);
+    MYSTL_EXPECT(std::fabs(static_cast<double>(sum) + static_cast<double>(comp) - expect) <= eps * abs_sum);
+    mystl::__details::compensated_sum(p, m, sum, comp);
+    MYSTL_EXPECT(std::fabs(static_cast<double>(sum) + static_cast<double>(comp) - expect) <= eps * abs_sum);
+
+    T es;
+    T emn;
+    T emx;
+    mystl::__details::stats_sum_min_max_scalar(src.data(), n, es, emn, emx);
+    T gs;
+    T gmn;
+    T gmx;
+    stats_sum_min_max_sse2(src.data(), n, gs, gmn, gmx);
+    MYSTL_EXPECT(gmn == emn && gmx == emx);
+    mystl::__details::stats_sum_min_max(src.data(), n, gs, gmn, gmx);
+    MYSTL_EXPECT(gmn == emn && gmx == emx);
+    mystl::__details::stats_sum_min_max_scalar(p, m, es, emn, emx);
+    mystl::__details::stats_sum_min_max(p, m, gs, gmn, gmx);
+    MYSTL_EXPECT(close(gs, es, abs_sum));
+
+    T eds;
+    T edq;
+    mystl::__details::stats_deviations_scalar(p, m, T(3), eds, edq);
+    T gds;
+    T gdq;
+    const double dev_scale = abs_sum + 3 * static_cast<double>(m);
+    const double sq_scale = static_cast<double>(edq) + 1;
+    stats_deviations_sse2(p, m, T(3), gds, gdq);
+    MYSTL_EXPECT(close(gds, eds, dev_scale) && close(gdq, edq, sq_scale));
+    mystl::__details::stats_deviations(p, m, T(3), gds, gdq);
+    MYSTL_EXPECT(close(gds, eds, dev_scale) && close(gdq, edq, sq_scale));
+  }
+}
+
+}  // namespace
+
+MYSTL_TEST(numeric_sequential_algorithms, {
+  const std::vector<int> v = {3, 1, 4, 1, 5, 9, 2, 6};
+  MYSTL_EXPECT_EQ(mystl::accumulate(v.begin(), v.end(), 0), 31);
+  MYSTL_EXPECT_EQ(mystl::accumulate(v.begin(), v.end(), 1, std::multiplies<>()), 6480);
+  const std::list<std::string> words = {"a", "b", "c"};
+  MYSTL_EXPECT_EQ(mystl::accumulate(words.begin(), words.end(), std::string("x")), std::string("xabc"));
+
+  MYSTL_EXPECT_EQ(mystl::inner_product(v.begin(), v.end(), v.begin(), 0), 173);
+  MYSTL_EXPECT_EQ(mystl::inner_product(v.begin(), v.begin() + 3, v.begin() + 1, 0, std::plus<>(), std::minus<>()), 2);
+
+  std::vector<int> d(v.size());
+  MYSTL_EXPECT(mystl::adjacent_difference(v.begin(), v.end(), d.begin()) == d.end());
+  MYSTL_EXPECT((d == std::vector<int>{3, -2, 3, -3, 4, 4, -7, 4}));
+  auto in_place = v;
+  mystl::adjacent_difference(in_place.begin(), in_place.end(), in_place.begin());
+  MYSTL_EXPECT(in_place == d);
+
+  std::vector<int> p(v.size());
+  mystl::partial_sum(v.begin(), v.end(), p.begin());
+  MYSTL_EXPECT((p == std::vector<int>{3, 4, 8, 9, 14, 23, 25, 31}));
+  std::list<int> lp;
+  mystl::partial_sum(v.begin(), v.end(), std::back_inserter(lp), std::multiplies<>());
+  MYSTL_EXPECT_EQ(lp.back(), 6480);
+
+  // partial_sum 对浮点数严格从左到右
+  const std::vector<double> f = make_values<double>(1000);
+  std::vector<double> fp(f.size());
+  std::vector<double> fe(f.size());
+  mystl::partial_sum(f.begin(), f.end(), fp.begin());
+  std::partial_sum(f.begin(), f.end(), fe.begin());
+  MYSTL_EXPECT(fp == fe);
+});
+
+MYSTL_TEST(numeric_reduce, {
+  for (const std::size_t n : {0u, 1u, 15u, 16u, 17u, 100u, 1001u}) {
+    const auto ints = make_values<std::int32_t>(n);
+    const auto doubles = make_values<double>(n);
+    std::int64_t expect_sum = 0;
+    for (const auto x : ints) {
+      expect_sum += x;
+    }
+    MYSTL_EXPECT_EQ(mystl::reduce(ints.begin(), ints.end(), std::int64_t{0}), expect_sum);
+    MYSTL_EXPECT_EQ(mystl::reduce(ints.begin(), ints.end()), std::reduce(ints.begin(), ints.end()));
+    const double ref = std::accumulate(doubles.begin(), doubles.end(), 0.0);
+    MYSTL_EXPECT(std::fabs(mystl::reduce(doubles.begin(), doubles.end()) - ref) < 1e-6);
+    const std::list<std::int32_t> list(ints.begin(), ints.end());
+    MYSTL_EXPECT_EQ(mystl::reduce(list.begin(), list.end(), std::int64_t{0}), expect_sum);
+
+    std::int64_t expect_dot = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      expect_dot += static_cast<std::int64_t>(ints[i] % 1000) * (ints[i] % 1000);
+    }
+    const auto square_mod = [](std::int32_t x) { return static_cast<std::int64_t>(x % 1000) * (x % 1000); };
+    MYSTL_EXPECT_EQ(mystl::transform_reduce(ints.begin(), ints.end(), std::int64_t{0}, std::plus<>(), square_mod),
+                    expect_dot);
+    const double dot = std::inner_product(doubles.begin(), doubles.end(), doubles.begin(), 0.0);
+    MYSTL_EXPECT(std::fabs(mystl::transform_reduce(doubles.begin(), doubles.end(), doubles.begin(), 0.0) - dot) <=
+                 1e-9 * (dot + 1));
+  }
+  MYSTL_EXPECT_EQ(mystl::reduce(static_cast<int*>(nullptr), static_cast<int*>(nullptr), 5), 5);
+  const std::vector<std::uint32_t> masks = {1, 2, 4, 64, 2};
+  MYSTL_EXPECT_EQ(mystl::reduce(masks.begin(), masks.end(), 0u, std::bit_or<>()), 71u);
+});
+
+MYSTL_TEST(numeric_scans, {
+  for (const std::size_t n : {0u, 1u, 3u, 4u, 8u, 15u, 16u, 17u, 33u, 1000u}) {
+    check_scans<std::int32_t>(n);
+    check_scans<std::uint32_t>(n);
+    check_scans<std::int64_t>(n);
+    check_scans<std::uint64_t>(n);
+    check_scans<float>(n);
+    check_scans<double>(n);
+  }
+
+  // 非加法运算、非连续存储、累加类型与元素类型不同
+  const std::vector<int> v = {1, 2, 3, 4, 5};
+  std::list<long> out;
+  mystl::inclusive_scan(v.begin(), v.end(), std::back_inserter(out), std::multiplies<>());
+  MYSTL_EXPECT((out == std::list<long>{1, 2, 6, 24, 120}));
+  std::vector<double> halves(v.size());
+  mystl::exclusive_scan(v.begin(), v.end(), halves.begin(), 0.5);
+  MYSTL_EXPECT((halves == std::vector<double>{0.5, 1.5, 3.5, 6.5, 10.5}));
+  std::vector<std::string> strs = {"a", "b", "c"};
+  std::vector<std::string> cat(3);
+  mystl::inclusive_scan(strs.begin(), strs.end(), cat.begin());
+  MYSTL_EXPECT((cat == std::vector<std::string>{"a", "ab", "abc"}));
+
+  // -0.0 保持不变
+  const std::vector<double> neg_zero = {-0.0};
+  std::vector<double> nz(1);
+  mystl::inclusive_scan(neg_zero.begin(), neg_zero.end(), nz.begin());
+  MYSTL_EXPECT(std::signbit(nz[0]));
+});
+
+MYSTL_TEST(numeric_scan_kernels_match_scalar, {
+  check_scan_kernels<std::int32_t>();
+  check_scan_kernels<std::uint32_t>();
+  check_scan_kernels<std::int64_t>();
+  check_scan_kernels<std::uint64_t>();
+});
+
+MYSTL_TEST(numeric_parallel_matches_sequential, {
+  mystl::execution::thread_pool pool(4);
+  const auto par = mystl::execution::par.on(pool);
+  // 覆盖顺序回退与分块并行两条路径
+  for (const std::size_t n : {std::size_t{1000}, std::size_t{300007}}) {
+    const auto ints = make_values<std::int64_t>(n);
+    std::vector<std::int64_t> expect(n);
+    std::vector<std::int64_t> got(n);
+
+    MYSTL_EXPECT_EQ(mystl::reduce(par, ints.begin(), ints.end()), std::reduce(ints.begin(), ints.end()));
+    MYSTL_EXPECT_EQ(mystl::reduce(mystl::execution::seq, ints.begin(), ints.end(), std::int64_t{1}),
+                    std::reduce(ints.begin(), ints.end(), std::int64_t{1}));
+    MYSTL_EXPECT_EQ(mystl::transform_reduce(par, ints.begin(), ints.end(), ints.begin(), std::int64_t{0}),
+                    std::transform_reduce(ints.begin(), ints.end(), ints.begin(), std::int64_t{0}));
+    MYSTL_EXPECT_EQ(mystl::transform_reduce(par, ints.begin(), ints.end(), std::int64_t{0}, std::bit_xor<>(),
+                                            [](std::int64_t x) { return x >> 3; }),
+                    std::transform_reduce(ints.begin(), ints.end(), std::int64_t{0}, std::bit_xor<>(),
+                                          [](std::int64_t x) { return x >> 3; }));
+
+    std::inclusive_scan(ints.begin(), ints.end(), expect.begin());
+    MYSTL_EXPECT(mystl::inclusive_scan(par, ints.begin(), ints.end(), got.begin()) == got.end());
+    MYSTL_EXPECT(got == expect);
+
+    std::inclusive_scan(ints.begin(), ints.end(), expect.begin(), std::bit_xor<>(), std::int64_t{42});
+    mystl::inclusive_scan(par, ints.begin(), ints.end(), got.begin(), std::bit_xor<>(), std::int64_t{42});
+    MYSTL_EXPECT(got == expect);
+
+    std::exclusive_scan(ints.begin(), ints.end(), expect.begin(), std::int64_t{-9});
+    got = ints;
+    MYSTL_EXPECT(mystl::exclusive_scan(par, got.begin(), got.end(), got.begin(), std::int64_t{-9}) == got.end());
+    MYSTL_EXPECT(got == expect);
+
+    // 非平凡元素：没有初始值的 inclusive 前缀和按块拼接
+    std::vector<std::string> strs(n / 1000 + 70000);
+    for (std::size_t i = 0; i < strs.size(); ++i) {
+      strs[i] = std::string(1, static_cast<char>('a' + i % 26));
+    }
+    std::vector<std::size_t> lengths(strs.size());
+    std::vector<std::size_t> expect_lengths(strs.size());
+    std::transform_inclusive_scan(strs.begin(), strs.end(), expect_lengths.begin(), std::plus<>(),
+                                  [](const std::string& s) { return s.size(); });
+    std::vector<std::size_t> sizes(strs.size());
+    std::transform(strs.begin(), strs.end(), sizes.begin(), [](const std::string& s) { return s.size(); });
+    mystl::inclusive_scan(par, sizes.begin(), sizes.end(), lengths.begin(), std::plus<std::size_t>());
+    MYSTL_EXPECT(lengths == expect_lengths);
+  }
+});
+
+namespace {
+
+// 80 位 long double 的两遍算法作为参考
+struct reference_stats {
+  long double mean = 0;
+  long double m2 = 0;
+};
+
+template <class T>
+reference_stats reference_of(const std::vector<T>& v) {
+  reference_stats r;
+  for (const T x : v) {
+    r.mean += static_cast<long double>(x);
+  }
+  r.mean /= static_cast<long double>(v.size());
+  for (const T x : v) {
+    const long double d = static_cast<long double>(x) - r.mean;
+    r.m2 += d * d;
+  }
+  return r;
+}
+
+}  // namespace
+
+MYSTL_TEST(numeric_kahan_and_pairwise, {
+  // 大数吃掉小数：顺序相加的结果为 0
+  std::vector<double> cancel;
+  cancel.push_back(1e16);
+  cancel.insert(cancel.end(), 10000, 1.0);
+  cancel.push_back(-1e16);
+  MYSTL_EXPECT_EQ(std::accumulate(cancel.begin(), cancel.end(), 0.0), 0.0);
+  MYSTL_EXPECT_EQ(mystl::kahan_reduce(cancel.begin(), cancel.end()), 10000.0);
+  const std::list<double> cancel_list(cancel.begin(), cancel.end());
+  MYSTL_EXPECT_EQ(mystl::kahan_reduce(cancel_list.begin(), cancel_list.end(), 0.5), 10000.5);
+
+  mystl::kahan_sum<double> acc;
+  for (const double x : cancel) {
+    acc.add(x);
+  }
+  MYSTL_EXPECT_EQ(acc.value(), 10000.0);
+
+  // float 累加一百万个 0.1f：顺序相加的相对误差在 1% 量级
+  const std::vector<float> tenths(1000000, 0.1f);
+  const double exact = 1000000.0 * static_cast<double>(0.1f);
+  MYSTL_EXPECT(std::fabs(static_cast<double>(mystl::kahan_reduce(tenths.begin(), tenths.end())) - exact) <=
+               1e-6 * exact);
+  MYSTL_EXPECT(std::fabs(static_cast<double>(mystl::pairwise_reduce(tenths.begin(), tenths.end())) - exact) <=
+               1e-5 * exact);
+
+  // 随机区间的误差界；长度覆盖不足一个通道、分块边界与尾部
+  for (const std::size_t n : {std::size_t{0}, std::size_t{5}, std::size_t{257}, std::size_t{65536 * 2 + 77}}) {
+    std::vector<double> v = make_values<double>(n);
+    for (std::size_t i = 0; i < n; i += 3) {
+      v[i] *= 1e8;
+    }
+    long double ref = 0.25L;
+    long double abs_sum = 0;
+    for (const double x : v) {
+      ref += x;
+      abs_sum += std::fabs(x);
+    }
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double kahan = mystl::kahan_reduce(v.begin(), v.end(), 0.25);
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(kahan) - ref) <= 2 * eps * std::fabs(ref) + 1e-20L * abs_sum);
+    const double pairwise = mystl::pairwise_reduce(v.begin(), v.end(), 0.25);
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(pairwise) - ref) <= 64 * eps * abs_sum + 1);
+  }
+
+  // 分段累加后合并
+  const std::vector<double> v = make_values<double>(10000);
+  mystl::kahan_sum<double> left;
+  mystl::kahan_sum<double> right;
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    (i < 3000 ? left : right).add(v[i]);
+  }
+  left.merge(right);
+  MYSTL_EXPECT(std::fabs(left.value() - mystl::kahan_reduce(v.begin(), v.end())) <= 1e-9);
+
+  // 无穷大不被补偿项变成 NaN
+  const std::vector<double> with_inf = {1.0, std::numeric_limits<double>::infinity(), 2.0};
+  MYSTL_EXPECT_EQ(mystl::kahan_reduce(with_inf.begin(), with_inf.end()), std::numeric_limits<double>::infinity());
+
+  // pairwise_reduce 保持元素顺序，只改变结合方式
+  const auto ints = make_values<std::int64_t>(5000);
+  MYSTL_EXPECT_EQ(mystl::pairwise_reduce(ints.begin(), ints.end()), std::accumulate(ints.begin(), ints.end(), 0LL));
+  std::vector<std::string> strs(1000);
+  for (std::size_t i = 0; i < strs.size(); ++i) {
+    strs[i] = std::string(1, static_cast<char>('a' + i % 26));
+  }
+  MYSTL_EXPECT(mystl::pairwise_reduce(strs.begin(), strs.end(), std::string(">")) ==
+               std::accumulate(strs.begin(), strs.end(), std::string(">")));
+});
+
+MYSTL_TEST(numeric_stable_kernels_match_scalar, {
+  check_stable_kernels<double>();
+  check_stable_kernels<float>();
+});
+
+MYSTL_TEST(numeric_stats, {
+  const std::vector<int> small = {2, 4, 4, 4, 5, 5, 7, 9};
+  const mystl::statistics<double> s = mystl::stats(small);
+  MYSTL_EXPECT_EQ(s.count(), std::size_t{8});
+  MYSTL_EXPECT_EQ(s.mean(), 5.0);
+  MYSTL_EXPECT_EQ(s.variance(), 4.0);
+  MYSTL_EXPECT(std::fabs(s.sample_variance() - 32.0 / 7.0) <= 1e-15);
+  MYSTL_EXPECT_EQ(s.stddev(), 2.0);
+  MYSTL_EXPECT_EQ(s.min(), 2.0);
+  MYSTL_EXPECT_EQ(s.max(), 9.0);
+  MYSTL_EXPECT_EQ(s.sum(), 40.0);
+
+  const std::list<int> small_list(small.begin(), small.end());
+  const auto from_list = mystl::stats(small_list.begin(), small_list.end());
+  MYSTL_EXPECT_EQ(from_list.mean(), 5.0);
+  MYSTL_EXPECT_EQ(from_list.variance(), 4.0);
+
+  const mystl::statistics<double> empty = mystl::stats(std::vector<double>());
+  MYSTL_EXPECT_EQ(empty.count(), std::size_t{0});
+  MYSTL_EXPECT_EQ(empty.variance(), 0.0);
+  MYSTL_EXPECT_EQ(empty.min(), std::numeric_limits<double>::infinity());
+  MYSTL_EXPECT(std::isnan(mystl::stats(std::vector<double>{1.0}).sample_variance()));
+
+  // 大偏移量：Σx² - n·mean² 的相消会丢掉全部有效数字
+  for (const std::size_t n : {std::size_t{3}, std::size_t{511}, std::size_t{100003}}) {
+    std::vector<double> v = make_values<double>(n);
+    for (double& x : v) {
+      x += 1e9;
+    }
+    const reference_stats ref = reference_of(v);
+    const auto got = mystl::stats(v.begin(), v.end());
+    MYSTL_EXPECT_EQ(got.count(), n);
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(got.mean()) - ref.mean) <= 1e-15L * ref.mean);
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(got.m2()) - ref.m2) <= 1e-9L * ref.m2);
+    MYSTL_EXPECT_EQ(got.min(), *std::min_element(v.begin(), v.end()));
+    MYSTL_EXPECT_EQ(got.max(), *std::max_element(v.begin(), v.end()));
+
+    // Welford 逐个加入与分段合并
+    mystl::statistics<double> left;
+    mystl::statistics<double> right;
+    for (std::size_t i = 0; i < n; ++i) {
+      (i < n / 3 ? left : right).add(v[i]);
+    }
+    left.merge(right);
+    MYSTL_EXPECT_EQ(left.count(), n);
+    // 逐个加入时均值的舍入随个数累积
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(left.mean()) - ref.mean) <= 1e-13L * ref.mean);
+    MYSTL_EXPECT(std::fabs(static_cast<long double>(left.m2()) - ref.m2) <= 1e-8L * ref.m2);
+    MYSTL_EXPECT_EQ(left.min(), got.min());
+    MYSTL_EXPECT_EQ(left.max(), got.max());
+  }
+
+  // float 按自身类型统计
+  const std::vector<float> floats = make_values<float>(4096);
+  const mystl::statistics<float> fs = mystl::stats(floats);
+  const reference_stats fref = reference_of(floats);
+  MYSTL_EXPECT(std::fabs(static_cast<long double>(fs.variance()) * 4096 - fref.m2) <= 1e-5L * fref.m2);
+
+  // min / max 忽略 NaN
+  const std::vector<double> with_nan = {3.0, std::numeric_limits<double>::quiet_NaN(), -1.0};
+  const auto ns = mystl::stats(with_nan);
+  MYSTL_EXPECT_EQ(ns.min(), -1.0);
+  MYSTL_EXPECT_EQ(ns.max(), 3.0);
+  MYSTL_EXPECT(std::isnan(ns.mean()));
+});
+
+MYSTL_TEST(numeric_stable_parallel_is_bitwise_sequential, {
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{4}}) {
+    mystl::execution::thread_pool pool(threads);
+    const auto par = mystl::execution::par.on(pool);
+    for (const std::size_t n : {std::size_t{1000}, std::size_t{65536 * 5 + 3}}) {
+      std::vector<double> v = make_values<double>(n);
+      for (std::size_t i = 0; i < n; i += 7) {
+        v[i] *= 1e10;
+      }
+      MYSTL_EXPECT_EQ(mystl::kahan_reduce(par, v.begin(), v.end()), mystl::kahan_reduce(v.begin(), v.end()));
+      MYSTL_EXPECT_EQ(mystl::kahan_reduce(mystl::execution::seq, v.begin(), v.end(), 1.0),
+                      mystl::kahan_reduce(v.begin(), v.end(), 1.0));
+      MYSTL_EXPECT_EQ(mystl::pairwise_reduce(par, v.begin(), v.end()), mystl::pairwise_reduce(v.begin(), v.end()));
+      MYSTL_EXPECT_EQ(mystl::pairwise_reduce(par, v.begin(), v.end(), 2.0, std::plus<>()),
+                      mystl::pairwise_reduce(v.begin(), v.end(), 2.0, std::plus<>()));
+
+      const auto seq_stats = mystl::stats(v.begin(), v.end());
+      const auto par_stats = mystl::stats(par, v.begin(), v.end());
+      MYSTL_EXPECT_EQ(par_stats.count(), seq_stats.count());
+      MYSTL_EXPECT_EQ(par_stats.mean(), seq_stats.mean());
+      MYSTL_EXPECT_EQ(par_stats.m2(), seq_stats.m2());
+      MYSTL_EXPECT_EQ(par_stats.min(), seq_stats.min());
+      MYSTL_EXPECT_EQ(par_stats.max(), seq_stats.max());
+
+      const auto ints = make_values<std::int32_t>(n);
+      MYSTL_EXPECT_EQ(mystl::stats(par, ints.begin(), ints.end()).m2(), mystl::stats(ints).m2());
+    }
+  }
+});
@@ -0,0 +1,111 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/adapters/priority_queue.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+// 随机交替 push / pop / replace_top，与 std::priority_queue 逐步比较
+template <std::size_t Arity>
+void check_against_std() {
+  mystl::priority_queue<int, std::vector<int>, std::less<int>, Arity> q;
+  std::priority_queue<int> ref;
+  for (int step = 0; step < 5000; ++step) {
+    const std::uint32_t op = next_random() % 8;
+    const int x = static_cast<int>(next_random() % 1000);
+    if (op < 4 || ref.empty()) {
+      q.push(x);
+      ref.push(x);
+    } else if (op < 7) {
+      q.pop();
+      ref.pop();
+    } else {
+      q.replace_top(x);
+      ref.pop();
+      ref.push(x);
+    }
+    MYSTL_EXPECT_EQ(q.size(), ref.size());
+    if (!ref.empty()) {
+      MYSTL_EXPECT_EQ(q.top(), ref.top());
+    }
+  }
+}
+
+}  // namespace
+
+MYSTL_TEST(priority_queue_basic, {
+  mystl::priority_queue<int> q;
+  static_assert(decltype(q)::arity == 2);
+  MYSTL_EXPECT(q.empty());
+  for (const int x : {5, 1, 9, 3, 9, 7}) {
+    q.push(x);
+  }
+  MYSTL_EXPECT_EQ(q.size(), 6u);
+  std::vector<int> out;
+  while (!q.empty()) {
+    out.push_back(q.top());
+    q.pop();
+  }
+  MYSTL_EXPECT(out == (std::vector<int>{9, 9, 7, 5, 3, 1}));
+});
+
+MYSTL_TEST(priority_queue_arity_matches_std, {
+  check_against_std<2>();
+  check_against_std<4>();
+  check_against_std<8>();
+});
+
+MYSTL_TEST(priority_queue_constructors, {
+  const std::vector<int> src = {4, 8, 2, 6, 0};
+
+  mystl::priority_queue<int, std::vector<int>, std::greater<int>, 4> min_q(src.begin(), src.end());
+  static_assert(decltype(min_q)::arity == 4);
+  MYSTL_EXPECT_EQ(min_q.top(), 0);
+
+  std::deque<int> dq(src.begin(), src.end());
+  mystl::priority_queue<int, std::deque<int>, std::less<int>, 8> from_container(std::less<int>(), std::move(dq));
+  MYSTL_EXPECT_EQ(from_container.top(), 8);
+  MYSTL_EXPECT_EQ(from_container.size(), 5u);
+
+  mystl::priority_queue deduced(src.begin(), src.end());
+  static_assert(std::is_same_v<decltype(deduced), mystl::priority_queue<int>>);
+  MYSTL_EXPECT_EQ(deduced.top(), 8);
+
+  mystl::priority_queue<int> appended(src.begin(), src.begin() + 2, std::less<int>(), std::vector<int>{10, 1});
+  MYSTL_EXPECT_EQ(appended.size(), 4u);
+  MYSTL_EXPECT_EQ(appended.top(), 10);
+
+  swap(deduced, appended);
+  MYSTL_EXPECT_EQ(deduced.top(), 10);
+  MYSTL_EXPECT_EQ(appended.top(), 8);
+});
+
+MYSTL_TEST(priority_queue_move_only, {
+  struct by_value {
+    bool operator()(const std::unique_ptr<std::string>& a, const std::unique_ptr<std::string>& b) const {
+      return *a > *b;
+    }
+  };
+  mystl::priority_queue<std::unique_ptr<std::string>, std::vector<std::unique_ptr<std::string>>, by_value, 4> q;
+  for (const char* s : {"pear", "apple", "fig", "kiwi", "banana"}) {
+    q.emplace(std::make_unique<std::string>(s));
+  }
+  q.replace_top(std::make_unique<std::string>("zucchini"));
+  std::vector<std::string> out;
+  while (!q.empty()) {
+    out.push_back(*q.top());
+    q.pop();
+  }
+  MYSTL_EXPECT(out == (std::vector<std::string>{"banana", "fig", "kiwi", "pear", "zucchini"}));
+});
@@ -0,0 +1,228 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/rope.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <sstream>
+#include <string>
+
+namespace {
+
+using mystl_test::next_random;
+
+mystl::string_view as_view(const std::string& s) noexcept { return mystl::string_view(s.data(), s.size()); }
+
+bool same(const mystl::rope& r, const std::string& s) {
+  return r.size() == s.size() && r == as_view(s) && std::string(r.to_string().c_str(), r.size()) == s;
+}
+
+// 全局 operator new / delete（非对齐版本）统一替换为 malloc / free 并计数；
+// 分配预算小于 0 表示不限制，否则用完后抛出 std::bad_alloc
+std::atomic<long> g_alloc_budget{-1};
+std::atomic<long> g_live_allocs{0};
+
+// 依次让第 0、1、2…… 次分配失败，直到 op 不再抛出；每次都检查原 rope 不变、
+// 被修改的拷贝仍然有效，且离开作用域后没有泄漏
+void check_edit_under_alloc_failure(const std::string& base, const std::string& expected, bool shared,
+                                    const std::function<void(mystl::rope&)>& op) {
+  for (long budget = 0;; ++budget) {
+    const long live = g_live_allocs.load();
+    bool threw = false;
+    {
+      mystl::rope original(as_view(base));
+      mystl::rope r = shared ? original : mystl::rope(as_view(base));
+      g_alloc_budget.store(budget);
+      try {
+        op(r);
+      } catch (const std::bad_alloc&) {
+        threw = true;
+      }
+      g_alloc_budget.store(-1);
+      MYSTL_EXPECT(same(original, base));
+      MYSTL_EXPECT_EQ(r.to_string().size(), r.size());
+      if (!threw) {
+        MYSTL_EXPECT(same(r, expected));
+      }
+    }
+    MYSTL_EXPECT_EQ(g_live_allocs.load(), live);
+    if (!threw) {
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+void* operator new(std::size_t n) {
+  const long budget = g_alloc_budget.load(std::memory_order_relaxed);
+  if (budget == 0) {
+    throw std::bad_alloc();
+  }
+  if (budget > 0) {
+    g_alloc_budget.store(budget - 1, std::memory_order_relaxed);
+  }
+  void* p = std::malloc(n == 0 ? 1 : n);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  g_live_allocs.fetch_add(1, std::memory_order_relaxed);
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  if (p != nullptr) {
+    g_live_allocs.fetch_sub(1, std::memory_order_relaxed);
+    std::free(p);
+  }
+}
+
+void* operator new[](std::size_t n) { return ::operator new(n); }
+
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+  try {
+    return ::operator new(n);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return ::operator new(n, std::nothrow); }
+
+void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }
+void operator delete[](void* p) noexcept { ::operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { ::operator delete(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { ::operator delete(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { ::operator delete(p); }
+
+MYSTL_TEST(rope_basic_edits, {
+  mystl::rope r("hello world");
+  MYSTL_EXPECT_EQ(r.size(), 11u);
+  r.insert(5, ",");
+  r.append("!");
+  MYSTL_EXPECT(r == "hello, world!");
+  r.erase(0, 7);
+  MYSTL_EXPECT(r == "world!");
+  r.replace(0, 5, "there");
+  MYSTL_EXPECT(r == "there!");
+  MYSTL_EXPECT_EQ(r[1], 'h');
+  MYSTL_EXPECT_EQ(r.at(5), '!');
+
+  bool threw = false;
+  try {
+    r.insert(100, "x");
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+
+  r.clear();
+  MYSTL_EXPECT(r.empty());
+  MYSTL_EXPECT(r == "");
+});
+
+MYSTL_TEST(rope_random_edits_match_std_string, {
+  std::string text(20000, ' ');
+  for (auto& c : text) {
+    c = static_cast<char>('a' + next_random() % 26);
+  }
+  mystl::rope r(as_view(text));
+  std::string model = text;
+  for (int step = 0; step < 2000; ++step) {
+    const std::size_t pos = next_random() % (model.size() + 1);
+    switch (next_random() % 4) {
+      case 0:
+      case 1: {
+        const std::string piece(next_random() % 40 + (step % 50 == 0 ? 3000 : 0), static_cast<char>('A' + step % 26));
+        r.insert(pos, as_view(piece));
+        model.insert(pos, piece);
+        break;
+      }
+      case 2: {
+        const std::size_t count = next_random() % 100 + (step % 70 == 0 ? 5000 : 0);
+        r.erase(pos, count);
+        model.erase(pos, count);
+        break;
+      }
+      default: {
+        const std::size_t count = next_random() % 3000;
+        MYSTL_EXPECT(r.substr(pos, count) == as_view(model.substr(pos, count)));
+        break;
+      }
+    }
+  }
+  MYSTL_EXPECT(same(r, model));
+  for (std::size_t i = 0; i < model.size(); i += 997) {
+    MYSTL_EXPECT_EQ(r[i], model[i]);
+  }
+});
+
+MYSTL_TEST(rope_copies_are_independent, {
+  const std::string text(10000, 'x');
+  mystl::rope a(as_view(text));
+  mystl::rope b = a;
+  mystl::rope c = a.substr(100, 5000);
+  b.insert(5000, "middle");
+  c.erase(0, 10);
+  a.erase(0, 9000);
+  MYSTL_EXPECT(same(a, std::string(1000, 'x')));
+  MYSTL_EXPECT(same(b, std::string(5000, 'x') + "middle" + std::string(5000, 'x')));
+  MYSTL_EXPECT(same(c, std::string(4990, 'x')));
+  MYSTL_EXPECT(!(a == b));
+  MYSTL_EXPECT(b.substr(0, 1000) == a);
+});
+
+MYSTL_TEST(rope_chunk_iteration, {
+  std::string text;
+  for (int i = 0; i < 3000; ++i) {
+    text += std::to_string(i);
+  }
+  mystl::rope r(as_view(text));
+  r.insert(1234, "<insert>");
+  text.insert(1234, "<insert>");
+
+  std::string joined;
+  std::size_t chunks = 0;
+  for (mystl::string_view chunk : r.chunks()) {
+    MYSTL_EXPECT(!chunk.empty());
+    joined.append(chunk.data(), chunk.size());
+    ++chunks;
+  }
+  MYSTL_EXPECT(joined == text);
+  MYSTL_EXPECT_EQ(chunks, r.chunk_count());
+
+  std::ostringstream os;
+  os << r;
+  MYSTL_EXPECT(os.str() == text);
+});
+
+MYSTL_TEST(rope_edits_survive_allocation_failure, {
+  std::string base;
+  for (int i = 0; i < 12000; ++i) {
+    base += static_cast<char>('a' + i % 26);
+  }
+  const std::string piece(5000, '#');
+  for (bool shared : {true, false}) {
+    // 大段插入：走 build + split + merge
+    std::string inserted = base;
+    inserted.insert(4321, piece);
+    check_edit_under_alloc_failure(base, inserted, shared,
+                                   [&](mystl::rope& r) { r.insert(4321, as_view(piece)); });
+
+    // 插入另一个 rope
+    std::string spliced = base;
+    spliced.insert(777, base);
+    check_edit_under_alloc_failure(base, spliced, shared, [&](mystl::rope& r) { r.insert(777, mystl::rope(r)); });
+
+    // 跨块删除：两次 split 后 merge
+    std::string erased = base;
+    erased.erase(1500, 6000);
+    check_edit_under_alloc_failure(base, erased, shared, [](mystl::rope& r) { r.erase(1500, 6000); });
+
+    // 截取
+    check_edit_under_alloc_failure(base, base.substr(1000, 9000), shared,
+                                   [](mystl::rope& r) { r = r.substr(1000, 9000); });
+  }
+});
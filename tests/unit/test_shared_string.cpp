@@ -0,0 +1,83 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/shared_string.hpp"
+#include "mystl/containers/string.hpp"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+MYSTL_TEST(shared_string_copy_shares_bytes, {
+  const mystl::shared_string a("requests.latency.p99");
+  MYSTL_EXPECT_EQ(a.use_count(), 1L);
+  mystl::shared_string b = a;
+  MYSTL_EXPECT(b.data() == a.data());
+  MYSTL_EXPECT_EQ(a.use_count(), 2L);
+  {
+    std::vector<mystl::shared_string> copies(8, a);
+    MYSTL_EXPECT_EQ(a.use_count(), 10L);
+  }
+  MYSTL_EXPECT_EQ(a.use_count(), 2L);
+
+  mystl::shared_string c = std::move(b);
+  MYSTL_EXPECT(b.empty());
+  MYSTL_EXPECT_EQ(a.use_count(), 2L);
+  c = mystl::shared_string("other");
+  MYSTL_EXPECT_EQ(a.use_count(), 1L);
+  MYSTL_EXPECT(c == "other");
+  MYSTL_EXPECT_EQ(std::string(c.c_str()), std::string("other"));
+});
+
+MYSTL_TEST(shared_string_empty_and_compare, {
+  const mystl::shared_string empty;
+  MYSTL_EXPECT(empty.empty());
+  MYSTL_EXPECT_EQ(empty.size(), 0u);
+  MYSTL_EXPECT_EQ(empty.c_str()[0], '\0');
+  MYSTL_EXPECT_EQ(empty.use_count(), 0L);
+  MYSTL_EXPECT(empty == mystl::shared_string(""));
+
+  const mystl::shared_string a("abc");
+  const mystl::shared_string b("abd");
+  MYSTL_EXPECT(a < b);
+  MYSTL_EXPECT(a == mystl::shared_string("abc"));
+  MYSTL_EXPECT(a != b);
+  MYSTL_EXPECT(a.view().starts_with("ab"));
+});
+
+MYSTL_TEST(shared_string_transparent_lookup, {
+  // 缓存哈希必须与 string_view 的哈希一致，否则异构查找会落到错误的桶
+  const mystl::shared_string key("cpu.user");
+  MYSTL_EXPECT_EQ(key.cached_hash(), mystl::string_hash{}(mystl::string_view("cpu.user")));
+  MYSTL_EXPECT_EQ(mystl::shared_string().cached_hash(), mystl::string_hash{}(mystl::string_view()));
+
+  std::unordered_map<mystl::shared_string, int, mystl::string_hash, mystl::string_equal> counters;
+  counters.emplace(key, 1);
+  counters.emplace(mystl::shared_string("cpu.system"), 2);
+  MYSTL_EXPECT_EQ(key.use_count(), 2L);
+
+  MYSTL_EXPECT(counters.find(mystl::string_view("cpu.user")) != counters.end());
+  MYSTL_EXPECT_EQ(counters.find("cpu.system")->second, 2);
+  MYSTL_EXPECT(counters.find(mystl::string("cpu.idle")) == counters.end());
+
+  std::unordered_set<mystl::shared_string> plain{key};
+  MYSTL_EXPECT(plain.count(mystl::shared_string("cpu.user")) == 1);
+});
+
+MYSTL_TEST(shared_string_concurrent_copies, {
+  const mystl::shared_string key("shared.across.threads");
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&key] {
+      for (int i = 0; i < 10000; ++i) {
+        mystl::shared_string copy = key;
+        (void)copy;
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  MYSTL_EXPECT_EQ(key.use_count(), 1L);
+});
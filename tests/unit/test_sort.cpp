@@ -0,0 +1,617 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/algorithms/heap.hpp"
+#include "mystl/algorithms/sorting.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+// 各种输入形状：随机、有序、逆序、风琴管、少量不同值、几乎有序
+std::vector<int> make_pattern(int kind, std::size_t n) {
+  std::vector<int> v(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const int x = static_cast<int>(i);
+    switch (kind) {
+      case 0:
+        v[i] = static_cast<int>(next_random());
+        break;
+      case 1:
+        v[i] = x;
+        break;
+      case 2:
+        v[i] = static_cast<int>(n) - x;
+        break;
+      case 3:
+        v[i] = i < n / 2 ? x : static_cast<int>(n) - x;
+        break;
+      case 4:
+        v[i] = static_cast<int>(next_random() % 4);
+        break;
+      default:
+        v[i] = x;
+        break;
+    }
+  }
+  if (kind == 5 && n > 1) {
+    for (int k = 0; k < 5; ++k) {
+      std::swap(v[next_random() % n], v[next_random() % n]);
+    }
+  }
+  return v;
+}
+
+}  // namespace
+
+MYSTL_TEST(sort_matches_std_sort_on_patterns, {
+  for (int kind = 0; kind < 6; ++kind) {
+    for (const std::size_t n : {0u, 1u, 2u, 3u, 23u, 24u, 25u, 100u, 129u, 1000u, 50000u}) {
+      std::vector<int> v = make_pattern(kind, n);
+      std::vector<int> expect = v;
+      std::sort(expect.begin(), expect.end());
+      mystl::sort(v.begin(), v.end());
+      MYSTL_EXPECT(v == expect);
+
+      // greater 同样走无分支划分
+      v = make_pattern(kind, n);
+      expect = v;
+      std::sort(expect.begin(), expect.end(), std::greater<>());
+      mystl::sort(v.begin(), v.end(), std::greater<>());
+      MYSTL_EXPECT(v == expect);
+    }
+  }
+});
+
+MYSTL_TEST(sort_generic_comparator_and_iterators, {
+  // 非算术类型、自定义比较器、非指针迭代器
+  std::deque<std::string> words;
+  for (int i = 0; i < 3000; ++i) {
+    words.push_back(std::to_string(next_random() % 500));
+  }
+  std::vector<std::string> expect(words.begin(), words.end());
+  std::sort(expect.begin(), expect.end());
+  mystl::sort(words.begin(), words.end(), [](const std::string& a, const std::string& b) { return a < b; });
+  MYSTL_EXPECT(std::equal(words.begin(), words.end(), expect.begin(), expect.end()));
+
+  // 只能移动的元素
+  std::vector<std::unique_ptr<int>> ptrs;
+  for (int i = 0; i < 1000; ++i) {
+    ptrs.push_back(std::make_unique<int>(static_cast<int>(next_random() % 100)));
+  }
+  mystl::sort(ptrs.begin(), ptrs.end(), [](const auto& a, const auto& b) { return *a < *b; });
+  MYSTL_EXPECT(mystl::is_sorted(ptrs.begin(), ptrs.end(), [](const auto& a, const auto& b) { return *a < *b; }));
+
+  std::vector<double> d = {3.5, -1.0, 2.25, -1.0, 0.0};
+  mystl::sort(d.begin(), d.end());
+  MYSTL_EXPECT((d == std::vector<double>{-1.0, -1.0, 0.0, 2.25, 3.5}));
+});
+
+MYSTL_TEST(sort_adversarial_falls_back_to_heapsort, {
+  // 所有比较都按固定规律给出的"杀手"序列：中值选取每次都取到极端值，
+  // 打乱后仍不平衡时应退化为堆排序而不是 O(n^2)
+  std::vector<int> v(1 << 16);
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    v[i] = static_cast<int>(i % 2 == 0 ? i : v.size() - i);
+  }
+  std::size_t comparisons = 0;
+  mystl::sort(v.begin(), v.end(), [&](int a, int b) {
+    ++comparisons;
+    return a < b;
+  });
+  MYSTL_EXPECT(mystl::is_sorted(v.begin(), v.end()));
+  MYSTL_EXPECT(comparisons < v.size() * 40);
+});
+
+MYSTL_TEST(sort_is_sorted_until, {
+  const std::vector<int> v = {1, 2, 2, 5, 4, 6};
+  MYSTL_EXPECT(mystl::is_sorted_until(v.begin(), v.end()) == v.begin() + 4);
+  MYSTL_EXPECT(!mystl::is_sorted(v.begin(), v.end()));
+  MYSTL_EXPECT(mystl::is_sorted(v.begin(), v.begin() + 4));
+  MYSTL_EXPECT(mystl::is_sorted(v.begin(), v.begin()));
+});
+
+MYSTL_TEST(heap_algorithms, {
+  for (const std::size_t n : {0u, 1u, 2u, 5u, 64u, 1001u}) {
+    std::vector<int> v = make_pattern(0, n);
+    mystl::make_heap(v.begin(), v.end());
+    MYSTL_EXPECT(mystl::is_heap(v.begin(), v.end()));
+    MYSTL_EXPECT(std::is_heap(v.begin(), v.end()));
+
+    std::vector<int> heap;
+    for (const int x : v) {
+      heap.push_back(x);
+      mystl::push_heap(heap.begin(), heap.end());
+      MYSTL_EXPECT(std::is_heap(heap.begin(), heap.end()));
+    }
+    if (!heap.empty()) {
+      const int top = *std::max_element(heap.begin(), heap.end());
+      mystl::pop_heap(heap.begin(), heap.end());
+      MYSTL_EXPECT_EQ(heap.back(), top);
+      MYSTL_EXPECT(std::is_heap(heap.begin(), heap.end() - 1));
+      heap.pop_back();
+    }
+
+    mystl::sort_heap(v.begin(), v.end());
+    MYSTL_EXPECT(std::is_sorted(v.begin(), v.end()));
+  }
+
+  std::vector<int> v = {1, 9, 3, 7};
+  mystl::make_heap(v.begin(), v.end(), std::greater<>());
+  MYSTL_EXPECT_EQ(v.front(), 1);
+  MYSTL_EXPECT(mystl::is_heap(v.begin(), v.end(), std::greater<>()));
+  MYSTL_EXPECT(mystl::is_heap_until(v.begin(), v.end()) == v.begin() + 1);
+});
+
+namespace {
+
+template <std::size_t Arity>
+void check_dary_heap(std::size_t n) {
+  std::vector<int> v = make_pattern(0, n);
+  for (int& x : v) {
+    x %= 50;  // 大量重复值
+  }
+  mystl::make_heap<Arity>(v.begin(), v.end());
+  MYSTL_EXPECT(mystl::is_heap<Arity>(v.begin(), v.end()));
+  for (std::size_t i = 1; i < n; ++i) {
+    MYSTL_EXPECT(v[(i - 1) / Arity] >= v[i]);
+  }
+
+  std::vector<int> heap;
+  for (const int x : v) {
+    heap.push_back(x);
+    mystl::push_heap<Arity>(heap.begin(), heap.end());
+    MYSTL_EXPECT(mystl::is_heap<Arity>(heap.begin(), heap.end()));
+  }
+  for (auto last = heap.end(); last != heap.begin(); --last) {
+    const int top = *std::max_element(heap.begin(), last);
+    mystl::pop_heap<Arity>(heap.begin(), last);
+    MYSTL_EXPECT_EQ(*(last - 1), top);
+    MYSTL_EXPECT(mystl::is_heap<Arity>(heap.begin(), last - 1));
+  }
+
+  mystl::sort_heap<Arity>(v.begin(), v.end());
+  MYSTL_EXPECT(std::is_sorted(v.begin(), v.end()));
+}
+
+}  // namespace
+
+MYSTL_TEST(heap_algorithms_dary, {
+  for (const std::size_t n : {0u, 1u, 2u, 3u, 4u, 5u, 8u, 9u, 10u, 17u, 64u, 65u, 300u}) {
+    check_dary_heap<3>(n);
+    check_dary_heap<4>(n);
+    check_dary_heap<8>(n);
+  }
+
+  // 4 叉堆的第一个违例：节点 5 的父节点是 1
+  std::vector<int> v = {9, 5, 8, 7, 6, 6, 1};
+  MYSTL_EXPECT(mystl::is_heap_until<4>(v.begin(), v.end()) == v.begin() + 5);
+  MYSTL_EXPECT(!mystl::is_heap<4>(v.begin(), v.end()));
+  MYSTL_EXPECT(mystl::is_heap<8>(v.begin(), v.end()));
+
+  std::vector<std::unique_ptr<int>> owned;
+  for (int i = 0; i < 40; ++i) {
+    owned.push_back(std::make_unique<int>((i * 7) % 40));
+  }
+  const auto by_value = [](const auto& a, const auto& b) { return *a > *b; };
+  mystl::make_heap<4>(owned.begin(), owned.end(), by_value);
+  mystl::sort_heap<4>(owned.begin(), owned.end(), by_value);
+  for (int i = 0; i < 40; ++i) {
+    MYSTL_EXPECT_EQ(*owned[static_cast<std::size_t>(i)], 39 - i);
+  }
+});
+
+MYSTL_TEST(radix_sort_fixed_width_keys, {
+  for (const std::size_t n : {0u, 1u, 63u, 64u, 1000u, 20000u}) {
+    std::vector<std::uint64_t> u(n);
+    std::vector<std::int32_t> s(n);
+    std::vector<double> d(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      // 高位相同的时间戳：大部分趟应被跳过
+      u[i] = 1700000000000000ULL + next_random() % 100000;
+      s[i] = static_cast<std::int32_t>(next_random());
+      d[i] = (static_cast<double>(next_random()) - 2147483648.0) / 1024.0;
+    }
+    auto eu = u;
+    auto es = s;
+    auto ed = d;
+    std::sort(eu.begin(), eu.end());
+    std::sort(es.begin(), es.end());
+    std::sort(ed.begin(), ed.end());
+    mystl::radix_sort(u.begin(), u.end());
+    mystl::radix_sort(s.begin(), s.end());
+    mystl::radix_sort(d.begin(), d.end());
+    MYSTL_EXPECT(u == eu);
+    MYSTL_EXPECT(s == es);
+    MYSTL_EXPECT(d == ed);
+  }
+
+  std::vector<float> f = {1.5f, -0.0f, -2.0f, 0.0f, -1e30f, 3.0f, 1e-30f, -1e-30f};
+  mystl::radix_sort(f.begin(), f.end());
+  MYSTL_EXPECT(std::is_sorted(f.begin(), f.end()));
+  MYSTL_EXPECT(std::signbit(f[3]) && !std::signbit(f[4]));
+
+  std::deque<std::int8_t> small = {5, -3, 127, -128, 0};
+  mystl::radix_sort(small.begin(), small.end());
+  MYSTL_EXPECT((small == std::deque<std::int8_t>{-128, -3, 0, 5, 127}));
+});
+
+MYSTL_TEST(radix_sort_by_key_is_stable, {
+  struct event {
+    std::int64_t time;
+    int seq;
+    std::unique_ptr<int> payload;
+  };
+  std::vector<event> events;
+  for (int i = 0; i < 5000; ++i) {
+    events.push_back({static_cast<std::int64_t>(next_random() % 300) - 150, i, std::make_unique<int>(i)});
+  }
+  mystl::radix_sort_by_key(events.begin(), events.end(), [](const event& e) { return e.time; });
+  for (std::size_t i = 1; i < events.size(); ++i) {
+    MYSTL_EXPECT(events[i - 1].time <= events[i].time);
+    if (events[i - 1].time == events[i].time) {
+      MYSTL_EXPECT(events[i - 1].seq < events[i].seq);
+    }
+    MYSTL_EXPECT_EQ(*events[i].payload, events[i].seq);
+  }
+});
+
+MYSTL_TEST(radix_sort_strings, {
+  std::vector<std::string> words;
+  for (int i = 0; i < 20000; ++i) {
+    // 长公共前缀、空串、前缀关系与高位字节
+    std::string w = i % 3 == 0 ? "metrics.cpu." : "m";
+    const std::size_t len = next_random() % 12;
+    for (std::size_t k = 0; k < len; ++k) {
+      w.push_back(static_cast<char>(next_random() % 4 == 0 ? 0xE4 : 'a' + next_random() % 6));
+    }
+    words.push_back(i % 97 == 0 ? std::string() : w);
+  }
+  auto expect = words;
+  std::sort(expect.begin(), expect.end());
+  mystl::radix_sort(words.begin(), words.end());
+  MYSTL_EXPECT(words == expect);
+
+  struct row {
+    std::string name;
+    int id;
+  };
+  std::vector<row> rows = {{"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}, {"alpha", 1}};
+  mystl::radix_sort_by_key(rows.begin(), rows.end(), [](const row& r) -> const std::string& { return r.name; });
+  for (std::size_t i = 1; i < rows.size(); ++i) {
+    MYSTL_EXPECT(rows[i - 1].name <= rows[i].name);
+    MYSTL_EXPECT(rows[i - 1].id <= rows[i].id);
+  }
+});
+
+MYSTL_TEST(stable_sort_keeps_equal_elements_in_order, {
+  struct item {
+    int key;
+    int seq;
+    std::unique_ptr<int> payload;
+  };
+  for (const std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{31}, std::size_t{33}, std::size_t{5000}}) {
+    std::vector<item> items;
+    for (std::size_t i = 0; i < n; ++i) {
+      const int seq = static_cast<int>(i);
+      items.push_back({static_cast<int>(next_random() % 50), seq, std::make_unique<int>(seq)});
+    }
+    mystl::stable_sort(items.begin(), items.end(), [](const item& a, const item& b) { return a.key < b.key; });
+    for (std::size_t i = 1; i < items.size(); ++i) {
+      MYSTL_EXPECT(items[i - 1].key <= items[i].key);
+      if (items[i - 1].key == items[i].key) {
+        MYSTL_EXPECT(items[i - 1].seq < items[i].seq);
+      }
+      MYSTL_EXPECT_EQ(*items[i].payload, items[i].seq);
+    }
+  }
+  for (int kind = 0; kind < 6; ++kind) {
+    auto v = make_pattern(kind, 3000);
+    auto expect = v;
+    std::stable_sort(expect.begin(), expect.end());
+    mystl::stable_sort(v.begin(), v.end());
+    MYSTL_EXPECT(v == expect);
+  }
+});
+
+MYSTL_TEST(stable_sort_adapts_to_runs, {
+  struct item {
+    int key;
+    int seq;
+  };
+  auto by_key = [](const item& a, const item& b) { return a.key < b.key; };
+  auto check = [](const std::vector<item>& v) {
+    for (std::size_t i = 1; i < v.size(); ++i) {
+      MYSTL_EXPECT(v[i - 1].key <= v[i].key);
+      if (v[i - 1].key == v[i].key) {
+        MYSTL_EXPECT(v[i - 1].seq < v[i].seq);
+      }
+    }
+  };
+  // 升序段、严格降序段、长短悬殊的段与乱序窗口交替，键有大量重复，覆盖飞奔与两个方向的归并
+  auto make = [](std::size_t n) {
+    std::vector<item> v;
+    while (v.size() < n) {
+      const std::size_t len = std::size_t{1} << (next_random() % 12);
+      const int base = static_cast<int>(next_random() % 4000);
+      const auto shape = static_cast<unsigned>(next_random() % 3);
+      for (std::size_t k = 0; k < len && v.size() < n; ++k) {
+        const int step = static_cast<int>(k / 3);
+        const int noise = static_cast<int>(next_random() % 8);
+        const int key = shape == 0 ? base + step : shape == 1 ? base - step : base + noise;
+        v.push_back({key, static_cast<int>(v.size())});
+      }
+    }
+    return v;
+  };
+  for (const std::size_t n : {std::size_t{100}, std::size_t{5000}, std::size_t{60000}}) {
+    auto v = make(n);
+    mystl::stable_sort(v.begin(), v.end(), by_key);
+    check(v);
+
+    // 缓冲区容量为 0 时每次归并都走原地路径
+    auto w = make(n);
+    mystl::__details::merge_buffer<item> no_buffer(0);
+    mystl::__details::powersort(w.begin(), w.end(), by_key, no_buffer);
+    check(w);
+  }
+
+  // 有乱序小窗口的近似有序序列
+  std::vector<int> nearly(100000);
+  for (std::size_t i = 0; i < nearly.size(); ++i) {
+    nearly[i] = static_cast<int>(i);
+  }
+  for (std::size_t i = 0; i + 16 < nearly.size(); i += 1000) {
+    std::reverse(nearly.begin() + static_cast<std::ptrdiff_t>(i), nearly.begin() + static_cast<std::ptrdiff_t>(i + 16));
+  }
+  auto expect = nearly;
+  std::sort(expect.begin(), expect.end());
+  mystl::stable_sort(nearly.begin(), nearly.end());
+  MYSTL_EXPECT(nearly == expect);
+});
+
+MYSTL_TEST(nth_element_places_the_nth_element, {
+  for (int kind = 0; kind < 6; ++kind) {
+    for (const std::size_t n : {std::size_t{1}, std::size_t{20}, std::size_t{1000}, std::size_t{50000}}) {
+      const auto src = make_pattern(kind, n);
+      auto expect = src;
+      std::sort(expect.begin(), expect.end());
+      for (const std::size_t nth : {std::size_t{0}, n / 3, n - 1}) {
+        auto v = src;
+        mystl::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(nth), v.end());
+        MYSTL_EXPECT_EQ(v[nth], expect[nth]);
+        MYSTL_EXPECT(std::all_of(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(nth), [&](int x) {
+          return x <= v[nth];
+        }));
+        MYSTL_EXPECT(std::all_of(v.begin() + static_cast<std::ptrdiff_t>(nth), v.end(), [&](int x) {
+          return x >= v[nth];
+        }));
+      }
+    }
+  }
+  std::vector<int> same(10000, 7);
+  mystl::nth_element(same.begin(), same.begin() + 5000, same.end());
+  MYSTL_EXPECT(std::all_of(same.begin(), same.end(), [](int x) { return x == 7; }));
+});
+
+MYSTL_TEST(nth_element_is_linear_against_an_adversary, {
+  // McIlroy 的 antiqsort：值在比较时才确定，总让枢轴成为极端值；回退到中位数的中位数后仍为线性
+  const std::size_t n = 1 << 14;
+  std::vector<std::size_t> val(n, n);
+  std::size_t solid = 0;
+  std::size_t candidate = 0;
+  std::size_t comparisons = 0;
+  auto cmp = [&](std::size_t x, std::size_t y) {
+    ++comparisons;
+    if (val[x] == n && val[y] == n) {
+      val[x == candidate ? x : y] = solid++;
+    }
+    if (val[x] == n) {
+      candidate = x;
+    } else if (val[y] == n) {
+      candidate = y;
+    }
+    return val[x] < val[y];
+  };
+  std::vector<std::size_t> idx(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    idx[i] = i;
+  }
+  mystl::nth_element(idx.begin(), idx.begin() + n / 2, idx.end(), cmp);
+  const std::size_t mid = val[idx[n / 2]];
+  MYSTL_EXPECT(std::all_of(idx.begin(), idx.begin() + n / 2, [&](std::size_t i) { return val[i] <= mid; }));
+  MYSTL_EXPECT(std::all_of(idx.begin() + n / 2, idx.end(), [&](std::size_t i) { return val[i] >= mid; }));
+  MYSTL_EXPECT(comparisons < n * 64);
+});
+
+MYSTL_TEST(partial_sort_orders_the_prefix, {
+  for (int kind = 0; kind < 6; ++kind) {
+    const auto src = make_pattern(kind, 20000);
+    auto expect = src;
+    std::sort(expect.begin(), expect.end());
+    // 堆选择（向量过滤）与 nth_element 两条路径
+    for (const std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{100}, std::size_t{10000}, src.size()}) {
+      auto v = src;
+      mystl::partial_sort(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end());
+      MYSTL_EXPECT(std::equal(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), expect.begin()));
+      std::sort(v.begin(), v.end());
+      MYSTL_EXPECT(v == expect);
+    }
+  }
+
+  // 非算术元素与非 less / greater 比较器走标量路径
+  std::vector<std::string> words;
+  for (int i = 0; i < 3000; ++i) {
+    words.push_back(std::to_string(next_random() % 100000));
+  }
+  auto expect = words;
+  auto by_length = [](const std::string& a, const std::string& b) {
+    return a.size() != b.size() ? a.size() > b.size() : a < b;
+  };
+  std::sort(expect.begin(), expect.end(), by_length);
+  mystl::partial_sort(words.begin(), words.begin() + 50, words.end(), by_length);
+  MYSTL_EXPECT(std::equal(words.begin(), words.begin() + 50, expect.begin()));
+});
+
+MYSTL_TEST(top_k_selects_the_best_k, {
+  std::vector<double> scores(100000);
+  for (auto& x : scores) {
+    x = static_cast<double>(next_random() % 1000000) / 7.0;
+  }
+  auto sorted = scores;
+  std::sort(sorted.begin(), sorted.end(), std::greater<>());
+  for (const std::size_t k : {std::size_t{1}, std::size_t{100}, std::size_t{5000}}) {
+    std::vector<double> out(k);
+    MYSTL_EXPECT(mystl::top_k(scores, k, out.begin()) == out.end());
+    MYSTL_EXPECT(std::equal(out.begin(), out.end(), sorted.begin()));
+  }
+  std::vector<double> smallest(10);
+  mystl::top_k(scores, 10, smallest.begin(), std::less<>());
+  MYSTL_EXPECT(std::equal(smallest.begin(), smallest.end(), sorted.rbegin()));
+
+  // 各种向量化类型：无符号数需要翻转符号位比较，升序输入让阈值不断收紧
+  std::vector<std::uint64_t> big(50000);
+  std::vector<std::uint32_t> mid(50000);
+  std::vector<float> floats(50000);
+  for (std::size_t i = 0; i < big.size(); ++i) {
+    big[i] = i % 3 == 0 ? (std::uint64_t{1} << 63) + i : i;
+    mid[i] = static_cast<std::uint32_t>(i % 2 == 0 ? 0x80000000u + i : i);
+    floats[i] = static_cast<float>(next_random() % 1000) - 500.0f;
+  }
+  std::vector<std::uint64_t> big_out(3);
+  mystl::top_k(big, 3, big_out.begin());
+  const std::uint64_t high = std::uint64_t{1} << 63;
+  MYSTL_EXPECT(big_out == (std::vector<std::uint64_t>{high + 49998, high + 49995, high + 49992}));
+  std::vector<std::uint32_t> mid_out(2);
+  mystl::top_k(mid, 2, mid_out.begin(), std::less<>());
+  MYSTL_EXPECT(mid_out == (std::vector<std::uint32_t>{1, 3}));
+  auto floats_sorted = floats;
+  std::sort(floats_sorted.begin(), floats_sorted.end());
+  std::vector<float> floats_out(64);
+  mystl::top_k(floats, 64, floats_out.begin(), std::less<>());
+  MYSTL_EXPECT(std::equal(floats_out.begin(), floats_out.end(), floats_sorted.begin()));
+
+  // 非连续的输入区间、k 超过元素数、k 为 0
+  std::deque<int> d = {5, 1, 4, 1, 5, 9, 2, 6};
+  std::vector<int> out(10, -1);
+  MYSTL_EXPECT(mystl::top_k(d, 10, out.begin()) == out.begin() + 8);
+  MYSTL_EXPECT((std::vector<int>(out.begin(), out.begin() + 8) == std::vector<int>{9, 6, 5, 5, 4, 2, 1, 1}));
+  MYSTL_EXPECT(mystl::top_k(d, 0, out.begin()) == out.begin());
+  std::vector<std::string> names = {"kiwi", "apple", "fig", "banana", "cherry"};
+  std::vector<std::string> first_two(2);
+  mystl::top_k(names, 2, first_two.begin(), std::less<>());
+  MYSTL_EXPECT((first_two == std::vector<std::string>{"apple", "banana"}));
+});
+
+namespace {
+
+// 没有 SSE2 的平台上退化为标量版本
+template <bool Greater, class T>
+std::size_t find_beyond_sse2(const T* p, std::size_t n, T t) {
+#if MYSTL_HAS_SSE2
+  return mystl::__details::find_beyond_sse2<Greater>(p, n, t);
+#else
+  return mystl::__details::find_beyond_scalar<Greater>(p, n, t);
+#endif
+}
+
+}  // namespace
+
+MYSTL_TEST(select_kernels_match_scalar, {
+  // 运行期分派只会走其中一个向量版本，这里逐个与标量版本对照
+  std::vector<std::int32_t> ints(1000);
+  std::vector<double> doubles(1000);
+  for (std::size_t i = 0; i < ints.size(); ++i) {
+    ints[i] = static_cast<std::int32_t>(next_random() % 2001) - 1000;
+    doubles[i] = static_cast<double>(ints[i]) / 3.0;
+  }
+  for (const std::int32_t t : {-1000, 0, 990, 999, 1000}) {
+    for (const std::size_t off : {std::size_t{0}, std::size_t{3}, std::size_t{997}}) {
+      const std::size_t n = ints.size() - off;
+      const double td = static_cast<double>(t) / 3.0;
+      const std::size_t up = mystl::__details::find_beyond_scalar<true>(ints.data() + off, n, t);
+      const std::size_t down = mystl::__details::find_beyond_scalar<false>(ints.data() + off, n, t);
+      const std::size_t up_d = mystl::__details::find_beyond_scalar<true>(doubles.data() + off, n, td);
+      MYSTL_EXPECT_EQ(mystl::__details::find_beyond<true>(ints.data() + off, n, t), up);
+      MYSTL_EXPECT_EQ(mystl::__details::find_beyond<false>(ints.data() + off, n, t), down);
+      MYSTL_EXPECT_EQ(mystl::__details::find_beyond<true>(doubles.data() + off, n, td), up_d);
+      MYSTL_EXPECT_EQ(find_beyond_sse2<true>(ints.data() + off, n, t), up);
+      MYSTL_EXPECT_EQ(find_beyond_sse2<false>(ints.data() + off, n, t), down);
+      MYSTL_EXPECT_EQ(find_beyond_sse2<true>(doubles.data() + off, n, td), up_d);
+    }
+  }
+});
+
+MYSTL_TEST(parallel_sorts_match_sequential, {
+  mystl::execution::thread_pool pool(4);
+  const auto par = mystl::execution::par.on(pool);
+  for (int kind = 0; kind < 6; ++kind) {
+    // 覆盖顺序回退与多层拆分的并行路径
+    for (const std::size_t n : {std::size_t{1000}, std::size_t{200000}}) {
+      const auto src = make_pattern(kind, n);
+      auto expect = src;
+      std::sort(expect.begin(), expect.end());
+
+      auto v = src;
+      mystl::sort(par, v.begin(), v.end());
+      MYSTL_EXPECT(v == expect);
+      v = src;
+      mystl::sort(mystl::execution::seq, v.begin(), v.end(), std::greater<>());
+      MYSTL_EXPECT(std::equal(v.begin(), v.end(), expect.rbegin()));
+      v = src;
+      mystl::stable_sort(par, v.begin(), v.end());
+      MYSTL_EXPECT(v == expect);
+      v = src;
+      mystl::radix_sort(par, v.begin(), v.end());
+      MYSTL_EXPECT(v == expect);
+    }
+  }
+
+  struct event {
+    std::uint32_t time;
+    int seq;
+    std::unique_ptr<int> payload;
+  };
+  std::vector<event> events;
+  for (int i = 0; i < 100000; ++i) {
+    events.push_back({static_cast<std::uint32_t>(next_random() % 1000), i, std::make_unique<int>(i)});
+  }
+  auto check_events = [&] {
+    for (std::size_t i = 1; i < events.size(); ++i) {
+      MYSTL_EXPECT(events[i - 1].time <= events[i].time);
+      if (events[i - 1].time == events[i].time) {
+        MYSTL_EXPECT(events[i - 1].seq < events[i].seq);
+      }
+      MYSTL_EXPECT_EQ(*events[i].payload, events[i].seq);
+    }
+  };
+  mystl::stable_sort(par, events.begin(), events.end(),
+                     [](const event& a, const event& b) { return a.time < b.time; });
+  check_events();
+  std::sort(events.begin(), events.end(), [](const event& a, const event& b) { return a.seq > b.seq; });
+  mystl::radix_sort_by_key(par, events.begin(), events.end(), [](const event& e) { return e.time; });
+  // 逆序输入经稳定排序后，等价键的 seq 递减
+  for (std::size_t i = 1; i < events.size(); ++i) {
+    MYSTL_EXPECT(events[i - 1].time <= events[i].time);
+    if (events[i - 1].time == events[i].time) {
+      MYSTL_EXPECT(events[i - 1].seq > events[i].seq);
+    }
+  }
+
+  std::vector<std::string> words;
+  for (int i = 0; i < 60000; ++i) {
+    words.push_back("key." + std::to_string(next_random() % 20000));
+  }
+  auto expect = words;
+  std::sort(expect.begin(), expect.end());
+  mystl::radix_sort(par, words.begin(), words.end());
+  MYSTL_EXPECT(words == expect);
+});
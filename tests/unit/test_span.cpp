@@ -0,0 +1,77 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+MYSTL_TEST(span_construction, {
+  int arr[] = {1, 2, 3, 4, 5};
+  mystl::span s(arr);
+  static_assert(std::is_same_v<decltype(s), mystl::span<int, 5>>);
+  static_assert(sizeof(s) == sizeof(int*));
+  MYSTL_EXPECT_EQ(s.size(), 5u);
+  MYSTL_EXPECT_EQ(s.front(), 1);
+  MYSTL_EXPECT_EQ(s.back(), 5);
+
+  std::vector<int> v{7, 8, 9};
+  mystl::span<int> dv(v);
+  MYSTL_EXPECT_EQ(dv.size(), 3u);
+  MYSTL_EXPECT(dv.data() == v.data());
+  dv[1] = 80;
+  MYSTL_EXPECT_EQ(v[1], 80);
+
+  const std::array<int, 2> ca{1, 2};
+  mystl::span cs(ca);
+  static_assert(std::is_same_v<decltype(cs), mystl::span<const int, 2>>);
+
+  mystl::span<const int> from_static = s;  // 静态 -> 动态、int -> const int
+  MYSTL_EXPECT_EQ(from_static.size(), 5u);
+  mystl::span<int> ptr_count(arr + 1, 3);
+  mystl::span<int> iter_pair(v.begin(), v.end());
+  MYSTL_EXPECT_EQ(ptr_count[0], 2);
+  MYSTL_EXPECT_EQ(iter_pair.size(), 3u);
+
+  mystl::span<int> empty;
+  MYSTL_EXPECT(empty.empty() && empty.data() == nullptr);
+  static_assert(!std::is_default_constructible_v<mystl::span<int, 3>>);
+  static_assert(!std::is_convertible_v<mystl::span<int>, mystl::span<int, 3>>);
+  static_assert(!std::is_constructible_v<mystl::span<int>, const std::vector<int>&>);
+});
+
+MYSTL_TEST(span_subviews_and_iteration, {
+  int arr[] = {0, 1, 2, 3, 4, 5, 6, 7};
+  mystl::span<int> s(arr);
+  auto f = s.first<3>();
+  static_assert(decltype(f)::extent == 3);
+  MYSTL_EXPECT_EQ(f[2], 2);
+  MYSTL_EXPECT_EQ(s.last(2)[0], 6);
+  MYSTL_EXPECT_EQ(s.subspan(2, 3).size(), 3u);
+  MYSTL_EXPECT_EQ(s.subspan(5).front(), 5);
+
+  mystl::span<int, 8> fixed(arr);
+  auto sub = fixed.subspan<2>();
+  static_assert(decltype(sub)::extent == 6);
+  MYSTL_EXPECT_EQ(sub.front(), 2);
+
+  int sum = 0;
+  for (int x : s) {
+    sum += x;
+  }
+  MYSTL_EXPECT_EQ(sum, 28);
+  MYSTL_EXPECT_EQ(*s.rbegin(), 7);
+
+  static_assert(std::ranges::contiguous_range<mystl::span<int>>);
+  static_assert(std::ranges::borrowed_range<mystl::span<int>>);
+  static_assert(std::ranges::view<mystl::span<int>>);
+
+  auto bytes = mystl::as_bytes(fixed);
+  static_assert(decltype(bytes)::extent == 8 * sizeof(int));
+  MYSTL_EXPECT_EQ(bytes.size(), sizeof(arr));
+  auto wbytes = mystl::as_writable_bytes(s);
+  wbytes[0] = std::byte{0};
+  MYSTL_EXPECT_EQ(arr[0], 0);
+});
@@ -0,0 +1,92 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/string.hpp"
+#include "mystl/ranges/views/split_sv.hpp"
+
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+using mystl::string_view;
+
+template <class R>
+std::vector<std::string> collect(R&& r) {
+  std::vector<std::string> out;
+  for (string_view f : r) {
+    out.emplace_back(f.data(), f.size());
+  }
+  return out;
+}
+
+// 参考实现：std::views::split 以单个字符为模式
+std::vector<std::string> reference_split(const std::string& s, char c) {
+  std::vector<std::string> out;
+  for (auto part : std::views::split(s, c)) {
+    out.emplace_back(part.begin(), part.end());
+  }
+  return out;
+}
+
+}  // namespace
+
+MYSTL_TEST(split_sv_basic_semantics, {
+  using V = std::vector<std::string>;
+  MYSTL_EXPECT(collect(mystl::views::split_sv("a,b,c", ',')) == (V{"a", "b", "c"}));
+  MYSTL_EXPECT(collect(mystl::views::split_sv("a,,b", ',')) == (V{"a", "", "b"}));
+  MYSTL_EXPECT(collect(mystl::views::split_sv(",a,", ',')) == (V{"", "a", ""}));
+  MYSTL_EXPECT(collect(mystl::views::split_sv(",", ',')) == (V{"", ""}));
+  MYSTL_EXPECT(collect(mystl::views::split_sv("abc", ',')) == (V{"abc"}));
+  MYSTL_EXPECT(collect(mystl::views::split_sv("", ',')).empty());
+
+  MYSTL_EXPECT(collect(mystl::views::split_sv("k=v; x=1\ty", string_view("; \t"))) ==
+               (V{"k=v", "", "x=1", "y"}));
+
+  const mystl::string line("2024-01-01,INFO,started");
+  MYSTL_EXPECT(collect(line | mystl::views::split_sv(',')) == (V{"2024-01-01", "INFO", "started"}));
+  MYSTL_EXPECT(collect("a b|c" | mystl::views::split_sv(string_view(" |"))) == (V{"a", "b", "c"}));
+});
+
+MYSTL_TEST(split_sv_matches_std_split, {
+  // 覆盖整块、重叠加载的尾块以及不足 16 字节的短串
+  for (int round = 0; round < 2000; ++round) {
+    std::string s(next_random() % 80, 'x');
+    for (auto& c : s) {
+      const auto r = next_random() % 6;
+      c = r == 0 ? ',' : static_cast<char>('a' + r);
+    }
+    const auto got = collect(mystl::views::split_sv(string_view(s.data(), s.size()), ','));
+    MYSTL_EXPECT(got == reference_split(s, ','));
+
+    // 超过 8 个字符的集合走位图路径
+    const auto set = collect(mystl::views::split_sv(string_view(s.data(), s.size()), string_view(",;:!?#@$%")));
+    MYSTL_EXPECT(set == got);
+  }
+});
+
+MYSTL_TEST(split_sv_composes_with_ranges, {
+  auto fields = mystl::views::split_sv("10,20,30,40", ',');
+  static_assert(std::ranges::forward_range<decltype(fields)>);
+  static_assert(std::ranges::view<decltype(fields)>);
+  static_assert(std::is_same_v<std::ranges::range_value_t<decltype(fields)>, string_view>);
+
+  int sum = 0;
+  for (std::size_t n : fields | std::views::transform([](string_view f) { return f.size(); }) | std::views::take(3)) {
+    sum += static_cast<int>(n);
+  }
+  MYSTL_EXPECT_EQ(sum, 6);
+  MYSTL_EXPECT_EQ(std::ranges::distance(fields), 4);
+  MYSTL_EXPECT(fields.front() == "10");
+
+  // 多遍遍历得到相同结果
+  auto it = fields.begin();
+  auto copy = it;
+  ++it;
+  MYSTL_EXPECT(*copy == "10" && *it == "20");
+  MYSTL_EXPECT(std::next(copy) == it);
+});
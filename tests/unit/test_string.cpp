@@ -0,0 +1,157 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/string.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+bool same(const mystl::string& s, const std::string& expected) {
+  return s.size() == expected.size() && std::memcmp(s.data(), expected.data(), s.size()) == 0 &&
+         s.c_str()[s.size()] == '\0';
+}
+
+}  // namespace
+
+static_assert(sizeof(mystl::string) == 3 * sizeof(void*));
+static_assert(mystl::string::sso_capacity == 3 * sizeof(void*) - 1);
+
+MYSTL_TEST(string_sso_boundary, {
+  mystl::string empty;
+  MYSTL_EXPECT(empty.empty());
+  MYSTL_EXPECT(empty.is_inline());
+  MYSTL_EXPECT_EQ(std::strlen(empty.c_str()), 0u);
+
+  const std::string max_inline(mystl::string::sso_capacity, 'a');
+  mystl::string inline_full(max_inline.c_str());
+  MYSTL_EXPECT(inline_full.is_inline());
+  MYSTL_EXPECT(same(inline_full, max_inline));
+  MYSTL_EXPECT_EQ(inline_full.capacity(), mystl::string::sso_capacity);
+
+  mystl::string spilled(max_inline.c_str());
+  spilled.push_back('b');
+  MYSTL_EXPECT(!spilled.is_inline());
+  MYSTL_EXPECT(same(spilled, max_inline + "b"));
+  MYSTL_EXPECT(spilled.capacity() >= 2 * mystl::string::sso_capacity);
+});
+
+MYSTL_TEST(string_grow_by_push_back_and_append, {
+  mystl::string s;
+  std::string model;
+  for (int i = 0; i < 200; ++i) {
+    const char c = static_cast<char>('a' + i % 26);
+    s.push_back(c);
+    model.push_back(c);
+    MYSTL_EXPECT(same(s, model));
+  }
+  s.append("-tail");
+  model.append("-tail");
+  s.append(3, '!');
+  model.append(3, '!');
+  MYSTL_EXPECT(same(s, model));
+
+  // 追加自身的一部分（包括需要重新分配的情况）
+  mystl::string self("abcdefghij");
+  self.append(self.data(), self.size());
+  MYSTL_EXPECT(same(self, "abcdefghijabcdefghij"));
+  self.append(self);
+  MYSTL_EXPECT(same(self, "abcdefghijabcdefghijabcdefghijabcdefghij"));
+});
+
+MYSTL_TEST(string_copy_move_swap, {
+  mystl::string short_s("short");
+  mystl::string long_s("a string that is definitely longer than the inline buffer");
+  mystl::string a = short_s;
+  mystl::string b = long_s;
+  MYSTL_EXPECT(a == short_s);
+  MYSTL_EXPECT(b == long_s);
+  MYSTL_EXPECT(b.data() != long_s.data());
+
+  mystl::string moved(std::move(b));
+  MYSTL_EXPECT(moved == long_s);
+  MYSTL_EXPECT(b.empty());
+
+  a.swap(moved);
+  MYSTL_EXPECT(a == long_s);
+  MYSTL_EXPECT(moved == short_s);
+
+  a = short_s;
+  MYSTL_EXPECT(a == "short");
+  a = std::move(long_s);
+  MYSTL_EXPECT(a.size() > mystl::string::sso_capacity);
+  a = "x";
+  MYSTL_EXPECT(a == "x");
+});
+
+MYSTL_TEST(string_insert_erase_replace, {
+  mystl::string s("hello world");
+  s.insert(5, ",");
+  MYSTL_EXPECT(s == "hello, world");
+  s.erase(0, 7);
+  MYSTL_EXPECT(s == "world");
+  s.replace(0, 1, "W");
+  MYSTL_EXPECT(s == "World");
+  s.replace(5, 0, " and a much longer suffix to force reallocation");
+  MYSTL_EXPECT(s == "World and a much longer suffix to force reallocation");
+  s.replace(0, 5, s.data() + 6, 3);
+  MYSTL_EXPECT(s == "and and a much longer suffix to force reallocation");
+  s.insert(s.begin(), '>');
+  MYSTL_EXPECT(s.starts_with(">and"));
+  s.erase(s.begin() + 1, s.end());
+  MYSTL_EXPECT(s == ">");
+
+  bool threw = false;
+  try {
+    s.insert(10, "x");
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+});
+
+MYSTL_TEST(string_resize_and_overwrite, {
+  mystl::string s("abc");
+  s.resize_and_overwrite(100, [](char* p, std::size_t n) {
+    MYSTL_EXPECT(p[0] == 'a' && p[2] == 'c');
+    for (std::size_t i = 3; i < n; ++i) {
+      p[i] = 'z';
+    }
+    return std::size_t{40};
+  });
+  MYSTL_EXPECT_EQ(s.size(), 40u);
+  MYSTL_EXPECT(s.starts_with("abczz"));
+  MYSTL_EXPECT_EQ(s.c_str()[40], '\0');
+
+  mystl::string t;
+  t.resize_and_overwrite(8, [](char* p, std::size_t) {
+    std::memcpy(p, "1234", 4);
+    return 4;
+  });
+  MYSTL_EXPECT(t == "1234");
+  MYSTL_EXPECT(t.is_inline());
+});
+
+MYSTL_TEST(string_compare_substr_shrink, {
+  mystl::string a("apple");
+  mystl::string b("banana");
+  MYSTL_EXPECT(a < b);
+  MYSTL_EXPECT(a.compare("apple") == 0);
+  MYSTL_EXPECT(a.compare("apples") < 0);
+  MYSTL_EXPECT((a + "-" + b) == "apple-banana");
+  MYSTL_EXPECT(mystl::string("0123456789").substr(3, 4) == "3456");
+
+  mystl::string big(100, 'x');
+  big.resize(10);
+  big.shrink_to_fit();
+  MYSTL_EXPECT(big.is_inline());
+  MYSTL_EXPECT(big == "xxxxxxxxxx");
+
+  mystl::string reserved;
+  reserved.reserve(1000);
+  MYSTL_EXPECT(reserved.capacity() >= 1000u);
+  MYSTL_EXPECT(reserved.empty());
+  MYSTL_EXPECT(reserved.ends_with(""));
+});
@@ -0,0 +1,89 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/string_pool.hpp"
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+MYSTL_TEST(string_pool_intern_dedup, {
+  mystl::string_pool pool;
+  MYSTL_EXPECT(pool.empty());
+  const auto a = pool.intern("method");
+  const auto b = pool.intern("status");
+  std::string again = "method";
+  MYSTL_EXPECT_EQ(pool.intern(mystl::string_view(again.data(), again.size())), a);
+  MYSTL_EXPECT(a != b);
+  MYSTL_EXPECT_EQ(pool.size(), 2u);
+  MYSTL_EXPECT(pool.view(a) == "method");
+  MYSTL_EXPECT_EQ(std::string(pool.c_str(b)), std::string("status"));
+  MYSTL_EXPECT_EQ(pool.find("status"), b);
+  MYSTL_EXPECT_EQ(pool.find("missing"), mystl::string_pool::invalid_id);
+  MYSTL_EXPECT(!pool.contains("missing"));
+
+  // 空串也是一个合法符号
+  const auto empty = pool.intern("");
+  MYSTL_EXPECT(pool.view(empty).empty());
+  MYSTL_EXPECT_EQ(pool.intern(""), empty);
+});
+
+MYSTL_TEST(string_pool_views_stay_valid, {
+  // 小块 arena 迫使频繁换块与查找表扩容
+  mystl::string_pool pool(256);
+  std::vector<mystl::string_view> views;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 5000; ++i) {
+    expected.push_back("label_" + std::to_string(i) + (i % 97 == 0 ? std::string(300, 'x') : std::string()));
+    views.push_back(pool.intern_view(mystl::string_view(expected.back().data(), expected.back().size())));
+  }
+  mystl::string_pool moved = std::move(pool);
+  MYSTL_EXPECT_EQ(moved.size(), 5000u);
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    MYSTL_EXPECT(views[i] == mystl::string_view(expected[i].data(), expected[i].size()));
+    MYSTL_EXPECT_EQ(views[i].data()[views[i].size()], '\0');
+    MYSTL_EXPECT(moved.view(static_cast<mystl::string_pool::id_type>(i)).data() == views[i].data());
+  }
+});
+
+MYSTL_TEST(string_pool_reserve_keeps_ids, {
+  mystl::string_pool pool;
+  const auto first = pool.intern("first");
+  pool.reserve(10000);
+  MYSTL_EXPECT_EQ(pool.find("first"), first);
+  for (int i = 0; i < 1000; ++i) {
+    pool.intern(mystl::string_view(std::to_string(i).c_str()));
+  }
+  MYSTL_EXPECT_EQ(pool.size(), 1001u);
+  MYSTL_EXPECT_EQ(pool.intern("first"), first);
+});
+
+MYSTL_TEST(concurrent_string_pool_threads_agree, {
+  mystl::concurrent_string_pool pool;
+  constexpr int kThreads = 4;
+  constexpr int kLabels = 2000;
+  std::vector<std::vector<mystl::concurrent_string_pool::id_type>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&pool, &ids, t] {
+      for (int i = 0; i < kLabels; ++i) {
+        // 各线程以不同顺序驻留同一批字符串
+        const int k = (i * (t + 1) * 7919) % kLabels;
+        const std::string label = "host=" + std::to_string(k);
+        ids[static_cast<std::size_t>(t)].push_back(pool.intern(mystl::string_view(label.data(), label.size())));
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  MYSTL_EXPECT_EQ(pool.size(), static_cast<std::size_t>(kLabels));
+  std::set<mystl::concurrent_string_pool::id_type> distinct(ids[0].begin(), ids[0].end());
+  MYSTL_EXPECT_EQ(distinct.size(), static_cast<std::size_t>(kLabels));
+  for (int i = 0; i < kLabels; ++i) {
+    const std::string label = "host=" + std::to_string(i);
+    const auto id = pool.find(mystl::string_view(label.data(), label.size()));
+    MYSTL_EXPECT(id != mystl::concurrent_string_pool::invalid_id);
+    MYSTL_EXPECT(pool.view(id) == mystl::string_view(label.data(), label.size()));
+  }
+});
@@ -0,0 +1,171 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/string.hpp"
+#include "mystl/containers/string_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+
+using mystl_test::next_random;
+
+using namespace mystl::literals;
+
+// 在多种长度与起点上与 std::string_view 逐项对比，覆盖向量块与尾部标量路径
+bool matches_std(const std::string& text, const std::string& needle) {
+  const mystl::string_view a(text.data(), text.size());
+  const std::string_view b(text);
+  const mystl::string_view na(needle.data(), needle.size());
+  for (std::size_t pos = 0; pos <= text.size() + 1; ++pos) {
+    if (a.find(na, pos) != b.find(needle, pos) || a.rfind(na, pos) != b.rfind(needle, pos) ||
+        a.find_first_of(na, pos) != b.find_first_of(needle, pos) ||
+        a.find_first_not_of(na, pos) != b.find_first_not_of(needle, pos) ||
+        a.find_last_of(na, pos) != b.find_last_of(needle, pos) ||
+        a.find_last_not_of(na, pos) != b.find_last_not_of(needle, pos)) {
+      return false;
+    }
+    if (!needle.empty() && (a.find(needle[0], pos) != b.find(needle[0], pos) ||
+                            a.rfind(needle[0], pos) != b.rfind(needle[0], pos))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string random_text(std::size_t n, int alphabet) {
+  std::string s(n, ' ');
+  for (auto& c : s) {
+    c = static_cast<char>('a' + static_cast<int>(next_random() % static_cast<unsigned>(alphabet)));
+  }
+  return s;
+}
+
+}  // namespace
+
+// 常量求值走标量路径
+static_assert("hello world"_sv.find("world") == 6);
+static_assert("hello world"_sv.rfind('o') == 7);
+static_assert("key: value"_sv.find_first_of(":;") == 3);
+static_assert("   trim"_sv.find_first_not_of(' ') == 3);
+static_assert("abc"_sv < "abd"_sv);
+static_assert("abc"_sv.compare("ab") > 0);
+
+MYSTL_TEST(string_view_basic, {
+  mystl::string_view v("hello world");
+  MYSTL_EXPECT_EQ(v.size(), 11u);
+  MYSTL_EXPECT(v.starts_with("hello"));
+  MYSTL_EXPECT(v.ends_with('d'));
+  MYSTL_EXPECT(v.contains("o w"));
+  MYSTL_EXPECT(v.substr(6) == "world");
+  v.remove_prefix(6);
+  v.remove_suffix(1);
+  MYSTL_EXPECT(v == "worl");
+  MYSTL_EXPECT(static_cast<std::string_view>(v) == std::string_view("worl"));
+
+  bool threw = false;
+  try {
+    (void)v.substr(10);
+  } catch (const std::out_of_range&) {
+    threw = true;
+  }
+  MYSTL_EXPECT(threw);
+});
+
+MYSTL_TEST(string_view_find_matches_std_random, {
+  for (int round = 0; round < 200; ++round) {
+    const std::size_t n = next_random() % 100;
+    const int alphabet = 2 + static_cast<int>(next_random() % 6);
+    const std::string text = random_text(n, alphabet);
+    const std::string needle = random_text(next_random() % 5, alphabet);
+    MYSTL_EXPECT(matches_std(text, needle));
+  }
+  // 较长的文本与较大的集合：覆盖 rfind / find_last_of 的整块路径与 AVX2 查找表
+  for (int round = 0; round < 40; ++round) {
+    const std::size_t n = 64 + next_random() % 200;
+    const int alphabet = 2 + static_cast<int>(next_random() % 20);
+    const std::string text = random_text(n, alphabet);
+    const std::string needle = random_text(2 + next_random() % 11, alphabet);
+    MYSTL_EXPECT(matches_std(text, needle));
+  }
+});
+
+MYSTL_TEST(string_view_find_long_inputs, {
+  // 命中位置落在不同的 16/32 字节块与尾部
+  for (std::size_t n : {15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 200u}) {
+    for (std::size_t at = 0; at < n; at += 7) {
+      std::string text(n, 'x');
+      text[at] = 'y';
+      const mystl::string_view v(text.data(), text.size());
+      MYSTL_EXPECT_EQ(v.find('y'), at);
+      MYSTL_EXPECT_EQ(v.rfind('y'), at);
+      MYSTL_EXPECT_EQ(v.find_first_of("yz"), at);
+      MYSTL_EXPECT_EQ(v.find_first_of("abcdefghijkly"), at);
+      MYSTL_EXPECT_EQ(v.find_first_not_of('x'), at);
+      MYSTL_EXPECT_EQ(v.find_first_not_of("xabcdefghijklmn"), at);
+      MYSTL_EXPECT_EQ(v.find_last_of("yz"), at);
+      MYSTL_EXPECT_EQ(v.find_last_of("abcdefghijkly"), at);
+      MYSTL_EXPECT_EQ(v.find_last_not_of('x'), at);
+      MYSTL_EXPECT_EQ(v.find_last_not_of("xabcdefghijklmn"), at);
+      if (at + 3 <= n) {
+        text[at + 1] = 'z';
+        text[at + 2] = 'y';
+        const mystl::string_view w(text.data(), text.size());
+        MYSTL_EXPECT_EQ(w.find("yzy"), at);
+        MYSTL_EXPECT_EQ(w.rfind("yzy"), at);
+        MYSTL_EXPECT_EQ(w.rfind("yz"), at);
+      }
+    }
+  }
+});
+
+#if MYSTL_HAS_AVX2 || MYSTL_HAS_AVX2_DISPATCH
+MYSTL_TEST(string_view_avx2_find_char_short_inputs, {
+  if (!mystl::__details::cpu_has_avx2()) {
+    return;
+  }
+  // 直接调用 AVX2 内核：不足 32 字节时不能向缓冲区之前重叠读取
+  for (std::size_t n = 0; n < 40; ++n) {
+    std::unique_ptr<char[]> buf(new char[n == 0 ? 1 : n]);
+    std::fill_n(buf.get(), n, 'x');
+    MYSTL_EXPECT_EQ(mystl::__details::find_char_avx2(buf.get(), n, 'y'), mystl::__details::search_npos);
+    for (std::size_t at = 0; at < n; ++at) {
+      buf[at] = 'y';
+      MYSTL_EXPECT_EQ(mystl::__details::find_char_avx2(buf.get(), n, 'y'), at);
+      buf[at] = 'x';
+    }
+  }
+});
+#endif
+
+MYSTL_TEST(string_view_high_bytes_in_sets, {
+  std::string text(80, 'a');
+  text[50] = static_cast<char>(0xE9);
+  text[70] = static_cast<char>(0x80);
+  const mystl::string_view v(text.data(), text.size());
+  const char set[] = {static_cast<char>(0x80), static_cast<char>(0xE9), 'z'};
+  MYSTL_EXPECT_EQ(v.find_first_of(mystl::string_view(set, 3)), 50u);
+  MYSTL_EXPECT_EQ(v.find_last_of(mystl::string_view(set, 3)), 70u);
+  MYSTL_EXPECT_EQ(v.find_first_not_of("a"), 50u);
+  const std::string high(40, static_cast<char>(0xFF));
+  MYSTL_EXPECT_EQ(mystl::string_view(high.data(), high.size()).find_first_not_of(mystl::string_view(set, 3)), 0u);
+});
+
+MYSTL_TEST(string_find_delegates_to_view, {
+  mystl::string s("GET /index.html HTTP/1.1\r\nHost: example.com\r\n");
+  MYSTL_EXPECT_EQ(s.find("\r\n"), 24u);
+  MYSTL_EXPECT_EQ(s.rfind("\r\n"), 43u);
+  MYSTL_EXPECT_EQ(s.find_first_of(" :"), 3u);
+  MYSTL_EXPECT_EQ(s.find(':'), 30u);
+  MYSTL_EXPECT(s.contains("Host"));
+  mystl::string_view view = s;
+  MYSTL_EXPECT(view.starts_with("GET"));
+  MYSTL_EXPECT(s == view);
+  mystl::string copy(view.substr(4, 11));
+  MYSTL_EXPECT(copy == "/index.html");
+  copy += "?q"_sv;
+  MYSTL_EXPECT(copy.ends_with("?q"_sv));
+});
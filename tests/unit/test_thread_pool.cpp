@@ -0,0 +1,96 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/execution/policy.hpp"
+#include "mystl/execution/thread_pool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+namespace {
+
+// 递归 fork-join 求 [lo, hi) 之和，叶子 64 个
+std::uint64_t parallel_sum(mystl::execution::thread_pool& pool, std::uint64_t lo, std::uint64_t hi) {
+  if (hi - lo <= 64) {
+    std::uint64_t s = 0;
+    for (std::uint64_t i = lo; i < hi; ++i) {
+      s += i;
+    }
+    return s;
+  }
+  const std::uint64_t mid = lo + (hi - lo) / 2;
+  std::uint64_t left = 0;
+  std::uint64_t right = 0;
+  pool.invoke([&] { left = parallel_sum(pool, lo, mid); }, [&] { right = parallel_sum(pool, mid, hi); });
+  return left + right;
+}
+
+}  // namespace
+
+MYSTL_TEST(thread_pool_fork_join, {
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{3}, std::size_t{8}}) {
+    mystl::execution::thread_pool pool(threads);
+    MYSTL_EXPECT_EQ(pool.size(), threads);
+    MYSTL_EXPECT(!pool.in_pool());
+    // 池外调用 invoke 会经由 run 进入池
+    MYSTL_EXPECT_EQ(parallel_sum(pool, 0, 100000), std::uint64_t{100000} * 99999 / 2);
+
+    bool inside = false;
+    pool.run([&] { inside = pool.in_pool(); });
+    MYSTL_EXPECT(inside);
+  }
+  mystl::execution::thread_pool empty(0);
+  MYSTL_EXPECT_EQ(empty.size(), std::size_t{1});
+});
+
+MYSTL_TEST(thread_pool_concurrent_submitters, {
+  mystl::execution::thread_pool pool(4);
+  std::atomic<int> ok{0};
+  std::thread a([&] { ok += parallel_sum(pool, 0, 50000) == std::uint64_t{50000} * 49999 / 2; });
+  std::thread b([&] { ok += parallel_sum(pool, 0, 70000) == std::uint64_t{70000} * 69999 / 2; });
+  a.join();
+  b.join();
+  MYSTL_EXPECT_EQ(ok.load(), 2);
+});
+
+MYSTL_TEST(thread_pool_propagates_exceptions, {
+  mystl::execution::thread_pool pool(3);
+  bool caught = false;
+  try {
+    pool.invoke([] {}, [] { throw std::runtime_error("b"); });
+  } catch (const std::runtime_error& e) {
+    caught = std::string_view(e.what()) == "b";
+  }
+  MYSTL_EXPECT(caught);
+
+  // 两侧都抛出时保留 a 的异常，并且 b 已经结束
+  std::atomic<bool> b_finished{false};
+  caught = false;
+  try {
+    pool.invoke([] { throw std::logic_error("a"); },
+                [&] {
+                  b_finished = true;
+                  throw std::runtime_error("b");
+                });
+  } catch (const std::logic_error&) {
+    caught = true;
+  }
+  MYSTL_EXPECT(caught);
+  MYSTL_EXPECT(b_finished.load());
+
+  // 异常之后池仍可用
+  MYSTL_EXPECT_EQ(parallel_sum(pool, 0, 1000), std::uint64_t{1000} * 999 / 2);
+});
+
+MYSTL_TEST(execution_policy_traits, {
+  static_assert(mystl::execution::is_execution_policy_v<mystl::execution::sequenced_policy>);
+  static_assert(mystl::execution::is_execution_policy_v<mystl::execution::parallel_policy>);
+  static_assert(!mystl::execution::is_execution_policy_v<int>);
+  static_assert(mystl::execution::execution_policy<const mystl::execution::parallel_policy&>);
+  mystl::execution::thread_pool pool(2);
+  MYSTL_EXPECT(&mystl::execution::par.on(pool).pool() == &pool);
+  MYSTL_EXPECT(&mystl::execution::par.pool() == &mystl::execution::thread_pool::default_pool());
+});
@@ -0,0 +1,222 @@
+#include "tests/framework/mystl_test.hpp"
+
+#include "mystl/containers/utf8.hpp"
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+using mystl_test::next_random;
+
+using mystl::string_view;
+
+string_view sv(const std::string& s) { return string_view(s.data(), s.size()); }
+
+// 逐码点的参考实现：只用区间判断，与向量内核完全独立
+bool reference_valid(const std::string& s) {
+  std::size_t i = 0;
+  const auto at = [&](std::size_t k) { return static_cast<unsigned char>(s[k]); };
+  const auto cont = [&](std::size_t k, unsigned lo = 0x80, unsigned hi = 0xBF) {
+    return k < s.size() && at(k) >= lo && at(k) <= hi;
+  };
+  while (i < s.size()) {
+    const unsigned b = at(i);
+    if (b <= 0x7F) {
+      i += 1;
+    } else if (b >= 0xC2 && b <= 0xDF && cont(i + 1)) {
+      i += 2;
+    } else if (b == 0xE0 && cont(i + 1, 0xA0) && cont(i + 2)) {
+      i += 3;
+    } else if (((b >= 0xE1 && b <= 0xEC) || b == 0xEE || b == 0xEF) && cont(i + 1) && cont(i + 2)) {
+      i += 3;
+    } else if (b == 0xED && cont(i + 1, 0x80, 0x9F) && cont(i + 2)) {
+      i += 3;
+    } else if (b == 0xF0 && cont(i + 1, 0x90) && cont(i + 2) && cont(i + 3)) {
+      i += 4;
+    } else if (b >= 0xF1 && b <= 0xF3 && cont(i + 1) && cont(i + 2) && cont(i + 3)) {
+      i += 4;
+    } else if (b == 0xF4 && cont(i + 1, 0x80, 0x8F) && cont(i + 2) && cont(i + 3)) {
+      i += 4;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string random_mixed(std::size_t code_points) {
+  std::string s;
+  for (std::size_t k = 0; k < code_points; ++k) {
+    char32_t cp;
+    const auto r = static_cast<char32_t>(next_random());
+    switch (r % 8) {
+      case 0:
+        cp = 0x80 + (r >> 3) % 0x780;
+        break;
+      case 1:
+        cp = 0x800 + (r >> 3) % 0xF800;
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+          cp = 0x4E2D;
+        }
+        break;
+      case 2:
+        cp = 0x10000 + (r >> 3) % 0x100000;
+        break;
+      default:
+        cp = 0x20 + (r >> 3) % 0x5F;
+    }
+    char buf[4];
+    s.append(buf, static_cast<std::size_t>(mystl::__details::utf8_encode(cp, buf)));
+  }
+  return s;
+}
+
+}  // namespace
+
+MYSTL_TEST(utf8_validate_known_sequences, {
+  MYSTL_EXPECT(mystl::utf8::validate(""));
+  MYSTL_EXPECT(mystl::utf8::validate("plain ascii"));
+  MYSTL_EXPECT(mystl::utf8::validate("\xC2\xA9 \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80"));
+  MYSTL_EXPECT(mystl::utf8::validate("\xEF\xBF\xBF\xF4\x8F\xBF\xBF"));  // U+FFFF、U+10FFFF
+
+  const char* invalid[] = {
+      "\x80",              // 孤立的续字节
+      "\xC0\xAF",          // 过长的 '/'
+      "\xC1\xBF",          // 过长
+      "\xE0\x80\xAF",      // 三字节过长
+      "\xED\xA0\x80",      // 代理区 U+D800
+      "\xF0\x8F\xBF\xBF",  // 四字节过长
+      "\xF4\x90\x80\x80",  // U+110000
+      "\xF5\x80\x80\x80",  // 非法首字节
+      "\xC2",              // 截断
+      "\xE4\xB8",          // 截断
+      "\xF0\x9F\x98",      // 截断
+      "\xC2\x41",          // 缺少续字节
+      "\xFF",
+  };
+  for (const char* s : invalid) {
+    MYSTL_EXPECT(!mystl::utf8::validate(s));
+    // 同一序列放在长 ASCII 文本中的各个位置，覆盖块边界与尾部
+    for (std::size_t pos : {0u, 15u, 30u, 31u, 32u, 62u, 63u, 64u, 100u}) {
+      std::string text(130, 'a');
+      text.insert(pos, s);
+      MYSTL_EXPECT(!mystl::utf8::validate(sv(text)));
+      MYSTL_EXPECT_EQ(mystl::utf8::first_invalid(sv(text)), pos);
+    }
+    // 放在末尾：截断序列只能靠结尾检查发现
+    std::string tail(64 - std::string(s).size(), 'a');
+    tail += s;
+    MYSTL_EXPECT(!mystl::utf8::validate(sv(tail)));
+  }
+  MYSTL_EXPECT_EQ(mystl::utf8::first_invalid("ok"), mystl::utf8::npos);
+});
+
+MYSTL_TEST(utf8_validate_matches_reference, {
+  // 所有两字节组合，以及嵌入在块边界附近的三字节组合
+  for (unsigned a = 0; a < 256; ++a) {
+    for (unsigned b = 0; b < 256; ++b) {
+      std::string s{static_cast<char>(a), static_cast<char>(b)};
+      MYSTL_EXPECT_EQ(mystl::utf8::validate(sv(s)), reference_valid(s));
+    }
+  }
+  for (unsigned a = 0xE0; a < 0x100; ++a) {
+    for (unsigned b = 0x70; b < 0xD0; ++b) {
+      std::string s(30, 'x');
+      s += {static_cast<char>(a), static_cast<char>(b), '\x80', '\x80', 'y'};
+      MYSTL_EXPECT_EQ(mystl::utf8::validate(sv(s)), reference_valid(s));
+    }
+  }
+
+  // 合法文本上的随机单字节变异
+  for (int round = 0; round < 3000; ++round) {
+    std::string s = random_mixed(1 + next_random() % 120);
+    if (round % 2 == 0) {
+      s[next_random() % s.size()] = static_cast<char>(next_random());
+    }
+    const bool expected = reference_valid(s);
+    MYSTL_EXPECT_EQ(mystl::utf8::validate(sv(s)), expected);
+    MYSTL_EXPECT_EQ(mystl::utf8::first_invalid(sv(s)) == mystl::utf8::npos, expected);
+  }
+});
+
+MYSTL_TEST(utf8_count_and_lengths, {
+  MYSTL_EXPECT_EQ(mystl::utf8::count_code_points(""), 0u);
+  MYSTL_EXPECT_EQ(mystl::utf8::count_code_points("a\xC2\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80"), 4u);
+  MYSTL_EXPECT_EQ(mystl::utf8::utf16_length("a\xC2\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80"), 5u);
+
+  const std::string s = random_mixed(5000);
+  std::vector<char32_t> u32(s.size());
+  const auto r32 = mystl::utf8::to_utf32(sv(s), u32);
+  MYSTL_EXPECT(r32.ec == std::errc{});
+  MYSTL_EXPECT_EQ(r32.written, 5000u);
+  MYSTL_EXPECT_EQ(mystl::utf8::count_code_points(sv(s)), 5000u);
+
+  std::vector<char16_t> u16(mystl::utf8::utf16_length(sv(s)));
+  const auto r16 = mystl::utf8::to_utf16(sv(s), u16);
+  MYSTL_EXPECT(r16.ec == std::errc{});
+  MYSTL_EXPECT_EQ(r16.written, u16.size());
+  MYSTL_EXPECT_EQ(mystl::utf8::utf8_length(mystl::span<const char16_t>(u16)), s.size());
+  MYSTL_EXPECT_EQ(mystl::utf8::utf8_length(mystl::span<const char32_t>(u32.data(), r32.written)), s.size());
+});
+
+MYSTL_TEST(utf8_transcode_round_trip, {
+  for (int round = 0; round < 200; ++round) {
+    const std::string s = round % 4 == 0 ? std::string(static_cast<std::size_t>(next_random() % 100), 'q')
+                                         : random_mixed(next_random() % 300);
+    std::vector<char16_t> u16(s.size() + 1);
+    std::vector<char32_t> u32(s.size() + 1);
+    std::string back16(s.size() + 1, '\0');
+    std::string back32(s.size() + 1, '\0');
+
+    const auto a = mystl::utf8::to_utf16(sv(s), u16);
+    const auto b = mystl::utf8::to_utf32(sv(s), u32);
+    MYSTL_EXPECT(a.ec == std::errc{} && b.ec == std::errc{});
+    MYSTL_EXPECT_EQ(a.read, s.size());
+
+    const auto c = mystl::utf8::from_utf16(mystl::span<const char16_t>(u16.data(), a.written), back16);
+    const auto d = mystl::utf8::from_utf32(mystl::span<const char32_t>(u32.data(), b.written), back32);
+    MYSTL_EXPECT(c.ec == std::errc{} && d.ec == std::errc{});
+    MYSTL_EXPECT(back16.substr(0, c.written) == s);
+    MYSTL_EXPECT(back32.substr(0, d.written) == s);
+  }
+});
+
+MYSTL_TEST(utf8_transcode_errors, {
+  // 非法输入：read 指向非法序列起点，之前的码点已写出
+  std::string bad(20, 'a');
+  bad += "\xE4\xB8\xAD\xED\xA0\x80tail";
+  std::vector<char16_t> u16(64);
+  auto r = mystl::utf8::to_utf16(sv(bad), u16);
+  MYSTL_EXPECT(r.ec == std::errc::illegal_byte_sequence);
+  MYSTL_EXPECT_EQ(r.read, 23u);
+  MYSTL_EXPECT_EQ(r.written, 21u);
+
+  // 输出不足：不写出半个代理对
+  char16_t small[2];
+  r = mystl::utf8::to_utf16("a\xF0\x9F\x98\x80", small);
+  MYSTL_EXPECT(r.ec == std::errc::value_too_large);
+  MYSTL_EXPECT_EQ(r.read, 1u);
+  MYSTL_EXPECT_EQ(r.written, 1u);
+
+  const char16_t lone_high[] = {u'x', 0xD83D, u'y'};
+  char out[16];
+  auto w = mystl::utf8::from_utf16(lone_high, out);
+  MYSTL_EXPECT(w.ec == std::errc::illegal_byte_sequence);
+  MYSTL_EXPECT_EQ(w.read, 1u);
+  const char16_t lone_low[] = {0xDE00};
+  MYSTL_EXPECT(mystl::utf8::from_utf16(lone_low, out).ec == std::errc::illegal_byte_sequence);
+
+  const char32_t too_large[] = {U'a', 0x110000};
+  w = mystl::utf8::from_utf32(too_large, out);
+  MYSTL_EXPECT(w.ec == std::errc::illegal_byte_sequence);
+  MYSTL_EXPECT_EQ(w.read, 1u);
+
+  const char32_t wide[] = {0x4E2D, 0x6587};
+  char three[4];
+  w = mystl::utf8::from_utf32(wide, three);
+  MYSTL_EXPECT(w.ec == std::errc::value_too_large);
+  MYSTL_EXPECT_EQ(w.written, 3u);
+});